@@ -6,6 +6,11 @@
 
 #include "Traits.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <memory>
 #include <stdexcept>
 
 #if (!defined ISLITTLEENDIAN)
@@ -38,27 +43,88 @@ public:
     ///
     enum class ModeValue {
         Serializing,                        /// The `Archive` instance is being used to serialize data
-        Deserializing                       /// The `Archive` instance is being used to deserialize data
+        Deserializing,                      /// The `Archive` instance is being used to deserialize data
+        Sizing                              /// The `Archive` instance is calculating the size of serialized data without writing it (see `Archive::Serialize`)
+    };
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \enum          LayoutValue
+    ///  \brief         Indicates how objects should lay out their data when
+    ///                 serializing.
+    ///
+    enum class LayoutValue {
+        Standard,                           /// Data is written in a form that is deserialized into owning containers
+        Flat,                               /// Objects that support it write lookup tables in a position-independent form that can be used in place (for example, from a memory-mapped file) when deserialized
+        Compact                             /// Objects that support it write lookup tables with variable-length integers and front-coded keys (see CompactEncoding.h) to minimize the size of the serialized data
     };
 
     using ByteArray                         = std::vector<unsigned char>;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \typedef       BufferOwnerPtr
+    ///  \brief         Keeps a deserialization buffer alive; objects that
+    ///                 reference the buffer in place retain a copy.
+    ///
+    using BufferOwnerPtr                    = std::shared_ptr<void const>;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \typedef       SinkFunc
+    ///  \brief         Receives serialized data in chunks; used to stream data
+    ///                 to a file or other destination rather than accumulating
+    ///                 it in memory.
+    ///
+    using SinkFunc                          = std::function<void (unsigned char const *pBuffer, size_t cbBuffer)>;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \typedef       SourceFunc
+    ///  \brief         Populates `pBuffer` with up to `cbBuffer` bytes of
+    ///                 serialized data and returns the number of bytes written;
+    ///                 0 indicates that all the data has been read.
+    ///
+    using SourceFunc                        = std::function<size_t (unsigned char *pBuffer, size_t cbBuffer)>;
+
+    static size_t constexpr                 DefaultChunkSize = 64 * 1024;
+
     // ----------------------------------------------------------------------
     // |
-    // |  Public Types
+    // |  Public Data
     // |
     // ----------------------------------------------------------------------
     ModeValue const                         Mode;
+    LayoutValue const                       Layout;
 
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    Archive(size_t cReservedSize=0);
+    Archive(size_t cReservedSize=0, LayoutValue layout=LayoutValue::Standard);
     Archive(ByteArray data);
     Archive(unsigned char const *pBuffer, size_t cbBuffer);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Archive
+    ///  \brief         Deserializes data from a buffer that is kept alive by
+    ///                 `pBufferOwner`.
+    ///
+    Archive(unsigned char const *pBuffer, size_t cbBuffer, BufferOwnerPtr pBufferOwner);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Archive
+    ///  \brief         Serializes data to `sink` in chunks of (at least)
+    ///                 `cbChunkSize` bytes; no more than a single chunk is
+    ///                 buffered in memory. `commit` must be called to write the
+    ///                 final chunk.
+    ///
+    Archive(SinkFunc sink, size_t cbChunkSize=DefaultChunkSize, LayoutValue layout=LayoutValue::Standard);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Archive
+    ///  \brief         Deserializes data read from `source` in chunks of (at
+    ///                 least) `cbChunkSize` bytes.
+    ///
+    Archive(SourceFunc source, size_t cbChunkSize=DefaultChunkSize);
+
     ~Archive(void) = default;
 
     Archive(Archive const &) = delete;
@@ -67,19 +133,92 @@ public:
     Archive(Archive &&) = default;
     Archive & operator =(Archive &&) = delete;
 
-    // Methods value when `Mode` is `ModeValue::Serializing`
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Serialize
+    ///  \brief         Invokes `func(Archive &)` with an archive in `ModeValue::Sizing`
+    ///                 mode to calculate the size of the serialized data, and
+    ///                 then again with an archive whose buffer is allocated
+    ///                 exactly once with that size.
+    ///
+    template <typename FuncT>
+    static ByteArray Serialize(FuncT const &func, LayoutValue layout=LayoutValue::Standard);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            SerializedSize
+    ///  \brief         Returns the number of bytes that `func(Archive &)` writes,
+    ///                 without writing them.
+    ///
+    template <typename FuncT>
+    static size_t SerializedSize(FuncT const &func, LayoutValue layout=LayoutValue::Standard);
+
+    // Methods value when `Mode` is `ModeValue::Serializing` or `ModeValue::Sizing`
     Archive & serialize(unsigned char const *pBuffer, size_t cBuffer);
     template <typename T> Archive & serialize(T const &value);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            serialize_items
+    ///  \brief         Serializes a contiguous range of arithmetic values; the
+    ///                 values are copied in bulk on little-endian hosts. The
+    ///                 result is the same as serializing each value individually.
+    ///
+    template <typename T> Archive & serialize_items(T const *pItems, size_t cItems);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            commit
+    ///  \brief         Returns the serialized data. When the archive was created
+    ///                 with a `SinkFunc`, any buffered data is written to the
+    ///                 sink and the returned buffer is empty.
+    ///
     ByteArray commit(void);
 
     // Methods valid when `Mode` is `ModeValue::Deserialzing`
     unsigned char const * get_buffer_ptr(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            get_buffer_ptr
+    ///  \brief         Returns a pointer to at least `cbRequired` contiguous
+    ///                 bytes, reading more data from the source if necessary.
+    ///                 The pointer is only valid until the next call that
+    ///                 deserializes data.
+    ///
+    unsigned char const * get_buffer_ptr(size_t cbRequired);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            get_buffer_size
+    ///  \brief         Returns the number of bytes that are available without
+    ///                 reading from the source; this is the number of bytes
+    ///                 remaining when the archive doesn't have a source.
+    ///
+    size_t get_buffer_size(void) const;
+
     Archive & update_buffer_ptr(size_t cDelta);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            get_buffer_owner
+    ///  \brief         Returns the object that keeps the buffer alive, or
+    ///                 an empty pointer if the buffer is borrowed (in which
+    ///                 case it may not be referenced after deserialization).
+    ///
+    BufferOwnerPtr const & get_buffer_owner(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            read_bytes
+    ///  \brief         Copies `cbBuffer` bytes into `pBuffer`, reading from the
+    ///                 source as necessary (without holding all of the bytes in
+    ///                 the archive's buffer at once).
+    ///
+    void read_bytes(unsigned char *pBuffer, size_t cbBuffer);
+
     template <typename T> T deserialize(void);
 
-    bool AtEnd(void) const;
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            deserialize_items
+    ///  \brief         Deserializes values written by `serialize_items` (or by
+    ///                 serializing each value individually) into `pItems`.
+    ///
+    template <typename T> Archive & deserialize_items(T *pItems, size_t cItems);
+
+    bool AtEnd(void);
 
 private:
     // ----------------------------------------------------------------------
@@ -88,20 +227,43 @@ private:
     // |
     // ----------------------------------------------------------------------
     ByteArray                               _buffer;
+    size_t                                  _cbSize;                // Used when `Mode` is `ModeValue::Sizing`
+    BufferOwnerPtr const                    _pBufferOwner;
+
+    SinkFunc const                          _sink;
+    SourceFunc const                        _source;
+    size_t const                            _cbChunkSize;           // Used with `_sink` or `_source`
 
     unsigned char const *                   _pBuffer;
-    unsigned char const * const             _pEndBuffer;
+    unsigned char const *                   _pEndBuffer;
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    struct SizingTag {};
+
+    Archive(SizingTag, LayoutValue layout);
+    Archive(std::shared_ptr<ByteArray const> const &pData);
+
+    void flush_sink(void);
+
+    /// Reads data from the source until at least `cbRequired` bytes are
+    /// available; returns false if the source is exhausted before then.
+    bool read_source(size_t cbRequired);
+
     template <typename T> Archive & serialize_impl(T const &value, std::true_type);
     template <typename T> Archive & serialize_impl(T const &value, std::false_type);
 
     template <typename T> T deserialize_impl(std::true_type);
     template <typename T> T deserialize_impl(std::false_type);
+
+    template <typename T> Archive & serialize_items_impl(T const *pItems, size_t cItems, std::true_type);
+    template <typename T> Archive & serialize_items_impl(T const *pItems, size_t cItems, std::false_type);
+
+    template <typename T> Archive & deserialize_items_impl(T *pItems, size_t cItems, std::true_type);
+    template <typename T> Archive & deserialize_items_impl(T *pItems, size_t cItems, std::false_type);
 };
 
 // ----------------------------------------------------------------------
@@ -113,8 +275,9 @@ private:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-inline Archive::Archive(size_t cReservedSize) :
+inline Archive::Archive(size_t cReservedSize, LayoutValue layout) :
     Mode(ModeValue::Serializing),
+    Layout(layout),
     _buffer(
         [&cReservedSize](void) -> ByteArray {
             ByteArray                       result;
@@ -125,19 +288,28 @@ inline Archive::Archive(size_t cReservedSize) :
             return result;
         }()
     ),
+    _cbSize(0),
+    _cbChunkSize(0),
     _pBuffer(nullptr),
     _pEndBuffer(nullptr) {
 }
 
 inline Archive::Archive(ByteArray data) :
-    Mode(ModeValue::Deserializing),
-    _buffer(std::move(data)),
-    _pBuffer(_buffer.data()),
-    _pEndBuffer(_pBuffer + _buffer.size()) {
+    // The data is shared so that objects can continue to reference it in place
+    // once the archive has been destroyed
+    Archive(std::make_shared<ByteArray const>(std::move(data))) {
 }
 
 inline Archive::Archive(unsigned char const *pBuffer, size_t cbBuffer) :
+    Archive(pBuffer, cbBuffer, BufferOwnerPtr()) {
+}
+
+inline Archive::Archive(unsigned char const *pBuffer, size_t cbBuffer, BufferOwnerPtr pBufferOwner) :
     Mode(ModeValue::Deserializing),
+    Layout(LayoutValue::Standard),
+    _cbSize(0),
+    _pBufferOwner(std::move(pBufferOwner)),
+    _cbChunkSize(0),
     _pBuffer(pBuffer),
     _pEndBuffer(_pBuffer + cbBuffer)
 {
@@ -145,15 +317,93 @@ inline Archive::Archive(unsigned char const *pBuffer, size_t cbBuffer) :
         throw std::invalid_argument("Invalid input buffer");
 }
 
+inline Archive::Archive(SinkFunc sink, size_t cbChunkSize, LayoutValue layout) :
+    Mode(ModeValue::Serializing),
+    Layout(layout),
+    _cbSize(0),
+    _sink(std::move(sink)),
+    _cbChunkSize(cbChunkSize),
+    _pBuffer(nullptr),
+    _pEndBuffer(nullptr) {
+    if(!_sink)
+        throw std::invalid_argument("Invalid sink");
+    if(_cbChunkSize == 0)
+        throw std::invalid_argument("Invalid chunk size");
+
+    _buffer.reserve(_cbChunkSize);
+}
+
+inline Archive::Archive(SourceFunc source, size_t cbChunkSize) :
+    Mode(ModeValue::Deserializing),
+    Layout(LayoutValue::Standard),
+    _cbSize(0),
+    _source(std::move(source)),
+    _cbChunkSize(cbChunkSize),
+    _pBuffer(nullptr),
+    _pEndBuffer(nullptr) {
+    if(!_source)
+        throw std::invalid_argument("Invalid source");
+    if(_cbChunkSize == 0)
+        throw std::invalid_argument("Invalid chunk size");
+}
+
+inline Archive::Archive(SizingTag, LayoutValue layout) :
+    Mode(ModeValue::Sizing),
+    Layout(layout),
+    _cbSize(0),
+    _cbChunkSize(0),
+    _pBuffer(nullptr),
+    _pEndBuffer(nullptr) {
+}
+
+inline Archive::Archive(std::shared_ptr<ByteArray const> const &pData) :
+    Archive(pData->empty() ? nullptr : pData->data(), pData->size(), pData) {
+}
+
+template <typename FuncT>
+/*static*/ Archive::ByteArray Archive::Serialize(FuncT const &func, LayoutValue layout) {
+    size_t const                            cbSize(SerializedSize(func, layout));
+    Archive                                 archive(cbSize, layout);
+
+    func(archive);
+
+    // The size is deterministic, so the buffer should never have been reallocated
+    assert(archive._buffer.size() == cbSize);
+
+    return archive.commit();
+}
+
+template <typename FuncT>
+/*static*/ size_t Archive::SerializedSize(FuncT const &func, LayoutValue layout) {
+    Archive                                 sizingArchive(SizingTag(), layout);
+
+    func(sizingArchive);
+    return sizingArchive._cbSize;
+}
+
 inline Archive & Archive::serialize(unsigned char const *pBuffer, size_t cBuffer) {
-    if(Mode != ModeValue::Serializing)
+    if(Mode == ModeValue::Deserializing)
         throw std::runtime_error("Invalid mode");
 
     if((pBuffer == nullptr && cBuffer != 0) || (pBuffer != nullptr && cBuffer == 0))
         throw std::invalid_argument("Invalid buffer");
 
-    std::copy(pBuffer, pBuffer + cBuffer, std::back_inserter(_buffer));
+    if(Mode == ModeValue::Sizing) {
+        _cbSize += cBuffer;
+        return *this;
+    }
+
+    if(_sink && _buffer.size() + cBuffer > _cbChunkSize) {
+        flush_sink();
+
+        // Large blocks are written directly rather than being copied into the buffer
+        if(cBuffer >= _cbChunkSize) {
+            _sink(pBuffer, cBuffer);
+            return *this;
+        }
+    }
 
+    _buffer.insert(_buffer.end(), pBuffer, pBuffer + cBuffer);
     return *this;
 }
 
@@ -166,14 +416,39 @@ inline Archive::ByteArray Archive::commit(void) {
     if(Mode != ModeValue::Serializing)
         throw std::runtime_error("Invalid mode");
 
+    if(_sink) {
+        flush_sink();
+        return ByteArray();
+    }
+
     return std::move(_buffer);
 }
 
+template <typename T>
+Archive & Archive::serialize_items(T const *pItems, size_t cItems) {
+    static_assert(std::is_arithmetic<T>::value && std::is_same<T, bool>::value == false, "T must be a non-bool arithmetic type");
+
+    if(pItems == nullptr && cItems != 0)
+        throw std::invalid_argument("Invalid items");
+
+    return serialize_items_impl(pItems, cItems, std::integral_constant<bool, ISLITTLEENDIAN>());
+}
+
 template <typename T>
 T Archive::deserialize(void) {
     return deserialize_impl<T>(std::integral_constant<bool, ISLITTLEENDIAN>());
 }
 
+template <typename T>
+Archive & Archive::deserialize_items(T *pItems, size_t cItems) {
+    static_assert(std::is_arithmetic<T>::value && std::is_same<T, bool>::value == false, "T must be a non-bool arithmetic type");
+
+    if(pItems == nullptr && cItems != 0)
+        throw std::invalid_argument("Invalid items");
+
+    return deserialize_items_impl(pItems, cItems, std::integral_constant<bool, ISLITTLEENDIAN>());
+}
+
 inline unsigned char const * Archive::get_buffer_ptr(void) const {
     if(Mode != ModeValue::Deserializing)
         throw std::runtime_error("Invalid mode");
@@ -184,6 +459,23 @@ inline unsigned char const * Archive::get_buffer_ptr(void) const {
     return _pBuffer;
 }
 
+inline unsigned char const * Archive::get_buffer_ptr(size_t cbRequired) {
+    if(Mode != ModeValue::Deserializing)
+        throw std::runtime_error("Invalid mode");
+
+    if(static_cast<size_t>(_pEndBuffer - _pBuffer) < cbRequired && read_source(cbRequired) == false)
+        throw std::runtime_error("Invalid buffer");
+
+    return get_buffer_ptr();
+}
+
+inline size_t Archive::get_buffer_size(void) const {
+    if(Mode != ModeValue::Deserializing)
+        throw std::runtime_error("Invalid mode");
+
+    return static_cast<size_t>(_pEndBuffer - _pBuffer);
+}
+
 inline Archive & Archive::update_buffer_ptr(size_t cDelta) {
     if(Mode != ModeValue::Deserializing)
         throw std::runtime_error("Invalid mode");
@@ -197,11 +489,96 @@ inline Archive & Archive::update_buffer_ptr(size_t cDelta) {
     return *this;
 }
 
-inline bool Archive::AtEnd(void) const {
+inline Archive::BufferOwnerPtr const & Archive::get_buffer_owner(void) const {
     if(Mode != ModeValue::Deserializing)
         throw std::runtime_error("Invalid mode");
 
-    return _pBuffer == _pEndBuffer;
+    return _pBufferOwner;
+}
+
+inline bool Archive::AtEnd(void) {
+    if(Mode != ModeValue::Deserializing)
+        throw std::runtime_error("Invalid mode");
+
+    return _pBuffer == _pEndBuffer && read_source(1) == false;
+}
+
+inline void Archive::flush_sink(void) {
+    if(_buffer.empty())
+        return;
+
+    _sink(_buffer.data(), _buffer.size());
+    _buffer.clear();
+}
+
+inline bool Archive::read_source(size_t cbRequired) {
+    if(!_source)
+        return false;
+
+    size_t                                  cbAvailable(static_cast<size_t>(_pEndBuffer - _pBuffer));
+
+    // Move the data that hasn't been consumed to the beginning of the buffer
+    // (this must happen before the buffer is resized, as resizing may move it)
+    if(cbAvailable != 0 && _pBuffer != _buffer.data())
+        std::memmove(_buffer.data(), _pBuffer, cbAvailable);
+
+    size_t const                            cbCapacity(std::max(cbRequired, _cbChunkSize));
+
+    if(_buffer.size() < cbCapacity)
+        _buffer.resize(cbCapacity);
+
+    bool                                    result(true);
+
+    while(cbAvailable < cbRequired) {
+        size_t const                        cbRead(_source(_buffer.data() + cbAvailable, _buffer.size() - cbAvailable));
+
+        if(cbRead == 0) {
+            result = false;
+            break;
+        }
+
+        if(cbRead > _buffer.size() - cbAvailable)
+            throw std::runtime_error("Invalid source");
+
+        cbAvailable += cbRead;
+    }
+
+    _pBuffer = _buffer.data();
+    _pEndBuffer = _pBuffer + cbAvailable;
+
+    return result;
+}
+
+inline void Archive::read_bytes(unsigned char *pBuffer, size_t cbBuffer) {
+    if(Mode != ModeValue::Deserializing)
+        throw std::runtime_error("Invalid mode");
+
+    if(!_source) {
+        if(static_cast<size_t>(_pEndBuffer - _pBuffer) < cbBuffer)
+            throw std::runtime_error("Invalid buffer");
+
+        if(cbBuffer != 0) {
+            std::memcpy(pBuffer, _pBuffer, cbBuffer);
+            _pBuffer += cbBuffer;
+        }
+
+        return;
+    }
+
+    // Copy the data a chunk at a time so that large blocks don't have to be
+    // held in the buffer in their entirety
+    while(cbBuffer != 0) {
+        if(_pBuffer == _pEndBuffer && read_source(1) == false)
+            throw std::runtime_error("Invalid buffer");
+
+        size_t const                        cbToCopy(std::min(cbBuffer, static_cast<size_t>(_pEndBuffer - _pBuffer)));
+
+        std::memcpy(pBuffer, _pBuffer, cbToCopy);
+
+        _pBuffer += cbToCopy;
+        pBuffer += cbToCopy;
+        cbBuffer -= cbToCopy;
+    }
 }
 
 // ----------------------------------------------------------------------
@@ -237,15 +614,10 @@ template <typename T>
 T Archive::deserialize_impl(std::true_type) {
     static_assert(std::is_pod<T>::value, "T must be a POD");
 
-    if(Mode != ModeValue::Deserializing)
-        throw std::runtime_error("Invalid mode");
-
-    if(static_cast<size_t>(_pEndBuffer - _pBuffer) < sizeof(T))
-        throw std::runtime_error("Invalid buffer");
+    typename std::remove_cv<T>::type        value;
 
-    T                                       value(*reinterpret_cast<T const *>(_pBuffer));
-
-    _pBuffer += sizeof(T);
+    // The buffer isn't guaranteed to be aligned
+    read_bytes(reinterpret_cast<unsigned char *>(&value), sizeof(T));
     return value;
 }
 
@@ -254,5 +626,42 @@ T Archive::deserialize_impl(std::false_type) {
     return swap_endian<T>(deserialize_impl<T>(std::true_type()));
 }
 
+template <typename T>
+Archive & Archive::serialize_items_impl(T const *pItems, size_t cItems, std::true_type) {
+    if(cItems == 0)
+        return *this;
+
+    return serialize(reinterpret_cast<unsigned char const *>(pItems), cItems * sizeof(T));
+}
+
+template <typename T>
+Archive & Archive::serialize_items_impl(T const *pItems, size_t cItems, std::false_type) {
+    T const * const                         pEndItems(pItems + cItems);
+
+    while(pItems != pEndItems)
+        serialize(*pItems++);
+
+    return *this;
+}
+
+template <typename T>
+Archive & Archive::deserialize_items_impl(T *pItems, size_t cItems, std::true_type) {
+    if(cItems > std::numeric_limits<size_t>::max() / sizeof(T))
+        throw std::runtime_error("Invalid buffer");
+
+    read_bytes(reinterpret_cast<unsigned char *>(pItems), cItems * sizeof(T));
+    return *this;
+}
+
+template <typename T>
+Archive & Archive::deserialize_items_impl(T *pItems, size_t cItems, std::false_type) {
+    T * const                               pEndItems(pItems + cItems);
+
+    while(pItems != pEndItems)
+        *pItems++ = deserialize<T>();
+
+    return *this;
+}
+
 } // namespace Featurizer
 } // namespace Microsoft
@@ -0,0 +1,275 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "Archive.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Microsoft {
+namespace Featurizer {
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            SerializeVarint
+///  \brief         Writes an unsigned integer as a LEB128 variable-length
+///                 integer (7 bits per byte, least significant bits first).
+///
+void SerializeVarint(Archive &ar, std::uint64_t value);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            DeserializeVarint
+///  \brief         Reads an integer written by `SerializeVarint`.
+///
+std::uint64_t DeserializeVarint(Archive &ar);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            SerializeCompactIndexMap
+///  \brief         Writes a map of keys to `std::uint32_t` values in a form
+///                 that is typically several times smaller than the standard
+///                 serialization:
+///
+///                     - String keys are sorted and front-coded (each key is
+///                       written as the length of the prefix that it shares
+///                       with the previous key, followed by the remaining
+///                       characters).
+///                     - Integer keys are sorted and written as varint deltas.
+///                     - Values are written as zigzag varint deltas from the
+///                       previous value plus one, so that the dense indices
+///                       produced by `IndexMapEstimator` are all written as
+///                       single bytes.
+///
+///                 Other key types are written with `Traits<KeyT>`.
+///
+template <typename MapT>
+void SerializeCompactIndexMap(Archive &ar, MapT const &map);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            DeserializeCompactIndexMap
+///  \brief         Reads a map written by `SerializeCompactIndexMap`.
+///
+template <typename MapT>
+MapT DeserializeCompactIndexMap(Archive &ar);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        CompactKeyTraits
+///  \brief         Writes and reads keys relative to the previous key. Keys
+///                 are only sorted before they are written when `IsSorted`
+///                 is true.
+///
+template <
+    typename T,
+    int CategoryV=std::is_same<T, std::string>::value ? 2 : (std::is_integral<T>::value && std::is_same<T, bool>::value == false) ? 1 : 0
+>
+struct CompactKeyTraits {
+    static bool constexpr                   IsSorted = false;
+
+    static T Initial(void) {
+        return T();
+    }
+
+    static void Serialize(Archive &ar, T const &key, T const &) {
+        Traits<T>::serialize(ar, key);
+    }
+
+    static T Deserialize(Archive &ar, T const &) {
+        return Traits<T>::deserialize(ar);
+    }
+};
+
+template <typename T>
+struct CompactKeyTraits<T, 1> {
+    static bool constexpr                   IsSorted = true;
+
+    static T Initial(void) {
+        return std::numeric_limits<T>::lowest();
+    }
+
+    static void Serialize(Archive &ar, T const &key, T const &previous) {
+        // Unsigned arithmetic is well-defined for both signed and unsigned keys
+        SerializeVarint(ar, static_cast<std::uint64_t>(key) - static_cast<std::uint64_t>(previous));
+    }
+
+    static T Deserialize(Archive &ar, T const &previous) {
+        return static_cast<T>(static_cast<std::uint64_t>(previous) + DeserializeVarint(ar));
+    }
+};
+
+template <typename T>
+struct CompactKeyTraits<T, 2> {
+    static bool constexpr                   IsSorted = true;
+
+    static T Initial(void) {
+        return T();
+    }
+
+    static void Serialize(Archive &ar, std::string const &key, std::string const &previous) {
+        size_t const                        cMaxPrefix(std::min(key.size(), previous.size()));
+        size_t                              cPrefix(0);
+
+        while(cPrefix < cMaxPrefix && key[cPrefix] == previous[cPrefix])
+            ++cPrefix;
+
+        size_t const                        cSuffix(key.size() - cPrefix);
+
+        SerializeVarint(ar, cPrefix);
+        SerializeVarint(ar, cSuffix);
+
+        if(cSuffix != 0)
+            ar.serialize(reinterpret_cast<unsigned char const *>(key.data() + cPrefix), cSuffix);
+    }
+
+    static std::string Deserialize(Archive &ar, std::string const &previous) {
+        std::uint64_t const                 cPrefix(DeserializeVarint(ar));
+        std::uint64_t const                 cSuffix(DeserializeVarint(ar));
+
+        if(cPrefix > previous.size())
+            throw std::runtime_error("Invalid prefix");
+
+        std::string                         result(previous, 0, static_cast<size_t>(cPrefix));
+
+        if(cSuffix != 0) {
+            char const * const              pSuffix(reinterpret_cast<char const *>(ar.get_buffer_ptr(static_cast<size_t>(cSuffix))));
+
+            result.append(pSuffix, static_cast<size_t>(cSuffix));
+            ar.update_buffer_ptr(static_cast<size_t>(cSuffix));
+        }
+
+        return result;
+    }
+};
+
+inline std::uint64_t ZigZagEncode(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+inline std::int64_t ZigZagDecode(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+} // namespace Details
+
+inline void SerializeVarint(Archive &ar, std::uint64_t value) {
+    unsigned char                           buffer[10];
+    unsigned char *                         pBuffer(buffer);
+
+    while(value >= 0x80) {
+        *pBuffer++ = static_cast<unsigned char>(value | 0x80);
+        value >>= 7;
+    }
+
+    *pBuffer++ = static_cast<unsigned char>(value);
+
+    ar.serialize(buffer, static_cast<size_t>(pBuffer - buffer));
+}
+
+inline std::uint64_t DeserializeVarint(Archive &ar) {
+    std::uint64_t                           result(0);
+    unsigned int                            shift(0);
+
+    while(true) {
+        std::uint8_t const                  byte(ar.deserialize<std::uint8_t>());
+
+        // The 10th byte may only contain the most significant bit
+        if(shift == 63 && byte > 1)
+            throw std::runtime_error("Invalid varint");
+
+        result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+        if((byte & 0x80) == 0)
+            return result;
+
+        shift += 7;
+    }
+}
+
+template <typename MapT>
+void SerializeCompactIndexMap(Archive &ar, MapT const &map) {
+    using KeyTraits                         = Details::CompactKeyTraits<typename MapT::key_type>;
+    using value_type                        = typename MapT::value_type;
+
+    std::vector<value_type const *>         items;
+
+    items.reserve(map.size());
+
+    for(auto const &item : map)
+        items.emplace_back(&item);
+
+    if(KeyTraits::IsSorted) {
+        std::sort(
+            items.begin(),
+            items.end(),
+            [](value_type const *pItem1, value_type const *pItem2) {
+                return pItem1->first < pItem2->first;
+            }
+        );
+    }
+
+    SerializeVarint(ar, items.size());
+
+    typename MapT::key_type                 previousKey(KeyTraits::Initial());
+    std::int64_t                            expectedValue(0);
+
+    for(value_type const *pItem : items) {
+        KeyTraits::Serialize(ar, pItem->first, previousKey);
+        SerializeVarint(ar, Details::ZigZagEncode(static_cast<std::int64_t>(pItem->second) - expectedValue));
+
+        previousKey = pItem->first;
+        expectedValue = static_cast<std::int64_t>(pItem->second) + 1;
+    }
+}
+
+template <typename MapT>
+MapT DeserializeCompactIndexMap(Archive &ar) {
+    using KeyTraits                         = Details::CompactKeyTraits<typename MapT::key_type>;
+    using mapped_type                       = typename MapT::mapped_type;
+
+    std::uint64_t                           cItems(DeserializeVarint(ar));
+    MapT                                    result;
+
+    // Every item is at least 2 bytes (key and value), so don't trust a count that
+    // the remaining data can't hold; corrupt data would otherwise result in a huge
+    // allocation. Streaming archives only report the bytes currently buffered, in
+    // which case the map grows as items are read.
+    result.reserve(static_cast<size_t>(std::min<std::uint64_t>(cItems, ar.get_buffer_size() / 2)));
+
+    typename MapT::key_type                 previousKey(KeyTraits::Initial());
+    std::int64_t                            expectedValue(0);
+
+    while(cItems--) {
+        typename MapT::key_type             key(KeyTraits::Deserialize(ar, previousKey));
+        std::int64_t const                  value(expectedValue + Details::ZigZagDecode(DeserializeVarint(ar)));
+
+        if(value < 0 || static_cast<std::uint64_t>(value) > std::numeric_limits<mapped_type>::max())
+            throw std::runtime_error("Invalid value");
+
+        if(result.emplace(key, static_cast<mapped_type>(value)).second == false)
+            throw std::runtime_error("Invalid key");
+
+        previousKey = std::move(key);
+        expectedValue = value + 1;
+    }
+
+    return result;
+}
+
+} // namespace Featurizer
+} // namespace Microsoft
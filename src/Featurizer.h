@@ -4,12 +4,16 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <atomic>
+#include <cassert>
 #include <cstring>                          // For `strcmp`
 #include <memory>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include "FunctionRef.h"
 #include "Traits.h"
 
 #include "3rdParty/optional.h"
@@ -45,6 +49,44 @@ namespace Featurizer {
 // |  Forward Declarations
 class Archive; // Defined in Archive.h
 
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            AssignOutput
+///  \brief         Assigns a value to an item in a caller-provided output
+///                 buffer. Types that can't be move-assigned (for example,
+///                 those with const members) are destroyed and then
+///                 move-constructed in place.
+///
+template <typename T>
+inline void AssignOutput(T &output, T &&value, std::true_type /*is_move_assignable*/) {
+    output = std::move(value);
+}
+
+template <typename T>
+inline void AssignOutput(T &output, T &&value, std::false_type /*is_move_assignable*/) {
+    output.~T();
+    new (reinterpret_cast<void *>(&output)) T(std::move(value));
+}
+
+template <typename T>
+inline void AssignOutput(T &output, T &&value) {
+    AssignOutput(output, std::move(value), std::is_move_assignable<T>());
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            ExecuteSingle
+///  \brief         Invokes `executeFunc` with a callback that captures the
+///                 single result generated; an exception is thrown if
+///                 the number of results is not 1. The result is captured
+///                 without requiring that `TransformedT` be default
+///                 constructible.
+///
+template <typename TransformedT, typename ExecuteFuncT>
+TransformedT ExecuteSingle(ExecuteFuncT const &executeFunc);
+
+} // namespace Details
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         Transformer
 ///  \brief         Object that uses state to produce a result during
@@ -66,7 +108,11 @@ public:
 
     using Archive                       = Microsoft::Featurizer::Archive;
 
-    using CallbackFunction              = std::function<void (TransformedType)>;
+    using TransformerUniquePtr          = std::unique_ptr<Transformer<InputT, TransformedT>>;
+
+    // Callbacks are only valid for the duration of the call that they are passed to;
+    // results are passed by value so that they can be moved through each link in a chain.
+    using CallbackFunction              = FunctionRef<void (TransformedType)>;
 
     // ----------------------------------------------------------------------
     // |
@@ -85,6 +131,16 @@ public:
     ///
     void execute(InputType const &input, CallbackFunction const &callback);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute
+    ///  \brief         Transforms a batch of inputs, assigning exactly one
+    ///                 result for each input to the caller-provided output
+    ///                 buffer (which must contain `cInputs` constructed items). This
+    ///                 method should only be used with `Transformers` that
+    ///                 generate 1 output value for each input value.
+    ///
+    void execute(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs);
+
     /////////////////////////////////////////////////////////////////////////
     ///  \fn            flush
     ///  \brief         Flushes any remaining elements before the `Transformer`
@@ -92,6 +148,28 @@ public:
     ///
     void flush(CallbackFunction const &callback);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            is_stateless
+    ///  \brief         Returns true if `execute` doesn't modify any state within
+    ///                 the `Transformer`, meaning that a single instance may be
+    ///                 used to execute inputs concurrently on multiple threads.
+    ///                 The default implementation conservatively returns false.
+    ///
+    virtual bool is_stateless(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            clone
+    ///  \brief         Returns a new `Transformer` that has the trained state of
+    ///                 this `Transformer` and the stream state of a `Transformer`
+    ///                 that hasn't executed any inputs, so that each thread can
+    ///                 use its own instance when the `Transformer` isn't stateless.
+    ///                 Trained state is shared with the clone rather than copied
+    ///                 when possible. The default implementation returns nullptr,
+    ///                 indicating that cloning isn't supported (`CloneTransformer`
+    ///                 saves and restores the `Transformer` in this case).
+    ///
+    virtual TransformerUniquePtr clone(void) const;
+
     /////////////////////////////////////////////////////////////////////////
     ///  \fn            save
     ///  \brief         Saves the state of the object so it can be reconstructed
@@ -107,8 +185,26 @@ private:
     // ----------------------------------------------------------------------
     virtual void execute_impl(InputType const &input, CallbackFunction const &callback) = 0;
     virtual void flush_impl(CallbackFunction const &callback) = 0;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch_impl
+    ///  \brief         `execute` performs common parameter validation before invoking
+    ///                 this method. The default implementation invokes `execute_impl`
+    ///                 for each input; derived classes should override this method
+    ///                 so that a batch is processed with a single virtual dispatch.
+    ///
+    virtual void execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs);
 };
 
+/////////////////////////////////////////////////////////////////////////
+///  \fn            CloneTransformer
+///  \brief         Returns the result of `transformer.clone()` or, when the
+///                 `Transformer` doesn't support cloning, a `Transformer`
+///                 deserialized from the saved state of `transformer`.
+///
+template <typename TransformerT>
+std::unique_ptr<TransformerT> CloneTransformer(TransformerT const &transformer);
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         StandardTransformer
 ///  \brief         Most `Transformers` will generate a single transformed
@@ -142,6 +238,12 @@ public:
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(StandardTransformer);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute
+    ///  \brief         Returns the single result generated by the provided input.
+    ///                 The input is never copied and the result is constructed
+    ///                 directly in the caller's storage.
+    ///
     TransformedType execute(InputType &input);
     TransformedType execute(InputType const &input);
     using BaseType::execute;
@@ -153,6 +255,15 @@ private:
     // |
     // ----------------------------------------------------------------------
     void flush_impl(CallbackFunction const &callback) override;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            transform_impl
+    ///  \brief         Returns the single result generated by the provided input.
+    ///                 The default implementation captures the result produced
+    ///                 by `execute_impl`; derived classes should override this
+    ///                 method so that the result is returned directly.
+    ///
+    virtual TransformedType transform_impl(InputType const &input);
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -191,7 +302,6 @@ using AnnotationPtr                         = std::shared_ptr<Annotation>;
 // `Estimators` with the same name may generate different Annotations based on
 // the settings provided when it was constructed...
 using AnnotationPtrs                        = std::vector<AnnotationPtr>;
-// TODO: Updating the vector should be thread safe when executing the DAGs in parallel.
 
 namespace Details {
 
@@ -199,11 +309,160 @@ struct RawStringComparison {
     inline bool operator()(char const *p1, char const *p2) const { return strcmp(p1, p2) < 0; }
 };
 
+/////////////////////////////////////////////////////////////////////////
+///  \fn            AnnotationTypeId
+///  \brief         Returns a small integer that uniquely identifies the `Annotation`
+///                 type within the process. These values are used to index typed
+///                 `Annotation` slots, which avoids string comparisons and RTTI
+///                 when retrieving `Annotations`.
+///
+template <typename AnnotationT>
+size_t AnnotationTypeId(void);
+
 } // namespace Details
 
-// A single column supports `Annotations` from different `Estimators`...
-using AnnotationMap                         = std::map<char const *, AnnotationPtrs, Details::RawStringComparison>;
-// TODO: Updating the map should be thread safe when executing the DAGs in parallel.
+/////////////////////////////////////////////////////////////////////////
+///  \class         AnnotationMap
+///  \brief         A single column supports `Annotations` from different `Estimators`.
+///
+///                 `Estimators` that share a collection of column `Annotations` may be
+///                 trained on different threads. Readers never acquire a lock; they
+///                 see an immutable snapshot of the `Annotations` published at the
+///                 time of the read. Writers (which are infrequent, as `Annotations` are
+///                 generally published when an `Estimator` completes training) are
+///                 serialized, copy the current snapshot, and atomically publish the
+///                 updated version. A previous version is released once it has been
+///                 replaced and no reader holds it (readers hold a version for the
+///                 duration of a lookup or for as long as they keep a `SnapshotPtr`).
+///
+class AnnotationMap {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using Snapshot                          = std::map<char const *, AnnotationPtrs, Details::RawStringComparison>;
+    using SnapshotPtr                       = std::shared_ptr<Snapshot const>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    AnnotationMap(void);
+    ~AnnotationMap(void) = default;
+
+    AnnotationMap(AnnotationMap const &) = delete;
+    AnnotationMap & operator =(AnnotationMap const &) = delete;
+    AnnotationMap(AnnotationMap &&) = delete;
+    AnnotationMap & operator =(AnnotationMap &&) = delete;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            snapshot
+    ///  \brief         Returns the most recently published `Annotations`. The
+    ///                 snapshot will not change (and remains valid as long as the
+    ///                 pointer is held), even if `Annotations` are published by
+    ///                 other threads while it is being used.
+    ///
+    SnapshotPtr snapshot(void) const;
+
+    // Convenience methods that operate on the current snapshot. Iterators aren't provided, as
+    // they would be invalidated by `publish`; iterate the result of `snapshot` instead.
+    bool empty(void) const;
+    size_t size(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            get_typed
+    ///  \brief         Returns the first `Annotation` created by the named `Estimator`
+    ///                 that was published with the exact type `AnnotationT`, or nullptr
+    ///                 if no such `Annotation` exists. This lookup is an index into the
+    ///                 typed slots followed by a (generally single) name comparison.
+    ///
+    template <typename AnnotationT>
+    AnnotationT * get_typed(char const *name) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            publish
+    ///  \brief         Adds an `Annotation` created by the named `Estimator` and
+    ///                 publishes a new snapshot that includes it. The `Annotation`
+    ///                 is available via `get_typed` for the static type `AnnotationT`.
+    ///
+    template <typename AnnotationT>
+    void publish(char const *name, std::shared_ptr<AnnotationT> pAnnotation);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    struct TypedAnnotation {
+        char const *                        Name;
+        Annotation *                        pAnnotation;
+    };
+
+    using TypedAnnotations                  = std::vector<TypedAnnotation>;
+
+    struct Version : public std::enable_shared_from_this<Version> {
+        Snapshot                            Annotations;
+        std::vector<TypedAnnotations>       Slots;          // Indexed by `AnnotationTypeId`
+    };
+
+    using VersionPtr                        = std::shared_ptr<Version const>;
+    using VersionPtrs                       = std::vector<VersionPtr>;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \class         ReaderScope
+    ///  \brief         Prevents replaced versions from being released while a
+    ///                 reader is accessing the current version.
+    ///
+    class ReaderScope {
+    public:
+        ReaderScope(AnnotationMap const &map);
+        ~ReaderScope(void);
+
+        ReaderScope(ReaderScope const &) = delete;
+        ReaderScope & operator =(ReaderScope const &) = delete;
+
+        Version const & get(void) const;
+
+    private:
+        AnnotationMap const &               _map;
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::atomic<Version const *>            _pVersion;
+    mutable std::atomic<size_t>             _cReaders;
+
+    mutable std::mutex                      _publishMutex;
+    VersionPtr                              _pCurrentVersion;
+
+    // Versions that have been replaced but may still be accessed by readers
+    // that loaded them before they were replaced. They are released by `publish`
+    // or by the last active reader, whichever first finds that there aren't any
+    // readers.
+    mutable VersionPtrs                     _retiredVersions;
+    mutable std::atomic<bool>               _hasRetiredVersions;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void publish_impl(char const *name, AnnotationPtr pAnnotation, size_t typeId);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            release_retired_versions
+    ///  \brief         Releases the retired versions if there aren't any active
+    ///                 readers. `_publishMutex` must be locked by the caller.
+    ///
+    void release_retired_versions(void) const;
+};
 
 // An `Estimator` may support multiple columns...
 using AnnotationMaps                        = std::vector<AnnotationMap>;
@@ -278,9 +537,11 @@ protected:
     ///  \fn            add_annotation
     ///  \brief         Adds an `Annotation` to the specified column.
     ///
-    void add_annotation(AnnotationPtr pAnnotation, size_t colIndex) const;
+    template <typename AnnotationT>
+    void add_annotation(std::shared_ptr<AnnotationT> pAnnotation, size_t colIndex) const;
 
-    static void add_annotation(AnnotationMapsPtr const allColumnAnnotations, AnnotationPtr pAnnotation, size_t colIndex, char const *name);
+    template <typename AnnotationT>
+    static void add_annotation(AnnotationMapsPtr const allColumnAnnotations, std::shared_ptr<AnnotationT> pAnnotation, size_t colIndex, char const *name);
 
     /////////////////////////////////////////////////////////////////////////
     ///  \fn            get_annotation_impl
@@ -523,14 +784,183 @@ private:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 inline AnnotationMapsPtr CreateTestAnnotationMapsPtr(size_t numCols) {
-    AnnotationMaps                          maps;
+    return std::make_shared<AnnotationMaps>(numCols);
+}
 
-    if(numCols)
-        maps.resize(numCols);
+// ----------------------------------------------------------------------
+// |
+// |  AnnotationMap
+// |
+// ----------------------------------------------------------------------
+namespace Details {
+
+inline size_t NextAnnotationTypeId(void) {
+    static std::atomic<size_t>              nextId(0);
 
-    return std::make_shared<decltype(maps)>(std::move(maps));
+    return nextId++;
+}
+
+template <typename AnnotationT>
+size_t AnnotationTypeId(void) {
+    static size_t const                     id(NextAnnotationTypeId());
+
+    return id;
+}
+
+} // namespace Details
+
+inline AnnotationMap::AnnotationMap(void) :
+    _cReaders(0),
+    _pCurrentVersion(std::make_shared<Version>()),
+    _hasRetiredVersions(false) {
+    _pVersion.store(_pCurrentVersion.get());
+}
+
+inline AnnotationMap::SnapshotPtr AnnotationMap::snapshot(void) const {
+    ReaderScope const                       scope(*this);
+    VersionPtr                              pVersion(scope.get().shared_from_this());
+
+    return SnapshotPtr(pVersion, &pVersion->Annotations);
+}
+
+inline bool AnnotationMap::empty(void) const {
+    ReaderScope const                       scope(*this);
+
+    return scope.get().Annotations.empty();
+}
+
+inline size_t AnnotationMap::size(void) const {
+    ReaderScope const                       scope(*this);
+
+    return scope.get().Annotations.size();
+}
+
+template <typename AnnotationT>
+AnnotationT * AnnotationMap::get_typed(char const *name) const {
+    size_t const                            typeId(Details::AnnotationTypeId<AnnotationT>());
+    ReaderScope const                       scope(*this);
+    Version const &                         version(scope.get());
+
+    if(typeId >= version.Slots.size())
+        return nullptr;
+
+    // The `Annotation` is owned by every subsequent version, so it remains valid after
+    // this version is released.
+    for(TypedAnnotation const &typed : version.Slots[typeId]) {
+        if(typed.Name == name || strcmp(typed.Name, name) == 0)
+            return static_cast<AnnotationT *>(typed.pAnnotation);
+    }
+
+    return nullptr;
+}
+
+template <typename AnnotationT>
+void AnnotationMap::publish(char const *name, std::shared_ptr<AnnotationT> pAnnotation) {
+    static_assert(std::is_base_of<Annotation, AnnotationT>::value, "`AnnotationT` must be an `Annotation`");
+
+    publish_impl(name, std::move(pAnnotation), Details::AnnotationTypeId<AnnotationT>());
+}
+
+inline void AnnotationMap::publish_impl(char const *name, AnnotationPtr pAnnotation, size_t typeId) {
+    if(name == nullptr || *name == 0)
+        throw std::invalid_argument("name");
+    if(!pAnnotation)
+        throw std::invalid_argument("pAnnotation");
+
+    std::unique_lock<std::mutex>            lock(_publishMutex);
+
+    std::shared_ptr<Version>                pNew(std::make_shared<Version>());
+
+    pNew->Annotations = _pCurrentVersion->Annotations;
+    pNew->Slots = _pCurrentVersion->Slots;
+
+    if(typeId >= pNew->Slots.size())
+        pNew->Slots.resize(typeId + 1);
+
+    pNew->Slots[typeId].emplace_back(TypedAnnotation{name, pAnnotation.get()});
+    pNew->Annotations[name].emplace_back(std::move(pAnnotation));
+
+    _pVersion.store(pNew.get());
+
+    _retiredVersions.emplace_back(std::move(_pCurrentVersion));
+    _pCurrentVersion = std::move(pNew);
+
+    _hasRetiredVersions.store(true);
+
+    release_retired_versions();
+}
+
+inline void AnnotationMap::release_retired_versions(void) const {
+    // A reader registers itself before loading the current version; if there aren't any
+    // readers now, any reader that arrives later will load the current version (which can't
+    // be retired until the lock is released). Versions held via `SnapshotPtr` remain alive
+    // through their reference counts.
+    if(_cReaders.load() != 0)
+        return;
+
+    _retiredVersions.clear();
+    _hasRetiredVersions.store(false);
+}
+
+inline AnnotationMap::ReaderScope::ReaderScope(AnnotationMap const &map) :
+    _map(map) {
+    ++_map._cReaders;
+}
+
+inline AnnotationMap::ReaderScope::~ReaderScope(void) {
+    if(--_map._cReaders != 0 || _map._hasRetiredVersions.load() == false)
+        return;
+
+    // This was the last active reader, so the versions retired while it was active can be
+    // released. Readers never wait on a publisher; if one holds the lock, the versions are
+    // released by a later reader or publisher instead.
+    std::unique_lock<std::mutex>            lock(_map._publishMutex, std::try_to_lock);
+
+    if(lock.owns_lock())
+        _map.release_retired_versions();
+}
+
+inline AnnotationMap::Version const & AnnotationMap::ReaderScope::get(void) const {
+    return *_map._pVersion.load();
 }
 
+// ----------------------------------------------------------------------
+// |
+// |  Details
+// |
+// ----------------------------------------------------------------------
+namespace Details {
+
+template <typename TransformedT, typename ExecuteFuncT>
+TransformedT ExecuteSingle(ExecuteFuncT const &executeFunc) {
+    // We can't use nonstd::optional here, as it doesn't properly support move semantics (which
+    // becomes a problem for types that don't support copying).
+    TransformedT *                          pResult(reinterpret_cast<TransformedT *>(alloca(sizeof(TransformedT))));
+    size_t                                  cResults(0);
+
+    executeFunc(
+        [&pResult, &cResults](TransformedT &&result) {
+            if(cResults++ == 0)
+                new (reinterpret_cast<void *>(pResult)) TransformedT(std::move(result));
+        }
+    );
+
+    if(cResults != 1) {
+        if(cResults != 0)
+            pResult->~TransformedT();
+
+        throw std::runtime_error("This method should only be used with Transformers that generate 1 output value for each input value");
+    }
+
+    TransformedT                            result(std::move(*pResult));
+
+    pResult->~TransformedT();
+
+    return result;
+}
+
+} // namespace Details
+
 // ----------------------------------------------------------------------
 // |
 // |  Transformer
@@ -544,6 +974,20 @@ void Transformer<InputT, TransformedT>::execute(InputType const &input, Callback
     execute_impl(input, callback);
 }
 
+template <typename InputT, typename TransformedT>
+void Transformer<InputT, TransformedT>::execute(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) {
+    if(pInputs == nullptr)
+        throw std::invalid_argument("pInputs");
+
+    if(cInputs == 0)
+        throw std::invalid_argument("cInputs");
+
+    if(pOutputs == nullptr)
+        throw std::invalid_argument("pOutputs");
+
+    execute_batch_impl(pInputs, cInputs, pOutputs);
+}
+
 template <typename InputT, typename TransformedT>
 void Transformer<InputT, TransformedT>::flush(CallbackFunction const &callback) {
     if(!callback)
@@ -552,41 +996,78 @@ void Transformer<InputT, TransformedT>::flush(CallbackFunction const &callback)
     flush_impl(callback);
 }
 
+template <typename InputT, typename TransformedT>
+/*virtual*/ bool Transformer<InputT, TransformedT>::is_stateless(void) const {
+    return false;
+}
+
+template <typename InputT, typename TransformedT>
+/*virtual*/ typename Transformer<InputT, TransformedT>::TransformerUniquePtr Transformer<InputT, TransformedT>::clone(void) const {
+    return TransformerUniquePtr();
+}
+
 // ----------------------------------------------------------------------
 // |
-// |  StandardTransformer
+// |  CloneTransformer
 // |
 // ----------------------------------------------------------------------
+template <typename TransformerT>
+std::unique_ptr<TransformerT> CloneTransformer(TransformerT const &transformer) {
+    // ----------------------------------------------------------------------
+    using ArchiveType                       = typename TransformerT::Archive;
+    // ----------------------------------------------------------------------
+
+    typename TransformerT::TransformerUniquePtr         pClone(transformer.clone());
+
+    if(pClone) {
+        assert(dynamic_cast<TransformerT *>(pClone.get()) != nullptr);
+        return std::unique_ptr<TransformerT>(static_cast<TransformerT *>(pClone.release()));
+    }
+
+    ArchiveType                             archive(ArchiveType::Serialize([&transformer](ArchiveType &ar) { transformer.save(ar); }));
+
+    return std::unique_ptr<TransformerT>(new TransformerT(archive));
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
-typename StandardTransformer<InputT, TransformedT>::TransformedType StandardTransformer<InputT, TransformedT>::execute(InputType &input) {
-    // We can't use nonstd::optional here, as it doesn't properly support move semantics (which
-    // becomes a problem for types that don't support copying).
-    TransformedT *                          pResult(reinterpret_cast<TransformedT *>(alloca(sizeof(TransformedT))));
-    bool                                    isSet(false);
-
-    execute(
-        input,
-        [&pResult, &isSet](TransformedType r) {
-            assert(isSet == false);
-            new (reinterpret_cast<void *>(pResult)) TransformedT(std::move(r));
-            isSet = true;
-        }
-    );
+/*virtual*/ void Transformer<InputT, TransformedT>::execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) {
+    InputType const * const                 pEndInputs(pInputs + cInputs);
 
-    assert(isSet);
+    while(pInputs != pEndInputs) {
+        size_t                              cResults(0);
 
-    TransformedT                            result(std::move(*pResult));
+        execute_impl(
+            *pInputs,
+            [&pOutputs, &cResults](TransformedType &&result) {
+                if(cResults++ == 0)
+                    Details::AssignOutput(*pOutputs, std::move(result));
+            }
+        );
 
-    pResult->~TransformedT();
+        if(cResults != 1)
+            throw std::runtime_error("This method should only be used with Transformers that generate 1 output value for each input value");
 
-    return result;
+        ++pInputs;
+        ++pOutputs;
+    }
 }
 
+// ----------------------------------------------------------------------
+// |
+// |  StandardTransformer
+// |
+// ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
-typename StandardTransformer<InputT, TransformedT>::TransformedType StandardTransformer<InputT, TransformedT>::execute(InputType const &input) {
-    InputType                               value(input);
+typename StandardTransformer<InputT, TransformedT>::TransformedType StandardTransformer<InputT, TransformedT>::execute(InputType &input) {
+    return transform_impl(input);
+}
 
-    return execute(value);
+template <typename InputT, typename TransformedT>
+typename StandardTransformer<InputT, TransformedT>::TransformedType StandardTransformer<InputT, TransformedT>::execute(InputType const &input) {
+    return transform_impl(input);
 }
 
 // ----------------------------------------------------------------------
@@ -597,6 +1078,15 @@ void StandardTransformer<InputT, TransformedT>::flush_impl(CallbackFunction cons
     // This method doesn't do anything for StandardTransformers
 }
 
+template <typename InputT, typename TransformedT>
+/*virtual*/ typename StandardTransformer<InputT, TransformedT>::TransformedType StandardTransformer<InputT, TransformedT>::transform_impl(InputType const &input) {
+    return Details::ExecuteSingle<TransformedType>(
+        [this, &input](CallbackFunction const &callback) {
+            this->execute(input, callback);
+        }
+    );
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  Estimator
@@ -630,7 +1120,8 @@ inline Estimator::Estimator(char const *name, AnnotationMapsPtr pAllColumnAnnota
     ) {
 }
 
-/*static*/ inline void Estimator::add_annotation(AnnotationMapsPtr const allColumnAnnotations, AnnotationPtr pAnnotation, size_t colIndex, char const *name) {
+template <typename AnnotationT>
+/*static*/ void Estimator::add_annotation(AnnotationMapsPtr const allColumnAnnotations, std::shared_ptr<AnnotationT> pAnnotation, size_t colIndex, char const *name) {
     if(!pAnnotation)
         throw std::invalid_argument("pAnnotation");
 
@@ -639,32 +1130,12 @@ inline Estimator::Estimator(char const *name, AnnotationMapsPtr pAllColumnAnnota
     if(colIndex >= allAnnotations.size())
         throw std::invalid_argument("colIndex");
 
-    AnnotationPtrs &                        annotations(
-        [&allAnnotations, &colIndex, &name](void) -> AnnotationPtrs & {
-            AnnotationMap &                 columnAnnotations(allAnnotations[colIndex]);
-
-            // TODO: Acquire read map lock
-            AnnotationMap::iterator const   iter(columnAnnotations.find(name));
-
-            if(iter != columnAnnotations.end())
-                return iter->second;
-
-            // TODO: Promote read lock to write lock
-            std::pair<AnnotationMap::iterator, bool> const result(columnAnnotations.emplace(std::make_pair(name, AnnotationPtrs())));
-
-            if(result.first == columnAnnotations.end() || result.second == false)
-                throw std::runtime_error("Invalid insertion");
-
-            return result.first->second;
-        }()
-    );
-
-    // TODO: Acquire vector read lock
-    annotations.emplace_back(std::move(pAnnotation));
+    allAnnotations[colIndex].publish(name, std::move(pAnnotation));
 }
 
-inline void Estimator::add_annotation(AnnotationPtr pAnnotation, size_t colIndex) const {
-    return add_annotation(_allColumnAnnotations, pAnnotation, colIndex, Name);
+template <typename AnnotationT>
+void Estimator::add_annotation(std::shared_ptr<AnnotationT> pAnnotation, size_t colIndex) const {
+    return add_annotation(_allColumnAnnotations, std::move(pAnnotation), colIndex, Name);
 }
 
 template <typename DerivedAnnotationT>
@@ -674,16 +1145,22 @@ DerivedAnnotationT * Estimator::get_annotation_impl(AnnotationMaps const &allAnn
     if(name == nullptr || *name == 0)
         throw std::invalid_argument("name");
 
-    AnnotationMap const &                   columnAnnotations(allAnnotations[colIndex]);
+    AnnotationMap const &                   columnAnnotationMap(allAnnotations[colIndex]);
 
-    // TODO: Acquire read map lock
-    AnnotationMap::const_iterator const     column_annotations_iter(columnAnnotations.find(name));
+    DerivedAnnotationT * const              pTypedAnnotation(columnAnnotationMap.get_typed<DerivedAnnotationT>(name));
+
+    if(pTypedAnnotation)
+        return pTypedAnnotation;
+
+    // The `Annotation` may have been published as a different (base or derived) type; search
+    // by name and use RTTI.
+    AnnotationMap::SnapshotPtr const        pColumnAnnotations(columnAnnotationMap.snapshot());
+    AnnotationMap::Snapshot const &         columnAnnotations(*pColumnAnnotations);
+    AnnotationMap::Snapshot::const_iterator const   column_annotations_iter(columnAnnotations.find(name));
 
     if(column_annotations_iter != columnAnnotations.end()) {
         AnnotationPtrs const &              annotations(column_annotations_iter->second);
 
-        // TODO: Acquire vector read lock
-
         for(auto const &annotation : annotations) {
             if(dynamic_cast<DerivedAnnotationT *>(annotation.get()) != nullptr)
                 return &static_cast<DerivedAnnotationT &>(*annotation);
@@ -54,6 +54,14 @@ public:
 
     void save(Archive &ar) const override;
 
+    // MSVC runs into problems when the declaration and definition are separated
+    typename BaseType::TransformerUniquePtr clone(void) const override {
+        if(!_defaultValue)
+            return typename BaseType::TransformerUniquePtr(new BackwardFillImputerTransformer());
+
+        return typename BaseType::TransformerUniquePtr(new BackwardFillImputerTransformer(*_defaultValue));
+    }
+
     bool operator==(BackwardFillImputerTransformer const &other) const;
 
 private:
@@ -83,6 +83,9 @@ public:
 
     void save(Archive &ar) const override;
 
+    // The current row is updated during each call to `execute`
+    bool is_stateless(void) const override;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -106,6 +109,10 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(IteratorRangeT const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(IteratorRangeT const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override;
+    typename BaseType::TransformedType transform_impl(IteratorRangeT const &input) override;
+
+    typename BaseType::TransformedType transform(IteratorRangeT const &input);
 
     void execute_impl(IteratorType &begin, IteratorType const &end, typename BaseType::CallbackFunction const &callback, std::true_type);
     void execute_impl(IteratorType &begin, IteratorType const &end, typename BaseType::CallbackFunction const &callback, std::false_type);
@@ -272,6 +279,11 @@ void NormalizeTransformer<IteratorRangeT>::save(Archive &ar) const /*override*/
     Traits<std::vector<std::double_t>>::serialize(ar, _norms);
 }
 
+template <typename IteratorRangeT>
+bool NormalizeTransformer<IteratorRangeT>::is_stateless(void) const /*override*/ {
+    return false;
+}
+
 template <typename IteratorRangeT>
 bool NormalizeTransformer<IteratorRangeT>::operator==(NormalizeTransformer const &other) const {
 
@@ -294,6 +306,24 @@ bool NormalizeTransformer<IteratorRangeT>::operator==(NormalizeTransformer const
 // ----------------------------------------------------------------------
 template <typename IteratorRangeT>
 void NormalizeTransformer<IteratorRangeT>::execute_impl(IteratorRangeT const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+template <typename IteratorRangeT>
+void NormalizeTransformer<IteratorRangeT>::execute_batch_impl(IteratorRangeT const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) /*override*/ {
+    IteratorRangeT const * const            pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs)
+        *pOutputs++ = transform(*pInputs++);
+}
+
+template <typename IteratorRangeT>
+typename NormalizeTransformer<IteratorRangeT>::BaseType::TransformedType NormalizeTransformer<IteratorRangeT>::transform_impl(IteratorRangeT const &input) /*override*/ {
+    return transform(input);
+}
+
+template <typename IteratorRangeT>
+typename NormalizeTransformer<IteratorRangeT>::BaseType::TransformedType NormalizeTransformer<IteratorRangeT>::transform(IteratorRangeT const &input) {
     // unpack input to two iterators
     IteratorType begin = std::get<0>(input);
     IteratorType const & end = std::get<1>(input);
@@ -317,7 +347,7 @@ void NormalizeTransformer<IteratorRangeT>::execute_impl(IteratorRangeT const &in
         ++begin;
     }
     ++_row;
-    callback(res);
+    return res;
 }
 
 
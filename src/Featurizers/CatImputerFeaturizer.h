@@ -9,9 +9,7 @@
 #include "../Traits.h"
 
 #include "Components/PipelineExecutionEstimatorImpl.h"
-#include "Components/HistogramEstimator.h"
 #include "Components/ModeEstimator.h"
-#include "Components/OrderEstimator.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -54,6 +52,7 @@ public:
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(CatImputerTransformer);
 
     void save(Archive &ar) const override;
+    bool is_stateless(void) const override;
 
 private:
     // ----------------------------------------------------------------------
@@ -62,6 +61,10 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) override;
+    TransformedType transform_impl(InputType const &input) override;
+
+    TransformedType transform(InputType const &input) const;
 };
 
 namespace Details {
@@ -117,7 +120,7 @@ private:
     typename BaseType::TransformerUniquePtr create_transformer_impl(void) override {
         // ----------------------------------------------------------------------
         using ModeAnnotationData            = Components::ModeAnnotationData<InputType>;
-        using ModeEstimator                 = Components::ModeEstimator<InputType, false, MaxNumTrainingItemsV>;
+        using ModeEstimator                 = Components::SinglePassModeEstimator<InputType, false, MaxNumTrainingItemsV>;
 
         using TheseTraits                   = Traits<InputType>;
         // ----------------------------------------------------------------------
@@ -141,9 +144,7 @@ template <
 >
 class CatImputerEstimator :
     public Components::PipelineExecutionEstimatorImpl<
-        Components::HistogramEstimator<typename MakeNullableType<TransformedT>::type, MaxNumTrainingItemsV>,
-        Components::OrderEstimator<typename MakeNullableType<TransformedT>::type, MaxNumTrainingItemsV>,
-        Components::ModeEstimator<typename MakeNullableType<TransformedT>::type, false, MaxNumTrainingItemsV>,
+        Components::SinglePassModeEstimator<typename MakeNullableType<TransformedT>::type, false, MaxNumTrainingItemsV>,
         Details::CatImputerEstimatorImpl<TransformedT, MaxNumTrainingItemsV>
     > {
 public:
@@ -154,9 +155,7 @@ public:
     // ----------------------------------------------------------------------
     using BaseType =
         Components::PipelineExecutionEstimatorImpl<
-            Components::HistogramEstimator<typename MakeNullableType<TransformedT>::type, MaxNumTrainingItemsV>,
-            Components::OrderEstimator<typename MakeNullableType<TransformedT>::type, MaxNumTrainingItemsV>,
-            Components::ModeEstimator<typename MakeNullableType<TransformedT>::type, false, MaxNumTrainingItemsV>,
+            Components::SinglePassModeEstimator<typename MakeNullableType<TransformedT>::type, false, MaxNumTrainingItemsV>,
             Details::CatImputerEstimatorImpl<TransformedT, MaxNumTrainingItemsV>
         >;
 
@@ -208,6 +207,11 @@ CatImputerTransformer<TransformedT>::CatImputerTransformer(Archive &ar) :
     ) {
 }
 
+template <typename TransformedT>
+bool CatImputerTransformer<TransformedT>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template <typename TransformedT>
 void CatImputerTransformer<TransformedT>::save(Archive &ar) const /*override*/ {
     // Version
@@ -223,14 +227,32 @@ void CatImputerTransformer<TransformedT>::save(Archive &ar) const /*override*/ {
 // ----------------------------------------------------------------------
 template <typename TransformedT>
 void CatImputerTransformer<TransformedT>::execute_impl(InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+template <typename TransformedT>
+void CatImputerTransformer<TransformedT>::execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) /*override*/ {
+    InputType const * const                 pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs)
+        *pOutputs++ = transform(*pInputs++);
+}
+
+template <typename TransformedT>
+typename CatImputerTransformer<TransformedT>::TransformedType CatImputerTransformer<TransformedT>::transform_impl(InputType const &input) /*override*/ {
+    return transform(input);
+}
+
+template <typename TransformedT>
+typename CatImputerTransformer<TransformedT>::TransformedType CatImputerTransformer<TransformedT>::transform(InputType const &input) const {
     // ----------------------------------------------------------------------
     using TheseTraits                       = Traits<InputType>;
     // ----------------------------------------------------------------------
 
     if(TheseTraits::IsNull(input))
-        callback(Value);
-    else
-        callback(TheseTraits::GetNullableValue(input));
+        return Value;
+
+    return TheseTraits::GetNullableValue(input);
 }
 
 // ----------------------------------------------------------------------
@@ -243,9 +265,7 @@ CatImputerEstimator<TransformedT, MaxNumTrainingItemsV>::CatImputerEstimator(Ann
     BaseType(
         "CatImputerEstimator",
         pAllColumnAnnotations,
-        [pAllColumnAnnotations, colIndex](void) { return Components::HistogramEstimator<typename MakeNullableType<TransformedT>::type, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
-        [pAllColumnAnnotations, colIndex](void) { return Components::OrderEstimator<typename MakeNullableType<TransformedT>::type, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
-        [pAllColumnAnnotations, colIndex](void) { return Components::ModeEstimator<typename MakeNullableType<TransformedT>::type, false, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
+        [pAllColumnAnnotations, colIndex](void) { return Components::SinglePassModeEstimator<typename MakeNullableType<TransformedT>::type, false, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
         [pAllColumnAnnotations, colIndex](void) { return Details::CatImputerEstimatorImpl<TransformedT, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); }
     ) {
 }
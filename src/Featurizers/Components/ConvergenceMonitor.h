@@ -0,0 +1,226 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../../Featurizer.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        ConvergenceOptions
+///  \brief         Criteria used to determine when the statistics tracked
+///                 by an `Estimator` have stabilized, at which point training
+///                 can be completed without seeing the remainder of the data.
+///
+struct ConvergenceOptions {
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    double const                            RelativeTolerance;  // Maximum relative change of each statistic between checks
+    std::uint64_t const                     CheckInterval;      // Number of items fit between checks
+    std::uint32_t const                     NumStableChecks;    // Number of consecutive checks within the tolerance required for convergence
+    std::uint64_t const                     MinNumItems;        // Minimum number of items fit before convergence is possible
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    ConvergenceOptions(double relativeTolerance, std::uint64_t checkInterval=10000, std::uint32_t numStableChecks=3, std::uint64_t minNumItems=0);
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(ConvergenceOptions);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ConvergenceMonitor
+///  \brief         Periodically compares statistics against the values seen
+///                 at the previous check and reports convergence once all of
+///                 them have changed by less than the relative tolerance for
+///                 the configured number of consecutive checks. The leading
+///                 `NumExactStatistics` statistics (typically counts) must not
+///                 change at all between checks.
+///
+class ConvergenceMonitor {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using Statistics                        = std::vector<double>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    ConvergenceOptions const                Options;
+    size_t const                            NumExactStatistics;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    ConvergenceMonitor(ConvergenceOptions options, size_t numExactStatistics=0);
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(ConvergenceMonitor);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            update
+    ///  \brief         Notes that `cItems` have been fit and returns true if the
+    ///                 statistics have converged. `getStatisticsFunc` is only
+    ///                 invoked when a check is due; it may return an empty
+    ///                 collection when statistics aren't available yet.
+    ///
+    template <typename GetStatisticsFuncT>
+    bool update(size_t cItems, GetStatisticsFuncT const &getStatisticsFunc);
+
+    bool has_converged(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::uint64_t                           _cItems;
+    std::uint64_t                           _cItemsSinceCheck;
+    std::uint32_t                           _cStableChecks;
+    Statistics                              _previous;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    bool is_stable(Statistics const &statistics) const;
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  ConvergenceOptions
+// |
+// ----------------------------------------------------------------------
+inline ConvergenceOptions::ConvergenceOptions(double relativeTolerance, std::uint64_t checkInterval, std::uint32_t numStableChecks, std::uint64_t minNumItems) :
+    RelativeTolerance(
+        [&relativeTolerance](void) -> double {
+            if(std::isnan(relativeTolerance) || relativeTolerance < 0.0)
+                throw std::invalid_argument("relativeTolerance");
+
+            return relativeTolerance;
+        }()
+    ),
+    CheckInterval(
+        [&checkInterval](void) -> std::uint64_t {
+            if(checkInterval == 0)
+                throw std::invalid_argument("checkInterval");
+
+            return checkInterval;
+        }()
+    ),
+    NumStableChecks(
+        [&numStableChecks](void) -> std::uint32_t {
+            if(numStableChecks == 0)
+                throw std::invalid_argument("numStableChecks");
+
+            return numStableChecks;
+        }()
+    ),
+    MinNumItems(minNumItems) {
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  ConvergenceMonitor
+// |
+// ----------------------------------------------------------------------
+inline ConvergenceMonitor::ConvergenceMonitor(ConvergenceOptions options, size_t numExactStatistics) :
+    Options(std::move(options)),
+    NumExactStatistics(numExactStatistics),
+    _cItems(0),
+    _cItemsSinceCheck(0),
+    _cStableChecks(0) {
+}
+
+template <typename GetStatisticsFuncT>
+bool ConvergenceMonitor::update(size_t cItems, GetStatisticsFuncT const &getStatisticsFunc) {
+    _cItems += cItems;
+    _cItemsSinceCheck += cItems;
+
+    if(_cItemsSinceCheck < Options.CheckInterval)
+        return has_converged();
+
+    _cItemsSinceCheck = 0;
+
+    Statistics                              statistics(getStatisticsFunc());
+
+    if(is_stable(statistics))
+        ++_cStableChecks;
+    else
+        _cStableChecks = 0;
+
+    _previous = std::move(statistics);
+
+    return has_converged();
+}
+
+inline bool ConvergenceMonitor::has_converged(void) const {
+    return _cStableChecks >= Options.NumStableChecks && _cItems >= Options.MinNumItems;
+}
+
+inline bool ConvergenceMonitor::is_stable(Statistics const &statistics) const {
+    if(statistics.empty() || statistics.size() != _previous.size())
+        return false;
+
+    for(size_t i = 0; i < statistics.size(); ++i) {
+        double const                        current(statistics[i]);
+        double const                        previous(_previous[i]);
+
+        if(i < NumExactStatistics) {
+            if(current != previous)
+                return false;
+
+            continue;
+        }
+
+        double const                        scale(std::max(std::abs(current), std::abs(previous)));
+
+        // Values that are both 0 haven't changed (scale is never negative)
+        if(scale <= 0.0)
+            continue;
+
+        if(std::isfinite(scale) == false || std::abs(current - previous) / scale > Options.RelativeTolerance)
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
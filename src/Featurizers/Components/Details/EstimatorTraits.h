@@ -72,6 +72,24 @@ struct IsTransformerEstimator {
     static_assert(IsTransformerEstimator<FitEstimator<char>>::value == false, "");
 #endif
 
+/////////////////////////////////////////////////////////////////////////
+///  \class         IsConcurrentTrainingEstimator
+///  \brief         Contains a constant value of true if the provided `Estimator`
+///                 can be trained at the same time as other `Estimators` that
+///                 consume the same input. These `Estimators` define:
+///
+///                     static constexpr bool const SupportsConcurrentTraining = true;
+///
+template <typename EstimatorT, typename EnableIfT=void>
+struct IsConcurrentTrainingEstimator {
+    static constexpr bool const             value = false;
+};
+
+template <typename EstimatorT>
+struct IsConcurrentTrainingEstimator<EstimatorT, typename std::enable_if<EstimatorT::SupportsConcurrentTraining>::type> {
+    static constexpr bool const             value = true;
+};
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         EstimatorOutputTypeImpl
 ///  \brief         Output type for `TransformerEstimator` objects.
@@ -4,7 +4,11 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <array>
+
 #include "EstimatorTraits.h"
+#include "../../../SPSCQueue.h"
+#include "../../../ThreadPool.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -12,6 +16,16 @@ namespace Featurizers {
 namespace Components {
 namespace Details {
 
+/////////////////////////////////////////////////////////////////////////
+///  \struct        CloneTag
+///  \brief         Selects the constructor that clones the `Transformers`
+///                 within a `TransformerChainElement`; stateless `Transformers`
+///                 are shared with the clone rather than cloned. `is_cloned`
+///                 returns false if any of the other `Transformers` don't
+///                 support cloning.
+///
+struct CloneTag {};
+
 namespace Impl {
 
 // ----------------------------------------------------------------------
@@ -72,6 +86,150 @@ struct ValidateEstimators<
     static constexpr bool const             value = true;
 };
 
+/////////////////////////////////////////////////////////////////////////
+///  \fn            TransformSingle
+///  \brief         Returns the single result generated by a `Transformer`.
+///                 `StandardTransformers` return the result directly; other
+///                 `Transformers` have their result captured from the callback.
+///
+template <typename TransformerT, typename InputT>
+typename TransformerT::TransformedType TransformSingle(TransformerT &transformer, InputT const &input, std::true_type /*is_standard_transformer*/) {
+    return transformer.execute(input);
+}
+
+template <typename TransformerT, typename InputT>
+typename TransformerT::TransformedType TransformSingle(TransformerT &transformer, InputT const &input, std::false_type /*is_standard_transformer*/) {
+    return Microsoft::Featurizer::Details::ExecuteSingle<typename TransformerT::TransformedType>(
+        [&transformer, &input](typename TransformerT::CallbackFunction const &callback) {
+            transformer.execute(input, callback);
+        }
+    );
+}
+
+template <typename TransformerT, typename InputT>
+typename TransformerT::TransformedType TransformSingle(TransformerT &transformer, InputT const &input) {
+    return TransformSingle(
+        transformer,
+        input,
+        std::is_base_of<
+            StandardTransformer<typename TransformerT::InputType, typename TransformerT::TransformedType>,
+            TransformerT
+        >()
+    );
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         PipelinedFitStage
+///  \brief         Fits batches of items on a dedicated worker thread, which
+///                 allows a `Transformer` to produce the next batch while the
+///                 `Estimators` that follow it are fit on the previous one.
+///
+///                 Once the `Estimators` return a result other than
+///                 `FitResult::Continue` (or throw), the batches that remain in
+///                 the queue are discarded, as the caller would not have provided
+///                 them if the batches were fit synchronously.
+///
+template <typename T>
+class PipelinedFitStage {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using Batch                             = std::vector<T>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    template <typename FitFuncT>
+    PipelinedFitStage(size_t maxPendingBatches, FitFuncT fitFunc) :
+        _queue(maxPendingBatches),
+        _result(FitResult::Continue),
+        _isDone(false),
+        _worker(
+            [this, fitFunc](void) {
+                while(true) {
+                    Batch                   batch(_queue.pop());
+
+                    // An empty batch indicates that the stage is being stopped
+                    if(batch.empty())
+                        break;
+
+                    if(_isDone.load(std::memory_order_relaxed))
+                        continue;
+
+                    try {
+                        FitResult const     result(fitFunc(batch.data(), batch.size()));
+
+                        if(result != FitResult::Continue) {
+                            _result = result;
+                            _isDone.store(true, std::memory_order_release);
+                        }
+                    }
+                    catch(...) {
+                        _pException = std::current_exception();
+                        _isDone.store(true, std::memory_order_release);
+                    }
+                }
+            }
+        ) {
+    }
+
+    ~PipelinedFitStage(void) {
+        if(_worker.joinable()) {
+            _queue.push(Batch());
+            _worker.join();
+        }
+    }
+
+    PipelinedFitStage(PipelinedFitStage const &) = delete;
+    PipelinedFitStage & operator =(PipelinedFitStage const &) = delete;
+    PipelinedFitStage(PipelinedFitStage &&) = delete;
+    PipelinedFitStage & operator =(PipelinedFitStage &&) = delete;
+
+    void push(Batch batch) {
+        assert(batch.empty() == false);
+        _queue.push(std::move(batch));
+    }
+
+    // Returns true if the `Estimators` have stopped accepting batches
+    bool is_done(void) const {
+        return _isDone.load(std::memory_order_acquire);
+    }
+
+    // Waits for all pending batches to be processed (or discarded) and returns
+    // the result of the last batch fit.
+    FitResult stop(void) {
+        assert(_worker.joinable());
+
+        _queue.push(Batch());
+        _worker.join();
+
+        if(_pException)
+            std::rethrow_exception(_pException);
+
+        return _result;
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    SPSCQueue<Batch>                        _queue;
+
+    // Written by the worker thread and read once it has been joined
+    FitResult                               _result;
+    std::exception_ptr                      _pException;
+
+    std::atomic<bool>                       _isDone;
+    std::thread                             _worker;
+};
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -82,6 +240,43 @@ struct ValidateEstimators<
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 
+/////////////////////////////////////////////////////////////////////////
+///  \class         IsConcurrentWithNextEstimator
+///  \brief         True if the `Estimator` at index N (which must not be the
+///                 last `Estimator`) and the `Estimator` that follows it are
+///                 in the same concurrent training group. Note that the
+///                 terminal `Estimator` is never part of a group, as it must
+///                 not be completed until the entire chain is completed.
+///
+template <int N, typename EstimatorTupleT>
+struct IsConcurrentWithNextEstimator {
+    using ThisEstimator                     = typename std::tuple_element<N, EstimatorTupleT>::type;
+    using NextEstimator                     = typename std::tuple_element<N + 1, EstimatorTupleT>::type;
+
+    static constexpr bool const             value =
+        N + 1 != std::tuple_size<EstimatorTupleT>::value - 1
+        && IsTransformerEstimator<ThisEstimator>::value == false
+        && IsTransformerEstimator<NextEstimator>::value == false
+        && IsConcurrentTrainingEstimator<ThisEstimator>::value
+        && IsConcurrentTrainingEstimator<NextEstimator>::value;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ConcurrentGroupSize
+///  \brief         The number of `Estimators` in the concurrent training group
+///                 that begins with the `Estimator` at index N (which must not
+///                 be the last `Estimator`).
+///
+template <int N, typename EstimatorTupleT, bool IsConcurrentWithNextV=IsConcurrentWithNextEstimator<N, EstimatorTupleT>::value>
+struct ConcurrentGroupSize {
+    static constexpr size_t const           value = 1;
+};
+
+template <int N, typename EstimatorTupleT>
+struct ConcurrentGroupSize<N, EstimatorTupleT, true> {
+    static constexpr size_t const           value = 1 + ConcurrentGroupSize<N + 1, EstimatorTupleT>::value;
+};
+
 // ----------------------------------------------------------------------
 // |  Forward Declaration
 template <
@@ -221,6 +416,10 @@ public:
 
         return estimator.get_state() == TrainingState::Finished;
     }
+
+    void enable_pipelined_training(size_t /*maxPendingBatches*/) {
+        // Nothing follows the terminal `Estimator`, so there is nothing to pipeline
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -228,6 +427,15 @@ public:
 ///  \brief         Functionality common to all `Estimators` that are not
 ///                 the last `Estimator` in a chain of `Estimators`.
 ///
+///                 Consecutive training-only `Estimators` that support concurrent
+///                 training (see `IsConcurrentTrainingEstimator`) form a group. The
+///                 `Estimators` in a group begin training together, are fit
+///                 concurrently on the same items, and are completed together
+///                 (in chain order, so that `Annotations` created by earlier
+///                 `Estimators` are available to later `Estimators` during
+///                 `complete_training`). The first element of the group drives
+///                 this process on behalf of the others.
+///
 template <typename EstimatorChainElementT, int N, typename EstimatorTupleT>
 class EstimatorChainElement_IntraMixin {
 public:
@@ -240,6 +448,20 @@ public:
     using NextEstimator                     = typename std::tuple_element<N + 1, EstimatorTupleT>::type;
     using NextEstimatorChainElement         = EstimatorChainElement<N + 1, EstimatorTupleT>;
 
+    using ConcurrentEstimator               = FitEstimator<typename ThisEstimator::InputType>;
+
+    // Batches with fewer items are fit on the calling thread, as the cost of dispatching
+    // work to the thread pool exceeds the benefit of fitting the `Estimators` concurrently.
+    static constexpr size_t const           MinConcurrentFitBatchSize = 1024;
+
+    // True if this `Estimator` and the next `Estimator` are in the same group
+    static constexpr bool const             IsConcurrentWithNext = IsConcurrentWithNextEstimator<N, EstimatorTupleT>::value;
+
+    // The number of `Estimators` in the group that begins with this `Estimator`
+    static constexpr size_t const           NumConcurrentEstimators = ConcurrentGroupSize<N, EstimatorTupleT>::value;
+
+    using ConcurrentEstimators              = std::array<ConcurrentEstimator *, NumConcurrentEstimators>;
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
@@ -251,11 +473,7 @@ public:
         ThisEstimator &                     estimator(thisElement.get_estimator());
 
         if(estimator.get_state() == TrainingState::Pending) {
-            estimator.begin_training();
-
-            if(estimator.get_state() != TrainingState::Training)
-                complete_chained_estimator();
-
+            begin_training_impl(std::integral_constant<bool, IsConcurrentWithNext>());
             return thisElement.has_all_training_finished() == false;
         }
 
@@ -264,36 +482,20 @@ public:
 
     template <typename InputT>
     FitResult fit(InputT const *pItems, size_t cItems) {
-        EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
-        ThisEstimator &                     estimator(thisElement.get_estimator());
-
-        if(estimator.get_state() == TrainingState::Training) {
-            FitResult                       result(estimator.fit(pItems, cItems));
-
-            if(result == FitResult::Continue)
-                return result;
-
-            complete_chained_estimator();
-
-            return thisElement.has_all_training_finished() ? FitResult::Complete : FitResult::Reset;
-        }
-
-        return thisElement.execute_next_fit(pItems, cItems);
+        return fit_impl(pItems, cItems, std::integral_constant<bool, IsConcurrentWithNext>());
     }
 
     bool on_data_completed(void) {
         EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
         NextEstimatorChainElement &         nextElement(static_cast<NextEstimatorChainElement &>(thisElement));
-        ThisEstimator &                     estimator(thisElement.get_estimator());
 
-        if(estimator.get_state() == TrainingState::Training) {
-            estimator.on_data_completed();
-
-            if(estimator.get_state() != TrainingState::Training)
-                complete_chained_estimator();
+        if(is_training(std::integral_constant<bool, IsConcurrentWithNext>()))
+            return on_data_completed_impl(std::integral_constant<bool, IsConcurrentWithNext>());
 
+        // If the following `Estimators` completed or requested a reset while fitting pipelined
+        // batches, they have already moved beyond the data that is being completed.
+        if(thisElement.stop_pipelined_fit_if_necessary() == false)
             return thisElement.has_all_training_finished();
-        }
 
         thisElement.flush_transformer_if_necessary();
         return nextElement.on_data_completed();
@@ -307,7 +509,9 @@ public:
         ThisEstimator &                     estimator(thisElement.get_estimator());
 
         if(estimator.get_state() != TrainingState::Completed)
-            complete_chained_estimator();
+            complete_chained_estimator(std::integral_constant<bool, IsConcurrentWithNext>());
+        else
+            thisElement.stop_pipelined_fit_if_necessary();
 
         nextElement.complete_training();
     }
@@ -319,13 +523,178 @@ public:
         return nextElement.has_all_training_finished();
     }
 
+    void enable_pipelined_training(size_t maxPendingBatches) {
+        EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
+        NextEstimatorChainElement &         nextElement(static_cast<NextEstimatorChainElement &>(thisElement));
+
+        thisElement.set_max_pending_batches(maxPendingBatches);
+        nextElement.enable_pipelined_training(maxPendingBatches);
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            get_concurrent_estimators
+    ///  \brief         Writes this `Estimator` and the `Estimators` that follow
+    ///                 it within the same group to `ppEstimators`, which must
+    ///                 have room for `NumConcurrentEstimators` items.
+    ///
+    void get_concurrent_estimators(ConcurrentEstimator **ppEstimators) {
+        EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
+
+        *ppEstimators = &thisElement.get_estimator();
+        get_next_concurrent_estimators(ppEstimators + 1, std::integral_constant<bool, IsConcurrentWithNext>());
+    }
+
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+
+    // The `Estimators` in the group that begins with this `Estimator`; populated when the
+    // group begins training (and only used by the first element of the group).
+    ConcurrentEstimators                    _concurrentEstimators;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
-    void complete_chained_estimator(void) {
+    void begin_training_impl(std::false_type /*is_concurrent_with_next*/) {
+        ThisEstimator &                     estimator(static_cast<EstimatorChainElementT &>(*this).get_estimator());
+
+        estimator.begin_training();
+
+        if(estimator.get_state() != TrainingState::Training)
+            complete_chained_estimator(std::false_type());
+    }
+
+    void begin_training_impl(std::true_type /*is_concurrent_with_next*/) {
+        // The `Estimators` in the group can't change, so they are collected once rather than
+        // during each call to `fit`.
+        get_concurrent_estimators(_concurrentEstimators.data());
+
+        for(auto &pEstimator : _concurrentEstimators)
+            pEstimator->begin_training();
+
+        if(is_training(std::true_type()) == false)
+            complete_chained_estimator(std::true_type());
+    }
+
+    template <typename InputT>
+    FitResult fit_impl(InputT const *pItems, size_t cItems, std::false_type /*is_concurrent_with_next*/) {
+        EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
+        ThisEstimator &                     estimator(thisElement.get_estimator());
+
+        if(estimator.get_state() == TrainingState::Training) {
+            FitResult                       result(estimator.fit(pItems, cItems));
+
+            if(result == FitResult::Continue)
+                return result;
+
+            complete_chained_estimator(std::false_type());
+
+            return thisElement.has_all_training_finished() ? FitResult::Complete : FitResult::Reset;
+        }
+
+        return thisElement.execute_next_fit(pItems, cItems);
+    }
+
+    template <typename InputT>
+    FitResult fit_impl(InputT const *pItems, size_t cItems, std::true_type /*is_concurrent_with_next*/) {
+        EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
+
+        if(is_training(std::true_type()) == false)
+            return thisElement.execute_next_fit(pItems, cItems);
+
+        ConcurrentEstimators                trainingEstimators;
+        size_t                              cTrainingEstimators(0);
+
+        for(auto &pEstimator : _concurrentEstimators) {
+            if(pEstimator->get_state() == TrainingState::Training)
+                trainingEstimators[cTrainingEstimators++] = pEstimator;
+        }
+
+        assert(cTrainingEstimators != 0);
+
+        if(cTrainingEstimators == 1 || cItems < MinConcurrentFitBatchSize) {
+            for(size_t i = 0; i < cTrainingEstimators; ++i)
+                trainingEstimators[i]->fit(pItems, cItems);
+        }
+        else {
+            GetSharedThreadPool().parallel_for(
+                cTrainingEstimators,
+                [&trainingEstimators, &pItems, &cItems](size_t begin, size_t end) {
+                    while(begin != end)
+                        trainingEstimators[begin++]->fit(pItems, cItems);
+                }
+            );
+        }
+
+        for(size_t i = 0; i < cTrainingEstimators; ++i) {
+            if(trainingEstimators[i]->get_state() == TrainingState::Training)
+                return FitResult::Continue;
+        }
+
+        complete_chained_estimator(std::true_type());
+
+        return thisElement.has_all_training_finished() ? FitResult::Complete : FitResult::Reset;
+    }
+
+    bool on_data_completed_impl(std::false_type /*is_concurrent_with_next*/) {
+        EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
+        ThisEstimator &                     estimator(thisElement.get_estimator());
+
+        estimator.on_data_completed();
+
+        if(estimator.get_state() != TrainingState::Training)
+            complete_chained_estimator(std::false_type());
+
+        return thisElement.has_all_training_finished();
+    }
+
+    bool on_data_completed_impl(std::true_type /*is_concurrent_with_next*/) {
+        EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
+
+        for(auto &pEstimator : _concurrentEstimators) {
+            if(pEstimator->get_state() == TrainingState::Training)
+                pEstimator->on_data_completed();
+        }
+
+        if(is_training(std::true_type()) == false)
+            complete_chained_estimator(std::true_type());
+
+        return thisElement.has_all_training_finished();
+    }
+
+    bool is_training(std::false_type /*is_concurrent_with_next*/) {
+        return static_cast<EstimatorChainElementT &>(*this).get_estimator().get_state() == TrainingState::Training;
+    }
+
+    bool is_training(std::true_type /*is_concurrent_with_next*/) {
+        TrainingState const                 state(static_cast<EstimatorChainElementT &>(*this).get_estimator().get_state());
+
+        // The group hasn't begun training while the first `Estimator` is pending, and is
+        // complete once the first `Estimator` has been completed.
+        if(state == TrainingState::Pending || state == TrainingState::Completed)
+            return false;
+
+        for(auto &pEstimator : _concurrentEstimators) {
+            if(pEstimator->get_state() == TrainingState::Training)
+                return true;
+        }
+
+        return false;
+    }
+
+    void get_next_concurrent_estimators(ConcurrentEstimator **, std::false_type /*is_concurrent_with_next*/) {
+    }
+
+    void get_next_concurrent_estimators(ConcurrentEstimator **ppEstimators, std::true_type /*is_concurrent_with_next*/) {
+        static_cast<NextEstimatorChainElement &>(static_cast<EstimatorChainElementT &>(*this)).get_concurrent_estimators(ppEstimators);
+    }
+
+    void complete_chained_estimator(std::false_type /*is_concurrent_with_next*/) {
         EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
         NextEstimatorChainElement &         nextElement(static_cast<NextEstimatorChainElement &>(thisElement));
         ThisEstimator &                     estimator(thisElement.get_estimator());
@@ -338,6 +707,24 @@ private:
 
         nextElement.begin_training();
     }
+
+    void complete_chained_estimator(std::true_type /*is_concurrent_with_next*/) {
+        EstimatorChainElementT &            thisElement(static_cast<EstimatorChainElementT &>(*this));
+        NextEstimatorChainElement &         nextElement(static_cast<NextEstimatorChainElement &>(thisElement));
+
+        // Complete the `Estimators` in order, as `complete_training` may rely on `Annotations`
+        // created by earlier `Estimators`. Note that the `Estimators` in a group are never
+        // `TransformerEstimators`, so there aren't any `Transformers` to create.
+        for(auto &pEstimator : _concurrentEstimators) {
+            assert(pEstimator->get_state() != TrainingState::Completed);
+            pEstimator->complete_training();
+            assert(pEstimator->get_state() == TrainingState::Completed);
+        }
+
+        // The other `Estimators` in the group are completed, so this will begin training
+        // on the first `Estimator` after the group.
+        nextElement.begin_training();
+    }
 };
 
 // ----------------------------------------------------------------------
@@ -436,6 +823,7 @@ public:
     using TerminalMixin::on_data_completed;
     using TerminalMixin::complete_training;
     using TerminalMixin::has_all_training_finished;
+    using TerminalMixin::enable_pipelined_training;
 
 private:
     // ----------------------------------------------------------------------
@@ -513,6 +901,7 @@ public:
     using TerminalMixin::on_data_completed;
     using TerminalMixin::complete_training;
     using TerminalMixin::has_all_training_finished;
+    using TerminalMixin::enable_pipelined_training;
 
     using TransformerMixin::move_transformer;
 
@@ -596,6 +985,8 @@ public:
     using IntraMixin::on_data_completed;
     using IntraMixin::complete_training;
     using IntraMixin::has_all_training_finished;
+    using IntraMixin::enable_pipelined_training;
+    using IntraMixin::get_concurrent_estimators;
 
 private:
     // ----------------------------------------------------------------------
@@ -619,6 +1010,14 @@ private:
 
     void flush_transformer_if_necessary(void) {
     }
+
+    void set_max_pending_batches(size_t) {
+        // Items are passed through unmodified, so there isn't any work to overlap
+    }
+
+    bool stop_pipelined_fit_if_necessary(void) {
+        return true;
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -676,15 +1075,23 @@ public:
     // ----------------------------------------------------------------------
     EstimatorChainElement(AnnotationMapsPtr pAllColumnAnnotations) :
         ThisEstimatorChainElementBase(pAllColumnAnnotations),
-        NextEstimatorChainElement(std::move(pAllColumnAnnotations)) {
+        NextEstimatorChainElement(std::move(pAllColumnAnnotations)),
+        _maxPendingBatches(0) {
     }
 
     template <typename ConstructFuncT, typename... ConstructFuncTs>
     EstimatorChainElement(ConstructFuncT && func, ConstructFuncTs &&... funcs) :
         ThisEstimatorChainElementBase(std::forward<ConstructFuncT>(func)),
-        NextEstimatorChainElement(std::forward<ConstructFuncTs>(funcs)...) {
+        NextEstimatorChainElement(std::forward<ConstructFuncTs>(funcs)...),
+        _maxPendingBatches(0) {
     }
 
+    // The worker thread created by pipelined training references this object
+    EstimatorChainElement(EstimatorChainElement const &) = delete;
+    EstimatorChainElement & operator =(EstimatorChainElement const &) = delete;
+    EstimatorChainElement(EstimatorChainElement &&) = delete;
+    EstimatorChainElement & operator =(EstimatorChainElement &&) = delete;
+
     using ThisEstimatorChainElementBase::get_estimator;
 
     using IntraMixin::begin_training;
@@ -692,6 +1099,7 @@ public:
     using IntraMixin::on_data_completed;
     using IntraMixin::complete_training;
     using IntraMixin::has_all_training_finished;
+    using IntraMixin::enable_pipelined_training;
 
     using TransformerMixin::move_transformer;
 
@@ -700,6 +1108,28 @@ private:
     // |  Relationships
     friend IntraMixin;
 
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using TransformedType                   = typename ThisEstimator::TransformedType;
+    using TransformedTypes                  = std::vector<TransformedType>;
+    using PipelinedFitStage                 = Details::Impl::PipelinedFitStage<TransformedType>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+
+    // 0 if pipelined training is disabled
+    size_t                                  _maxPendingBatches;
+
+    // Created when the first batch is pipelined and destroyed when the following
+    // `Estimators` are done with the current data
+    std::unique_ptr<PipelinedFitStage>      _pPipelinedFitStage;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
@@ -709,10 +1139,9 @@ private:
     // Mixin functionality
     template <typename InputT>
     FitResult execute_next_fit(InputT const *pItems, size_t cItems) {
-        // ----------------------------------------------------------------------
-        using TransformedType               = typename ThisEstimator::TransformedType;
-        using TransformedTypes              = std::vector<TransformedType>;
-        // ----------------------------------------------------------------------
+        // The following `Estimators` aren't accepting any more of the current data
+        if(_pPipelinedFitStage && _pPipelinedFitStage->is_done())
+            return stop_pipelined_fit();
 
         TransformedTypes                    transformed;
 
@@ -720,7 +1149,7 @@ private:
         transformed.reserve(cItems);
 
         auto const                          callback(
-            [&transformed](TransformedType output) {
+            [&transformed](TransformedType &&output) {
                 transformed.emplace_back(std::move(output));
             }
         );
@@ -731,9 +1160,27 @@ private:
         while(pItems != pEndItems)
             transformer.execute(*pItems++, callback);
 
-        if(transformed.empty() == false)
+        if(transformed.empty())
+            return FitResult::Continue;
+
+        // A `Transformer` with state may see a few batches that it wouldn't see if the results
+        // were fit synchronously (before the following `Estimators` report that they are done),
+        // so only stateless `Transformers` are pipelined.
+        if(_maxPendingBatches == 0 || transformer.is_stateless() == false)
             return NextEstimatorChainElement::fit(transformed.data(), transformed.size());
 
+        if(!_pPipelinedFitStage) {
+            _pPipelinedFitStage.reset(
+                new PipelinedFitStage(
+                    _maxPendingBatches,
+                    [this](TransformedType const *pTransformed, size_t cTransformed) {
+                        return NextEstimatorChainElement::fit(pTransformed, cTransformed);
+                    }
+                )
+            );
+        }
+
+        _pPipelinedFitStage->push(std::move(transformed));
         return FitResult::Continue;
     }
 
@@ -745,16 +1192,11 @@ private:
     }
 
     void flush_transformer_if_necessary(void) {
-        // ----------------------------------------------------------------------
-        using TransformedType               = typename ThisEstimator::TransformedType;
-        using TransformedTypes              = std::vector<TransformedType>;
-        // ----------------------------------------------------------------------
-
         TransformedTypes                    transformed;
         auto &                              transformer(TransformerMixin::get_transformer());
 
         transformer.flush(
-            [&transformed](TransformedType output) {
+            [&transformed](TransformedType &&output) {
                 transformed.emplace_back(std::move(output));
             }
         );
@@ -762,6 +1204,24 @@ private:
         if(transformed.empty() == false)
             NextEstimatorChainElement::fit(transformed.data(), transformed.size());
     }
+
+    void set_max_pending_batches(size_t maxPendingBatches) {
+        assert(!_pPipelinedFitStage);
+        _maxPendingBatches = maxPendingBatches;
+    }
+
+    bool stop_pipelined_fit_if_necessary(void) {
+        if(!_pPipelinedFitStage)
+            return true;
+
+        return stop_pipelined_fit() == FitResult::Continue;
+    }
+
+    FitResult stop_pipelined_fit(void) {
+        std::unique_ptr<PipelinedFitStage>  pStage(std::move(_pPipelinedFitStage));
+
+        return pStage->stop();
+    }
 };
 
 // ----------------------------------------------------------------------
@@ -774,6 +1234,20 @@ private:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 
+/////////////////////////////////////////////////////////////////////////
+///  \fn            ShareOrCloneTransformer
+///  \brief         Returns `pTransformer` if it is stateless (as it can be used
+///                 concurrently), a clone of it otherwise, or nullptr if the
+///                 `Transformer` doesn't support cloning.
+///
+template <typename TransformerT>
+std::shared_ptr<TransformerT> ShareOrCloneTransformer(std::shared_ptr<TransformerT> const &pTransformer) {
+    if(pTransformer->is_stateless())
+        return pTransformer;
+
+    return std::shared_ptr<TransformerT>(pTransformer->clone());
+}
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         TransformerChainElement
 ///  \brief         Single `Transformer` within a chain of `Transformers`.
@@ -821,18 +1295,42 @@ public:
     TransformerChainElement(Archive &) {
     }
 
+    TransformerChainElement(TransformerChainElement const &, CloneTag) {
+    }
+
     bool operator==(TransformerChainElement const &) const {
         return true;
     }
 
+    bool is_cloned(void) const {
+        return true;
+    }
+
     void save(Archive &) const {
     }
 
+    bool is_stateless(void) const {
+        return true;
+    }
+
     template <typename InputT, typename CallbackT>
     void execute(InputT &input, CallbackT const &callback) {
         callback(std::move(input));
     }
 
+    template <typename InputT, typename TransformedT>
+    void execute(InputT *pInputs, size_t cInputs, TransformedT *pOutputs) {
+        InputT * const                      pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            Microsoft::Featurizer::Details::AssignOutput(*pOutputs++, TransformedT(std::move(*pInputs++)));
+    }
+
+    template <typename TransformedT, typename InputT>
+    TransformedT transform(InputT &&input) {
+        return TransformedT(std::forward<InputT>(input));
+    }
+
     template <typename CallbackT>
     void flush(CallbackT const &) {
     }
@@ -872,10 +1370,22 @@ public:
         _pTransformer(new typename ThisEstimator::TransformerType(ar)) {
     }
 
+    TransformerChainElement(TransformerChainElement const &other, CloneTag) :
+        _pTransformer(ShareOrCloneTransformer(other._pTransformer)) {
+    }
+
+    bool is_cloned(void) const {
+        return static_cast<bool>(_pTransformer);
+    }
+
     void save(Archive &ar) const {
         _pTransformer->save(ar);
     }
 
+    bool is_stateless(void) const {
+        return _pTransformer->is_stateless();
+    }
+
     bool operator==(TransformerChainElement const &other) const {
         // ----------------------------------------------------------------------
         using ThisTransformer               = typename ThisEstimator::TransformerType;
@@ -889,6 +1399,20 @@ public:
         _pTransformer->execute(input, callback);
     }
 
+    template <typename InputT, typename TransformedT>
+    void execute(InputT const *pInputs, size_t cInputs, TransformedT *pOutputs) {
+        _pTransformer->execute(pInputs, cInputs, pOutputs);
+    }
+
+    template <typename TransformedT, typename InputT>
+    TransformedT transform(InputT const &input) {
+        // ----------------------------------------------------------------------
+        using ThisTransformer               = typename ThisEstimator::TransformerType;
+        // ----------------------------------------------------------------------
+
+        return TransformSingle(static_cast<ThisTransformer &>(*_pTransformer), input);
+    }
+
     template <typename CallbackT>
     void flush(CallbackT const &callback) {
         _pTransformer->flush(callback);
@@ -900,14 +1424,14 @@ private:
     // |  Private Types
     // |
     // ----------------------------------------------------------------------
-    using TransformerUniquePtr              = typename ThisEstimator::TransformerUniquePtr;
+    using TransformerSharedPtr              = std::shared_ptr<typename ThisEstimator::TransformerUniquePtr::element_type>;
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    TransformerUniquePtr const              _pTransformer;
+    TransformerSharedPtr const              _pTransformer;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -947,6 +1471,14 @@ public:
         NextTransformerChainElement(ar) {
     }
 
+    TransformerChainElement(TransformerChainElement const &other, CloneTag tag) :
+        NextTransformerChainElement(static_cast<NextTransformerChainElement const &>(other), tag) {
+    }
+
+    bool is_cloned(void) const {
+        return NextTransformerChainElement::is_cloned();
+    }
+
     bool operator==(TransformerChainElement const &other) const {
         return NextTransformerChainElement::operator==(other);
     }
@@ -955,11 +1487,25 @@ public:
         NextTransformerChainElement::save(ar);
     }
 
+    bool is_stateless(void) const {
+        return NextTransformerChainElement::is_stateless();
+    }
+
     template <typename InputT, typename CallbackT>
     void execute(InputT const &input, CallbackT const &callback) {
         NextTransformerChainElement::execute(input, callback);
     }
 
+    template <typename InputT, typename TransformedT>
+    void execute(InputT *pInputs, size_t cInputs, TransformedT *pOutputs) {
+        NextTransformerChainElement::execute(pInputs, cInputs, pOutputs);
+    }
+
+    template <typename TransformedT, typename InputT>
+    TransformedT transform(InputT &&input) {
+        return NextTransformerChainElement::template transform<TransformedT>(std::forward<InputT>(input));
+    }
+
     template <typename CallbackT>
     void flush(CallbackT const &callback) {
         NextTransformerChainElement::flush(callback);
@@ -1007,6 +1553,15 @@ public:
         _pTransformer(new ThisTransformer(ar)) {
     }
 
+    TransformerChainElement(TransformerChainElement const &other, CloneTag tag) :
+        NextTransformerChainElement(static_cast<NextTransformerChainElement const &>(other), tag),
+        _pTransformer(ShareOrCloneTransformer(other._pTransformer)) {
+    }
+
+    bool is_cloned(void) const {
+        return NextTransformerChainElement::is_cloned() && _pTransformer;
+    }
+
     bool operator==(TransformerChainElement const &other) const {
         return NextTransformerChainElement::operator==(other)
             && static_cast<ThisTransformer const &>(*_pTransformer) == static_cast<ThisTransformer const &>(*other._pTransformer);
@@ -1017,24 +1572,62 @@ public:
         _pTransformer->save(ar);
     }
 
+    bool is_stateless(void) const {
+        return NextTransformerChainElement::is_stateless() && _pTransformer->is_stateless();
+    }
+
     template <typename InputT, typename CallbackT>
     void execute(InputT const &input, CallbackT const &callback) {
         NextTransformerChainElement &       next(static_cast<NextTransformerChainElement &>(*this));
 
         _pTransformer->execute(
             input,
-            [&callback, &next](typename ThisTransformer::TransformedType output) {
+            [&callback, &next](typename ThisTransformer::TransformedType &&output) {
                 next.execute(output, callback);
             }
         );
     }
 
+    template <typename InputT, typename TransformedT>
+    void execute(InputT const *pInputs, size_t cInputs, TransformedT *pOutputs) {
+        // ----------------------------------------------------------------------
+        using ThisTransformedType           = typename ThisTransformer::TransformedType;
+        // ----------------------------------------------------------------------
+
+        std::vector<ThisTransformedType>    transformed;
+
+        transformed.reserve(cInputs);
+
+        InputT const * const                pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs) {
+            _pTransformer->execute(
+                *pInputs++,
+                [&transformed](ThisTransformedType &&output) {
+                    transformed.emplace_back(std::move(output));
+                }
+            );
+        }
+
+        if(transformed.size() != cInputs)
+            throw std::runtime_error("This method should only be used with Transformers that generate 1 output value for each input value");
+
+        static_cast<NextTransformerChainElement &>(*this).execute(transformed.data(), transformed.size(), pOutputs);
+    }
+
+    template <typename TransformedT, typename InputT>
+    TransformedT transform(InputT const &input) {
+        return static_cast<NextTransformerChainElement &>(*this).template transform<TransformedT>(
+            TransformSingle(static_cast<ThisTransformer &>(*_pTransformer), input)
+        );
+    }
+
     template <typename CallbackT>
     void flush(CallbackT const &callback) {
         NextTransformerChainElement &       next(static_cast<NextTransformerChainElement &>(*this));
 
         _pTransformer->flush(
-            [&callback, &next](typename ThisTransformer::TransformedType output) {
+            [&callback, &next](typename ThisTransformer::TransformedType &&output) {
                 next.execute(output, callback);
             }
         );
@@ -1048,14 +1641,14 @@ private:
     // |  Private Types
     // |
     // ----------------------------------------------------------------------
-    using TransformerUniquePtr              = typename ThisEstimator::TransformerUniquePtr;
+    using TransformerSharedPtr              = std::shared_ptr<typename ThisEstimator::TransformerUniquePtr::element_type>;
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    TransformerUniquePtr const              _pTransformer;
+    TransformerSharedPtr const              _pTransformer;
 };
 
 } // namespace Impl
@@ -328,6 +328,21 @@ Details::DocumentStatisticsTrainingOnlyPolicy::FrequencyMap PruneTermFreqMap(Det
     return termFrequency;
 }
 
+void MergeTermFrequency(Details::DocumentStatisticsTrainingOnlyPolicy::FrequencyMap &termFrequency, std::uint32_t &totalNumDocuments,
+                        Details::DocumentStatisticsTrainingOnlyPolicy::FrequencyMap const &otherTermFrequency, std::uint32_t otherTotalNumDocuments) {
+    if(std::numeric_limits<std::uint32_t>::max() - totalNumDocuments < otherTotalNumDocuments)
+        throw std::runtime_error("Overflow occurred when merging document statistics");
+
+    for(auto const &kvp : otherTermFrequency) {
+        std::uint32_t &                     count(termFrequency[kvp.first]);
+
+        // A term can't appear in more documents than the total, so this can't overflow
+        count += kvp.second;
+    }
+
+    totalNumDocuments += otherTotalNumDocuments;
+}
+
 } // anonymous namespace
 
 DocumentStatisticsAnnotationData::FrequencyAndIndexMap MergeTwoMapsWithSameKeys(Details::DocumentStatisticsTrainingOnlyPolicy::FrequencyMap termFrequency,
@@ -366,6 +381,27 @@ DocumentStatisticsAnnotationData Details::DocumentStatisticsTrainingOnlyPolicy::
     return DocumentStatisticsAnnotationData(std::move(termFrequencyAndIndex), std::move(_totalNumDocuments));
 }
 
+void Details::DocumentStatisticsTrainingOnlyPolicy::merge(DocumentStatisticsTrainingOnlyPolicy const &other) {
+    MergeTermFrequency(_termFrequency, _totalNumDocuments, other._termFrequency, other._totalNumDocuments);
+}
+
+void Details::DocumentStatisticsTrainingOnlyPolicy::merge(Archive &ar) {
+    FrequencyMap                            termFrequency(Traits<FrequencyMap>::deserialize(ar));
+    std::uint32_t                           totalNumDocuments(Traits<std::uint32_t>::deserialize(ar));
+
+    for(auto const &kvp : termFrequency) {
+        if(kvp.second == 0 || kvp.second > totalNumDocuments)
+            throw std::runtime_error("Invalid term frequency");
+    }
+
+    MergeTermFrequency(_termFrequency, _totalNumDocuments, termFrequency, totalNumDocuments);
+}
+
+void Details::DocumentStatisticsTrainingOnlyPolicy::save(Archive &ar) const {
+    Traits<FrequencyMap>::serialize(ar, _termFrequency);
+    Traits<std::uint32_t>::serialize(ar, _totalNumDocuments);
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  Public Functions
@@ -141,6 +141,10 @@ public:
     void fit(InputType const &input);
     DocumentStatisticsAnnotationData complete_training(void);
 
+    void merge(DocumentStatisticsTrainingOnlyPolicy const &other);
+    void merge(Archive &ar);
+    void save(Archive &ar) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -4,9 +4,14 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
+#include <limits>
 #include <unordered_map>
+#include <vector>
 
+#include "../../Archive.h"
 #include "../../Featurizer.h"
+#include "../../ThreadPool.h"
 #include "Details/EstimatorTraits.h"
 
 namespace Microsoft {
@@ -31,7 +36,7 @@ public:
             GrainT,
             AnnotationPtr,
             std::hash<GrainT>,
-            Traits<GrainT>::key_equal
+            typename Traits<GrainT>::key_equal
         >;
 
     // ----------------------------------------------------------------------
@@ -70,6 +75,11 @@ struct GrainEstimatorTraits {
 ///  \brief         A Transformer that applies a Transformer unique to the
 ///                 observed grain using grain-specific state.
 ///
+///                 Archives contain an index of the offset of each grain's
+///                 data, so that a grain's Transformer can be deserialized
+///                 the first time that the grain is observed (or all grains
+///                 can be deserialized in parallel).
+///
 template <typename GrainT, typename EstimatorT>
 class GrainTransformer :
     public Transformer<
@@ -105,15 +115,54 @@ public:
     // |
     // ----------------------------------------------------------------------
     GrainTransformer(TransformerMap transformers);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GrainTransformer
+    ///  \brief         Deserializes the grain index; each grain's Transformer
+    ///                 is deserialized when the grain is first observed. The
+    ///                 data is referenced in place when the archive's buffer
+    ///                 has an owner and copied otherwise. Archives created
+    ///                 before the index was introduced are deserialized in
+    ///                 their entirety.
+    ///
     GrainTransformer(Archive &ar);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GrainTransformer
+    ///  \brief         Deserializes the Transformers for all grains in parallel.
+    ///
+    GrainTransformer(Archive &ar, ThreadPool &pool);
+
     ~GrainTransformer(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(GrainTransformer);
 
     void save(Archive &ar) const override;
 
+    size_t num_grains(void) const;
+    size_t num_loaded_grains(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            load_all
+    ///  \brief         Deserializes the Transformers for all grains that
+    ///                 haven't been observed yet.
+    ///
+    void load_all(void);
+    void load_all(ThreadPool &pool);
+
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    struct IndexEntry {
+        std::uint64_t                       Offset;
+        std::uint64_t                       Size;
+    };
+
+    using GrainIndex                        = std::map<GrainT, IndexEntry>;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
@@ -121,11 +170,24 @@ private:
     // ----------------------------------------------------------------------
     TransformerMap                          _transformers;
 
+    // Grains whose Transformers haven't been deserialized yet
+    GrainIndex                              _index;
+    Archive::BufferOwnerPtr                 _pIndexData;
+    unsigned char const *                   _pIndexBuffer;
+    Archive::LayoutValue                    _indexLayout;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    GrainTransformer(TransformerMap transformers, GrainIndex index, Archive::BufferOwnerPtr pIndexData, unsigned char const *pIndexBuffer, Archive::LayoutValue indexLayout);
+
+    /// Written in place of the number of elements in archives that contain an index
+    static std::uint64_t IndexedArchiveMarker(void);
+
+    GrainTransformerTypeUniquePtr load_grain(IndexEntry const &entry) const;
+    void on_grains_loaded(void);
 
     // MSVC has problems when the declaration and definition are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
@@ -133,13 +195,22 @@ private:
         GrainTransformerType &              transformer(
             [this, &grain](void) -> GrainTransformerType & {
 
-                typename TransformerMap::iterator const                     iter(_transformers.find(grain));
+                typename TransformerMap::iterator                           iter(_transformers.find(grain));
+
+                if(iter == _transformers.end()) {
+                    typename GrainIndex::iterator const                     indexIter(_index.find(grain));
+
+                    if(indexIter == _index.end())
+                        throw std::runtime_error("Grain not found");
 
-                if(iter == _transformers.end())
-                    throw std::runtime_error("Grain not found");
+                    // TODO: Add support for a "default transformer" that (if provided during construction)
+                    //       is cloned when a grain isn't found.
 
-                // TODO: Add support for a "default transformer" that (if provided during construction)
-                //       is cloned when a grain isn't found.
+                    iter = _transformers.emplace(indexIter->first, load_grain(indexIter->second)).first;
+
+                    _index.erase(indexIter);
+                    on_grains_loaded();
+                }
 
                 assert(iter->second);
                 return *iter->second;
@@ -150,7 +221,7 @@ private:
 
         transformer.execute(
             grainInput,
-            [&callback, &grain](typename EstimatorT::TransformedType output) {
+            [&callback, &grain](typename EstimatorT::TransformedType &&output) {
                 callback(std::make_tuple(grain, std::move(output)));
             }
         );
@@ -158,9 +229,10 @@ private:
 
     // MSVC has problems when the declaration and definition are separated
     void flush_impl(typename BaseType::CallbackFunction const &callback) override {
+        // Grains that haven't been observed don't have any pending output
         for(auto &kvp : _transformers) {
             kvp.second->flush(
-                [&callback, &kvp](typename EstimatorT::TransformedType output) {
+                [&callback, &kvp](typename EstimatorT::TransformedType &&output) {
                     callback(std::make_tuple(kvp.first, std::move(output)));
                 }
             );
@@ -204,13 +276,41 @@ public:
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(GrainEstimatorImplBase);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            merge
+    ///  \brief         Merges the per-grain training state of an estimator that
+    ///                 was fit on a different shard of the data. The per-grain
+    ///                 `Estimator` must support `merge`.
+    ///
+    GrainEstimatorImplBase & merge(GrainEstimatorImplBase const &other);
+    GrainEstimatorImplBase & merge(Archive &ar);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            save_training_state
+    ///  \brief         Writes the training state of each per-grain `Estimator`.
+    ///
+    void save_training_state(Archive &ar) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            restore_training_state
+    ///  \brief         Restores training state written by `save_training_state`;
+    ///                 must be invoked after `begin_training` and before `fit`.
+    ///
+    GrainEstimatorImplBase & restore_training_state(Archive &ar);
+
 protected:
     // ----------------------------------------------------------------------
     // |
     // |  Protected Types
     // |
     // ----------------------------------------------------------------------
-    using EstimatorMap                      = typename GrainEstimatorAnnotation<GrainT>::AnnotationMap;
+    using EstimatorMap =
+        std::unordered_map<
+            GrainT,
+            EstimatorT,
+            std::hash<GrainT>,
+            typename Traits<GrainT>::key_equal
+        >;
 
     // ----------------------------------------------------------------------
     // |
@@ -226,8 +326,8 @@ private:
     // |
     // ----------------------------------------------------------------------
 
-    // Maintain the smart pointer to this object so that we can provide it when
-    // invoking _createFunc.
+    // Maintain the smart pointer to this object so that we can create per-grain
+    // `AnnotationMaps` with the same number of columns when invoking _createFunc.
     AnnotationMapsPtr const                 _pAllColumnAnnotations;
     CreateEstimatorFunc const               _createFunc;
 
@@ -241,6 +341,8 @@ private:
     bool begin_training_impl(void) override;
     FitResult fit_impl(InputType const *pItems, size_t cItems) override;
     void complete_training_impl(void) override;
+
+    EstimatorT & get_estimator(GrainT const &grain);
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -433,15 +535,98 @@ GrainTransformer<GrainT, EstimatorT>::GrainTransformer(TransformerMap transforme
                 return transformers;
             }()
         )
-    ) {
+    ),
+    _pIndexBuffer(nullptr),
+    _indexLayout(Archive::LayoutValue::Standard) {
 }
 
 template <typename GrainT, typename EstimatorT>
 GrainTransformer<GrainT, EstimatorT>::GrainTransformer(Archive &ar) :
     GrainTransformer(
-        [&ar](void) -> TransformerMap {
+        [&ar](void) -> GrainTransformer {
             std::uint64_t                   cElements(Traits<std::uint64_t>::deserialize(ar));
 
+            if(cElements == IndexedArchiveMarker()) {
+                // Version
+                std::uint16_t               majorVersion(Traits<std::uint16_t>::deserialize(ar));
+                std::uint16_t               minorVersion(Traits<std::uint16_t>::deserialize(ar));
+
+                if(majorVersion != 1 || minorVersion != 0)
+                    throw std::runtime_error("Unsupported archive version");
+
+                // Index
+                std::uint8_t const          layout(Traits<std::uint8_t>::deserialize(ar));
+
+                if(layout > static_cast<std::uint8_t>(Archive::LayoutValue::Compact))
+                    throw std::runtime_error("Invalid layout");
+
+                cElements = Traits<std::uint64_t>::deserialize(ar);
+
+                if(cElements == 0)
+                    throw std::runtime_error("Invalid elements");
+
+                GrainIndex                  index;
+
+                while(cElements--) {
+                    GrainT                  grain(Traits<GrainT>::deserialize(ar));
+                    IndexEntry              entry;
+
+                    entry.Offset = Traits<std::uint64_t>::deserialize(ar);
+                    entry.Size = Traits<std::uint64_t>::deserialize(ar);
+
+                    if(entry.Size == 0)
+                        throw std::runtime_error("Invalid grain size");
+
+                    if(index.emplace(std::move(grain), std::move(entry)).second == false)
+                        throw std::runtime_error("Invalid insertion");
+                }
+
+                // Data
+                std::uint64_t const         cbData(Traits<std::uint64_t>::deserialize(ar));
+
+                for(auto const &kvp : index) {
+                    if(kvp.second.Offset > cbData || kvp.second.Size > cbData - kvp.second.Offset)
+                        throw std::runtime_error("Invalid grain offset");
+                }
+
+                Archive::BufferOwnerPtr     pDataOwner(ar.get_buffer_owner());
+                unsigned char const *       pData(nullptr);
+
+                if(pDataOwner) {
+                    // The data can be referenced in place
+                    pData = ar.get_buffer_ptr(static_cast<size_t>(cbData));
+                    ar.update_buffer_ptr(static_cast<size_t>(cbData));
+                }
+                else {
+                    // The buffer is only valid during deserialization, so read
+                    // the data into a buffer that we own. The data is read a chunk
+                    // at a time so that a streaming archive never buffers all of
+                    // it and a corrupt size fails before everything is allocated.
+                    std::shared_ptr<Archive::ByteArray> const       pCopy(std::make_shared<Archive::ByteArray>());
+
+                    while(pCopy->size() < cbData) {
+                        size_t const        cbOffset(pCopy->size());
+                        size_t const        cbChunk(
+                            static_cast<size_t>(
+                                std::min<std::uint64_t>(
+                                    cbData - cbOffset,
+                                    std::max(ar.get_buffer_size(), static_cast<size_t>(Archive::DefaultChunkSize))
+                                )
+                            )
+                        );
+
+                        pCopy->resize(cbOffset + cbChunk);
+                        ar.read_bytes(pCopy->data() + cbOffset, cbChunk);
+                    }
+
+                    pData = pCopy->data();
+                    pDataOwner = pCopy;
+                }
+
+                return GrainTransformer(TransformerMap(), std::move(index), std::move(pDataOwner), pData, static_cast<Archive::LayoutValue>(layout));
+            }
+
+            // Archives without an index
             if(cElements == 0)
                 throw std::runtime_error("Invalid elements");
 
@@ -457,18 +642,179 @@ GrainTransformer<GrainT, EstimatorT>::GrainTransformer(Archive &ar) :
                     throw std::runtime_error("Invalid insertion");
             }
 
-            return transformers;
+            return GrainTransformer(std::move(transformers));
         }()
     ) {
 }
 
+template <typename GrainT, typename EstimatorT>
+GrainTransformer<GrainT, EstimatorT>::GrainTransformer(Archive &ar, ThreadPool &pool) :
+    GrainTransformer(ar) {
+    load_all(pool);
+}
+
+template <typename GrainT, typename EstimatorT>
+GrainTransformer<GrainT, EstimatorT>::GrainTransformer(TransformerMap transformers, GrainIndex index, Archive::BufferOwnerPtr pIndexData, unsigned char const *pIndexBuffer, Archive::LayoutValue indexLayout) :
+    _transformers(std::move(transformers)),
+    _index(std::move(index)),
+    _pIndexData(std::move(pIndexData)),
+    _pIndexBuffer(pIndexBuffer),
+    _indexLayout(indexLayout) {
+    if(_transformers.empty() && _index.empty())
+        throw std::invalid_argument("transformers");
+}
+
 template <typename GrainT, typename EstimatorT>
 void GrainTransformer<GrainT, EstimatorT>::save(Archive &ar) const /*override*/ {
-    Traits<std::uint64_t>::serialize(ar, _transformers.size());
+    // ----------------------------------------------------------------------
+    struct Item {
+        GrainT const *                      pGrain;
+        GrainTransformerType const *        pTransformer;   // nullptr when the data is copied from the index
+        IndexEntry const *                  pEntry;
+        std::uint64_t                       cbSize;
+    };
+    // ----------------------------------------------------------------------
 
-    for(auto const &kvp: _transformers) {
-        Traits<GrainT>::serialize(ar, kvp.first);
-        kvp.second->save(ar);
+    std::vector<Item>                       items;
+    std::vector<GrainTransformerTypeUniquePtr>          loadedTransformers;
+
+    items.reserve(num_grains());
+
+    for(auto const &kvp : _transformers)
+        items.emplace_back(Item{&kvp.first, kvp.second.get(), nullptr, 0});
+
+    for(auto const &kvp : _index) {
+        // Data saved with the same layout can be copied as-is
+        if(_indexLayout == ar.Layout) {
+            items.emplace_back(Item{&kvp.first, nullptr, &kvp.second, kvp.second.Size});
+            continue;
+        }
+
+        loadedTransformers.emplace_back(load_grain(kvp.second));
+        items.emplace_back(Item{&kvp.first, loadedTransformers.back().get(), nullptr, 0});
+    }
+
+    // Write the grains in order so that the output doesn't depend on which grains have been loaded
+    std::sort(
+        items.begin(),
+        items.end(),
+        [](Item const &item1, Item const &item2) {
+            return *item1.pGrain < *item2.pGrain;
+        }
+    );
+
+    for(auto &item : items) {
+        if(item.pTransformer == nullptr)
+            continue;
+
+        GrainTransformerType const &        transformer(*item.pTransformer);
+
+        item.cbSize = Archive::SerializedSize([&transformer](Archive &sizingArchive) { transformer.save(sizingArchive); }, ar.Layout);
+    }
+
+    Traits<std::uint64_t>::serialize(ar, IndexedArchiveMarker());
+
+    // Version
+    Traits<std::uint16_t>::serialize(ar, 1); // Major
+    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+
+    // Index
+    Traits<std::uint8_t>::serialize(ar, static_cast<std::uint8_t>(ar.Layout));
+    Traits<std::uint64_t>::serialize(ar, items.size());
+
+    std::uint64_t                           offset(0);
+
+    for(auto const &item : items) {
+        Traits<GrainT>::serialize(ar, *item.pGrain);
+        Traits<std::uint64_t>::serialize(ar, offset);
+        Traits<std::uint64_t>::serialize(ar, item.cbSize);
+
+        offset += item.cbSize;
+    }
+
+    // Data
+    Traits<std::uint64_t>::serialize(ar, offset);
+
+    for(auto const &item : items) {
+        if(item.pTransformer)
+            item.pTransformer->save(ar);
+        else
+            ar.serialize(_pIndexBuffer + item.pEntry->Offset, static_cast<size_t>(item.cbSize));
+    }
+}
+
+template <typename GrainT, typename EstimatorT>
+size_t GrainTransformer<GrainT, EstimatorT>::num_grains(void) const {
+    return _transformers.size() + _index.size();
+}
+
+template <typename GrainT, typename EstimatorT>
+size_t GrainTransformer<GrainT, EstimatorT>::num_loaded_grains(void) const {
+    return _transformers.size();
+}
+
+template <typename GrainT, typename EstimatorT>
+void GrainTransformer<GrainT, EstimatorT>::load_all(void) {
+    for(auto const &kvp : _index)
+        _transformers.emplace(kvp.first, load_grain(kvp.second));
+
+    _index.clear();
+    on_grains_loaded();
+}
+
+template <typename GrainT, typename EstimatorT>
+void GrainTransformer<GrainT, EstimatorT>::load_all(ThreadPool &pool) {
+    std::vector<typename GrainIndex::const_iterator>    entries;
+
+    entries.reserve(_index.size());
+
+    for(typename GrainIndex::const_iterator iter = _index.begin(); iter != _index.end(); ++iter)
+        entries.emplace_back(iter);
+
+    std::vector<GrainTransformerTypeUniquePtr>          transformers(entries.size());
+
+    pool.parallel_for(
+        entries.size(),
+        [this, &entries, &transformers](size_t begin, size_t end) {
+            while(begin != end) {
+                transformers[begin] = load_grain(entries[begin]->second);
+                ++begin;
+            }
+        }
+    );
+
+    for(size_t index = 0; index < entries.size(); ++index)
+        _transformers.emplace(entries[index]->first, std::move(transformers[index]));
+
+    _index.clear();
+    on_grains_loaded();
+}
+
+template <typename GrainT, typename EstimatorT>
+/*static*/ std::uint64_t GrainTransformer<GrainT, EstimatorT>::IndexedArchiveMarker(void) {
+    // This value can't be a valid number of elements
+    return std::numeric_limits<std::uint64_t>::max();
+}
+
+template <typename GrainT, typename EstimatorT>
+typename GrainTransformer<GrainT, EstimatorT>::GrainTransformerTypeUniquePtr GrainTransformer<GrainT, EstimatorT>::load_grain(IndexEntry const &entry) const {
+    // Transformers that reference their data in place (such as those saved with
+    // `Archive::LayoutValue::Flat`) share ownership of the buffer
+    Archive                                 ar(_pIndexBuffer + entry.Offset, static_cast<size_t>(entry.Size), _pIndexData);
+    GrainTransformerTypeUniquePtr           pTransformer(new typename EstimatorT::TransformerType(ar));
+
+    if(ar.AtEnd() == false)
+        throw std::runtime_error("Invalid grain data");
+
+    return pTransformer;
+}
+
+template <typename GrainT, typename EstimatorT>
+void GrainTransformer<GrainT, EstimatorT>::on_grains_loaded(void) {
+    // Release the data once all of the grains have been loaded
+    if(_index.empty()) {
+        _pIndexData.reset();
+        _pIndexBuffer = nullptr;
     }
 }
 
@@ -505,6 +851,82 @@ Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::G
     _cRemainingTrainingItems(MaxNumTrainingItemsV) {
 }
 
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV> & Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::merge(GrainEstimatorImplBase const &other) {
+    if(&other == this)
+        throw std::invalid_argument("other");
+
+    if(this->get_state() != TrainingState::Training && this->get_state() != TrainingState::Finished)
+        throw std::runtime_error("`merge` should not be invoked on an estimator that is not training or is already complete");
+
+    if(other.get_state() == TrainingState::Completed)
+        throw std::runtime_error("`merge` should not be invoked with an estimator that is already complete");
+
+    for(auto const &kvp : other._estimators)
+        get_estimator(kvp.first).merge(kvp.second);
+
+    _cRemainingTrainingItems -= std::min(_cRemainingTrainingItems, MaxNumTrainingItemsV - other._cRemainingTrainingItems);
+
+    return *this;
+}
+
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV> & Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::merge(Archive &ar) {
+    if(this->get_state() != TrainingState::Training && this->get_state() != TrainingState::Finished)
+        throw std::runtime_error("`merge` should not be invoked on an estimator that is not training or is already complete");
+
+    // Version
+    std::uint16_t                           majorVersion(Traits<std::uint16_t>::deserialize(ar));
+    std::uint16_t                           minorVersion(Traits<std::uint16_t>::deserialize(ar));
+
+    if(majorVersion != 1 || minorVersion != 0)
+        throw std::runtime_error("Unsupported archive version");
+
+    // Data
+    std::uint64_t const                     cItems(Traits<std::uint64_t>::deserialize(ar));
+    std::uint64_t                           cGrains(Traits<std::uint64_t>::deserialize(ar));
+
+    while(cGrains--) {
+        GrainT                              grain(Traits<GrainT>::deserialize(ar));
+
+        get_estimator(grain).merge(ar);
+    }
+
+    if(cItems >= _cRemainingTrainingItems)
+        _cRemainingTrainingItems = 0;
+    else
+        _cRemainingTrainingItems -= static_cast<size_t>(cItems);
+
+    return *this;
+}
+
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::save_training_state(Archive &ar) const {
+    if(this->get_state() == TrainingState::Completed)
+        throw std::runtime_error("`save_training_state` should not be invoked on an estimator that is already complete");
+
+    // Version
+    Traits<std::uint16_t>::serialize(ar, 1); // Major
+    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+
+    // Data
+    Traits<std::uint64_t>::serialize(ar, static_cast<std::uint64_t>(MaxNumTrainingItemsV - _cRemainingTrainingItems));
+    Traits<std::uint64_t>::serialize(ar, static_cast<std::uint64_t>(_estimators.size()));
+
+    for(auto const &kvp : _estimators) {
+        Traits<GrainT>::serialize(ar, kvp.first);
+        kvp.second.save_training_state(ar);
+    }
+}
+
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV> & Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::restore_training_state(Archive &ar) {
+    if(_cRemainingTrainingItems != MaxNumTrainingItemsV || _estimators.empty() == false)
+        throw std::runtime_error("`restore_training_state` should not be invoked on an estimator that has been fit");
+
+    return merge(ar);
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -519,21 +941,7 @@ FitResult Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTraining
     InputType const * const                 pEndItems(pItems + cRemainingItems);
 
     while(pItems != pEndItems) {
-        EstimatorT &                        estimator(
-            [this, pItems](void) -> EstimatorT & {
-                GrainT const &                          grain(std::get<0>(*pItems));
-                typename EstimatorMap::iterator const   iter(_estimators.find(grain));
-
-                if(iter != _estimators.end())
-                    return iter->second;
-
-                std::pair<typename EstimatorMap::iterator, bool> const      result(_estimators.emplace(std::make_pair(grain, _createFunc(_pAllColumnAnnotations))));
-
-                result.first->second.begin_training();
-
-                return result.first->second;
-            }()
-        );
+        EstimatorT &                        estimator(get_estimator(std::get<0>(*pItems)));
 
         if(estimator.get_state() == TrainingState::Training) {
             typename EstimatorT::InputType const &      input(std::get<1>(*pItems));
@@ -553,42 +961,34 @@ FitResult Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTraining
     return _cRemainingTrainingItems ? FitResult::Continue : FitResult::Complete;
 }
 
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+EstimatorT & Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::get_estimator(GrainT const &grain) {
+    typename EstimatorMap::iterator const   iter(_estimators.find(grain));
+
+    if(iter != _estimators.end())
+        return iter->second;
+
+    // Each per-grain `Estimator` publishes its `Annotations` to a private collection,
+    // which are combined into a single `Annotation` in `complete_training_impl`.
+    std::pair<typename EstimatorMap::iterator, bool> const      result(_estimators.emplace(std::make_pair(grain, _createFunc(std::make_shared<AnnotationMaps>(_pAllColumnAnnotations->size())))));
+
+    result.first->second.begin_training();
+
+    return result.first->second;
+}
+
 template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
 void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::complete_training_impl(void) /*override*/ {
     // ----------------------------------------------------------------------
     using ThisAnnotation                    = GrainEstimatorAnnotation<GrainT>;
     using ThisAnnotationMap                 = typename ThisAnnotation::AnnotationMap;
-    using Sizes                             = std::vector<size_t>;
-    // ----------------------------------------------------------------------
-
-    // This code is admittedly strange. We don't know if the per-grain `Estimator` creates `Annotations`.
-    // We are making the assumption that `Annotations` will only be created when `complete_training` is called
-    // (I believe that that is a reasonable assumption).
-    //
-    // To check if the `Estimator` has created an `Annotation`, we will capture the size of the `AnnotationMaps`
-    // before `complete_training` and after `complete_training` is invoked. Changes in size indicate that an
-    // `Annotation` has been created (note that this isn't safe if multiple threads are simultaneously
-    // modifying the `AnnotationMap` (but that problem will go away when we switch to contexts)).
-    //
-    // If a new `Annotation` is detected, we will remove it from the global `AnnotationMaps` and add it to our
-    // internal `AnnotationMap`. Once complete, we will check for the presence of added `Annotations` and
-    // create a grain-based `Annotation` that contains all the grain-specific `Annotations`.
-    //
-    // TODO: All of this code needs to change when we switch from using `AnnotationMaps` in favor of graph
-    //       contexts.
-
-    Sizes const                             sizes(
-        [this](void) {
-            Sizes                           result;
-
-            result.reserve(_pAllColumnAnnotations->size());
-
-            for(AnnotationMap const &map: *_pAllColumnAnnotations)
-                result.emplace_back(map.size());
-
-            return result;
-        }()
-    );
+    // ----------------------------------------------------------------------
+
+    // Each per-grain `Estimator` is created with its own `AnnotationMaps` (see `fit_impl`), so any
+    // `Annotations` that it creates are isolated from the global `AnnotationMaps` (which may be
+    // read and updated by `Estimators` training on other threads). Collect the `Annotations`
+    // created by each per-grain `Estimator` and create a grain-based `Annotation` that contains
+    // all of them.
 
     ThisAnnotationMap                       newAnnotations;
     size_t                                  colIndex(0);
@@ -596,47 +996,41 @@ void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItems
     for(auto & kvp : _estimators) {
         kvp.second.complete_training();
 
+        AnnotationMaps const &              maps(kvp.second.get_column_annotations());
         bool                                addedNewAnnotation(false);
 
-        for(size_t i = 0; i < _pAllColumnAnnotations->size(); ++i) {
-            assert(_pAllColumnAnnotations->size() == sizes.size());
-            assert(i < _pAllColumnAnnotations->size());
-
-            AnnotationMap &                 map((*_pAllColumnAnnotations)[i]);
-            size_t const &                  size(sizes[i]);
+        for(size_t i = 0; i < maps.size(); ++i) {
+            AnnotationMap::SnapshotPtr const    pMap(maps[i].snapshot());
+            AnnotationMap::Snapshot const &     map(*pMap);
 
-            if(map.size() != size) {
-                assert(map.size() == size + 1);
+            if(map.empty())
+                continue;
 
-                if(addedNewAnnotation)
-                    throw std::runtime_error("Unexpected AnnotationMap insertion (duplicate)");
+            if(addedNewAnnotation || map.size() != 1)
+                throw std::runtime_error("Unexpected AnnotationMap insertion (duplicate)");
 
-                if(newAnnotations.empty() == false && colIndex != i)
-                    throw std::runtime_error("Unexpected AnnotationMap insertion (different column)");
+            if(newAnnotations.empty() == false && colIndex != i)
+                throw std::runtime_error("Unexpected AnnotationMap insertion (different column)");
 
-                colIndex = i;
+            colIndex = i;
 
-                // If here, something was added. We expect that Annotation to be associated with the grain-based Estimator.
-                AnnotationMap::iterator     iter(map.find(kvp.second.Name));
+            // We expect the Annotation to be associated with the grain-based Estimator.
+            AnnotationMap::Snapshot::const_iterator const   iter(map.find(kvp.second.Name));
 
-                if(iter == map.end())
-                    throw std::runtime_error("Unexpected AnnotationMap insertion (different Estimator)");
+            if(iter == map.end())
+                throw std::runtime_error("Unexpected AnnotationMap insertion (different Estimator)");
 
-                // There should be only one entry
-                if(iter->second.size() != 1)
-                    throw std::runtime_error("Unexpected AnnotationMap size");
+            // There should be only one entry
+            if(iter->second.size() != 1)
+                throw std::runtime_error("Unexpected AnnotationMap size");
 
-                // Insert this value into our working map
-                std::pair<typename ThisAnnotationMap::iterator, bool> const     result(newAnnotations.emplace(std::make_pair(kvp.first, std::move(iter->second[0]))));
+            // Insert this value into our working map
+            std::pair<typename ThisAnnotationMap::iterator, bool> const     result(newAnnotations.emplace(std::make_pair(kvp.first, iter->second[0])));
 
-                if(result.first == newAnnotations.end() || result.second == false)
-                    throw std::runtime_error("Invalid AnnotationMap insertion");
+            if(result.first == newAnnotations.end() || result.second == false)
+                throw std::runtime_error("Invalid AnnotationMap insertion");
 
-                addedNewAnnotation = true;
-
-                // Remove the value from the global map (which should restore the original sizes)
-                map.erase(iter);
-            }
+            addedNewAnnotation = true;
         }
     }
 
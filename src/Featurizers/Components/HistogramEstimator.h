@@ -4,7 +4,9 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
 #include <unordered_map>
+#include <vector>
 
 #include "TrainingOnlyEstimatorImpl.h"
 
@@ -71,6 +73,10 @@ public:
     // ----------------------------------------------------------------------
     static constexpr char const * const     NameValue = HistogramEstimatorName;
 
+    // Any new value means that the histogram hasn't converged, regardless of
+    // how small the relative change in the number of distinct values is
+    static constexpr size_t const           NumExactConvergenceStatistics = 1;
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
@@ -79,6 +85,14 @@ public:
     void fit(InputType const &input);
     HistogramAnnotationData<T> complete_training(void);
 
+    void merge(HistogramTrainingOnlyPolicy const &other);
+    void merge(Archive &ar);
+    void save(Archive &ar) const;
+
+    // Returns the number of distinct values and the relative frequency of the
+    // most common value.
+    std::vector<double> get_convergence_statistics(void) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -93,6 +107,10 @@ private:
     // |
     // ----------------------------------------------------------------------
     Histogram                               _histogram;
+
+    // Running totals used by `get_convergence_statistics`
+    std::uint64_t                           _cItems = 0;
+    typename Histogram::mapped_type         _maxCount = 0;
 };
 
 } // namespace Details
@@ -150,6 +168,9 @@ void Details::HistogramTrainingOnlyPolicy<T>::fit(InputType const &input) {
     );
 
     count += 1;
+
+    ++_cItems;
+    _maxCount = std::max(_maxCount, count);
 }
 
 template <typename T>
@@ -157,6 +178,58 @@ HistogramAnnotationData<T> Details::HistogramTrainingOnlyPolicy<T>::complete_tra
     return HistogramAnnotationData<T>(std::move(_histogram));
 }
 
+template <typename T>
+void Details::HistogramTrainingOnlyPolicy<T>::merge(HistogramTrainingOnlyPolicy const &other) {
+    if(_histogram.empty()) {
+        _histogram = other._histogram;
+        _cItems = other._cItems;
+        _maxCount = other._maxCount;
+        return;
+    }
+
+    for(auto const &kvp : other._histogram) {
+        typename Histogram::mapped_type &   count(_histogram[kvp.first]);
+
+        if(std::numeric_limits<typename Histogram::mapped_type>::max() - count < kvp.second)
+            throw std::runtime_error("Overflow occurred when merging histograms");
+
+        count += kvp.second;
+        _maxCount = std::max(_maxCount, count);
+    }
+
+    _cItems += other._cItems;
+}
+
+template <typename T>
+void Details::HistogramTrainingOnlyPolicy<T>::merge(Archive &ar) {
+    HistogramTrainingOnlyPolicy             other;
+
+    other._histogram = Traits<Histogram>::deserialize(ar);
+
+    for(auto const &kvp : other._histogram) {
+        other._cItems += kvp.second;
+        other._maxCount = std::max(other._maxCount, kvp.second);
+    }
+
+    merge(other);
+}
+
+template <typename T>
+void Details::HistogramTrainingOnlyPolicy<T>::save(Archive &ar) const {
+    Traits<Histogram>::serialize(ar, _histogram);
+}
+
+template <typename T>
+std::vector<double> Details::HistogramTrainingOnlyPolicy<T>::get_convergence_statistics(void) const {
+    if(_histogram.empty())
+        return std::vector<double>();
+
+    return std::vector<double>{
+        static_cast<double>(_histogram.size()),
+        static_cast<double>(_maxCount) / static_cast<double>(_cItems)
+    };
+}
+
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
@@ -58,6 +58,7 @@ public:
     bool operator!=(ImputerTransformer const &other) const;
 
     void save(Archive &ar) const override;
+    bool is_stateless(void) const override;
 
 private:
     // ----------------------------------------------------------------------
@@ -66,6 +67,10 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) override;
+    TransformedType transform_impl(InputType const &input) override;
+
+    TransformedType transform(InputType const &input) const;
 };
 
 // ----------------------------------------------------------------------
@@ -118,6 +123,11 @@ bool ImputerTransformer<InputT, TransformedT>::operator!=(ImputerTransformer con
     return (*this == other) == false;
 }
 
+template <typename InputT, typename TransformedT>
+bool ImputerTransformer<InputT, TransformedT>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template <typename InputT, typename TransformedT>
 void ImputerTransformer<InputT, TransformedT>::save(Archive &ar) const /*override*/ {
     // Version
@@ -133,14 +143,32 @@ void ImputerTransformer<InputT, TransformedT>::save(Archive &ar) const /*overrid
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
 void ImputerTransformer<InputT, TransformedT>::execute_impl(InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+template <typename InputT, typename TransformedT>
+void ImputerTransformer<InputT, TransformedT>::execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) /*override*/ {
+    InputType const * const                 pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs)
+        *pOutputs++ = transform(*pInputs++);
+}
+
+template <typename InputT, typename TransformedT>
+typename ImputerTransformer<InputT, TransformedT>::TransformedType ImputerTransformer<InputT, TransformedT>::transform_impl(InputType const &input) /*override*/ {
+    return transform(input);
+}
+
+template <typename InputT, typename TransformedT>
+typename ImputerTransformer<InputT, TransformedT>::TransformedType ImputerTransformer<InputT, TransformedT>::transform(InputType const &input) const {
     // ----------------------------------------------------------------------
     using TheseTraits                       = Traits<InputType>;
     // ----------------------------------------------------------------------
 
     if(TheseTraits::IsNull(input))
-        callback(Value);
-    else
-        callback(static_cast<TransformedT>(TheseTraits::GetNullableValue(input)));
+        return Value;
+
+    return static_cast<TransformedT>(TheseTraits::GetNullableValue(input));
 }
 
 } // namespace Components
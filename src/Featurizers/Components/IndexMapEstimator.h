@@ -89,6 +89,13 @@ public:
     void fit(InputType const &input);
     IndexMapAnnotationData<T> complete_training(void);
 
+    // The index map is created from the `HistogramEstimator` annotation, so
+    // sharded training merges the histograms and there isn't any partial state
+    // to merge here.
+    void merge(IndexMapTrainingOnlyPolicy const &other);
+    void merge(Archive &ar);
+    void save(Archive &ar) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -243,6 +250,18 @@ IndexMapAnnotationData<T> Details::IndexMapTrainingOnlyPolicy<T, IndexMapEstimat
     return IndexMapAnnotationData<T>(CreateIndexMap<T>(data.Value, std::move(_values)));
 }
 
+template <typename T, typename IndexMapEstimatorT>
+void Details::IndexMapTrainingOnlyPolicy<T, IndexMapEstimatorT>::merge(IndexMapTrainingOnlyPolicy const &) {
+}
+
+template <typename T, typename IndexMapEstimatorT>
+void Details::IndexMapTrainingOnlyPolicy<T, IndexMapEstimatorT>::merge(Archive &) {
+}
+
+template <typename T, typename IndexMapEstimatorT>
+void Details::IndexMapTrainingOnlyPolicy<T, IndexMapEstimatorT>::save(Archive &) const {
+}
+
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
@@ -4,7 +4,9 @@
 // ----------------------------------------------------------------------
 #pragma once
 
-#include <queue>
+#include <algorithm>
+#include <functional>
+#include <vector>
 
 #include "TrainingOnlyEstimatorImpl.h"
 
@@ -74,26 +76,31 @@ public:
     void fit(InputType const &input);
     MedianAnnotationData<TransformedT> complete_training(void);
 
+    void merge(MedianTrainingOnlyPolicy const &other);
+    void merge(Archive &ar);
+    void save(Archive &ar) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
     // |  Private Types
     // |
     // ----------------------------------------------------------------------
-    // Note that a priority_queue is used here over another type, as a priority_queue
-    // ensures that sorting only happens when a value is retrieved while sorting would
-    // need to happen during insertion for other types. For this algorithm, it means
-    // that sorting only happens when we need to rebalance the queues.
-    using MaxHeapType                       = std::priority_queue<TransformedT>;
-    using MinHeapType                       = std::priority_queue<TransformedT, std::vector<TransformedT>, std::greater<TransformedT>>;
+    // The values are stored as heaps (maintained with std::push_heap and std::pop_heap)
+    // rather than sorted, as a heap only needs to be partially ordered; insertion and
+    // removal are logarithmic. Vectors are used (rather than std::priority_queue) so
+    // that the values can be enumerated when merging and saving.
+    using HeapType                          = std::vector<TransformedT>;
+    using MaxHeapCompare                    = std::less<TransformedT>;
+    using MinHeapCompare                    = std::greater<TransformedT>;
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    MaxHeapType                             _smaller;
-    MinHeapType                             _larger;
+    HeapType                                _smaller;               // Max heap (ordered by `MaxHeapCompare`)
+    HeapType                                _larger;                // Min heap (ordered by `MinHeapCompare`)
 
     // ----------------------------------------------------------------------
     // |
@@ -108,6 +115,12 @@ private:
 
     TransformedT _get_interpolated_value(std::true_type /*supports Interpolated values*/);
     TransformedT _get_interpolated_value(std::false_type /*supports Interpolated values*/);
+
+    template <typename CompareT>
+    static void PushHeap(HeapType &heap, TransformedT value);
+
+    template <typename CompareT>
+    static TransformedT PopHeap(HeapType &heap);
 };
 
 } // namespace Details
@@ -173,7 +186,7 @@ MedianAnnotationData<TransformedT> Details::MedianTrainingOnlyPolicy<InputT, Tra
         assert(_smaller.empty() == false);
         assert(InterpolateValuesV == false || _smaller.size() == _larger.size() + 1);
 
-        median = _smaller.top();
+        median = _smaller.front();
     }
     else
         median = this->_get_interpolated_value(std::integral_constant<bool, InterpolateValuesV>());
@@ -183,12 +196,40 @@ MedianAnnotationData<TransformedT> Details::MedianTrainingOnlyPolicy<InputT, Tra
 #endif
 
     // Clean up after ourselves
-    _smaller = MaxHeapType();
-    _larger = MinHeapType();
+    _smaller = HeapType();
+    _larger = HeapType();
 
     return median;
 }
 
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::merge(MedianTrainingOnlyPolicy const &other) {
+    for(TransformedT const &value : other._smaller)
+        fit_impl(value);
+
+    for(TransformedT const &value : other._larger)
+        fit_impl(value);
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::merge(Archive &ar) {
+    std::uint64_t                           cValues(Traits<std::uint64_t>::deserialize(ar));
+
+    while(cValues--)
+        fit_impl(Traits<TransformedT>::deserialize(ar));
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::save(Archive &ar) const {
+    Traits<std::uint64_t>::serialize(ar, static_cast<std::uint64_t>(_smaller.size() + _larger.size()));
+
+    for(TransformedT const &value : _smaller)
+        Traits<TransformedT>::serialize(ar, value);
+
+    for(TransformedT const &value : _larger)
+        Traits<TransformedT>::serialize(ar, value);
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -208,52 +249,30 @@ void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 template <typename U>
 void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::fit_impl(U const &input) {
-    if(_smaller.empty() || static_cast<TransformedT>(input) <= _smaller.top()) {
-#if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-        _smaller.push(static_cast<TransformedT>(input));
-#else
-        _smaller.emplace(static_cast<TransformedT>(input));
-#endif
-    }
-    else {
-#if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-        _larger.push(static_cast<TransformedT>(input));
-#else
-        _larger.emplace(static_cast<TransformedT>(input));
-#endif
-    }
+    if(_smaller.empty() || static_cast<TransformedT>(input) <= _smaller.front())
+        PushHeap<MaxHeapCompare>(_smaller, static_cast<TransformedT>(input));
+    else
+        PushHeap<MinHeapCompare>(_larger, static_cast<TransformedT>(input));
 
     // Rebalance if necessary
-    if(_smaller.size() >= _larger.size() + 2) {
-#if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-        _larger.push(_smaller.top());
-#else
-        _larger.emplace(_smaller.top());
-#endif
-        _smaller.pop();
-    }
-    else if(_larger.size() > _smaller.size()) {
-#if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-        _smaller.push(_larger.top());
-#else
-        _smaller.emplace(_larger.top());
-#endif
-        _larger.pop();
-    }
+    if(_smaller.size() >= _larger.size() + 2)
+        PushHeap<MinHeapCompare>(_larger, PopHeap<MaxHeapCompare>(_smaller));
+    else if(_larger.size() > _smaller.size())
+        PushHeap<MaxHeapCompare>(_smaller, PopHeap<MinHeapCompare>(_larger));
 }
 
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::_get_interpolated_value(std::true_type /*supports Interpolated values*/) {
     assert(_smaller.empty() == false);
 
-    TransformedT const                      greater(_larger.empty() ? 0 : _larger.top());
+    TransformedT const                      greater(_larger.empty() ? 0 : _larger.front());
 
 #if (defined __clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wdouble-promotion"
 #endif
 
-    return static_cast<TransformedT>((static_cast<double>(_smaller.top()) + greater) / 2);
+    return static_cast<TransformedT>((static_cast<double>(_smaller.front()) + greater) / 2);
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
@@ -265,6 +284,26 @@ TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, Interpolate
     throw std::runtime_error("This should never be called");
 }
 
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+template <typename CompareT>
+/*static*/ void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::PushHeap(HeapType &heap, TransformedT value) {
+    heap.emplace_back(std::move(value));
+    std::push_heap(heap.begin(), heap.end(), CompareT());
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+template <typename CompareT>
+/*static*/ TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::PopHeap(HeapType &heap) {
+    assert(heap.empty() == false);
+
+    std::pop_heap(heap.begin(), heap.end(), CompareT());
+
+    TransformedT                            result(std::move(heap.back()));
+
+    heap.pop_back();
+    return result;
+}
+
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
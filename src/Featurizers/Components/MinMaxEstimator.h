@@ -79,6 +79,10 @@ public:
     void fit(InputType const &input);
     MinMaxAnnotationData<T> complete_training(void);
 
+    void merge(MinMaxTrainingOnlyPolicy const &other);
+    void merge(Archive &ar);
+    void save(Archive &ar) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -150,6 +154,30 @@ MinMaxAnnotationData<T> Details::MinMaxTrainingOnlyPolicy<T>::complete_training(
     return MinMaxAnnotationData<T>(std::move(_min), std::move(_max));
 }
 
+template <typename T>
+void Details::MinMaxTrainingOnlyPolicy<T>::merge(MinMaxTrainingOnlyPolicy const &other) {
+    if(other._min < _min)
+        _min = other._min;
+    if(other._max > _max)
+        _max = other._max;
+}
+
+template <typename T>
+void Details::MinMaxTrainingOnlyPolicy<T>::merge(Archive &ar) {
+    MinMaxTrainingOnlyPolicy                other;
+
+    other._min = Traits<T>::deserialize(ar);
+    other._max = Traits<T>::deserialize(ar);
+
+    merge(other);
+}
+
+template <typename T>
+void Details::MinMaxTrainingOnlyPolicy<T>::save(Archive &ar) const {
+    Traits<T>::serialize(ar, _min);
+    Traits<T>::serialize(ar, _max);
+}
+
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
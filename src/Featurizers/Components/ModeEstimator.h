@@ -71,6 +71,68 @@ public:
     ModeAnnotationData<T> complete_training(void);
 };
 
+/////////////////////////////////////////////////////////////////////////
+///  \class         SinglePassModeTrainingOnlyPolicy
+///  \brief         `SinglePassModeEstimator` implementation details.
+///
+template <typename T, bool AllowNullModeV>
+class SinglePassModeTrainingOnlyPolicy {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    static_assert(AllowNullModeV == false || Traits<T>::IsNullableType, "'T' must be a nullable type if 'AllowNullModeV' is true");
+
+    using InputType                         = T;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr char const * const     NameValue = ModeEstimatorName;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    void fit(InputType const &input);
+    ModeAnnotationData<T> complete_training(void);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+
+    // The number of times that a value was encountered and the order in which
+    // it was first encountered; this is the information provided by the
+    // `HistogramEstimator` and `OrderEstimator` in a single lookup.
+    struct ValueInfo {
+        std::uint32_t                       Count;
+        std::uint32_t                       Index;
+    };
+
+    using ValueInfoMap =
+        std::unordered_map<
+            T,
+            ValueInfo,
+            std::hash<T>,
+            typename Traits<T>::key_equal
+        >;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    ValueInfoMap                            _values;
+};
+
 } // namespace Details
 
 /////////////////////////////////////////////////////////////////////////
@@ -121,6 +183,21 @@ public:
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(ModeEstimator);
 };
 
+/////////////////////////////////////////////////////////////////////////
+///  \typedef       SinglePassModeEstimator
+///  \brief         Creates `ModeAnnotationData` with the most common value
+///                 by counting values as they are encountered, rather than
+///                 relying on annotations created by the `HistogramEstimator`
+///                 and `OrderEstimator`. The mode is available after a single
+///                 pass over the training data.
+///
+template <
+    typename T,
+    bool AllowNullModeV=false,
+    size_t MaxNumTrainingItemsV=std::numeric_limits<size_t>::max()
+>
+using SinglePassModeEstimator               = TrainingOnlyEstimatorImpl<Details::SinglePassModeTrainingOnlyPolicy<T, AllowNullModeV>, MaxNumTrainingItemsV>;
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -240,6 +317,51 @@ ModeAnnotationData<T> Details::ModeTrainingOnlyPolicy<T, AllowNullModeV, ModeEst
     return ModeAnnotationData<T>(iterMode->first);
 }
 
+// ----------------------------------------------------------------------
+// |
+// |  Details::SinglePassModeTrainingOnlyPolicy
+// |
+// ----------------------------------------------------------------------
+template <typename T, bool AllowNullModeV>
+void Details::SinglePassModeTrainingOnlyPolicy<T, AllowNullModeV>::fit(InputType const &input) {
+    typename ValueInfoMap::iterator         iter(_values.find(input));
+
+    if(iter == _values.end()) {
+        std::pair<typename ValueInfoMap::iterator, bool> const              result(_values.emplace(input, ValueInfo{0, static_cast<std::uint32_t>(_values.size())}));
+
+        iter = result.first;
+    }
+
+    iter->second.Count += 1;
+}
+
+template <typename T, bool AllowNullModeV>
+ModeAnnotationData<T> Details::SinglePassModeTrainingOnlyPolicy<T, AllowNullModeV>::complete_training(void) {
+    // This is the same error produced by `OrderAnnotationData` when no values were encountered
+    if(_values.empty())
+        throw std::invalid_argument("value");
+
+    typename ValueInfoMap::const_iterator   iterMode(_values.end());
+
+    for(typename ValueInfoMap::const_iterator iter=_values.begin(); iter != _values.end(); ++iter) {
+        if(IsSupportedModeEstimatorValue(iter->first, std::integral_constant<bool, AllowNullModeV>()) == false)
+            continue;
+
+        // If the counts are equal, only take this value if it was seen before the current best
+        if(
+            iterMode == _values.end()
+            || iter->second.Count > iterMode->second.Count
+            || (iter->second.Count == iterMode->second.Count && iter->second.Index < iterMode->second.Index)
+        )
+            iterMode = iter;
+    }
+
+    if(iterMode == _values.end())
+        throw std::runtime_error("The histogram does not contain any supported values");
+
+    return ModeAnnotationData<T>(iterMode->first);
+}
+
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
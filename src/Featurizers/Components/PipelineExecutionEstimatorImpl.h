@@ -53,37 +53,42 @@ public:
 
     void save(Archive &ar) const override;
 
-    using BaseType::execute;
+    // MSVC has problems when the method definition is separated from the declaration
+    bool is_stateless(void) const override {
+        return _transformerChain.is_stateless();
+    }
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            clone
+    ///  \brief         Clones each stateful `Transformer` in the chain (stateless
+    ///                 `Transformers` are shared with the clone), returning
+    ///                 nullptr if any of them don't support cloning.
+    ///
     // MSVC has problems when the method definition is separated from the declaration
+    typename BaseType::TransformerUniquePtr clone(void) const override {
+        typename BaseType::TransformerUniquePtr                 pClone(new PipelineExecutionTransformer(*this, Details::CloneTag()));
+
+        if(static_cast<PipelineExecutionTransformer &>(*pClone)._transformerChain.is_cloned() == false)
+            return typename BaseType::TransformerUniquePtr();
+
+        return pClone;
+    }
+
+    using BaseType::execute;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute
+    ///  \brief         Returns the single result generated by the provided input.
+    ///                 The input is never copied; each result is passed directly
+    ///                 to the next `Transformer` in the chain.
+    ///
     typename BaseType::TransformedType execute(typename BaseType::InputType &input) {
-        // ----------------------------------------------------------------------
-        using TransformedType               = typename BaseType::TransformedType;
-        // ----------------------------------------------------------------------
-
-        // Do absolutely everything possible to avoid default construction, as we don't want
-        // to burden transformed types with that concept.
-        TransformedType *                   pResult(reinterpret_cast<TransformedType *>(alloca(sizeof(TransformedType))));
-        size_t                              cResults(0);
-
-        execute(
-            input,
-            [&pResult, &cResults](TransformedType value) {
-                ++cResults;
-                new (reinterpret_cast<void *>(pResult)) TransformedType(std::move(value));
-            }
-        );
-
-        if(cResults != 1)
-            throw std::runtime_error("This method should only be used with Transformers that generate 1 output value for each input value");
-
-        return std::move(*pResult);
+        return execute(static_cast<typename BaseType::InputType const &>(input));
     }
 
+    // MSVC has problems when the method definition is separated from the declaration
     typename BaseType::TransformedType execute(typename BaseType::InputType const &input) {
-        typename BaseType::InputType        temp(input);
-
-        return execute(temp);
+        return _transformerChain.template transform<typename BaseType::TransformedType>(input);
     }
 
 private:
@@ -97,6 +102,7 @@ private:
 
     // ----------------------------------------------------------------------
     // |  Private Methods
+    PipelineExecutionTransformer(PipelineExecutionTransformer const &other, Details::CloneTag tag);
 
     // MSVC has problems when attempting to separate the definition from the declaration
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
@@ -107,6 +113,11 @@ private:
     void flush_impl(typename BaseType::CallbackFunction const &callback) override {
         _transformerChain.flush(callback);
     }
+
+    // MSVC has problems when attempting to separate the definition from the declaration
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        _transformerChain.execute(pInputs, cInputs, pOutputs);
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -194,6 +205,20 @@ public:
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(PipelineExecutionEstimatorImpl);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            enable_pipelined_training
+    ///  \brief         Once an `Estimator` in the chain has created its `Transformer`,
+    ///                 the items it transforms are fit by the `Estimators` that
+    ///                 follow it on a dedicated worker thread, connected by a
+    ///                 bounded queue of up to `maxPendingBatches` batches. This
+    ///                 allows the stages of long chains to overlap rather than
+    ///                 run back to back. Batches produced by `Transformers` that
+    ///                 aren't stateless are always fit on the calling thread.
+    ///
+    ///                 This method must be invoked before training begins.
+    ///
+    void enable_pipelined_training(size_t maxPendingBatches=4);
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -207,7 +232,9 @@ private:
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    EstimatorChain                          _estimatorChain;
+    // The chain is allocated so that it doesn't move when this object is moved; the
+    // worker threads created by pipelined training reference elements of the chain.
+    std::unique_ptr<EstimatorChain>         _pEstimatorChain;
 
     // ----------------------------------------------------------------------
     // |
@@ -218,7 +245,7 @@ private:
 
     // MSVC has problems when attempting to separate the definition from the declaration
     FitResult fit_impl(typename BaseType::InputType const *pBuffer, size_t cBuffer) override {
-        return _estimatorChain.fit(pBuffer, cBuffer);
+        return _pEstimatorChain->fit(pBuffer, cBuffer);
     }
 
     bool on_data_completed_impl(void) override;
@@ -226,7 +253,7 @@ private:
 
     // MSVC has problems when attempting to separate the definition from the declaration
     typename BaseType::TransformerUniquePtr create_transformer_impl(void) override {
-        return typename BaseType::TransformerUniquePtr(new TransformerType(_estimatorChain));
+        return typename BaseType::TransformerUniquePtr(new TransformerType(*_pEstimatorChain));
     }
 };
 
@@ -255,6 +282,11 @@ PipelineExecutionTransformer<EstimatorTs...>::PipelineExecutionTransformer(Archi
     _transformerChain(ar) {
 }
 
+template <typename... EstimatorTs>
+PipelineExecutionTransformer<EstimatorTs...>::PipelineExecutionTransformer(PipelineExecutionTransformer const &other, Details::CloneTag tag) :
+    _transformerChain(other._transformerChain, tag) {
+}
+
 template <typename... EstimatorTs>
 bool PipelineExecutionTransformer<EstimatorTs...>::operator==(PipelineExecutionTransformer const &other) const {
     return _transformerChain == other._transformerChain;
@@ -273,34 +305,45 @@ void PipelineExecutionTransformer<EstimatorTs...>::save(Archive &ar) const /*ove
 template <typename... EstimatorTs>
 PipelineExecutionEstimatorImpl<EstimatorTs...>::PipelineExecutionEstimatorImpl(char const *name, AnnotationMapsPtr pAllColumnAnnotations) :
     BaseType(name, pAllColumnAnnotations),
-    _estimatorChain(pAllColumnAnnotations) {
+    _pEstimatorChain(new EstimatorChain(pAllColumnAnnotations)) {
 }
 
 template <typename... EstimatorTs>
 template <typename... ConstructFuncTs>
 PipelineExecutionEstimatorImpl<EstimatorTs...>::PipelineExecutionEstimatorImpl(char const *name, AnnotationMapsPtr pAllColumnAnnotations, ConstructFuncTs &&... funcs) :
     BaseType(name, pAllColumnAnnotations),
-    _estimatorChain(std::forward<ConstructFuncTs>(funcs)...) {
+    _pEstimatorChain(new EstimatorChain(std::forward<ConstructFuncTs>(funcs)...)) {
 
     static_assert(sizeof...(EstimatorTs) == sizeof...(ConstructFuncTs), "The number of constructor creation args must be equal to the number of estimators");
 }
 
+template <typename... EstimatorTs>
+void PipelineExecutionEstimatorImpl<EstimatorTs...>::enable_pipelined_training(size_t maxPendingBatches) {
+    if(maxPendingBatches == 0)
+        throw std::invalid_argument("maxPendingBatches");
+
+    if(BaseType::get_state() != TrainingState::Pending)
+        throw std::runtime_error("Pipelined training must be enabled before training begins");
+
+    _pEstimatorChain->enable_pipelined_training(maxPendingBatches);
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 template <typename... EstimatorTs>
 bool PipelineExecutionEstimatorImpl<EstimatorTs...>::begin_training_impl(void) /*override*/ {
-    return _estimatorChain.begin_training();
+    return _pEstimatorChain->begin_training();
 }
 
 template <typename... EstimatorTs>
 bool PipelineExecutionEstimatorImpl<EstimatorTs...>::on_data_completed_impl(void) /*override*/ {
-    return _estimatorChain.on_data_completed();
+    return _pEstimatorChain->on_data_completed();
 }
 
 template <typename... EstimatorTs>
 void PipelineExecutionEstimatorImpl<EstimatorTs...>::complete_training_impl(void) /*override*/ {
-    _estimatorChain.complete_training();
+    _pEstimatorChain->complete_training();
 }
 
 } // namespace Components
@@ -0,0 +1,363 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "../../Featurizer.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+static constexpr char const * const         SamplingEstimatorName("SamplingEstimator");
+
+/////////////////////////////////////////////////////////////////////////
+///  \enum          SamplingMethod
+///  \brief         Method used to select the training items provided to
+///                 the wrapped `Estimator`.
+///
+enum class SamplingMethod : unsigned char {
+    Reservoir = 1,                          ///> A uniform sample of a fixed number of items is collected while the data is streamed and provided to the `Estimator` once all of the data has been seen.
+    Bernoulli                               ///> Each item is provided to the `Estimator` independently with a fixed probability.
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        SamplingOptions
+///  \brief         Runtime configuration for a `SamplingEstimator`.
+///
+struct SamplingOptions {
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    SamplingMethod const                    Method;
+    size_t const                            ReservoirSize;      // Used with SamplingMethod::Reservoir
+    double const                            Probability;        // Used with SamplingMethod::Bernoulli
+    std::uint64_t const                     Seed;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    static SamplingOptions Reservoir(size_t reservoirSize, std::uint64_t seed=0);
+    static SamplingOptions Bernoulli(double probability, std::uint64_t seed=0);
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(SamplingOptions);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    SamplingOptions(SamplingMethod method, size_t reservoirSize, double probability, std::uint64_t seed);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SamplingEstimator
+///  \brief         Wraps a `FitEstimator` so that it is trained on an unbiased
+///                 random sample of the training data rather than on the
+///                 items at the head of the stream (which is the behavior
+///                 of the compile-time `MaxNumTrainingItemsV` limit). The
+///                 sample size is configured at runtime and the selection
+///                 is reproducible for a given seed.
+///
+///                 With `SamplingMethod::Reservoir`, the sampled items are
+///                 provided to the wrapped `Estimator` when `on_data_completed`
+///                 or `complete_training` is invoked; the sample is provided
+///                 again if the `Estimator` requests additional passes over
+///                 the data. With `SamplingMethod::Bernoulli`, the generator is
+///                 reseeded at the start of each pass so that every pass
+///                 selects the same items.
+///
+template <typename EstimatorT>
+class SamplingEstimator : public FitEstimator<typename EstimatorT::InputType> {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using BaseType                          = FitEstimator<typename EstimatorT::InputType>;
+    using InputType                         = typename EstimatorT::InputType;
+    using EstimatorType                     = EstimatorT;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    template <typename... EstimatorArgsT>
+    SamplingEstimator(AnnotationMapsPtr pAllColumnAnnotations, SamplingOptions options, EstimatorArgsT &&... estimatorArgs);
+
+    ~SamplingEstimator(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(SamplingEstimator);
+
+    EstimatorT & get_estimator(void);
+    EstimatorT const & get_estimator(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            get_num_items_seen
+    ///  \brief         Returns the number of items provided to `fit`.
+    ///
+    std::uint64_t get_num_items_seen(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using Items                             = std::vector<InputType>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    SamplingOptions const                   _options;
+    EstimatorT                              _estimator;
+
+    std::mt19937_64                         _generator;
+    std::uint64_t                           _cItemsSeen;
+
+    Items                                   _reservoir;
+    bool                                    _isReservoirProvided;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    bool begin_training_impl(void) override;
+    FitResult fit_impl(InputType const *pItems, size_t cItems) override;
+    bool on_data_completed_impl(void) override;
+    void complete_training_impl(void) override;
+
+    void fit_reservoir(InputType const *pItems, size_t cItems);
+    FitResult fit_bernoulli(InputType const *pItems, size_t cItems);
+
+    void provide_reservoir(void);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  SamplingOptions
+// |
+// ----------------------------------------------------------------------
+inline SamplingOptions::SamplingOptions(SamplingMethod method, size_t reservoirSize, double probability, std::uint64_t seed) :
+    Method(method),
+    ReservoirSize(reservoirSize),
+    Probability(probability),
+    Seed(seed) {
+}
+
+inline /*static*/ SamplingOptions SamplingOptions::Reservoir(size_t reservoirSize, std::uint64_t seed) {
+    if(reservoirSize == 0)
+        throw std::invalid_argument("reservoirSize");
+
+    return SamplingOptions(SamplingMethod::Reservoir, reservoirSize, 1.0, seed);
+}
+
+inline /*static*/ SamplingOptions SamplingOptions::Bernoulli(double probability, std::uint64_t seed) {
+    if(std::isnan(probability) || probability <= 0.0 || probability > 1.0)
+        throw std::invalid_argument("probability");
+
+    return SamplingOptions(SamplingMethod::Bernoulli, 0, probability, seed);
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  SamplingEstimator
+// |
+// ----------------------------------------------------------------------
+template <typename EstimatorT>
+template <typename... EstimatorArgsT>
+SamplingEstimator<EstimatorT>::SamplingEstimator(AnnotationMapsPtr pAllColumnAnnotations, SamplingOptions options, EstimatorArgsT &&... estimatorArgs) :
+    BaseType(SamplingEstimatorName, pAllColumnAnnotations),
+    _options(std::move(options)),
+    _estimator(std::move(pAllColumnAnnotations), std::forward<EstimatorArgsT>(estimatorArgs)...),
+    _generator(_options.Seed),
+    _cItemsSeen(0),
+    _isReservoirProvided(false) {
+}
+
+template <typename EstimatorT>
+EstimatorT & SamplingEstimator<EstimatorT>::get_estimator(void) {
+    return _estimator;
+}
+
+template <typename EstimatorT>
+EstimatorT const & SamplingEstimator<EstimatorT>::get_estimator(void) const {
+    return _estimator;
+}
+
+template <typename EstimatorT>
+std::uint64_t SamplingEstimator<EstimatorT>::get_num_items_seen(void) const {
+    return _cItemsSeen;
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename EstimatorT>
+bool SamplingEstimator<EstimatorT>::begin_training_impl(void) /*override*/ {
+    _estimator.begin_training();
+    return _estimator.get_state() == TrainingState::Training;
+}
+
+template <typename EstimatorT>
+FitResult SamplingEstimator<EstimatorT>::fit_impl(InputType const *pItems, size_t cItems) /*override*/ {
+    if(_options.Method == SamplingMethod::Bernoulli)
+        return fit_bernoulli(pItems, cItems);
+
+    fit_reservoir(pItems, cItems);
+
+    // Any item in the stream may be selected, so all of the data must be seen
+    return FitResult::Continue;
+}
+
+template <typename EstimatorT>
+bool SamplingEstimator<EstimatorT>::on_data_completed_impl(void) /*override*/ {
+    if(_options.Method == SamplingMethod::Reservoir) {
+        provide_reservoir();
+        return true;
+    }
+
+    if(_estimator.get_state() == TrainingState::Training)
+        _estimator.on_data_completed();
+
+    if(_estimator.get_state() != TrainingState::Training)
+        return true;
+
+    // The data will be provided again; select the same items during the next pass
+    _generator.seed(_options.Seed);
+    return false;
+}
+
+template <typename EstimatorT>
+void SamplingEstimator<EstimatorT>::complete_training_impl(void) /*override*/ {
+    if(_options.Method == SamplingMethod::Reservoir)
+        provide_reservoir();
+
+    _estimator.complete_training();
+}
+
+template <typename EstimatorT>
+void SamplingEstimator<EstimatorT>::fit_reservoir(InputType const *pItems, size_t cItems) {
+    InputType const * const                 pEndItems(pItems + cItems);
+
+    // Fill the reservoir
+    while(pItems != pEndItems && _reservoir.size() < _options.ReservoirSize) {
+        _reservoir.emplace_back(*pItems++);
+        ++_cItemsSeen;
+    }
+
+    // Algorithm R: the n-th item replaces a random item in the reservoir with
+    // probability ReservoirSize / n. Note that the modulo is used rather than
+    // std::uniform_int_distribution so that the samples are the same across
+    // standard library implementations; the bias is negligible with 64-bit values.
+    while(pItems != pEndItems) {
+        ++_cItemsSeen;
+
+        std::uint64_t const                 index(_generator() % _cItemsSeen);
+
+        if(index < _reservoir.size())
+            _reservoir[static_cast<size_t>(index)] = *pItems;
+
+        ++pItems;
+    }
+}
+
+template <typename EstimatorT>
+FitResult SamplingEstimator<EstimatorT>::fit_bernoulli(InputType const *pItems, size_t cItems) {
+    // ----------------------------------------------------------------------
+    using GeneratorResult                   = std::mt19937_64::result_type;
+    // ----------------------------------------------------------------------
+
+    if(_estimator.get_state() != TrainingState::Training)
+        return FitResult::Complete;
+
+    // Compare against a threshold rather than using std::bernoulli_distribution
+    // so that the samples are the same across standard library implementations.
+    bool const                              acceptAll(_options.Probability >= 1.0);
+    GeneratorResult const                   threshold(acceptAll ? 0 : static_cast<GeneratorResult>(std::ldexp(_options.Probability, 64)));
+
+    InputType const * const                 pEndItems(pItems + cItems);
+    Items                                   items;
+
+    while(pItems != pEndItems) {
+        if(acceptAll || _generator() < threshold)
+            items.emplace_back(*pItems);
+
+        ++pItems;
+    }
+
+    _cItemsSeen += cItems;
+
+    if(items.empty())
+        return FitResult::Continue;
+
+    // A `Reset` is passed through to the caller, as the wrapped `Estimator`
+    // must see the samples from the start of the data again.
+    FitResult const                         result(_estimator.fit(items.data(), items.size()));
+
+    if(result == FitResult::Reset)
+        _generator.seed(_options.Seed);
+
+    return result;
+}
+
+template <typename EstimatorT>
+void SamplingEstimator<EstimatorT>::provide_reservoir(void) {
+    if(_isReservoirProvided)
+        return;
+
+    _isReservoirProvided = true;
+
+    while(_estimator.get_state() == TrainingState::Training) {
+        if(_reservoir.empty() == false) {
+            FitResult                       result(_estimator.fit(_reservoir.data(), _reservoir.size()));
+
+            while(result == FitResult::Reset)
+                result = _estimator.fit(_reservoir.data(), _reservoir.size());
+
+            if(result == FitResult::Complete)
+                break;
+        }
+
+        // The `Estimator` remains in the Training state when it requires
+        // another pass over the data.
+        _estimator.on_data_completed();
+
+        if(_reservoir.empty())
+            break;
+    }
+
+    // The sample is no longer needed
+    Items().swap(_reservoir);
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
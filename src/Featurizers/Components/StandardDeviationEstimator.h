@@ -4,12 +4,13 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <vector>
 
 #include "TrainingOnlyEstimatorImpl.h"
 #include "../../Traits.h"
-#include "NormUpdaters.h"
-#include "StatisticalMetricsEstimator.h"
 namespace Microsoft {
 namespace Featurizer {
 namespace Featurizers {
@@ -55,6 +56,12 @@ namespace Details {
 ///  \class         StandardDeviationTrainingOnlyPolicy
 ///  \brief         `StandardDeviationTrainingOnlyPolicy` implementation details.
 ///
+///                 The running mean and sum of squared differences from the
+///                 mean are updated with each input (Welford's algorithm), so
+///                 the average calculated by the `StatisticalMetricsEstimator`
+///                 isn't needed and both can be trained in the same pass
+///                 over the data.
+///
 template <typename T, typename EstimatorT>
 class StandardDeviationTrainingOnlyPolicy {
 public:
@@ -80,18 +87,20 @@ public:
 
     StandardDeviationTrainingOnlyPolicy(void);
 
-    bool begin_training(AnnotationMap const &annotations);
     void fit(InputType const &input);
     StandardDeviationAnnotationData complete_training(void);
 
+    // Returns the current average and standard deviation
+    std::vector<double> get_convergence_statistics(void) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
-    // |  Private Types
+    // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    Updaters::L2NormUpdater<std::double_t>    _updater;
-    std::double_t                             _average;
+    long double                               _average;
+    long double                               _sumSquaredDifferences;
     std::uint64_t                             _count;
 
     // ----------------------------------------------------------------------
@@ -110,8 +119,8 @@ private:
 
 /////////////////////////////////////////////////////////////////////////
 ///  \typedef       StandardDeviationEstimator
-///  \brief         A training-only class that calculate standard deviation based on
-///                 average and count
+///  \brief         A training-only class that calculates the standard deviation
+///                 and count of the input data in a single pass
 ///
 template <
     typename T,
@@ -197,26 +206,11 @@ StandardDeviationEstimator<T, MaxNumTrainingItemsV>::StandardDeviationEstimator(
 // ----------------------------------------------------------------------
 template <typename T, typename StandardDeviationEstimatorT>
 Details::StandardDeviationTrainingOnlyPolicy<T, StandardDeviationEstimatorT>::StandardDeviationTrainingOnlyPolicy(void) :
-    _updater(Updaters::L2NormUpdater<std::double_t>()),
     _average(0),
+    _sumSquaredDifferences(0),
     _count(0) {
 }
 
-template <typename T, typename StandardDeviationEstimatorT>
-bool Details::StandardDeviationTrainingOnlyPolicy<T, StandardDeviationEstimatorT>::begin_training(AnnotationMap const &) {
-    // ----------------------------------------------------------------------
-    using StandardStatisticalAnnotationData            = Components::StandardStatisticalAnnotationData<T>;
-    using StatisticalMetricsEstimator                  = Components::StatisticalMetricsEstimator<T, StandardDeviationEstimatorT::MaxNumTrainingItems>;
-    // ----------------------------------------------------------------------
-
-    StandardDeviationEstimatorT       const &          estimator(static_cast<StandardDeviationEstimatorT const &>(*this));
-    StandardStatisticalAnnotationData const &          data(StatisticalMetricsEstimator::get_annotation_data(estimator.get_column_annotations(), estimator.get_column_index(), StatisticalMetricsEstimatorName));
-
-    _average = data.Average;
-
-    return true;
-}
-
 template <typename T, typename StandardDeviationEstimatorT>
 void Details::StandardDeviationTrainingOnlyPolicy<T, StandardDeviationEstimatorT>::fit(InputType const &input) {
     return fit_impl(input, std::integral_constant<bool, Microsoft::Featurizer::Traits<T>::IsNullableType>());
@@ -224,17 +218,27 @@ void Details::StandardDeviationTrainingOnlyPolicy<T, StandardDeviationEstimatorT
 
 template <typename T, typename StandardDeviationEstimatorT>
 StandardDeviationAnnotationData Details::StandardDeviationTrainingOnlyPolicy<T, StandardDeviationEstimatorT>::complete_training(void) {
-    long double l2 = _updater.commit();
-    // normally, if count is 0, commit() should throw an error for not calling update before commit
-    // this is check for _count == 0 is a guarantee of safety if L2NormUpdater's implementation is changed in the future
     if (_count == 0) {
-        throw std::runtime_error("Count is 0 when calculating standard deviation!");
+        throw std::runtime_error("No valid input is passed in before commit is called!");
     }
-    long double deviation = l2/std::sqrt(static_cast<long double>(_count));
+    // the sum is never negative mathematically, but rounding errors in the updates
+    // can produce a slightly negative value; clamp it so that sqrt is always valid
+    long double deviation = std::sqrt(std::max(_sumSquaredDifferences, 0.0l) / static_cast<long double>(_count));
     assert(deviation >= 0);
     return StandardDeviationAnnotationData(std::move(deviation), std::move(_count));
 }
 
+template <typename T, typename StandardDeviationEstimatorT>
+std::vector<double> Details::StandardDeviationTrainingOnlyPolicy<T, StandardDeviationEstimatorT>::get_convergence_statistics(void) const {
+    if(_count == 0)
+        return std::vector<double>();
+
+    return std::vector<double>{
+        static_cast<double>(_average),
+        static_cast<double>(std::sqrt(std::max(_sumSquaredDifferences, 0.0l) / static_cast<long double>(_count)))
+    };
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -259,12 +263,17 @@ void Details::StandardDeviationTrainingOnlyPolicy<T, StandardDeviationEstimatorT
 template <typename T, typename StandardDeviationEstimatorT>
 template <typename U>
 void Details::StandardDeviationTrainingOnlyPolicy<T, StandardDeviationEstimatorT>::fit_impl(U const &input) {
-    _updater.update(static_cast<std::double_t>(input) - _average);
     // check if count will be out of bounds
     if (std::numeric_limits<std::uint64_t>::max() == _count) {
         throw std::runtime_error("Overflow occured for count during calculating standard deviation! You might input too much data");
     }
     ++_count;
+
+    long double const value = static_cast<long double>(input);
+    long double const delta = value - _average;
+
+    _average += delta / static_cast<long double>(_count);
+    _sumSquaredDifferences += delta * (value - _average);
 }
 
 #if (defined __clang__)
@@ -38,6 +38,37 @@ struct SumTypeSelector<std::double_t> {
     static constexpr bool const IsNumeric = true;
 };
 
+// sum type serializer writes sums produced by the sum type selector
+template <typename T>
+struct SumTypeSerializer {
+    static void serialize(Archive &ar, T const &value) {
+        Traits<T>::serialize(ar, value);
+    }
+
+    static T deserialize(Archive &ar) {
+        return Traits<T>::deserialize(ar);
+    }
+};
+
+// the size and precision of long double vary by platform, so it is written as
+// the sum of two doubles (which is exact for 80-bit extended precision)
+template <>
+struct SumTypeSerializer<long double> {
+    static void serialize(Archive &ar, long double const &value) {
+        std::double_t const                 high(static_cast<std::double_t>(value));
+
+        Traits<std::double_t>::serialize(ar, high);
+        Traits<std::double_t>::serialize(ar, static_cast<std::double_t>(value - static_cast<long double>(high)));
+    }
+
+    static long double deserialize(Archive &ar) {
+        std::double_t const                 high(Traits<std::double_t>::deserialize(ar));
+        std::double_t const                 low(Traits<std::double_t>::deserialize(ar));
+
+        return static_cast<long double>(high) + static_cast<long double>(low);
+    }
+};
+
 } // namespace TypeSelector
 
 namespace Updaters {
@@ -86,11 +117,23 @@ public:
     // first_element_flag is default to be true in constructor to guarantee
     // min, max and count are set based on first valid input element
     BasicStatsUpdater(void);
+    BasicStatsUpdater(Archive &ar);
 
     void update(T input);
+    // merge combines the stats of an updater that processed a different shard of the data
+    void merge(BasicStatsUpdater const &other);
     // commit returns the result of min, max and count
     Result commit(void);
 
+    void save(Archive &ar) const;
+
+    std::uint64_t get_count(void) const;
+
+    // get_convergence_statistics returns the current min and max, or an empty
+    // vector if an element hasn't been processed yet
+    template <typename U=T>
+    typename std::enable_if<std::is_arithmetic<U>::value, std::vector<double>>::type get_convergence_statistics(void) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -157,11 +200,20 @@ public:
     // |
     // ----------------------------------------------------------------------
     StandardStatsUpdater(void);
+    StandardStatsUpdater(Archive &ar);
 
     void update(T input);
+    // merge combines the stats of an updater that processed a different shard of the data
+    void merge(StandardStatsUpdater const &other);
     // commit returns the result of min, max, count, sum and average
     Result commit(void);
 
+    void save(Archive &ar) const;
+
+    // get_convergence_statistics returns the current min, max and average, or
+    // an empty vector if an element hasn't been processed yet
+    std::vector<double> get_convergence_statistics(void) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -206,6 +258,14 @@ public:
     void fit(InputType const &input);
     typename UpdaterT::Result complete_training(void);
 
+    void merge(StatisticalMetricsTrainingOnlyPolicy const &other);
+    void merge(Archive &ar);
+    void save(Archive &ar) const;
+
+    // Only available for updaters that track numeric statistics
+    template <typename U=UpdaterT>
+    auto get_convergence_statistics(void) const -> decltype(std::declval<U const &>().get_convergence_statistics());
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -347,6 +407,19 @@ Updaters::BasicStatsUpdater<T>::BasicStatsUpdater(void) :
     _first_element_flag(true) {
 }
 
+template <typename T>
+Updaters::BasicStatsUpdater<T>::BasicStatsUpdater(Archive &ar) :
+    _count(Traits<std::uint64_t>::deserialize(ar)),
+    _first_element_flag(_count == 0) {
+    if(_count != 0) {
+        _min = Traits<T>::deserialize(ar);
+        _max = Traits<T>::deserialize(ar);
+
+        if(_min > _max)
+            throw std::runtime_error("Invalid min/max");
+    }
+}
+
 template <typename T>
 Updaters::BasicStatsUpdater<T>::Result::Result(T min, T max, std::uint64_t count) :
     Min(std::move(min)),
@@ -378,6 +451,55 @@ void Updaters::BasicStatsUpdater<T>::update(T input) {
     ++_count;
 }
 
+template <typename T>
+void Updaters::BasicStatsUpdater<T>::merge(BasicStatsUpdater const &other) {
+    if(other._count == 0)
+        return;
+
+    // check if count will be out of bounds
+    if (std::numeric_limits<std::uint64_t>::max() - _count < other._count) {
+        throw std::runtime_error("Overflow occurred for count during calculating statistic metrics! Check your data!");
+    }
+
+    if (_first_element_flag) {
+        _min = other._min;
+        _max = other._max;
+        _first_element_flag = false;
+    } else {
+        if(other._min < _min) {
+            _min = other._min;
+        }
+        if(other._max > _max) {
+            _max = other._max;
+        }
+    }
+    _count += other._count;
+}
+
+template <typename T>
+void Updaters::BasicStatsUpdater<T>::save(Archive &ar) const {
+    Traits<std::uint64_t>::serialize(ar, _count);
+
+    if(_count != 0) {
+        Traits<T>::serialize(ar, _min);
+        Traits<T>::serialize(ar, _max);
+    }
+}
+
+template <typename T>
+std::uint64_t Updaters::BasicStatsUpdater<T>::get_count(void) const {
+    return _count;
+}
+
+template <typename T>
+template <typename U>
+typename std::enable_if<std::is_arithmetic<U>::value, std::vector<double>>::type Updaters::BasicStatsUpdater<T>::get_convergence_statistics(void) const {
+    if(_count == 0)
+        return std::vector<double>();
+
+    return std::vector<double>{ static_cast<double>(_min), static_cast<double>(_max) };
+}
+
 template <typename T>
 typename Updaters::BasicStatsUpdater<T>::Result Updaters::BasicStatsUpdater<T>::commit(void) {
     if(_count == 0)
@@ -397,6 +519,12 @@ Updaters::StandardStatsUpdater<T>::StandardStatsUpdater(void) :
     _sum(0) {
 }
 
+template <typename T>
+Updaters::StandardStatsUpdater<T>::StandardStatsUpdater(Archive &ar) :
+    BaseType(ar),
+    _sum(TypeSelector::SumTypeSerializer<typename TypeSelector::SumTypeSelector<T>::type>::deserialize(ar)) {
+}
+
 template <typename T>
 Updaters::StandardStatsUpdater<T>::Result::Result(typename TypeSelector::SumTypeSelector<T>::type sum, std::double_t average, T min, T max, std::uint64_t count) :
     BaseType(std::move(min), std::move(max), std::move(count)),
@@ -432,6 +560,44 @@ void Updaters::StandardStatsUpdater<T>::update(T input) {
     }
 }
 
+template <typename T>
+void Updaters::StandardStatsUpdater<T>::merge(StandardStatsUpdater const &other) {
+    typename TypeSelector::SumTypeSelector<T>::type const               sum(_sum);
+
+    if (TypeSelector::SumTypeSelector<T>::IsNumeric) {
+        // std::isinf is used for check long double bounds
+        if (std::isinf(static_cast<long double>(sum) + static_cast<long double>(other._sum))) {
+            throw std::runtime_error("Overflow occured for sum during calculating statistic metrics! Check your data!");
+        }
+    }
+    else {
+        // if sum is of type int64_t, check for overflow
+        if ( ((other._sum > 0) && (std::numeric_limits<std::int64_t>::max() - static_cast<std::int64_t>(other._sum) < sum))
+         || ((other._sum < 0) && (std::numeric_limits<std::int64_t>::lowest() - static_cast<std::int64_t>(other._sum) > sum))) {
+            throw std::runtime_error("Overflow occured for sum during calculating statistic metrics! Check your data!");
+        }
+    }
+
+    BaseType::merge(other);
+    _sum = sum + other._sum;
+}
+
+template <typename T>
+void Updaters::StandardStatsUpdater<T>::save(Archive &ar) const {
+    BaseType::save(ar);
+    TypeSelector::SumTypeSerializer<typename TypeSelector::SumTypeSelector<T>::type>::serialize(ar, _sum);
+}
+
+template <typename T>
+std::vector<double> Updaters::StandardStatsUpdater<T>::get_convergence_statistics(void) const {
+    std::vector<double>                     result(BaseType::get_convergence_statistics());
+
+    if(result.empty() == false)
+        result.emplace_back(static_cast<double>(static_cast<long double>(_sum) / static_cast<long double>(BaseType::get_count())));
+
+    return result;
+}
+
 template <typename T>
 typename Updaters::StandardStatsUpdater<T>::Result Updaters::StandardStatsUpdater<T>::commit(void) {
     typename Result::BaseType               basics(BaseType::commit());
@@ -472,6 +638,27 @@ typename UpdaterT::Result Details::StatisticalMetricsTrainingOnlyPolicy<InputT,
     return _updater.commit();
 }
 
+template <typename InputT, typename UpdaterT>
+void Details::StatisticalMetricsTrainingOnlyPolicy<InputT, UpdaterT>::merge(StatisticalMetricsTrainingOnlyPolicy const &other) {
+    _updater.merge(other._updater);
+}
+
+template <typename InputT, typename UpdaterT>
+void Details::StatisticalMetricsTrainingOnlyPolicy<InputT, UpdaterT>::merge(Archive &ar) {
+    _updater.merge(UpdaterT(ar));
+}
+
+template <typename InputT, typename UpdaterT>
+void Details::StatisticalMetricsTrainingOnlyPolicy<InputT, UpdaterT>::save(Archive &ar) const {
+    _updater.save(ar);
+}
+
+template <typename InputT, typename UpdaterT>
+template <typename U>
+auto Details::StatisticalMetricsTrainingOnlyPolicy<InputT, UpdaterT>::get_convergence_statistics(void) const -> decltype(std::declval<U const &>().get_convergence_statistics()) {
+    return _updater.get_convergence_statistics();
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
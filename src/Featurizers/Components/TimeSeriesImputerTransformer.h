@@ -73,6 +73,8 @@ public:
 
         using StrTraits                     = Traits<nonstd::optional<std::string>>;
         using ThisBaseType                  = Microsoft::Featurizer::Transformer<typename BaseType::InputType,typename BaseType::TransformedType>;
+        using MedianValuesType              = std::map<KeyType,std::vector<double_t>>;
+        using MedianValuesPtr               = std::shared_ptr<MedianValuesType const>;
 
         // ----------------------------------------------------------------------
         // |
@@ -89,6 +91,12 @@ public:
 
         void save(Archive & ar) const override;
 
+        /////////////////////////////////////////////////////////////////////////
+        ///  \fn            clone
+        ///  \brief         The clone shares the median values with this Transformer.
+        ///
+        typename ThisBaseType::TransformerUniquePtr clone(void) const override;
+
         // ----------------------------------------------------------------------
         // |
         // |  Public Data
@@ -97,7 +105,8 @@ public:
         FrequencyType const                             _frequency;
         std::vector<TypeId> const                       _colsToImputeDataTypes;
         TimeSeriesImputeStrategy const                  _tsImputeStrategy;
-        std::map<KeyType,std::vector<double_t>> const   _medianValues;
+        MedianValuesPtr const                           _pMedianValues;
+        MedianValuesType const &                        _medianValues;
         bool const                                      _supressError;
 
     private:
@@ -114,6 +123,8 @@ public:
         // |  Private Methods
         // |
         // ----------------------------------------------------------------------
+        Transformer(FrequencyType value, std::vector<TypeId> colsToImputeDataTypes, TimeSeriesImputeStrategy tsImputeStrategy, bool supressError, MedianValuesPtr pMedianValues);
+
         void execute_impl(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) override;
         void flush_impl(typename ThisBaseType::CallbackFunction const &callback) override;
 
@@ -169,21 +180,16 @@ private:
     // MSVC has problems when the function is defined outside of the declaration
     typename BaseType::TransformerUniquePtr create_transformer_impl(void) override {
         AnnotationMaps const &                          maps(Estimator::get_column_annotations());
-        AnnotationMap const &                           annotations(maps[0]);
 
-        AnnotationMap::const_iterator const &           tsFreqIter(annotations.find("TimeSeriesFrequencyEstimator"));
-        if(tsFreqIter == annotations.end())
+        TimeSeriesFrequencyAnnotation const * const     pTsFreqAnnotation(Estimator::get_annotation_impl<TimeSeriesFrequencyAnnotation>(maps, 0, "TimeSeriesFrequencyEstimator"));
+        if(pTsFreqAnnotation == nullptr)
             throw std::runtime_error("Couldn't retrieve Frequency Annotation.");
-        Annotation const &                              freqAnnotation(*tsFreqIter->second[0]);
-        assert(dynamic_cast<TimeSeriesFrequencyAnnotation const *>(&freqAnnotation));
-        TimeSeriesFrequencyAnnotation const &           tsFreqAnnotation(static_cast<TimeSeriesFrequencyAnnotation const &>(freqAnnotation));
+        TimeSeriesFrequencyAnnotation const &           tsFreqAnnotation(*pTsFreqAnnotation);
 
-        AnnotationMap::const_iterator const &           tsMedianIter(annotations.find("TimeSeriesMedianEstimator"));
-        if(tsMedianIter == annotations.end())
+        TimeSeriesMedianAnnotation const * const        pTsMedianAnnotation(Estimator::get_annotation_impl<TimeSeriesMedianAnnotation>(maps, 0, "TimeSeriesMedianEstimator"));
+        if(pTsMedianAnnotation == nullptr)
             throw std::runtime_error("Couldn't retrieve Median Annotation.");
-        Annotation const &                              medianAnnotation(*tsMedianIter->second[0]);
-        assert(dynamic_cast<TimeSeriesMedianAnnotation const *>(&medianAnnotation));
-        TimeSeriesMedianAnnotation const &              tsMedianAnnotation(static_cast<TimeSeriesMedianAnnotation const &>(medianAnnotation));
+        TimeSeriesMedianAnnotation const &              tsMedianAnnotation(*pTsMedianAnnotation);
 
         return typename BaseType::TransformerUniquePtr(new Transformer(tsFreqAnnotation.Value, std::move(_colsToImputeDataTypes), std::move(_tsImputeStrategy), std::move(_supressError), tsMedianAnnotation.Value));
     }
@@ -242,10 +248,21 @@ inline void TimeSeriesImputerEstimator::complete_training_impl(void) /*override
 // |
 // ----------------------------------------------------------------------
 inline TimeSeriesImputerEstimator::Transformer::Transformer(TimeSeriesImputerEstimator::FrequencyType value, std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy, bool supressError, std::map<KeyType,std::vector<double_t>> medianValues) :
+    Transformer(
+        std::move(value),
+        std::move(colsToImputeDataTypes),
+        std::move(tsImputeStrategy),
+        std::move(supressError),
+        std::make_shared<MedianValuesType const>(std::move(medianValues))
+    ) {
+}
+
+inline TimeSeriesImputerEstimator::Transformer::Transformer(TimeSeriesImputerEstimator::FrequencyType value, std::vector<TypeId> colsToImputeDataTypes,TimeSeriesImputeStrategy tsImputeStrategy, bool supressError, MedianValuesPtr pMedianValues) :
     _frequency(std::move(value)),
     _colsToImputeDataTypes(std::move(colsToImputeDataTypes)),
     _tsImputeStrategy(std::move(tsImputeStrategy)),
-    _medianValues(std::move(medianValues)),
+    _pMedianValues(std::move(pMedianValues)),
+    _medianValues(*_pMedianValues),
     _supressError(std::move(supressError)) {
 
     if(_colsToImputeDataTypes.size() == 0)
@@ -327,6 +344,11 @@ inline bool TimeSeriesImputerEstimator::Transformer::operator==(Transformer cons
         && _supressError == other._supressError;
 }
 
+inline TimeSeriesImputerEstimator::Transformer::ThisBaseType::TransformerUniquePtr TimeSeriesImputerEstimator::Transformer::clone(void) const /*override*/ {
+    // The private constructor is used so that the clone shares the median values rather than copying them
+    return typename ThisBaseType::TransformerUniquePtr(new Transformer(_frequency, _colsToImputeDataTypes, _tsImputeStrategy, _supressError, _pMedianValues));
+}
+
 inline void TimeSeriesImputerEstimator::Transformer::save(Archive & ar) const {
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
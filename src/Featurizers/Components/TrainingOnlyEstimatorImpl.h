@@ -4,6 +4,8 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include "ConvergenceMonitor.h"
+#include "../../Archive.h"
 #include "../../Featurizer.h"
 
 namespace Microsoft {
@@ -11,6 +13,112 @@ namespace Featurizer {
 namespace Featurizers {
 namespace Components {
 
+namespace Details {
+
+template <typename, typename T>
+class HasFitBufferMethodImpl {
+    static_assert(std::integral_constant<T, false>::value, "Second template parameter must be a function type");
+};
+
+template <typename T, typename ReturnT, typename... ArgTs>
+class HasFitBufferMethodImpl<T, ReturnT (ArgTs...)> {
+private:
+    template <typename U> static constexpr std::false_type Check(...);
+
+    template <typename U>
+    static constexpr std::true_type Check(
+        U *,
+        typename std::enable_if<
+            std::is_same<
+                decltype(std::declval<U>().fit(std::declval<ArgTs>()...)),
+                ReturnT
+            >::value,
+            void *
+        >::type
+    );
+
+public:
+    static constexpr bool const             value = std::is_same<std::true_type, decltype(Check<T>(nullptr, nullptr))>::value;
+};
+
+template <typename InputT, typename T>
+class HasFitBufferMethod : public HasFitBufferMethodImpl<T, void (InputT const *, size_t)> {};
+
+// ----------------------------------------------------------------------
+template <typename, typename T>
+class HasBeginTrainingMethodImpl {
+    static_assert(std::integral_constant<T, false>::value, "Second template parameter must be a function type");
+};
+
+template <typename T, typename ReturnT, typename... ArgTs>
+class HasBeginTrainingMethodImpl<T, ReturnT (ArgTs...)> {
+private:
+    template <typename U> static constexpr std::false_type Check(...);
+
+    template <typename U>
+    static constexpr std::true_type Check(
+        U *,
+        typename std::enable_if<
+            std::is_same<
+                decltype(std::declval<U>().begin_training(std::declval<ArgTs>()...)),
+                ReturnT
+            >::value,
+            void *
+        >::type
+    );
+
+public:
+    static constexpr bool const             value = std::is_same<std::true_type, decltype(Check<T>(nullptr, nullptr))>::value;
+};
+
+template <typename T>
+class HasBeginTrainingMethod : public HasBeginTrainingMethodImpl<T, bool (AnnotationMap const &)> {};
+
+// ----------------------------------------------------------------------
+template <typename, typename T>
+class HasGetConvergenceStatisticsMethodImpl {
+    static_assert(std::integral_constant<T, false>::value, "Second template parameter must be a function type");
+};
+
+template <typename T, typename ReturnT, typename... ArgTs>
+class HasGetConvergenceStatisticsMethodImpl<T, ReturnT (ArgTs...)> {
+private:
+    template <typename U> static constexpr std::false_type Check(...);
+
+    template <typename U>
+    static constexpr std::true_type Check(
+        U *,
+        typename std::enable_if<
+            std::is_same<
+                decltype(std::declval<U const &>().get_convergence_statistics(std::declval<ArgTs>()...)),
+                ReturnT
+            >::value,
+            void *
+        >::type
+    );
+
+public:
+    static constexpr bool const             value = std::is_same<std::true_type, decltype(Check<T>(nullptr, nullptr))>::value;
+};
+
+template <typename T>
+class HasGetConvergenceStatisticsMethod : public HasGetConvergenceStatisticsMethodImpl<T, ConvergenceMonitor::Statistics (void)> {};
+
+// ----------------------------------------------------------------------
+template <typename T>
+class NumExactConvergenceStatistics {
+private:
+    template <typename U> static constexpr std::integral_constant<size_t, 0> Check(...);
+
+    template <typename U>
+    static constexpr std::integral_constant<size_t, U::NumExactConvergenceStatistics> Check(U *);
+
+public:
+    static constexpr size_t const           value = decltype(Check<T>(nullptr))::value;
+};
+
+} // namespace Details
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         TrainingOnlyEstimatorImpl
 ///  \brief         Base class that simplifies the process of collecting
@@ -38,6 +146,17 @@ namespace Components {
 ///
 ///                         <structure or value containing state data> complete_training(void);
 ///
+///                         [optional; required by `merge` and `save_training_state`]
+///                         void merge(EstimatorPolicy const &other);
+///                         void merge(Archive &ar);
+///                         void save(Archive &ar) const;
+///
+///                         [optional; required by `set_convergence_options`]
+///                         std::vector<double> get_convergence_statistics(void) const;
+///
+///                     [optional] Number of leading convergence statistics that must not change between checks
+///                         static constexpr size_t const           NumExactConvergenceStatistics;
+///
 template <typename EstimatorPolicyT, size_t MaxNumTrainingItemsV>
 class TrainingOnlyEstimatorImpl :
     public FitEstimator<typename EstimatorPolicyT::InputType>,
@@ -57,6 +176,10 @@ public:
     using InputType                         = typename EstimatorPolicyT::InputType;
     using AnnotationData                    = decltype(std::declval<EstimatorPolicyT>().complete_training());
 
+    // Policies that don't read `Annotations` created by other `Estimators` until `complete_training`
+    // is invoked can be trained at the same time as sibling `Estimators` within a pipeline.
+    static constexpr bool const             SupportsConcurrentTraining = Details::HasBeginTrainingMethod<EstimatorPolicyT>::value == false;
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
@@ -78,6 +201,50 @@ public:
 
     size_t get_column_index(void) const;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            merge
+    ///  \brief         Merges the partial training state of an estimator that was
+    ///                 fit on a different shard of the data into this one. Shards
+    ///                 can be fit concurrently on separate threads; `complete_training`
+    ///                 should be invoked on this estimator once all of them have
+    ///                 been merged.
+    ///
+    TrainingOnlyEstimatorImpl & merge(TrainingOnlyEstimatorImpl const &other);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            merge
+    ///  \brief         Merges partial training state written by `save_training_state`,
+    ///                 which allows shards to be fit on different machines.
+    ///
+    TrainingOnlyEstimatorImpl & merge(Archive &ar);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            save_training_state
+    ///  \brief         Writes the partial training state so that it can be merged
+    ///                 into another estimator via `merge` or restored via
+    ///                 `restore_training_state`.
+    ///
+    void save_training_state(Archive &ar) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            restore_training_state
+    ///  \brief         Restores training state written by `save_training_state`
+    ///                 (for example, a checkpoint created before a long-running
+    ///                 fit was interrupted). `begin_training` must have been invoked
+    ///                 and `fit` must not have been invoked; training continues
+    ///                 from the restored state.
+    ///
+    TrainingOnlyEstimatorImpl & restore_training_state(Archive &ar);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            set_convergence_options
+    ///  \brief         Completes training once the statistics tracked by the
+    ///                 policy have stabilized according to the provided options,
+    ///                 rather than after all of the data has been seen. Must be
+    ///                 invoked before `begin_training`.
+    ///
+    TrainingOnlyEstimatorImpl & set_convergence_options(ConvergenceOptions options);
+
     AnnotationData const & get_annotation_data(void) const;
     AnnotationData const * get_annotation_data_nothrow(void) const;
 
@@ -150,6 +317,8 @@ private:
     bool                                    _hasAnnotation;
     size_t                                  _cRemainingTrainingItems;
 
+    std::unique_ptr<ConvergenceMonitor>     _pConvergenceMonitor;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
@@ -167,6 +336,9 @@ private:
     void fit_impl(typename BaseType::InputType const *pItems, size_t cItems, std::true_type);
     void fit_impl(typename BaseType::InputType const *pItems, size_t cItems, std::false_type);
 
+    bool has_converged(size_t cItems, std::true_type);
+    bool has_converged(size_t cItems, std::false_type);
+
     void complete_training_impl(void) override;
 };
 
@@ -179,69 +351,6 @@ private:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-namespace Details {
-
-template <typename, typename T>
-class HasFitBufferMethodImpl {
-    static_assert(std::integral_constant<T, false>::value, "Second template parameter must be a function type");
-};
-
-template <typename T, typename ReturnT, typename... ArgTs>
-class HasFitBufferMethodImpl<T, ReturnT (ArgTs...)> {
-private:
-    template <typename U> static constexpr std::false_type Check(...);
-
-    template <typename U>
-    static constexpr std::true_type Check(
-        U *,
-        typename std::enable_if<
-            std::is_same<
-                decltype(std::declval<U>().fit(std::declval<ArgTs>()...)),
-                ReturnT
-            >::value,
-            void *
-        >::type
-    );
-
-public:
-    static constexpr bool const             value = std::is_same<std::true_type, decltype(Check<T>(nullptr, nullptr))>::value;
-};
-
-template <typename InputT, typename T>
-class HasFitBufferMethod : public HasFitBufferMethodImpl<T, void (InputT const *, size_t)> {};
-
-// ----------------------------------------------------------------------
-template <typename, typename T>
-class HasBeginTrainingMethodImpl {
-    static_assert(std::integral_constant<T, false>::value, "Second template parameter must be a function type");
-};
-
-template <typename T, typename ReturnT, typename... ArgTs>
-class HasBeginTrainingMethodImpl<T, ReturnT (ArgTs...)> {
-private:
-    template <typename U> static constexpr std::false_type Check(...);
-
-    template <typename U>
-    static constexpr std::true_type Check(
-        U *,
-        typename std::enable_if<
-            std::is_same<
-                decltype(std::declval<U>().begin_training(std::declval<ArgTs>()...)),
-                ReturnT
-            >::value,
-            void *
-        >::type
-    );
-
-public:
-    static constexpr bool const             value = std::is_same<std::true_type, decltype(Check<T>(nullptr, nullptr))>::value;
-};
-
-template <typename T>
-class HasBeginTrainingMethod : public HasBeginTrainingMethodImpl<T, bool (AnnotationMap const &)> {};
-
-} // namespace Details
-
 // ----------------------------------------------------------------------
 // |
 // |  TrainingOnlyEstimatorImpl
@@ -286,6 +395,81 @@ size_t TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::get_co
     return _colIndex;
 }
 
+template <typename EstimatorPolicyT, size_t MaxNumTrainingItemsV>
+TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV> & TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::merge(TrainingOnlyEstimatorImpl const &other) {
+    if(&other == this)
+        throw std::invalid_argument("other");
+
+    if(this->get_state() != TrainingState::Training && this->get_state() != TrainingState::Finished)
+        throw std::runtime_error("`merge` should not be invoked on an estimator that is not training or is already complete");
+
+    if(other.get_state() == TrainingState::Completed)
+        throw std::runtime_error("`merge` should not be invoked with an estimator that is already complete");
+
+    EstimatorPolicyT::merge(static_cast<EstimatorPolicyT const &>(other));
+    _cRemainingTrainingItems -= std::min(_cRemainingTrainingItems, MaxNumTrainingItemsV - other._cRemainingTrainingItems);
+
+    return *this;
+}
+
+template <typename EstimatorPolicyT, size_t MaxNumTrainingItemsV>
+TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV> & TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::merge(Archive &ar) {
+    if(this->get_state() != TrainingState::Training && this->get_state() != TrainingState::Finished)
+        throw std::runtime_error("`merge` should not be invoked on an estimator that is not training or is already complete");
+
+    // Version
+    std::uint16_t                           majorVersion(Traits<std::uint16_t>::deserialize(ar));
+    std::uint16_t                           minorVersion(Traits<std::uint16_t>::deserialize(ar));
+
+    if(majorVersion != 1 || minorVersion != 0)
+        throw std::runtime_error("Unsupported archive version");
+
+    // Data
+    std::uint64_t const                     cItems(Traits<std::uint64_t>::deserialize(ar));
+
+    EstimatorPolicyT::merge(ar);
+
+    if(cItems >= _cRemainingTrainingItems)
+        _cRemainingTrainingItems = 0;
+    else
+        _cRemainingTrainingItems -= static_cast<size_t>(cItems);
+
+    return *this;
+}
+
+template <typename EstimatorPolicyT, size_t MaxNumTrainingItemsV>
+void TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::save_training_state(Archive &ar) const {
+    if(this->get_state() == TrainingState::Completed)
+        throw std::runtime_error("`save_training_state` should not be invoked on an estimator that is already complete");
+
+    // Version
+    Traits<std::uint16_t>::serialize(ar, 1); // Major
+    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+
+    // Data
+    Traits<std::uint64_t>::serialize(ar, static_cast<std::uint64_t>(MaxNumTrainingItemsV - _cRemainingTrainingItems));
+    EstimatorPolicyT::save(ar);
+}
+
+template <typename EstimatorPolicyT, size_t MaxNumTrainingItemsV>
+TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV> & TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::restore_training_state(Archive &ar) {
+    if(_cRemainingTrainingItems != MaxNumTrainingItemsV)
+        throw std::runtime_error("`restore_training_state` should not be invoked on an estimator that has been fit");
+
+    return merge(ar);
+}
+
+template <typename EstimatorPolicyT, size_t MaxNumTrainingItemsV>
+TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV> & TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::set_convergence_options(ConvergenceOptions options) {
+    static_assert(Details::HasGetConvergenceStatisticsMethod<EstimatorPolicyT>::value, "The EstimatorPolicy does not provide statistics used to detect convergence");
+
+    if(this->get_state() != TrainingState::Pending)
+        throw std::runtime_error("`set_convergence_options` should not be invoked on an estimator that has begun training");
+
+    _pConvergenceMonitor.reset(new ConvergenceMonitor(std::move(options), Details::NumExactConvergenceStatistics<EstimatorPolicyT>::value));
+    return *this;
+}
+
 template <typename EstimatorPolicyT, size_t MaxNumTrainingItemsV>
 typename TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::AnnotationData const & TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::get_annotation_data(void) const {
     return get_annotation_data(this->get_column_annotations(), _colIndex, this->Name);
@@ -371,15 +555,17 @@ template <typename EstimatorPolicyT, size_t MaxNumTrainingItemsV>
 FitResult TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::fit_impl(typename BaseType::InputType const *pItems, size_t cItems) /*override*/ {
     // This method returns false when there aren't any training items remaining, which
     // will put the estimator into a finished state. Fit shouldn't ever be called on an
-    // estimator in a finished state.
-    assert(_cRemainingTrainingItems);
-
+    // estimator in a finished state, although the remaining items may have been consumed
+    // by a call to `merge`.
     if(pItems) {
         size_t const                                    cItemsToProcess(std::min(_cRemainingTrainingItems, cItems));
 
         fit_impl(pItems, cItemsToProcess, std::integral_constant<bool, Details::HasFitBufferMethod<typename BaseType::InputType, EstimatorPolicyT>::value>());
 
         _cRemainingTrainingItems -= cItemsToProcess;
+
+        if(_pConvergenceMonitor && has_converged(cItemsToProcess, std::integral_constant<bool, Details::HasGetConvergenceStatisticsMethod<EstimatorPolicyT>::value>()))
+            return FitResult::Complete;
     }
 
     return _cRemainingTrainingItems != 0 ? FitResult::Continue : FitResult::Complete;
@@ -408,6 +594,22 @@ void TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::fit_impl
 #   pragma warning(pop)
 #endif
 
+template <typename EstimatorPolicyT, size_t MaxNumTrainingItemsV>
+bool TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::has_converged(size_t cItems, std::true_type) {
+    return _pConvergenceMonitor->update(
+        cItems,
+        [this](void) {
+            return EstimatorPolicyT::get_convergence_statistics();
+        }
+    );
+}
+
+template <typename EstimatorPolicyT, size_t MaxNumTrainingItemsV>
+bool TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::has_converged(size_t, std::false_type) {
+    // `set_convergence_options` can't be invoked for policies that don't provide statistics
+    return false;
+}
+
 template <typename EstimatorPolicyT, size_t MaxNumTrainingItemsV>
 void TrainingOnlyEstimatorImpl<EstimatorPolicyT, MaxNumTrainingItemsV>::complete_training_impl(void) /*override*/ {
     // Don't add a new annotation if one already exists
@@ -0,0 +1,121 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../ConvergenceMonitor.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using ConvergenceOptions                    = NS::Featurizers::Components::ConvergenceOptions;
+using ConvergenceMonitor                    = NS::Featurizers::Components::ConvergenceMonitor;
+using Statistics                            = ConvergenceMonitor::Statistics;
+
+TEST_CASE("Invalid options") {
+    CHECK_THROWS_WITH(ConvergenceOptions(-0.1), "relativeTolerance");
+    CHECK_THROWS_WITH(ConvergenceOptions(std::numeric_limits<double>::quiet_NaN()), "relativeTolerance");
+    CHECK_THROWS_WITH(ConvergenceOptions(0.1, 0), "checkInterval");
+    CHECK_THROWS_WITH(ConvergenceOptions(0.1, 10, 0), "numStableChecks");
+}
+
+TEST_CASE("Stable statistics") {
+    ConvergenceMonitor                      monitor(ConvergenceOptions(0.01, 10, 2));
+    int                                     cCalls(0);
+    auto const                              func(
+        [&cCalls](void) {
+            ++cCalls;
+            return Statistics{ 1.0, 0.0 };
+        }
+    );
+
+    // Statistics are only retrieved when a check is due
+    CHECK(monitor.update(9, func) == false);
+    CHECK(cCalls == 0);
+
+    // The first check establishes the baseline
+    CHECK(monitor.update(1, func) == false);
+    CHECK(cCalls == 1);
+
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func));
+    CHECK(monitor.has_converged());
+    CHECK(cCalls == 3);
+}
+
+TEST_CASE("Unstable statistics") {
+    ConvergenceMonitor                      monitor(ConvergenceOptions(0.01, 10, 2));
+    std::vector<Statistics> const           values{
+        Statistics{ 100.0 },
+        Statistics{ 100.5 },                // Stable
+        Statistics{ 110.0 },                // Unstable
+        Statistics{ 110.1 },                // Stable
+        Statistics{ 110.2 }                 // Stable
+    };
+    size_t                                  index(0);
+    auto const                              func(
+        [&values, &index](void) {
+            return values[index++];
+        }
+    );
+
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func));
+}
+
+TEST_CASE("Exact statistics") {
+    ConvergenceMonitor                      monitor(ConvergenceOptions(0.05, 10, 2), 1);
+    std::vector<Statistics> const           values{
+        Statistics{ 100.0, 0.5 },
+        Statistics{ 101.0, 0.5 },           // Unstable, although within the tolerance
+        Statistics{ 101.0, 0.51 },          // Stable
+        Statistics{ 102.0, 0.51 },          // Unstable
+        Statistics{ 102.0, 0.51 },          // Stable
+        Statistics{ 102.0, 0.52 }           // Stable
+    };
+    size_t                                  index(0);
+    auto const                              func(
+        [&values, &index](void) {
+            return values[index++];
+        }
+    );
+
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func));
+}
+
+TEST_CASE("Empty statistics") {
+    ConvergenceMonitor                      monitor(ConvergenceOptions(0.01, 10, 1));
+    auto const                              func(
+        [](void) {
+            return Statistics();
+        }
+    );
+
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func) == false);
+}
+
+TEST_CASE("MinNumItems") {
+    ConvergenceMonitor                      monitor(ConvergenceOptions(0.01, 10, 1, 50));
+    auto const                              func(
+        [](void) {
+            return Statistics{ 1.0 };
+        }
+    );
+
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func) == false);
+    CHECK(monitor.update(10, func));
+}
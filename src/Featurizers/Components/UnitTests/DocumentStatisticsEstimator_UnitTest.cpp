@@ -793,3 +793,65 @@ TEST_CASE("string_idf_custom_over_existingVocabulary") {
                    ngramRangeMin,
                    ngramRangeMax);
 }
+
+TEST_CASE("merge") {
+    using Estimator                            = NS::Featurizers::Components::DocumentStatisticsEstimator<std::numeric_limits<size_t>::max()>;
+
+    FrequencyMap const                         termFreqLabel({{"orange",3}, {"apple", 1}, {"peach", 3}, {"grape", 2}, {"banana",1}});
+    IndexMap const                             termIndexLabel({{"apple", 0}, {"banana",1}, {"grape", 2}, {"orange",3}, {"peach", 4}});
+    FrequencyAndIndexMap const                 termFreqAndIndexLabel = NS::Featurizers::Components::MergeTwoMapsWithSameKeys(termFreqLabel, termIndexLabel);
+
+    std::vector<std::string> const             shards({" orange  apple  apple peach  grape ",
+                                                       " grape orange     peach peach banana",
+                                                       "orange orange peach   peach orange "});
+
+    auto const                                 createEstimatorFunc(
+        [](NS::AnnotationMapsPtr pAllColumnAnnotations) {
+            return Estimator(
+                std::move(pAllColumnAnnotations),
+                0,
+                StringDecorator(),
+                AnalyzerMethod::Word,
+                "",
+                nonstd::optional<IndexMap>(),
+                nonstd::optional<std::uint32_t>(),
+                0.0f,
+                1.0f,
+                1,
+                1
+            );
+        }
+    );
+
+    NS::AnnotationMapsPtr                      pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    Estimator                                  estimator(createEstimatorFunc(pAllColumnAnnotations));
+
+    estimator.begin_training();
+    estimator.fit(shards[0]);
+
+    Estimator                                  shard(createEstimatorFunc(NS::CreateTestAnnotationMapsPtr(1)));
+
+    shard.begin_training();
+    shard.fit(shards[1]);
+    estimator.merge(shard);
+
+    Estimator                                  remoteShard(createEstimatorFunc(NS::CreateTestAnnotationMapsPtr(1)));
+
+    remoteShard.begin_training();
+    remoteShard.fit(shards[2]);
+
+    NS::Archive                                out;
+
+    remoteShard.save_training_state(out);
+
+    NS::Archive                                in(out.commit());
+
+    estimator.merge(in);
+    estimator.complete_training();
+
+    NS::Featurizers::Components::DocumentStatisticsAnnotationData const &
+                                               annotation(estimator.get_annotation_data());
+
+    CHECK(annotation.TermFrequencyAndIndex == termFreqAndIndexLabel);
+    CHECK(annotation.TotalNumDocuments == 3);
+}
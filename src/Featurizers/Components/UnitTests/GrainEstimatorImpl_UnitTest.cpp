@@ -9,7 +9,14 @@
 #include "../InferenceOnlyFeaturizerImpl.h"
 #include "../TrainingOnlyEstimatorImpl.h"
 
+#include "../../LabelEncoderFeaturizer.h"
 #include "../../TestHelpers.h"
+#include "../../../MemoryMappedFile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
 
 namespace NS                                = Microsoft::Featurizer;
 namespace Components                        = Microsoft::Featurizer::Featurizers::Components;
@@ -62,6 +69,18 @@ public:
         return _total;
     }
 
+    void merge(SumTrainingOnlyEstimatorPolicy const &other) {
+        _total += other._total;
+    }
+
+    void merge(NS::Archive &ar) {
+        _total += NS::Traits<std::uint64_t>::deserialize(ar);
+    }
+
+    void save(NS::Archive &ar) const {
+        NS::Traits<std::uint64_t>::serialize(ar, _total);
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -216,8 +235,9 @@ Test(GrainEstimatorT &estimator, std::vector<InputT> const &inputs, bool creates
 
     REQUIRE(allAnnotations[0].empty() == false);
 
-    NS::AnnotationMap const &                           annotations(allAnnotations[0]);
-    NS::AnnotationMap::const_iterator const             iter(annotations.find(estimator.Name));
+    NS::AnnotationMap::SnapshotPtr const                pAnnotations(allAnnotations[0].snapshot());
+    NS::AnnotationMap::Snapshot const &                 annotations(*pAnnotations);
+    NS::AnnotationMap::Snapshot::const_iterator const   iter(annotations.find(estimator.Name));
 
     REQUIRE(iter != annotations.end());
     REQUIRE(iter->second.size() == 1);
@@ -288,6 +308,51 @@ TEST_CASE("Estimator") {
     }
 }
 
+TEST_CASE("Estimator - per-grain annotations") {
+    // ----------------------------------------------------------------------
+    using ThisSumTrainingOnlyEstimator      = SumTrainingOnlyEstimator<>;
+    using Estimator                         = Components::GrainEstimatorImpl<std::string, ThisSumTrainingOnlyEstimator>;
+    // ----------------------------------------------------------------------
+
+    NS::AnnotationMapsPtr                   pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(2));
+    std::vector<NS::AnnotationMapsPtr>      perGrainAnnotations;
+    Estimator                               estimator(
+        "Test",
+        pAllColumnAnnotations,
+        [&perGrainAnnotations](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+            perGrainAnnotations.emplace_back(pAllColumnAnnotationsParam);
+            return SumTrainingOnlyEstimator<>(std::move(pAllColumnAnnotationsParam), 0);
+        }
+    );
+
+    Test(
+        estimator,
+        NS::TestHelpers::make_vector<typename Estimator::InputType>(
+            std::make_tuple("one", 10),
+            std::make_tuple("two", 20)
+        )
+    );
+
+    // Each per-grain `Estimator` publishes to its own `AnnotationMaps` rather than the
+    // `AnnotationMaps` provided to the grain `Estimator`...
+    REQUIRE(perGrainAnnotations.size() == 2);
+    CHECK(perGrainAnnotations[0] != perGrainAnnotations[1]);
+
+    for(NS::AnnotationMapsPtr const &pAnnotations : perGrainAnnotations) {
+        CHECK(pAnnotations != pAllColumnAnnotations);
+        REQUIRE(pAnnotations->size() == pAllColumnAnnotations->size());
+        CHECK((*pAnnotations)[0].size() == 1);
+        CHECK((*pAnnotations)[0].snapshot()->count(Impl::SumTrainingOnlyEstimatorPolicyName) == 1);
+        CHECK((*pAnnotations)[1].empty());
+    }
+
+    // ...so the provided `AnnotationMaps` only contain the grain `Annotation`. Note that this
+    // also means that per-grain `Estimators` can't see `Annotations` in the provided `AnnotationMaps`.
+    CHECK(pAllColumnAnnotations->at(0).size() == 1);
+    CHECK(pAllColumnAnnotations->at(0).snapshot()->count(estimator.Name) == 1);
+    CHECK(pAllColumnAnnotations->at(1).empty());
+}
+
 TEST_CASE("Estimator - limited total training items") {
     // ----------------------------------------------------------------------
     using ThisSumTrainingOnlyEstimator      = SumTrainingOnlyEstimator<>;
@@ -605,6 +670,94 @@ void Execute(TransformerT &transformer, std::string const &grain, std::uint64_t
     );
 }
 
+TEST_CASE("Estimator - training state") {
+    // ----------------------------------------------------------------------
+    using ThisSumTrainingOnlyEstimator      = SumTrainingOnlyEstimator<>;
+    using Estimator                         = Components::GrainEstimatorImpl<std::string, ThisSumTrainingOnlyEstimator>;
+    using GrainEstimatorAnnotation          = Components::GrainEstimatorAnnotation<std::string>;
+    // ----------------------------------------------------------------------
+
+    auto const                              createFunc(
+        [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+            return ThisSumTrainingOnlyEstimator(std::move(pAllColumnAnnotationsParam), 0);
+        }
+    );
+
+    std::vector<typename Estimator::InputType> const    inputs1(
+        NS::TestHelpers::make_vector<typename Estimator::InputType>(
+            std::make_tuple("one", 10),
+            std::make_tuple("two", 100)
+        )
+    );
+    std::vector<typename Estimator::InputType> const    inputs2(
+        NS::TestHelpers::make_vector<typename Estimator::InputType>(
+            std::make_tuple("one", 20),
+            std::make_tuple("three", 1000)
+        )
+    );
+
+    auto const                              checkFunc(
+        [](Estimator const &estimator) {
+            NS::AnnotationMap::SnapshotPtr const                pAllAnnotations(estimator.get_column_annotations()[0].snapshot());
+            NS::AnnotationMap::Snapshot const &                 allAnnotations(*pAllAnnotations);
+            NS::AnnotationMap::Snapshot::const_iterator const   iter(allAnnotations.find(estimator.Name));
+
+            REQUIRE(iter != allAnnotations.end());
+
+            GrainEstimatorAnnotation::AnnotationMap const &     annotations(static_cast<GrainEstimatorAnnotation const &>(*iter->second[0]).Annotations);
+
+            REQUIRE(annotations.size() == 3);
+            CHECK(ThisSumTrainingOnlyEstimator::get_annotation_data(*annotations.find("one")->second).Value == 30);
+            CHECK(ThisSumTrainingOnlyEstimator::get_annotation_data(*annotations.find("two")->second).Value == 100);
+            CHECK(ThisSumTrainingOnlyEstimator::get_annotation_data(*annotations.find("three")->second).Value == 1000);
+        }
+    );
+
+    Estimator                               partial("Test", NS::CreateTestAnnotationMapsPtr(1), createFunc);
+
+    partial.begin_training();
+    partial.fit(inputs1.data(), inputs1.size());
+
+    SECTION("Restore") {
+        NS::Archive                         out;
+
+        partial.save_training_state(out);
+
+        NS::Archive                         in(out.commit());
+        Estimator                           estimator("Test", NS::CreateTestAnnotationMapsPtr(1), createFunc);
+
+        estimator.begin_training();
+        estimator.restore_training_state(in);
+        CHECK(in.AtEnd());
+
+        estimator.fit(inputs2.data(), inputs2.size());
+        estimator.complete_training();
+
+        checkFunc(estimator);
+    }
+
+    SECTION("Merge") {
+        Estimator                           estimator("Test", NS::CreateTestAnnotationMapsPtr(1), createFunc);
+
+        estimator.begin_training();
+        estimator.fit(inputs2.data(), inputs2.size());
+        estimator.merge(partial);
+        estimator.complete_training();
+
+        checkFunc(estimator);
+    }
+
+    SECTION("Restore after fit") {
+        NS::Archive                         out;
+
+        partial.save_training_state(out);
+
+        NS::Archive                         in(out.commit());
+
+        CHECK_THROWS_WITH(partial.restore_training_state(in), "`restore_training_state` should not be invoked on an estimator that has been fit");
+    }
+}
+
 TEST_CASE("Transformer") {
     // ----------------------------------------------------------------------
     using Estimator                         = Components::GrainEstimatorImpl<std::string, DeltaEstimator>;
@@ -709,6 +862,248 @@ TEST_CASE("Transformer") {
     }
 }
 
+TEST_CASE("GrainTransformer - flat layout") {
+    // ----------------------------------------------------------------------
+    using LabelEncoderEstimator             = NS::Featurizers::LabelEncoderEstimator<std::string>;
+    using LabelEncoderTransformer           = NS::Featurizers::LabelEncoderTransformer<std::string>;
+    using GrainTransformer                  = Components::GrainTransformer<std::string, LabelEncoderEstimator>;
+    using IndexMap                          = LabelEncoderTransformer::IndexMap;
+    // ----------------------------------------------------------------------
+
+    std::string const                       filename("GrainEstimatorImpl_UnitTest.bin");
+
+    {
+        GrainTransformer::TransformerMap    transformers;
+
+        transformers.emplace("one", GrainTransformer::GrainTransformerTypeUniquePtr(new LabelEncoderTransformer(IndexMap{{"a", 0}, {"b", 1}}, false)));
+        transformers.emplace("two", GrainTransformer::GrainTransformerTypeUniquePtr(new LabelEncoderTransformer(IndexMap{{"b", 0}, {"c", 1}}, false)));
+
+        NS::Archive                         out(0, NS::Archive::LayoutValue::Flat);
+
+        GrainTransformer(std::move(transformers)).save(out);
+
+        NS::Archive::ByteArray const        data(out.commit());
+        std::ofstream                       stream(filename, std::ios::binary);
+
+        stream.write(reinterpret_cast<char const *>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+    {
+        std::unique_ptr<GrainTransformer>   pTransformer;
+
+        {
+            NS::Archive                     in(NS::CreateMemoryMappedArchive(filename));
+
+            pTransformer.reset(new GrainTransformer(in));
+            CHECK(in.AtEnd());
+        }
+
+        // The per-grain lookup tables reference the mapped file, which is kept
+        // alive by the transformers
+        std::vector<std::tuple<std::string, std::uint32_t>>             results;
+        auto const                          callback(
+            [&results](std::tuple<std::string, std::uint32_t> value) {
+                results.emplace_back(std::move(value));
+            }
+        );
+
+        pTransformer->execute(std::make_tuple(std::string("one"), std::string("b")), callback);
+        pTransformer->execute(std::make_tuple(std::string("two"), std::string("b")), callback);
+        pTransformer->execute(std::make_tuple(std::string("two"), std::string("c")), callback);
+
+        CHECK(
+            results == NS::TestHelpers::make_vector<std::tuple<std::string, std::uint32_t>>(
+                std::make_tuple(std::string("one"), 1u),
+                std::make_tuple(std::string("two"), 0u),
+                std::make_tuple(std::string("two"), 1u)
+            )
+        );
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("GrainTransformer - lazy loading") {
+    // ----------------------------------------------------------------------
+    using LabelEncoderEstimator             = NS::Featurizers::LabelEncoderEstimator<std::string>;
+    using LabelEncoderTransformer           = NS::Featurizers::LabelEncoderTransformer<std::string>;
+    using GrainTransformer                  = Components::GrainTransformer<std::string, LabelEncoderEstimator>;
+    using IndexMap                          = LabelEncoderTransformer::IndexMap;
+    using ResultType                        = std::tuple<std::string, std::uint32_t>;
+    // ----------------------------------------------------------------------
+
+    auto const                              createTransformers(
+        [](void) {
+            GrainTransformer::TransformerMap                                transformers;
+
+            transformers.emplace("one", GrainTransformer::GrainTransformerTypeUniquePtr(new LabelEncoderTransformer(IndexMap{{"a", 0}, {"b", 1}}, false)));
+            transformers.emplace("two", GrainTransformer::GrainTransformerTypeUniquePtr(new LabelEncoderTransformer(IndexMap{{"b", 0}, {"c", 1}}, false)));
+            transformers.emplace("three", GrainTransformer::GrainTransformerTypeUniquePtr(new LabelEncoderTransformer(IndexMap{{"c", 0}, {"d", 1}, {"e", 2}}, false)));
+
+            return transformers;
+        }
+    );
+
+    auto const                              save(
+        [](GrainTransformer const &transformer, NS::Archive::LayoutValue layout) {
+            NS::Archive                     out(0, layout);
+
+            transformer.save(out);
+            return out.commit();
+        }
+    );
+
+    auto const                              execute(
+        [](GrainTransformer &transformer) {
+            std::vector<ResultType>         results;
+            auto const                      callback(
+                [&results](ResultType value) {
+                    results.emplace_back(std::move(value));
+                }
+            );
+
+            transformer.execute(std::make_tuple(std::string("one"), std::string("b")), callback);
+            transformer.execute(std::make_tuple(std::string("two"), std::string("c")), callback);
+            transformer.execute(std::make_tuple(std::string("three"), std::string("e")), callback);
+
+            return results;
+        }
+    );
+
+    std::vector<ResultType> const           expected(
+        NS::TestHelpers::make_vector<ResultType>(
+            std::make_tuple(std::string("one"), 1u),
+            std::make_tuple(std::string("two"), 1u),
+            std::make_tuple(std::string("three"), 2u)
+        )
+    );
+
+    NS::Archive::ByteArray const            data(save(GrainTransformer(createTransformers()), NS::Archive::LayoutValue::Standard));
+
+    SECTION("On demand") {
+        NS::Archive                         in(data);
+        GrainTransformer                    transformer(in);
+
+        CHECK(in.AtEnd());
+        CHECK(transformer.num_grains() == 3);
+        CHECK(transformer.num_loaded_grains() == 0);
+
+        std::vector<ResultType>             results;
+
+        transformer.execute(
+            std::make_tuple(std::string("two"), std::string("b")),
+            [&results](ResultType value) { results.emplace_back(std::move(value)); }
+        );
+
+        CHECK(results == NS::TestHelpers::make_vector<ResultType>(std::make_tuple(std::string("two"), 0u)));
+        CHECK(transformer.num_grains() == 3);
+        CHECK(transformer.num_loaded_grains() == 1);
+
+        CHECK(execute(transformer) == expected);
+        CHECK(transformer.num_loaded_grains() == 3);
+
+        CHECK_THROWS_WITH(
+            transformer.execute(std::make_tuple(std::string("four"), std::string("a")), [](ResultType) {}),
+            "Grain not found"
+        );
+    }
+
+    SECTION("Load all") {
+        NS::Archive                         in(data);
+        GrainTransformer                    transformer(in);
+
+        transformer.load_all();
+        CHECK(transformer.num_loaded_grains() == 3);
+        CHECK(execute(transformer) == expected);
+    }
+
+    SECTION("Parallel") {
+        NS::ThreadPool                      pool(2);
+        NS::Archive                         in(data);
+        GrainTransformer                    transformer(in, pool);
+
+        CHECK(transformer.num_loaded_grains() == 3);
+        CHECK(execute(transformer) == expected);
+    }
+
+    SECTION("Partially loaded") {
+        NS::Archive                         in(data);
+        GrainTransformer                    transformer(in);
+
+        transformer.execute(std::make_tuple(std::string("three"), std::string("c")), [](ResultType) {});
+        CHECK(transformer.num_loaded_grains() == 1);
+
+        // Unloaded grains are copied as-is when the layout is the same
+        NS::Archive::ByteArray const        sameLayoutData(save(transformer, NS::Archive::LayoutValue::Standard));
+
+        CHECK(sameLayoutData.size() == data.size());
+
+        // ...and are loaded and saved again when it is different
+        NS::Archive::ByteArray const        compactData(save(transformer, NS::Archive::LayoutValue::Compact));
+
+        CHECK(compactData == save(GrainTransformer(createTransformers()), NS::Archive::LayoutValue::Compact));
+        CHECK(transformer.num_loaded_grains() == 1);
+
+        for(auto const &otherData : { sameLayoutData, compactData }) {
+            NS::Archive                     otherIn(otherData);
+            GrainTransformer                other(otherIn);
+
+            CHECK(otherIn.AtEnd());
+            CHECK(other.num_grains() == 3);
+            CHECK(execute(other) == expected);
+        }
+    }
+
+    SECTION("Streaming") {
+        NS::Archive::ByteArray::const_iterator                              iter(data.begin());
+        size_t                              cbMaxRequested(0);
+        NS::Archive                         in(
+            NS::Archive::SourceFunc(
+                [&data, &iter, &cbMaxRequested](unsigned char *pBuffer, size_t cbBuffer) {
+                    size_t const            cbRead(std::min(cbBuffer, static_cast<size_t>(data.end() - iter)));
+
+                    cbMaxRequested = std::max(cbMaxRequested, cbBuffer);
+
+                    std::copy(iter, iter + static_cast<std::ptrdiff_t>(cbRead), pBuffer);
+                    iter += static_cast<std::ptrdiff_t>(cbRead);
+
+                    return cbRead;
+                }
+            ),
+            16
+        );
+
+        // The data is copied, as the archive's buffer doesn't outlive deserialization
+        std::unique_ptr<GrainTransformer>   pTransformer(new GrainTransformer(in));
+
+        CHECK(in.AtEnd());
+        CHECK(execute(*pTransformer) == expected);
+
+        // The grain data is read a chunk at a time rather than being buffered
+        // by the archive in its entirety
+        CHECK(cbMaxRequested <= 16);
+    }
+
+    SECTION("Archive without an index") {
+        NS::Archive                         out;
+
+        NS::Traits<std::uint64_t>::serialize(out, 2);
+
+        NS::Traits<std::string>::serialize(out, "one");
+        LabelEncoderTransformer(IndexMap{{"a", 0}, {"b", 1}}, false).save(out);
+
+        NS::Traits<std::string>::serialize(out, "two");
+        LabelEncoderTransformer(IndexMap{{"b", 0}, {"c", 1}}, false).save(out);
+
+        NS::Archive                         in(out.commit());
+        GrainTransformer                    transformer(in);
+
+        CHECK(in.AtEnd());
+        CHECK(transformer.num_grains() == 2);
+        CHECK(transformer.num_loaded_grains() == 2);
+    }
+}
+
 TEST_CASE("GrainTransformer - deserialization errors") {
     // ----------------------------------------------------------------------
     using GrainTransformer                  = Components::GrainTransformer<int, DeltaEstimator>;
@@ -748,6 +1143,60 @@ TEST_CASE("GrainTransformer - deserialization errors") {
             "Invalid insertion"
         );
     }
+
+    // ----------------------------------------------------------------------
+    auto const                              createIndexedArchive(
+        [](std::uint16_t majorVersion, std::uint64_t offset, std::uint64_t size) {
+            NS::Archive                     outArchive;
+
+            NS::Traits<std::uint64_t>::serialize(outArchive, std::numeric_limits<std::uint64_t>::max());
+            NS::Traits<std::uint16_t>::serialize(outArchive, majorVersion);
+            NS::Traits<std::uint16_t>::serialize(outArchive, 0);
+            NS::Traits<std::uint8_t>::serialize(outArchive, 0);
+            NS::Traits<std::uint64_t>::serialize(outArchive, 1);
+
+            NS::Traits<int>::serialize(outArchive, 1);
+            NS::Traits<std::uint64_t>::serialize(outArchive, offset);
+            NS::Traits<std::uint64_t>::serialize(outArchive, size);
+
+            NS::Archive                     dataArchive;
+
+            DeltaTransformer(10).save(dataArchive);
+
+            NS::Archive::ByteArray const    data(dataArchive.commit());
+
+            NS::Traits<std::uint64_t>::serialize(outArchive, data.size());
+            outArchive.serialize(data.data(), data.size());
+
+            return outArchive.commit();
+        }
+    );
+    // ----------------------------------------------------------------------
+
+    SECTION("Valid indexed archive") {
+        NS::Archive                         inArchive(createIndexedArchive(1, 0, sizeof(std::uint64_t)));
+        GrainTransformer                    transformer(inArchive);
+
+        CHECK(transformer.num_grains() == 1);
+    }
+
+    SECTION("Unsupported version") {
+        NS::Archive                         inArchive(createIndexedArchive(2, 0, sizeof(std::uint64_t)));
+
+        CHECK_THROWS_WITH(GrainTransformer(inArchive), "Unsupported archive version");
+    }
+
+    SECTION("Invalid grain size") {
+        NS::Archive                         inArchive(createIndexedArchive(1, 0, 0));
+
+        CHECK_THROWS_WITH(GrainTransformer(inArchive), "Invalid grain size");
+    }
+
+    SECTION("Invalid grain offset") {
+        NS::Archive                         inArchive(createIndexedArchive(1, 4, sizeof(std::uint64_t)));
+
+        CHECK_THROWS_WITH(GrainTransformer(inArchive), "Invalid grain offset");
+    }
 }
 
 TEST_CASE("GrainEstimatorAnnotation - construct errors") {
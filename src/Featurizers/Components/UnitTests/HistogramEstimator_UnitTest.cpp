@@ -5,6 +5,8 @@
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
 
+#include <thread>
+
 #include "../../../3rdParty/optional.h"
 #include "../../TestHelpers.h"
 #include "../HistogramEstimator.h"
@@ -61,3 +63,165 @@ TEST_CASE("string") {
 
     CHECK(toCheck == histogram);
 }
+
+TEST_CASE("merge") {
+    using Estimator                         = NS::Featurizers::Components::HistogramEstimator<int>;
+    using Histogram                         = NS::Featurizers::Components::HistogramAnnotationData<int>::Histogram;
+
+    std::vector<std::vector<int>> const     shards({{10,20,8,10,30},
+                                                    {7,10,10,15,11},
+                                                    {15,30,18,8,6}});
+    Histogram const                         histogram({{10,4}, {20, 1} , {8, 2}, {30, 2}, {7, 1}, {15, 2}, {11, 1}, {18, 1}, {6,1}});
+
+    NS::AnnotationMapsPtr                   pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    std::vector<Estimator>                  estimators;
+
+    for(size_t i = 0; i < shards.size(); ++i) {
+        estimators.emplace_back(NS::CreateTestAnnotationMapsPtr(1), 0);
+        estimators.back().begin_training();
+    }
+
+    std::vector<std::thread>                threads;
+
+    for(size_t i = 0; i < shards.size(); ++i) {
+        threads.emplace_back(
+            [&estimators, &shards, i](void) {
+                estimators[i].fit(shards[i].data(), shards[i].size());
+            }
+        );
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    SECTION("In memory") {
+        Estimator                           estimator(pAllColumnAnnotations, 0);
+
+        estimator.begin_training();
+
+        for(auto const &shard : estimators)
+            estimator.merge(shard);
+
+        estimator.complete_training();
+        CHECK(estimator.get_annotation_data().Value == histogram);
+    }
+
+    SECTION("Archive") {
+        Estimator                           estimator(pAllColumnAnnotations, 0);
+
+        estimator.begin_training();
+        estimator.fit(shards[0].data(), shards[0].size());
+
+        for(size_t i = 1; i < estimators.size(); ++i) {
+            NS::Archive                     out;
+
+            estimators[i].save_training_state(out);
+
+            NS::Archive                     in(out.commit());
+
+            estimator.merge(in);
+            CHECK(in.AtEnd());
+        }
+
+        estimator.complete_training();
+        CHECK(estimator.get_annotation_data().Value == histogram);
+    }
+
+    SECTION("Invalid state") {
+        Estimator                           estimator(pAllColumnAnnotations, 0);
+
+        CHECK_THROWS_WITH(estimator.merge(estimators[0]), "`merge` should not be invoked on an estimator that is not training or is already complete");
+
+        estimators[0].complete_training();
+        estimator.begin_training();
+
+        CHECK_THROWS_WITH(estimator.merge(estimators[0]), "`merge` should not be invoked with an estimator that is already complete");
+        CHECK_THROWS_WITH(estimator.merge(estimator), "other");
+    }
+}
+
+TEST_CASE("merge - MaxNumTrainingItems") {
+    using Estimator                         = NS::Featurizers::Components::HistogramEstimator<int, 5>;
+
+    std::vector<int> const                  data({1, 2, 3});
+    Estimator                               estimator1(NS::CreateTestAnnotationMapsPtr(1), 0);
+    Estimator                               estimator2(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+    estimator1.begin_training();
+    estimator2.begin_training();
+
+    CHECK(estimator1.fit(data.data(), data.size()) == NS::FitResult::Continue);
+    CHECK(estimator2.fit(data.data(), data.size()) == NS::FitResult::Continue);
+
+    estimator1.merge(estimator2);
+
+    // The merged estimator has seen 6 items, so it doesn't accept any more
+    CHECK(estimator1.fit(data.data(), data.size()) == NS::FitResult::Complete);
+    estimator1.complete_training();
+
+    CHECK(estimator1.get_annotation_data().Value == NS::Featurizers::Components::HistogramAnnotationData<int>::Histogram({{1, 2}, {2, 2}, {3, 2}}));
+}
+
+TEST_CASE("convergence") {
+    using Histogram                         = NS::Featurizers::Components::HistogramAnnotationData<int>::Histogram;
+    using ConvergenceOptions                = NS::Featurizers::Components::ConvergenceOptions;
+
+    std::vector<int>                        data(10000);
+
+    for(size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<int>(i % 4);
+
+    SECTION("Stable") {
+        NS::Featurizers::Components::HistogramEstimator<int>                estimator(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+        estimator.set_convergence_options(ConvergenceOptions(0.01, 100, 2));
+        estimator.begin_training();
+
+        size_t                              offset(0);
+
+        while(estimator.fit(data.data() + offset, 10) == NS::FitResult::Continue)
+            offset += 10;
+
+        // Retrieving the statistics doesn't modify the estimator
+        CHECK(estimator.get_convergence_statistics() == std::vector<double>{4.0, 0.25});
+        CHECK(estimator.get_convergence_statistics() == std::vector<double>{4.0, 0.25});
+
+        estimator.complete_training();
+
+        // Checks at 100 (baseline), 200 and 300 items
+        CHECK(estimator.get_annotation_data().Value == Histogram({{0, 75}, {1, 75}, {2, 75}, {3, 75}}));
+    }
+
+    SECTION("New values") {
+        // The number of distinct values continues to grow
+        for(size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<int>(i / 2);
+
+        NS::Featurizers::Components::HistogramEstimator<int>                estimator(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+        estimator.set_convergence_options(ConvergenceOptions(0.01, 100, 2));
+        NS::TestHelpers::Train(estimator, std::vector<std::vector<int>>{data});
+
+        CHECK(estimator.get_annotation_data().Value.size() == 5000);
+    }
+
+    SECTION("Rare new values") {
+        // A single new value is encountered during each check interval; the
+        // relative change in the number of distinct values quickly falls below
+        // the tolerance, but the histogram never converges.
+        for(size_t i = 50; i < data.size(); i += 100)
+            data[i] = static_cast<int>(1000 + i);
+
+        NS::Featurizers::Components::HistogramEstimator<int>                estimator(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+        estimator.set_convergence_options(ConvergenceOptions(0.05, 100, 2));
+        NS::TestHelpers::Train(estimator, std::vector<std::vector<int>>{data});
+
+        std::uint64_t                       cItems(0);
+
+        for(auto const &kvp : estimator.get_annotation_data().Value)
+            cItems += kvp.second;
+
+        CHECK(cItems == data.size());
+    }
+}
@@ -59,6 +59,55 @@ TEST_CASE("nullable strings") {
     Test<false, nonstd::optional<std::string>, std::string>({"1", nonstd::optional<std::string>(), "2", "3", nonstd::optional<std::string>(), "4"}, "2");
 }
 
+TEST_CASE("Training state") {
+    using MedianEstimator                   = NS::Featurizers::Components::MedianEstimator<int, double>;
+
+    std::vector<int> const                  inputs1({10, 3, 7, 1});
+    std::vector<int> const                  inputs2({8, 2, 9, 4});
+
+    MedianEstimator                         partial(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+    partial.begin_training();
+    partial.fit(inputs1.data(), inputs1.size());
+
+    SECTION("Restore") {
+        NS::Archive                         out;
+
+        partial.save_training_state(out);
+
+        NS::Archive                         in(out.commit());
+        MedianEstimator                     estimator(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+        estimator.begin_training();
+        estimator.restore_training_state(in);
+        estimator.fit(inputs2.data(), inputs2.size());
+        estimator.complete_training();
+
+        CHECK(estimator.get_annotation_data().Median == Approx(5.5));
+    }
+
+    SECTION("Merge") {
+        MedianEstimator                     estimator(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+        estimator.begin_training();
+        estimator.fit(inputs2.data(), inputs2.size());
+        estimator.merge(partial);
+        estimator.complete_training();
+
+        CHECK(estimator.get_annotation_data().Median == Approx(5.5));
+    }
+
+    SECTION("Restore after fit") {
+        NS::Archive                         out;
+
+        partial.save_training_state(out);
+
+        NS::Archive                         in(out.commit());
+
+        CHECK_THROWS_WITH(partial.restore_training_state(in), "`restore_training_state` should not be invoked on an estimator that has been fit");
+    }
+}
+
 TEST_CASE("No elements during training") {
     NS::AnnotationMapsPtr const                         pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
     NS::Featurizers::Components::MedianEstimator<int>   estimator(pAllColumnAnnotations, 0);
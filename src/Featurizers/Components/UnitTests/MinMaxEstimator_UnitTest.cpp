@@ -69,3 +69,37 @@ TEST_CASE("double") {
 
     CHECK(toCheck == std::tuple<InputType, InputType>(-1, 1));
 }
+
+TEST_CASE("merge") {
+    using InputType                         = int;
+    using Estimator                         = NS::Featurizers::Components::MinMaxEstimator<InputType>;
+
+    NS::AnnotationMapsPtr                   pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    Estimator                               estimator(pAllColumnAnnotations, 0);
+    Estimator                               shard1(NS::CreateTestAnnotationMapsPtr(1), 0);
+    Estimator                               shard2(NS::CreateTestAnnotationMapsPtr(1), 0);
+    Estimator                               emptyShard(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+    estimator.begin_training();
+    shard1.begin_training();
+    shard2.begin_training();
+    emptyShard.begin_training();
+
+    estimator.fit(10);
+    shard1.fit(-3);
+    shard2.fit(30);
+
+    NS::Archive                             out;
+
+    shard2.save_training_state(out);
+
+    NS::Archive                             in(out.commit());
+
+    estimator.merge(shard1).merge(in).merge(emptyShard);
+    estimator.complete_training();
+
+    NS::Featurizers::Components::MinMaxAnnotationData<InputType> const &    annotation(estimator.get_annotation_data());
+
+    CHECK(annotation.Min == -3);
+    CHECK(annotation.Max == 30);
+}
@@ -32,6 +32,13 @@ T Test(std::vector<T> const &input) {
     NS::TestHelpers::Train(orderEstimator, batchedInput);
     NS::TestHelpers::Train(modeEstimator, batchedInput);
 
+    // The single pass estimator doesn't rely on other annotations and should produce the same result
+    NS::AnnotationMapsPtr                                       pSinglePassAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    NS::Featurizers::Components::SinglePassModeEstimator<T>     singlePassEstimator(pSinglePassAnnotations, 0);
+
+    NS::TestHelpers::Train(singlePassEstimator, batchedInput);
+    CHECK(singlePassEstimator.get_annotation_data().Value == modeEstimator.get_annotation_data().Value);
+
     return modeEstimator.get_annotation_data().Value;
 }
 
@@ -64,3 +71,28 @@ TEST_CASE("Nulls") {
     CHECK(TestNullModeValues<true>() == OptionalString());
     CHECK(TestNullModeValues<false>() == "two");
 }
+
+template <bool AllowNullModeValueV>
+OptionalString TestSinglePassNullModeValues(void) {
+    std::vector<std::vector<OptionalString>> const                                          batchedInput(NS::TestHelpers::make_vector<std::vector<OptionalString>>(NS::TestHelpers::make_vector<OptionalString>("one", "two", OptionalString(), OptionalString(), "two", OptionalString())));
+    NS::AnnotationMapsPtr                                                                   pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    NS::Featurizers::Components::SinglePassModeEstimator<OptionalString, AllowNullModeValueV>  modeEstimator(pAllColumnAnnotations, 0);
+
+    NS::TestHelpers::Train(modeEstimator, batchedInput);
+
+    return modeEstimator.get_annotation_data().Value;
+}
+
+TEST_CASE("Single pass - Nulls") {
+    CHECK(TestSinglePassNullModeValues<true>() == OptionalString());
+    CHECK(TestSinglePassNullModeValues<false>() == "two");
+}
+
+TEST_CASE("Single pass - Ties") {
+    NS::AnnotationMapsPtr                                   pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    NS::Featurizers::Components::SinglePassModeEstimator<int>   modeEstimator(pAllColumnAnnotations, 0);
+
+    // 3 and 1 are seen the same number of times, but 3 was seen first
+    NS::TestHelpers::Train(modeEstimator, NS::TestHelpers::make_vector<std::vector<int>>(NS::TestHelpers::make_vector<int>(2, 3, 1, 1, 3)));
+    CHECK(modeEstimator.get_annotation_data().Value == 3);
+}
@@ -150,7 +150,29 @@ private:
     }
 };
 
+template <typename T, size_t ColIndexV, size_t MaxRowsV=100000>
+class MyConcurrentAnnotationEstimator : public MyAnnotationEstimator<T, ColIndexV, MaxRowsV> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    static constexpr bool const             SupportsConcurrentTraining = true;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    MyConcurrentAnnotationEstimator(NS::AnnotationMapsPtr pAllColumnAnnotations) :
+        MyAnnotationEstimator<T, ColIndexV, MaxRowsV>(std::move(pAllColumnAnnotations)) {
+    }
+};
+
+static_assert(NS::Featurizers::Components::Details::IsConcurrentTrainingEstimator<MyConcurrentAnnotationEstimator<int, 0>>::value, "");
+static_assert(NS::Featurizers::Components::Details::IsConcurrentTrainingEstimator<MyAnnotationEstimator<int, 0>>::value == false, "");
+
 class StringToIntTransformer : public NS::Featurizers::Components::InferenceOnlyTransformerImpl<NonCopyable<std::string>, NonCopyable<size_t>> {
+public:
+    bool is_stateless(void) const override {
+        return true;
+    }
+
 private:
     void execute_impl(InputType const &input, CallbackFunction const &callback) override {
         callback(input.Value.size());
@@ -169,12 +191,35 @@ public:
 };
 
 class IntToStringTransformer : public NS::Featurizers::Components::InferenceOnlyTransformerImpl<NonCopyable<size_t>, NonCopyable<std::string>> {
+public:
+    bool is_stateless(void) const override {
+        return true;
+    }
+
 private:
     void execute_impl(InputType const &input, CallbackFunction const &callback) override {
         callback(std::to_string(input.Value));
     }
 };
 
+class StatefulStringToIntTransformer : public NS::Featurizers::Components::InferenceOnlyTransformerImpl<NonCopyable<std::string>, NonCopyable<size_t>> {
+private:
+    void execute_impl(InputType const &input, CallbackFunction const &callback) override {
+        callback(input.Value.size());
+    }
+};
+
+class StatefulStringToIntEstimator : public NS::Featurizers::Components::InferenceOnlyEstimatorImpl<StatefulStringToIntTransformer> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    StatefulStringToIntEstimator(NS::AnnotationMapsPtr pAllColumnAnnotations) :
+        NS::Featurizers::Components::InferenceOnlyEstimatorImpl<StatefulStringToIntTransformer>("StatefulStringToIntEstimator", std::move(pAllColumnAnnotations)) {
+    }
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(StatefulStringToIntEstimator);
+};
+
 class IntToStringEstimator : public NS::Featurizers::Components::InferenceOnlyEstimatorImpl<IntToStringTransformer> {
 public:
     // ----------------------------------------------------------------------
@@ -221,11 +266,12 @@ TEST_CASE("Annotation, Transformer") {
         ) == NS::TestHelpers::make_vector<NonCopyable<size_t>>(3, 3, 5)
     );
 
-    NS::AnnotationMap const &               annotations((*pAllColumnAnnotations)[0]);
+    NS::AnnotationMap::SnapshotPtr const    pAnnotations((*pAllColumnAnnotations)[0].snapshot());
+    NS::AnnotationMap::Snapshot const &     annotations(*pAnnotations);
 
     REQUIRE(annotations.size() == 1);
 
-    NS::AnnotationMap::const_iterator const             iterAnnotations(annotations.find("MyAnnotationEstimator"));
+    NS::AnnotationMap::Snapshot::const_iterator const   iterAnnotations(annotations.find("MyAnnotationEstimator"));
 
     REQUIRE(iterAnnotations != annotations.end());
     REQUIRE(iterAnnotations->second.size() == 1);
@@ -263,11 +309,12 @@ TEST_CASE("Annotation, Annotation, Annotation, Transformer") {
         ) == NS::TestHelpers::make_vector<NonCopyable<size_t>>(3, 3, 5)
     );
 
-    NS::AnnotationMap const &               annotations((*pAllColumnAnnotations)[0]);
+    NS::AnnotationMap::SnapshotPtr const    pAnnotations((*pAllColumnAnnotations)[0].snapshot());
+    NS::AnnotationMap::Snapshot const &     annotations(*pAnnotations);
 
     REQUIRE(annotations.size() == 1);
 
-    NS::AnnotationMap::const_iterator const             iter(annotations.find("MyAnnotationEstimator"));
+    NS::AnnotationMap::Snapshot::const_iterator const   iter(annotations.find("MyAnnotationEstimator"));
 
     REQUIRE(iter != annotations.end());
 
@@ -293,6 +340,110 @@ TEST_CASE("Annotation, Annotation, Annotation, Transformer") {
     CHECK(mine3.Value.Value == "three"); // This test will fail if batches aren't being properly reset
 }
 
+TEST_CASE("Concurrent Annotation, Annotation, Annotation, Transformer") {
+    using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+        MyConcurrentAnnotationEstimator<NonCopyable<std::string>, 0>,
+        MyConcurrentAnnotationEstimator<NonCopyable<std::string>, 0, 4>,
+        MyConcurrentAnnotationEstimator<NonCopyable<std::string>, 0>,
+        StringToIntEstimator
+    >;
+
+    // ----------------------------------------------------------------------
+    using EstimatorTuple = std::tuple<
+        MyConcurrentAnnotationEstimator<NonCopyable<std::string>, 0>,
+        MyConcurrentAnnotationEstimator<NonCopyable<std::string>, 0, 4>,
+        MyConcurrentAnnotationEstimator<NonCopyable<std::string>, 0>,
+        StringToIntEstimator
+    >;
+    // ----------------------------------------------------------------------
+
+    static_assert(NS::Featurizers::Components::Details::Impl::ConcurrentGroupSize<0, EstimatorTuple>::value == 3, "");
+    static_assert(NS::Featurizers::Components::Details::Impl::ConcurrentGroupSize<2, EstimatorTuple>::value == 1, "");
+
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+
+    CHECK(
+        NS::TestHelpers::TransformerEstimatorTest(
+            Estimator("Estimator", pAllColumnAnnotations),
+            NS::TestHelpers::make_vector<std::vector<NonCopyable<std::string>>>(
+                // The estimators are fit together, so the 2nd estimator completing after
+                // the first 4 items doesn't cause the batch to be reset for the others.
+                NS::TestHelpers::make_vector<NonCopyable<std::string>>("three", "one", "two", "one", "three", "three", "three"),
+                NS::TestHelpers::make_vector<NonCopyable<std::string>>("two", "two")
+            ),
+            NS::TestHelpers::make_vector<NonCopyable<std::string>>("one", "two", "three")
+        ) == NS::TestHelpers::make_vector<NonCopyable<size_t>>(3, 3, 5)
+    );
+
+    NS::AnnotationMap::SnapshotPtr const    pAnnotations((*pAllColumnAnnotations)[0].snapshot());
+    NS::AnnotationMap::Snapshot const &     annotations(*pAnnotations);
+
+    REQUIRE(annotations.size() == 1);
+
+    NS::AnnotationMap::Snapshot::const_iterator const   iter(annotations.find("MyAnnotationEstimator"));
+
+    REQUIRE(iter != annotations.end());
+
+    // Annotations are added in the order in which the estimators appear in the chain
+    REQUIRE(iter->second.size() == 3);
+
+    MyAnnotation<NonCopyable<std::string>> const * const    pMine1(dynamic_cast<MyAnnotation<NonCopyable<std::string>> const *>(iter->second[0].get()));
+    MyAnnotation<NonCopyable<std::string>> const * const    pMine2(dynamic_cast<MyAnnotation<NonCopyable<std::string>> const *>(iter->second[1].get()));
+    MyAnnotation<NonCopyable<std::string>> const * const    pMine3(dynamic_cast<MyAnnotation<NonCopyable<std::string>> const *>(iter->second[2].get()));
+
+    REQUIRE(pMine1);
+    REQUIRE(pMine2);
+    REQUIRE(pMine3);
+
+    CHECK(pMine1->Value.Value == "three");
+    CHECK(pMine2->Value.Value == "one");
+    CHECK(pMine3->Value.Value == "three");
+}
+
+TEST_CASE("Concurrent Annotation, Annotation, Transformer - large batch") {
+    using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+        MyConcurrentAnnotationEstimator<NonCopyable<std::string>, 0>,
+        MyConcurrentAnnotationEstimator<NonCopyable<std::string>, 0, 3000>,
+        StringToIntEstimator
+    >;
+
+    // Batches of at least `MinConcurrentFitBatchSize` items are fit on the shared thread pool
+    std::vector<NonCopyable<std::string>>   batch;
+
+    for(size_t i = 0; i < 5000; ++i)
+        batch.emplace_back(i < 2500 ? (i % 3 == 0 ? "one" : "three") : "two");
+
+    std::vector<std::vector<NonCopyable<std::string>>>  batches;
+
+    batches.emplace_back(std::move(batch));
+
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+
+    CHECK(
+        NS::TestHelpers::TransformerEstimatorTest(
+            Estimator("Estimator", pAllColumnAnnotations),
+            std::move(batches),
+            NS::TestHelpers::make_vector<NonCopyable<std::string>>("one", "two")
+        ) == NS::TestHelpers::make_vector<NonCopyable<size_t>>(3, 3)
+    );
+
+    NS::AnnotationMap::SnapshotPtr const    pAnnotations((*pAllColumnAnnotations)[0].snapshot());
+    NS::AnnotationMap::Snapshot const &     annotations(*pAnnotations);
+    NS::AnnotationMap::Snapshot::const_iterator const   iter(annotations.find("MyAnnotationEstimator"));
+
+    REQUIRE(iter != annotations.end());
+    REQUIRE(iter->second.size() == 2);
+
+    MyAnnotation<NonCopyable<std::string>> const * const    pMine1(dynamic_cast<MyAnnotation<NonCopyable<std::string>> const *>(iter->second[0].get()));
+    MyAnnotation<NonCopyable<std::string>> const * const    pMine2(dynamic_cast<MyAnnotation<NonCopyable<std::string>> const *>(iter->second[1].get()));
+
+    REQUIRE(pMine1);
+    REQUIRE(pMine2);
+
+    CHECK(pMine1->Value.Value == "two");
+    CHECK(pMine2->Value.Value == "three");
+}
+
 TEST_CASE("Transformer, Transformer") {
     using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
         StringToIntEstimator,
@@ -332,11 +483,12 @@ TEST_CASE("Transformer, Annotation, Transformer") {
         ) == NS::TestHelpers::make_vector<NonCopyable<size_t>>(4, 3, 2, 1)
     );
 
-    NS::AnnotationMap const &               annotations((*pAllColumnAnnotations)[0]);
+    NS::AnnotationMap::SnapshotPtr const    pAnnotations((*pAllColumnAnnotations)[0].snapshot());
+    NS::AnnotationMap::Snapshot const &     annotations(*pAnnotations);
 
     REQUIRE(annotations.size() == 1);
 
-    NS::AnnotationMap::const_iterator const             iterAnnotations(annotations.find("MyAnnotationEstimator"));
+    NS::AnnotationMap::Snapshot::const_iterator const   iterAnnotations(annotations.find("MyAnnotationEstimator"));
 
     REQUIRE(iterAnnotations != annotations.end());
     REQUIRE(iterAnnotations->second.size() == 1);
@@ -369,11 +521,12 @@ TEST_CASE("Transformer, Annotation") {
         ) == NS::TestHelpers::make_vector<NonCopyable<std::string>>("1000", "200", "30", "4")
     );
 
-    NS::AnnotationMap const &               annotations((*pAllColumnAnnotations)[0]);
+    NS::AnnotationMap::SnapshotPtr const    pAnnotations((*pAllColumnAnnotations)[0].snapshot());
+    NS::AnnotationMap::Snapshot const &     annotations(*pAnnotations);
 
     REQUIRE(annotations.size() == 1);
 
-    NS::AnnotationMap::const_iterator const             iterAnnotations(annotations.find("MyAnnotationEstimator"));
+    NS::AnnotationMap::Snapshot::const_iterator const   iterAnnotations(annotations.find("MyAnnotationEstimator"));
 
     REQUIRE(iterAnnotations != annotations.end());
     REQUIRE(iterAnnotations->second.size() == 1);
@@ -387,6 +540,177 @@ TEST_CASE("Transformer, Annotation") {
     CHECK(myAnnotation.Value.Value == "4");
 }
 
+TEST_CASE("Batch execute") {
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    auto                                    inputs(NS::TestHelpers::make_vector<NonCopyable<size_t>>(1000, 200, 30, 4));
+
+    SECTION("Transformer, Transformer") {
+        using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+            IntToStringEstimator,
+            StringToIntEstimator
+        >;
+
+        Estimator                           estimator("Estimator", pAllColumnAnnotations);
+
+        estimator.begin_training();
+        estimator.complete_training();
+
+        Estimator::TransformerUniquePtr     pTransformer(estimator.create_transformer());
+        std::vector<NonCopyable<size_t>>    outputs;
+
+        while(outputs.size() != inputs.size())
+            outputs.emplace_back(0);
+
+        pTransformer->execute(inputs.data(), inputs.size(), outputs.data());
+
+        CHECK(outputs == NS::TestHelpers::make_vector<NonCopyable<size_t>>(4, 3, 2, 1));
+    }
+
+    SECTION("Transformer, Annotation") {
+        using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+            IntToStringEstimator,
+            MyAnnotationEstimator<NonCopyable<std::string>, 0>
+        >;
+
+        Estimator                           estimator("Estimator", pAllColumnAnnotations);
+
+        NS::TestHelpers::Train(
+            estimator,
+            NS::TestHelpers::make_vector<std::vector<NonCopyable<size_t>>>(
+                NS::TestHelpers::make_vector<NonCopyable<size_t>>(1000, 200, 30, 4)
+            )
+        );
+
+        Estimator::TransformerUniquePtr     pTransformer(estimator.create_transformer());
+        std::vector<NonCopyable<std::string>>           outputs;
+
+        while(outputs.size() != inputs.size())
+            outputs.emplace_back("");
+
+        pTransformer->execute(inputs.data(), inputs.size(), outputs.data());
+
+        CHECK(outputs == NS::TestHelpers::make_vector<NonCopyable<std::string>>("1000", "200", "30", "4"));
+    }
+}
+
+TEST_CASE("Clone") {
+    SECTION("Stateless Transformers") {
+        // ----------------------------------------------------------------------
+        using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+            IntToStringEstimator,
+            StringToIntEstimator
+        >;
+        // ----------------------------------------------------------------------
+
+        Estimator                           estimator("Estimator", NS::CreateTestAnnotationMapsPtr(1));
+
+        estimator.begin_training();
+        estimator.complete_training();
+
+        Estimator::TransformerUniquePtr     pTransformer(estimator.create_transformer());
+
+        // These Transformers don't implement `clone`, but they are stateless and
+        // are shared with the clone
+        Estimator::TransformerUniquePtr     pClone(pTransformer->clone());
+
+        REQUIRE(pClone);
+        CHECK(pClone->is_stateless());
+
+        std::vector<NonCopyable<size_t>>    results;
+
+        pClone->execute(
+            NonCopyable<size_t>(1000),
+            [&results](NonCopyable<size_t> value) {
+                results.emplace_back(std::move(value));
+            }
+        );
+
+        REQUIRE(results.size() == 1);
+        CHECK(results[0].Value == 4);
+    }
+
+    SECTION("Stateful Transformers") {
+        // ----------------------------------------------------------------------
+        using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+            IntToStringEstimator,
+            StatefulStringToIntEstimator
+        >;
+        // ----------------------------------------------------------------------
+
+        Estimator                           estimator("Estimator", NS::CreateTestAnnotationMapsPtr(1));
+
+        estimator.begin_training();
+        estimator.complete_training();
+
+        // This Transformer is stateful and doesn't support cloning, so neither
+        // does the pipeline
+        CHECK(!estimator.create_transformer()->clone());
+    }
+}
+
+TEST_CASE("Execute single result") {
+    // `NonCopyable` inputs ensure that the input is not copied when invoking `execute`
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    NonCopyable<size_t> const               input(1000);
+
+    SECTION("Transformer, Transformer") {
+        using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+            IntToStringEstimator,
+            StringToIntEstimator
+        >;
+
+        Estimator                           estimator("Estimator", pAllColumnAnnotations);
+
+        estimator.begin_training();
+        estimator.complete_training();
+
+        Estimator::TransformerUniquePtr     pTransformer(estimator.create_transformer());
+
+        CHECK(static_cast<Estimator::TransformerType &>(*pTransformer).execute(input).Value == 4);
+        CHECK(pTransformer->is_stateless());
+    }
+
+    SECTION("Transformer, Annotation") {
+        using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+            IntToStringEstimator,
+            MyAnnotationEstimator<NonCopyable<std::string>, 0>
+        >;
+
+        Estimator                           estimator("Estimator", pAllColumnAnnotations);
+
+        NS::TestHelpers::Train(
+            estimator,
+            NS::TestHelpers::make_vector<std::vector<NonCopyable<size_t>>>(
+                NS::TestHelpers::make_vector<NonCopyable<size_t>>(1000, 200, 30, 4)
+            )
+        );
+
+        Estimator::TransformerUniquePtr     pTransformer(estimator.create_transformer());
+
+        CHECK(static_cast<Estimator::TransformerType &>(*pTransformer).execute(input).Value == "1000");
+    }
+
+    SECTION("Annotation, Transformer") {
+        using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+            MyAnnotationEstimator<NonCopyable<size_t>, 0>,
+            IntToStringEstimator
+        >;
+
+        Estimator                           estimator("Estimator", pAllColumnAnnotations);
+
+        NS::TestHelpers::Train(
+            estimator,
+            NS::TestHelpers::make_vector<std::vector<NonCopyable<size_t>>>(
+                NS::TestHelpers::make_vector<NonCopyable<size_t>>(1000, 200, 30, 4)
+            )
+        );
+
+        Estimator::TransformerUniquePtr     pTransformer(estimator.create_transformer());
+
+        CHECK(static_cast<Estimator::TransformerType &>(*pTransformer).execute(input).Value == "1000");
+    }
+}
+
 TEST_CASE("Annotation, Annotation, Transformer, Annotation") {
     using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
         MyAnnotationEstimator<NonCopyable<size_t>, 0>,
@@ -408,11 +732,12 @@ TEST_CASE("Annotation, Annotation, Transformer, Annotation") {
         ) == NS::TestHelpers::make_vector<NonCopyable<std::string>>("1000", "200", "30", "4")
     );
 
-    NS::AnnotationMap const &               annotations((*pAllColumnAnnotations)[0]);
+    NS::AnnotationMap::SnapshotPtr const    pAnnotations((*pAllColumnAnnotations)[0].snapshot());
+    NS::AnnotationMap::Snapshot const &     annotations(*pAnnotations);
 
     REQUIRE(annotations.size() == 1);
 
-    NS::AnnotationMap::const_iterator const             iterAnnotations(annotations.find("MyAnnotationEstimator"));
+    NS::AnnotationMap::Snapshot::const_iterator const   iterAnnotations(annotations.find("MyAnnotationEstimator"));
 
     REQUIRE(iterAnnotations != annotations.end());
 
@@ -436,6 +761,72 @@ TEST_CASE("Annotation, Annotation, Transformer, Annotation") {
     CHECK(myAnnotation3.Value.Value == "4");
 }
 
+template <typename EstimatorT>
+std::vector<std::string> GetPipelinedTrainingAnnotations(bool enablePipelinedTraining) {
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    EstimatorT                              estimator("Estimator", pAllColumnAnnotations);
+
+    if(enablePipelinedTraining)
+        estimator.enable_pipelined_training(1);
+
+    CHECK(
+        NS::TestHelpers::TransformerEstimatorTest(
+            std::move(estimator),
+            NS::TestHelpers::make_vector<std::vector<NonCopyable<size_t>>>(
+                // Use small batches so that multiple batches are pending when the 1st
+                // annotation estimator completes (after the first 3 items)
+                NS::TestHelpers::make_vector<NonCopyable<size_t>>(1000),
+                NS::TestHelpers::make_vector<NonCopyable<size_t>>(200),
+                NS::TestHelpers::make_vector<NonCopyable<size_t>>(30),
+                NS::TestHelpers::make_vector<NonCopyable<size_t>>(4),
+                NS::TestHelpers::make_vector<NonCopyable<size_t>>(111),
+                NS::TestHelpers::make_vector<NonCopyable<size_t>>(4, 4)
+            ),
+            NS::TestHelpers::make_vector<NonCopyable<size_t>>(1000, 200, 30, 4)
+        ) == NS::TestHelpers::make_vector<NonCopyable<size_t>>(4, 3, 2, 1)
+    );
+
+    NS::AnnotationMap::SnapshotPtr const    pAnnotations((*pAllColumnAnnotations)[0].snapshot());
+    NS::AnnotationMap::Snapshot const &     annotations(*pAnnotations);
+    NS::AnnotationMap::Snapshot::const_iterator const   iterAnnotations(annotations.find("MyAnnotationEstimator"));
+    std::vector<std::string>                results;
+
+    REQUIRE(iterAnnotations != annotations.end());
+
+    for(auto const &pAnnotation : iterAnnotations->second) {
+        MyAnnotation<NonCopyable<std::string>> const * const    pMine(dynamic_cast<MyAnnotation<NonCopyable<std::string>> const *>(pAnnotation.get()));
+
+        REQUIRE(pMine);
+        results.emplace_back(pMine->Value.Value);
+    }
+
+    return results;
+}
+
+TEST_CASE("Pipelined training") {
+    using Estimator = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<
+        IntToStringEstimator,
+        MyAnnotationEstimator<NonCopyable<std::string>, 0, 3>,
+        MyAnnotationEstimator<NonCopyable<std::string>, 0>,
+        StringToIntEstimator
+    >;
+
+    std::vector<std::string> const          expected(GetPipelinedTrainingAnnotations<Estimator>(false));
+
+    CHECK(expected == std::vector<std::string>{"30", "4"});
+
+    for(int iteration = 0; iteration < 20; ++iteration)
+        CHECK(GetPipelinedTrainingAnnotations<Estimator>(true) == expected);
+
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    Estimator                               estimator("Estimator", pAllColumnAnnotations);
+
+    CHECK_THROWS_WITH(estimator.enable_pipelined_training(0), "maxPendingBatches");
+
+    estimator.begin_training();
+    CHECK_THROWS_WITH(estimator.enable_pipelined_training(), "Pipelined training must be enabled before training begins");
+}
+
 class SimpleEstimator : public NS::TransformerEstimator<int, double> {
 public:
     // ----------------------------------------------------------------------
@@ -524,11 +915,12 @@ TEST_CASE("Transformer with Training") {
         ) == std::vector<double>{14.5, 24.5, 34.5, 44.5, 54.5}
     );
 
-    NS::AnnotationMap const &               annotations((*pAllColumnAnnotations)[0]);
+    NS::AnnotationMap::SnapshotPtr const    pAnnotations((*pAllColumnAnnotations)[0].snapshot());
+    NS::AnnotationMap::Snapshot const &     annotations(*pAnnotations);
 
     REQUIRE(annotations.size() == 1);
 
-    NS::AnnotationMap::const_iterator const             iter(annotations.find("MyAnnotationEstimator"));
+    NS::AnnotationMap::Snapshot::const_iterator const   iter(annotations.find("MyAnnotationEstimator"));
 
     REQUIRE(iter != annotations.end());
 
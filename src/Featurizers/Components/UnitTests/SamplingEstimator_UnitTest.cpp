@@ -0,0 +1,225 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../SamplingEstimator.h"
+#include "../HistogramEstimator.h"
+#include "../MedianEstimator.h"
+#include "../../TestHelpers.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using HistogramEstimator                    = NS::Featurizers::Components::HistogramEstimator<int>;
+using SamplingEstimator                     = NS::Featurizers::Components::SamplingEstimator<HistogramEstimator>;
+using SamplingOptions                       = NS::Featurizers::Components::SamplingOptions;
+using Histogram                             = NS::Featurizers::Components::HistogramAnnotationData<int>::Histogram;
+
+std::vector<int> CreateInputs(int numItems) {
+    std::vector<int>                        result;
+
+    result.reserve(static_cast<size_t>(numItems));
+
+    for(int i = 0; i < numItems; ++i)
+        result.push_back(i);
+
+    return result;
+}
+
+Histogram Train(SamplingOptions options, std::vector<int> const &inputs, size_t batchSize=7) {
+    NS::AnnotationMapsPtr                   pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    SamplingEstimator                       estimator(pAllColumnAnnotations, std::move(options), static_cast<size_t>(0));
+
+    estimator.begin_training();
+
+    for(size_t offset = 0; offset < inputs.size(); offset += batchSize)
+        estimator.fit(inputs.data() + offset, std::min(batchSize, inputs.size() - offset));
+
+    estimator.on_data_completed();
+    estimator.complete_training();
+
+    CHECK(estimator.get_num_items_seen() == inputs.size());
+
+    return estimator.get_estimator().get_annotation_data().Value;
+}
+
+std::uint32_t GetNumItems(Histogram const &histogram) {
+    std::uint32_t                           result(0);
+
+    for(auto const &kvp : histogram)
+        result += kvp.second;
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         MultiPassEstimator
+///  \brief         Requests `numPasses` passes over the data and records the
+///                 items provided during each pass.
+///
+class MultiPassEstimator : public NS::FitEstimator<int> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    std::vector<std::vector<int>>           Passes;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    MultiPassEstimator(NS::AnnotationMapsPtr pAllColumnAnnotations, size_t numPasses) :
+        NS::FitEstimator<int>("MultiPassEstimator", std::move(pAllColumnAnnotations)),
+        _numPasses(numPasses) {
+    }
+
+    ~MultiPassEstimator(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MultiPassEstimator);
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    size_t const                            _numPasses;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    bool begin_training_impl(void) override {
+        Passes.emplace_back();
+        return true;
+    }
+
+    NS::FitResult fit_impl(int const *pItems, size_t cItems) override {
+        Passes.back().insert(Passes.back().end(), pItems, pItems + cItems);
+        return NS::FitResult::Continue;
+    }
+
+    bool on_data_completed_impl(void) override {
+        if(Passes.size() == _numPasses)
+            return true;
+
+        Passes.emplace_back();
+        return false;
+    }
+
+    void complete_training_impl(void) override {
+    }
+};
+
+TEST_CASE("Invalid options") {
+    CHECK_THROWS_WITH(SamplingOptions::Reservoir(0), "reservoirSize");
+    CHECK_THROWS_WITH(SamplingOptions::Bernoulli(0.0), "probability");
+    CHECK_THROWS_WITH(SamplingOptions::Bernoulli(1.5), "probability");
+    CHECK_THROWS_WITH(SamplingOptions::Bernoulli(std::numeric_limits<double>::quiet_NaN()), "probability");
+}
+
+TEST_CASE("Reservoir") {
+    std::vector<int> const                  inputs(CreateInputs(1000));
+
+    SECTION("Sample size") {
+        Histogram const                     histogram(Train(SamplingOptions::Reservoir(50, 1), inputs));
+
+        CHECK(histogram.size() == 50);
+        CHECK(GetNumItems(histogram) == 50);
+
+        for(auto const &kvp : histogram) {
+            CHECK(kvp.first >= 0);
+            CHECK(kvp.first < 1000);
+        }
+    }
+
+    SECTION("Deterministic") {
+        CHECK(Train(SamplingOptions::Reservoir(50, 1), inputs) == Train(SamplingOptions::Reservoir(50, 1), inputs, 100));
+        CHECK(Train(SamplingOptions::Reservoir(50, 1), inputs) != Train(SamplingOptions::Reservoir(50, 2), inputs));
+    }
+
+    SECTION("Fewer items than the reservoir") {
+        std::vector<int> const              smallInputs(CreateInputs(20));
+        Histogram const                     histogram(Train(SamplingOptions::Reservoir(50), smallInputs));
+
+        CHECK(histogram.size() == 20);
+        CHECK(GetNumItems(histogram) == 20);
+    }
+
+    SECTION("Unbiased") {
+        // Each item should be selected ReservoirSize / NumItems of the time,
+        // regardless of its position in the stream.
+        std::vector<int> const              smallInputs(CreateInputs(10));
+        std::vector<std::uint32_t>          counts(smallInputs.size(), 0);
+
+        for(std::uint64_t seed = 0; seed < 2000; ++seed) {
+            for(auto const &kvp : Train(SamplingOptions::Reservoir(5, seed), smallInputs, 3))
+                counts[static_cast<size_t>(kvp.first)] += kvp.second;
+        }
+
+        for(std::uint32_t count : counts) {
+            CHECK(count > 850);
+            CHECK(count < 1150);
+        }
+    }
+}
+
+TEST_CASE("Bernoulli") {
+    std::vector<int> const                  inputs(CreateInputs(10000));
+
+    SECTION("All items") {
+        Histogram const                     histogram(Train(SamplingOptions::Bernoulli(1.0), inputs));
+
+        CHECK(GetNumItems(histogram) == 10000);
+    }
+
+    SECTION("Sample size") {
+        std::uint32_t const                 numItems(GetNumItems(Train(SamplingOptions::Bernoulli(0.1, 3), inputs)));
+
+        CHECK(numItems > 850);
+        CHECK(numItems < 1150);
+    }
+
+    SECTION("Deterministic") {
+        CHECK(Train(SamplingOptions::Bernoulli(0.1, 3), inputs) == Train(SamplingOptions::Bernoulli(0.1, 3), inputs, 100));
+    }
+
+    SECTION("Multiple passes") {
+        // ----------------------------------------------------------------------
+        using MultiPassSamplingEstimator    = NS::Featurizers::Components::SamplingEstimator<MultiPassEstimator>;
+        // ----------------------------------------------------------------------
+
+        MultiPassSamplingEstimator          estimator(NS::CreateTestAnnotationMapsPtr(1), SamplingOptions::Bernoulli(0.1, 3), static_cast<size_t>(3));
+
+        estimator.begin_training();
+
+        while(estimator.get_state() == NS::TrainingState::Training) {
+            for(size_t offset = 0; offset < inputs.size(); offset += 7)
+                estimator.fit(inputs.data() + offset, std::min(static_cast<size_t>(7), inputs.size() - offset));
+
+            estimator.on_data_completed();
+        }
+
+        estimator.complete_training();
+
+        // Each pass sees the same sample
+        std::vector<std::vector<int>> const &                           passes(estimator.get_estimator().Passes);
+
+        REQUIRE(passes.size() == 3);
+        CHECK(passes[0].empty() == false);
+        CHECK(passes[1] == passes[0]);
+        CHECK(passes[2] == passes[0]);
+    }
+}
+
+TEST_CASE("Median") {
+    using MedianSamplingEstimator           = NS::Featurizers::Components::SamplingEstimator<NS::Featurizers::Components::MedianEstimator<int, double>>;
+
+    std::vector<int> const                  inputs(CreateInputs(10001));
+    NS::AnnotationMapsPtr                   pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    MedianSamplingEstimator                 estimator(pAllColumnAnnotations, SamplingOptions::Reservoir(1000, 7), static_cast<size_t>(0));
+
+    estimator.begin_training();
+    estimator.fit(inputs.data(), inputs.size());
+    estimator.complete_training();
+
+    double const                            median(estimator.get_estimator().get_annotation_data().Median);
+
+    // A sample taken from the head of the stream would have a median of ~500
+    CHECK(median > 4000.0);
+    CHECK(median < 6000.0);
+}
@@ -132,6 +132,46 @@ TEST_CASE("all same input") {
     CHECK(stats.StandardDeviation == 0);
     CHECK(stats.Count == 7);
 }
+TEST_CASE("no statistical metrics annotation") {
+    using inputType = std::double_t;
+
+    // The standard deviation is calculated in a single pass, so annotations from the
+    // StatisticalMetricsEstimator aren't necessary
+    NS::AnnotationMapsPtr pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+
+    NS::Featurizers::Components::StandardDeviationEstimator<inputType> estimator(pAllColumnAnnotations, 0);
+
+    NS::TestHelpers::Train(estimator, std::vector<std::vector<inputType>>({{10.3, 20.1, 8.4, 8.2}, {10.3, 30.1, 30.4, 15.8}}));
+    NS::Featurizers::Components::StandardDeviationAnnotationData const& stats(estimator.get_annotation_data());
+
+    CHECK(NS::TestHelpers::FuzzyCheck<long double>({stats.StandardDeviation}, {static_cast<long double>(8.679573)}));
+    CHECK(stats.Count == 8);
+}
+
+TEST_CASE("convergence") {
+    using inputType = std::double_t;
+
+    std::vector<std::vector<inputType>> batches(100, std::vector<inputType>(100));
+
+    for(auto &batch : batches) {
+        for(size_t i = 0; i < batch.size(); ++i)
+            batch[i] = static_cast<inputType>(i % 10);
+    }
+
+    NS::AnnotationMapsPtr pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+
+    NS::Featurizers::Components::StandardDeviationEstimator<inputType> estimator(pAllColumnAnnotations, 0);
+
+    estimator.set_convergence_options(NS::Featurizers::Components::ConvergenceOptions(0.001, 1000, 3, 5000));
+    NS::TestHelpers::Train(estimator, batches);
+
+    NS::Featurizers::Components::StandardDeviationAnnotationData const& stats(estimator.get_annotation_data());
+
+    // Converged after 3 stable checks, but not before MinNumItems
+    CHECK(stats.Count == 5000);
+    CHECK(NS::TestHelpers::FuzzyCheck<long double>({stats.StandardDeviation}, {static_cast<long double>(2.872281)}));
+}
+
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
@@ -275,6 +275,161 @@ TEST_CASE("null input for string") {
     );
 }
 
+TEST_CASE("updaters merge") {
+    using inputType = std::double_t;
+
+    NS::Featurizers::Components::Updaters::StandardStatsUpdater<inputType> updater1;
+    NS::Featurizers::Components::Updaters::StandardStatsUpdater<inputType> updater2;
+    NS::Featurizers::Components::Updaters::StandardStatsUpdater<inputType> empty_updater;
+
+    updater1.update(3.76);
+    updater1.update(7.89);
+    updater2.update(1.41);
+    updater2.update(5.39);
+
+    updater1.merge(empty_updater);
+    empty_updater.merge(updater2);
+    updater1.merge(empty_updater);
+
+    NS::Featurizers::Components::StandardStatisticalAnnotationData<inputType> const& stats(updater1.commit());
+    CHECK(NS::TestHelpers::FuzzyCheck<long double>({stats.Sum},       {18.45}));
+    CHECK(NS::TestHelpers::FuzzyCheck<std::double_t>({stats.Average}, {4.6125}));
+    CHECK(NS::TestHelpers::FuzzyCheck<inputType>({stats.Min},         {1.41}));
+    CHECK(NS::TestHelpers::FuzzyCheck<inputType>({stats.Max},         {7.89}));
+    CHECK(stats.Count == 4);
+}
+
+TEST_CASE("overflow for merge") {
+    using inputType = std::int64_t;
+
+    NS::Featurizers::Components::Updaters::StandardStatsUpdater<inputType> updater1;
+    NS::Featurizers::Components::Updaters::StandardStatsUpdater<inputType> updater2;
+
+    updater1.update(std::numeric_limits<inputType>::max());
+    updater2.update(1);
+
+    CHECK_THROWS_WITH(updater1.merge(updater2), "Overflow occured for sum during calculating statistic metrics! Check your data!");
+}
+
+template <typename InputT>
+void MergeTest(std::vector<std::vector<InputT>> const &shards) {
+    using Estimator = NS::Featurizers::Components::StatisticalMetricsEstimator<InputT>;
+
+    NS::AnnotationMapsPtr pExpectedAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    Estimator expected_estimator(pExpectedAnnotations, 0);
+
+    NS::TestHelpers::Train(expected_estimator, shards);
+
+    NS::AnnotationMapsPtr pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    Estimator estimator(pAllColumnAnnotations, 0);
+
+    estimator.begin_training();
+
+    for(auto const &shard : shards) {
+        Estimator shard_estimator(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+        shard_estimator.begin_training();
+        shard_estimator.fit(shard.data(), shard.size());
+
+        NS::Archive out;
+
+        shard_estimator.save_training_state(out);
+
+        NS::Archive in(out.commit());
+
+        estimator.merge(in);
+    }
+
+    estimator.complete_training();
+
+    auto const & expected(expected_estimator.get_annotation_data());
+    auto const & stats(estimator.get_annotation_data());
+
+    CHECK(stats.Min   == expected.Min);
+    CHECK(stats.Max   == expected.Max);
+    CHECK(stats.Count == expected.Count);
+}
+
+TEST_CASE("merge") {
+    MergeTest<int>({{10, 20, 8}, {10, 30}, {-5}});
+    MergeTest<std::double_t>({{10.3, 20.1, 8.4}, {10.2, 30.5}, {std::numeric_limits<std::double_t>::quiet_NaN()}});
+    MergeTest<std::string>({{"orange", "apple"}, {"peach"}, {"banana", "grape"}});
+}
+
+TEST_CASE("merge sum") {
+    using Estimator = NS::Featurizers::Components::StatisticalMetricsEstimator<std::double_t>;
+
+    Estimator estimator1(NS::CreateTestAnnotationMapsPtr(1), 0);
+    Estimator estimator2(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+    estimator1.begin_training();
+    estimator2.begin_training();
+
+    estimator1.fit(1.0 / 3.0);
+    estimator2.fit(2.0 / 3.0);
+
+    NS::Archive out;
+
+    estimator2.save_training_state(out);
+
+    NS::Archive in(out.commit());
+
+    estimator1.merge(in);
+    estimator1.complete_training();
+
+    auto const & stats(estimator1.get_annotation_data());
+
+    // The long double sum is written without loss of precision
+    CHECK(stats.Sum == static_cast<long double>(1.0 / 3.0) + static_cast<long double>(2.0 / 3.0));
+    CHECK(stats.Count == 2);
+}
+
+TEST_CASE("convergence") {
+    using Estimator = NS::Featurizers::Components::StatisticalMetricsEstimator<int>;
+    using ConvergenceOptions = NS::Featurizers::Components::ConvergenceOptions;
+
+    std::vector<std::vector<int>> batches(100, std::vector<int>(100));
+
+    for(auto &batch : batches) {
+        for(size_t i = 0; i < batch.size(); ++i)
+            batch[i] = static_cast<int>(i % 10);
+    }
+
+    SECTION("Stable") {
+        Estimator estimator(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+        estimator.set_convergence_options(ConvergenceOptions(0.001, 1000, 3));
+        NS::TestHelpers::Train(estimator, batches);
+
+        auto const & stats(estimator.get_annotation_data());
+
+        // Checks at 1000 (baseline), 2000, 3000 and 4000 items
+        CHECK(stats.Count == 4000);
+        CHECK(stats.Min == 0);
+        CHECK(stats.Max == 9);
+        CHECK(stats.Average == 4.5);
+    }
+
+    SECTION("Unstable") {
+        for(size_t i = 0; i < batches.size(); ++i)
+            batches[i][0] = static_cast<int>(i * 10);
+
+        Estimator estimator(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+        estimator.set_convergence_options(ConvergenceOptions(0.001, 1000, 3));
+        NS::TestHelpers::Train(estimator, batches);
+
+        CHECK(estimator.get_annotation_data().Count == 10000);
+    }
+
+    SECTION("Invalid state") {
+        Estimator estimator(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+        estimator.begin_training();
+        CHECK_THROWS_WITH(estimator.set_convergence_options(ConvergenceOptions(0.001)), "`set_convergence_options` should not be invoked on an estimator that has begun training");
+    }
+}
+
 #if (defined __clang__)
 #   pragma clang diagnostic pop
 #endif
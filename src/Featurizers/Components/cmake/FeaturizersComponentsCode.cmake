@@ -12,6 +12,7 @@ function(Impl)
 
     add_library(FeaturizersComponentsCode STATIC
         ${_this_path}/../Components.h
+        ${_this_path}/../ConvergenceMonitor.h
         ${_this_path}/../DocumentStatisticsEstimator.h
         ${_this_path}/../DocumentStatisticsEstimator.cpp
         ${_this_path}/../GrainEstimatorImpl.h
@@ -26,6 +27,7 @@ function(Impl)
         ${_this_path}/../NormUpdaters.h
         ${_this_path}/../OrderEstimator.h
         ${_this_path}/../PipelineExecutionEstimatorImpl.h
+        ${_this_path}/../SamplingEstimator.h
         ${_this_path}/../StandardDeviationEstimator.h
         ${_this_path}/../StatisticalMetricsEstimator.h
         ${_this_path}/../TimeSeriesFrequencyEstimator.h
@@ -37,6 +37,10 @@ void CountVectorizerTransformer::save(Archive &ar) const {
     _pTfidfTransformer->save(ar);
 }
 
+bool CountVectorizerTransformer::is_stateless(void) const /*override*/ {
+    return _pTfidfTransformer->is_stateless();
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -44,18 +48,48 @@ void CountVectorizerTransformer::execute_impl(typename BaseType::InputType const
 
     _pTfidfTransformer->execute(
         input,
-        [&callback](SparseVectorEncoding<std::float_t> obj) {
+        [&callback](SparseVectorEncoding<std::float_t> &&obj) {
+            callback(ToCounts(obj));
+        }
+    );
+}
 
-            std::vector<SparseVectorEncoding<std::uint32_t>::ValueEncoding> values;
-            values.reserve(obj.Values.size());
-            for (SparseVectorEncoding<std::float_t>::ValueEncoding const & item : obj.Values)
-                values.emplace_back(SparseVectorEncoding<std::uint32_t>::ValueEncoding(static_cast<std::uint32_t>(item.Value), item.Index));
+void CountVectorizerTransformer::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) /*override*/ {
+    typename BaseType::InputType const * const          pEndInputs(pInputs + cInputs);
 
-            callback(SparseVectorEncoding<std::uint32_t>(obj.NumElements, std::move(values)));
-        }
+    // The tfidf transformer is created by a pipeline estimator, so it must be invoked
+    // through the `Transformer` interface rather than as a `TfidfVectorizerTransformer`.
+    while(pInputs != pEndInputs) {
+        _pTfidfTransformer->execute(
+            *pInputs++,
+            [&pOutputs](SparseVectorEncoding<std::float_t> &&obj) {
+                *pOutputs = ToCounts(obj);
+            }
+        );
+
+        ++pOutputs;
+    }
+}
+
+CountVectorizerTransformer::BaseType::TransformedType CountVectorizerTransformer::transform_impl(typename BaseType::InputType const &input) /*override*/ {
+    return ToCounts(
+        Microsoft::Featurizer::Details::ExecuteSingle<SparseVectorEncoding<std::float_t>>(
+            [this, &input](TfidfEstimator::TransformerUniquePtr::element_type::CallbackFunction const &callback) {
+                _pTfidfTransformer->execute(input, callback);
+            }
+        )
     );
 }
 
+/*static*/ CountVectorizerTransformer::TransformedType CountVectorizerTransformer::ToCounts(SparseVectorEncoding<std::float_t> const &obj) {
+    std::vector<SparseVectorEncoding<std::uint32_t>::ValueEncoding> values;
+    values.reserve(obj.Values.size());
+    for (SparseVectorEncoding<std::float_t>::ValueEncoding const & item : obj.Values)
+        values.emplace_back(SparseVectorEncoding<std::uint32_t>::ValueEncoding(static_cast<std::uint32_t>(item.Value), item.Index));
+
+    return SparseVectorEncoding<std::uint32_t>(obj.NumElements, std::move(values));
+}
+
 } // namespace Featurizers
 } // namespace Featurizer
 } // namespace Microsoft
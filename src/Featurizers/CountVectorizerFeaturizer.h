@@ -44,6 +44,8 @@ public:
 
     bool operator==(CountVectorizerTransformer const &other) const;
 
+    bool is_stateless(void) const override;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -57,6 +59,10 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override;
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override;
+
+    static TransformedType ToCounts(SparseVectorEncoding<std::float_t> const &obj);
 };
 
 /////////////////////////////////////////////////////////////////////////
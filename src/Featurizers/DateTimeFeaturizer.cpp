@@ -94,6 +94,33 @@ TimePoint::TimePoint(const std::chrono::system_clock::time_point& sysTime) {
     }
 }
 
+TimePoint & TimePoint::operator =(TimePoint &&other) {
+    // The lookup tables are const and therefore not assignable, so move the individual components
+    year = other.year;
+    month = other.month;
+    day = other.day;
+    hour = other.hour;
+    minute = other.minute;
+    second = other.second;
+    amPm = other.amPm;
+    hour12 = other.hour12;
+    dayOfWeek = other.dayOfWeek;
+    dayOfQuarter = other.dayOfQuarter;
+    dayOfYear = other.dayOfYear;
+    weekOfMonth = other.weekOfMonth;
+    quarterOfYear = other.quarterOfYear;
+    halfOfYear = other.halfOfYear;
+    weekIso = other.weekIso;
+    yearIso = other.yearIso;
+    monthLabel = std::move(other.monthLabel);
+    amPmLabel = std::move(other.amPmLabel);
+    dayOfWeekLabel = std::move(other.dayOfWeekLabel);
+    holidayName = std::move(other.holidayName);
+    isPaidTimeOff = other.isPaidTimeOff;
+
+    return *this;
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  DateTimeTransformer
@@ -366,6 +393,10 @@ bool DateTimeTransformer::operator==(DateTimeTransformer const &other) const {
     return _dateHolidayMap == other._dateHolidayMap;
 }
 
+bool DateTimeTransformer::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 void DateTimeTransformer::save(Archive & ar) const /*override*/ {
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
@@ -379,6 +410,24 @@ void DateTimeTransformer::save(Archive & ar) const /*override*/ {
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 void DateTimeTransformer::execute_impl(InputType const &input, CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+void DateTimeTransformer::execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) /*override*/ {
+    InputType const * const                 pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs)
+        *pOutputs++ = transform(*pInputs++);
+}
+
+void DateTimeTransformer::flush_impl(CallbackFunction const &) /*override*/ {
+}
+
+DateTimeTransformer::TransformedType DateTimeTransformer::transform_impl(InputType const &input) /*override*/ {
+    return transform(input);
+}
+
+DateTimeTransformer::TransformedType DateTimeTransformer::transform(InputType const &input) const {
     static constexpr long long const        secondsPerDay(60 * 60 * 24);
 
     TimePoint                               result(input);
@@ -394,10 +443,7 @@ void DateTimeTransformer::execute_impl(InputType const &input, CallbackFunction
             result.holidayName = iter->second;
     }
 
-    callback(std::move(result));
-}
-
-void DateTimeTransformer::flush_impl(CallbackFunction const &) /*override*/ {
+    return result;
 }
 
 // ----------------------------------------------------------------------
@@ -80,7 +80,10 @@ struct TimePoint {
 
     TimePoint(const std::chrono::system_clock::time_point& sysTime);
 
-    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimePoint);
+    TimePoint(TimePoint const &) = delete;
+    TimePoint & operator =(TimePoint const &) = delete;
+    TimePoint(TimePoint &&) = default;
+    TimePoint & operator =(TimePoint &&other);
 
     enum {
         JANUARY = 1, FEBRUARY, MARCH, APRIL, MAY, JUNE,
@@ -135,6 +138,7 @@ public:
     bool operator==(DateTimeTransformer const &other) const;
 
     void save(Archive & ar) const override;
+    bool is_stateless(void) const override;
 
 private:
     // ----------------------------------------------------------------------
@@ -159,7 +163,11 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(InputType const &input, CallbackFunction const &callback) override;
+    void execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) override;
+    TransformedType transform_impl(InputType const &input) override;
     void flush_impl(CallbackFunction const &callback) override;
+
+    TransformedType transform(InputType const &input) const;
 };
 
 class DateTimeEstimator :
@@ -56,6 +56,17 @@ public:
 
     void save(Archive &ar) const override;
 
+    // The last valid value is updated during each call to `execute`
+    bool is_stateless(void) const override;
+
+    // MSVC runs into problems when the declaration and definition are separated
+    typename BaseType::TransformerUniquePtr clone(void) const override {
+        if(!_defaultValue)
+            return typename BaseType::TransformerUniquePtr(new ForwardFillImputerTransformer());
+
+        return typename BaseType::TransformerUniquePtr(new ForwardFillImputerTransformer(*_defaultValue));
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -86,6 +97,24 @@ private:
 
     // MSVC runs into problems when the declaration and definition are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        callback(transform(input));
+    }
+
+    // MSVC runs into problems when the declaration and definition are separated
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        typename BaseType::InputType const * const      pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            *pOutputs++ = transform(*pInputs++);
+    }
+
+    // MSVC runs into problems when the declaration and definition are separated
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override {
+        return transform(input);
+    }
+
+    // MSVC runs into problems when the declaration and definition are separated
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) {
         // ----------------------------------------------------------------------
         using TheseTraits                   = Traits<typename BaseType::InputType>;
         // ----------------------------------------------------------------------
@@ -102,16 +131,15 @@ private:
                 throw std::runtime_error("No source value for forward fill");
             }
 
-            callback(_lastValue);
+            return _lastValue;
         }
-        else {
-            T const &                       value(TheseTraits::GetNullableValue(input));
 
-            callback(value);
+        T const &                           value(TheseTraits::GetNullableValue(input));
 
-            _lastValue = value;
-            _validLastValue = true;
-        }
+        _lastValue = value;
+        _validLastValue = true;
+
+        return value;
     }
 };
 
@@ -204,6 +232,11 @@ void ForwardFillImputerTransformer<T>::save(Archive &ar) const /*override*/ {
     // Note that we aren't serializing working state
 }
 
+template <typename T>
+bool ForwardFillImputerTransformer<T>::is_stateless(void) const /*override*/ {
+    return false;
+}
+
 } // namespace Featurizers
 } // namespace Featurizer
 } // namespace Microsoft
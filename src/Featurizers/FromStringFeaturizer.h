@@ -37,6 +37,10 @@ public:
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(FromStringTransformer);
 
+    bool is_stateless(void) const override {
+        return true;
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -48,6 +52,19 @@ private:
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
         callback(Traits<T>::FromString(input));
     }
+
+    // MSVC has problems with the function declaration and definition are separated
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        typename BaseType::InputType const * const      pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            *pOutputs++ = Traits<T>::FromString(*pInputs++);
+    }
+
+    // MSVC has problems with the function declaration and definition are separated
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override {
+        return Traits<T>::FromString(input);
+    }
 };
 
 template <typename T>
@@ -42,6 +42,7 @@ public:
     bool operator ==(HashOneHotVectorizerTransformer const &other) const;
 
     void save(Archive & ar) const override;
+    bool is_stateless(void) const override;
 
 private:
     // ----------------------------------------------------------------------
@@ -59,15 +60,31 @@ private:
     // ----------------------------------------------------------------------
     // MSVC has problems when the function is defined outside of the declaration
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        callback(transform(input));
+    }
+
+    // MSVC has problems when the function is defined outside of the declaration
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        typename BaseType::InputType const * const      pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            *pOutputs++ = transform(*pInputs++);
+    }
+
+    // MSVC has problems when the function is defined outside of the declaration
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override {
+        return transform(input);
+    }
+
+    // MSVC has problems when the function is defined outside of the declaration
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const {
 
         std::uint32_t colHashVal = MurmurHashGenerator(input, _hashingSeedVal);
 
-        callback(
-            SingleValueSparseVectorEncoding<std::uint8_t>(
-                _numCols,
-                1,
-                static_cast<std::uint64_t>(colHashVal % _numCols)
-            )
+        return SingleValueSparseVectorEncoding<std::uint8_t>(
+            _numCols,
+            1,
+            static_cast<std::uint64_t>(colHashVal % _numCols)
         );
     }
 };
@@ -173,6 +190,11 @@ bool HashOneHotVectorizerTransformer<T>::operator ==(HashOneHotVectorizerTransfo
         && _numCols ==  other._numCols;
 }
 
+template <typename T>
+bool HashOneHotVectorizerTransformer<T>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template <typename T>
 void HashOneHotVectorizerTransformer<T>::save(Archive & ar) const {
     // Version
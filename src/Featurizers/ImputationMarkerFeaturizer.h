@@ -38,6 +38,10 @@ public:
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(ImputationMarkerTransformer);
 
+    bool is_stateless(void) const override {
+        return true;
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -49,6 +53,19 @@ private:
 
         callback(Traits<Type>::IsNull(input));
     }
+
+    // MSVC has problems when the function is defined outside of the declaration
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        typename BaseType::InputType const * const      pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            *pOutputs++ = Traits<Type>::IsNull(*pInputs++);
+    }
+
+    // MSVC has problems when the function is defined outside of the declaration
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override {
+        return Traits<Type>::IsNull(input);
+    }
 };
 
 template <typename T>
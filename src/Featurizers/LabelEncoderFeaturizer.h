@@ -7,6 +7,8 @@
 #include "Components/PipelineExecutionEstimatorImpl.h"
 #include "Components/HistogramEstimator.h"
 #include "Components/IndexMapEstimator.h"
+#include "../CompactEncoding.h"
+#include "../FlatIndexMap.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -26,13 +28,13 @@ public:
     // ----------------------------------------------------------------------
     using BaseType                          = StandardTransformer<InputT, std::uint32_t>;
     using IndexMap                          = typename Components::IndexMapAnnotationData<InputT>::IndexMap;
+    using FlatIndexMap                      = Microsoft::Featurizer::FlatIndexMap<InputT>;
 
     // ----------------------------------------------------------------------
     // |
     // |  Public Data
     // |
     // ----------------------------------------------------------------------
-    IndexMap const                          Labels;
     bool const                              AllowMissingValues;
 
     // ----------------------------------------------------------------------
@@ -41,6 +43,19 @@ public:
     // |
     // ----------------------------------------------------------------------
     LabelEncoderTransformer(IndexMap map, bool allowMissingValues);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            LabelEncoderTransformer
+    ///  \brief         Creates a read-only view that looks up labels directly
+    ///                 within `labels` (which may reference a memory-mapped file).
+    ///
+    LabelEncoderTransformer(FlatIndexMap labels, bool allowMissingValues);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            LabelEncoderTransformer
+    ///  \brief         Deserializes the transformer; archives written with
+    ///                 `Archive::LayoutValue::Flat` produce a read-only view.
+    ///
     LabelEncoderTransformer(Archive &ar);
 
     ~LabelEncoderTransformer(void) override = default;
@@ -48,10 +63,30 @@ public:
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(LabelEncoderTransformer);
 
     void save(Archive &ar) const override;
+    bool is_stateless(void) const override;
+
+    bool IsView(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetLabels
+    ///  \brief         Returns a copy of the labels; the map is created from
+    ///                 the flat data when the transformer is a read-only view.
+    ///
+    IndexMap GetLabels(void) const;
 
     bool operator==(LabelEncoderTransformer const &other) const;
 
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+
+    // Only one of these is populated (`_pFlatLabels` when the transformer is a view)
+    IndexMap const                                      _labels;
+    std::shared_ptr<FlatIndexMap const> const           _pFlatLabels;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
@@ -60,19 +95,37 @@ private:
 
     // MSVC has problems when the definition and declaration are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
-        typename IndexMap::const_iterator const         iter(Labels.find(input));
+        callback(transform(input));
+    }
 
-        if(iter == Labels.end()) {
-            if(AllowMissingValues) {
-                callback(0);
-                return;
-            }
+    // MSVC has problems when the definition and declaration are separated
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        typename BaseType::InputType const * const      pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            *pOutputs++ = transform(*pInputs++);
+    }
+
+    // MSVC has problems when the definition and declaration are separated
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override {
+        return transform(input);
+    }
+
+    // MSVC has problems when the definition and declaration are separated
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const {
+        std::uint32_t                       label;
+
+        if(find(input, label) == false) {
+            if(AllowMissingValues)
+                return 0;
 
             throw std::invalid_argument("'input' was not found");
         }
 
-        callback(iter->second + (AllowMissingValues ? 1 : 0));
+        return label + (AllowMissingValues ? 1 : 0);
     }
+
+    bool find(typename BaseType::InputType const &input, std::uint32_t &label) const;
 };
 
 namespace Details {
@@ -203,8 +256,14 @@ public:
 // ----------------------------------------------------------------------
 template <typename InputT>
 LabelEncoderTransformer<InputT>::LabelEncoderTransformer(IndexMap map, bool allowMissingValues) :
-    Labels(std::move(map)),
-    AllowMissingValues(std::move(allowMissingValues)) {
+    AllowMissingValues(std::move(allowMissingValues)),
+    _labels(std::move(map)) {
+}
+
+template <typename InputT>
+LabelEncoderTransformer<InputT>::LabelEncoderTransformer(FlatIndexMap labels, bool allowMissingValues) :
+    AllowMissingValues(std::move(allowMissingValues)),
+    _pFlatLabels(std::make_shared<FlatIndexMap>(std::move(labels))) {
 }
 
 template <typename InputT>
@@ -215,11 +274,18 @@ LabelEncoderTransformer<InputT>::LabelEncoderTransformer(Archive &ar) :
             std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
             std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
 
-            if(majorVersion != 1 || minorVersion != 0)
+            if(majorVersion != 1 || minorVersion > 2)
                 throw std::runtime_error("Unsupported archive version");
 
-            // Data
-            IndexMap                        map(Traits<IndexMap>::deserialize(ar));
+            // Data (1.1 archives contain flat labels, 1.2 archives contain compact labels)
+            if(minorVersion == 1) {
+                FlatIndexMap                labels(ar);
+                bool                        allowMissingValues(Traits<bool>::deserialize(ar));
+
+                return LabelEncoderTransformer(std::move(labels), std::move(allowMissingValues));
+            }
+
+            IndexMap                        map(minorVersion == 2 ? DeserializeCompactIndexMap<IndexMap>(ar) : Traits<IndexMap>::deserialize(ar));
             bool                            allowMissingValues(Traits<bool>::deserialize(ar));
 
             return LabelEncoderTransformer(std::move(map), std::move(allowMissingValues));
@@ -227,23 +293,74 @@ LabelEncoderTransformer<InputT>::LabelEncoderTransformer(Archive &ar) :
     ) {
 }
 
+template <typename InputT>
+bool LabelEncoderTransformer<InputT>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template <typename InputT>
 void LabelEncoderTransformer<InputT>::save(Archive &ar) const /*override*/ {
+    bool const                              isFlat(ar.Layout == Archive::LayoutValue::Flat);
+    bool const                              isCompact(ar.Layout == Archive::LayoutValue::Compact);
+
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
-    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+    Traits<std::uint16_t>::serialize(ar, isFlat ? 1 : isCompact ? 2 : 0); // Minor
 
     // Data
-    Traits<decltype(Labels)>::serialize(ar, Labels);
+    if(isFlat) {
+        if(_pFlatLabels)
+            _pFlatLabels->save(ar);
+        else
+            FlatIndexMap(FlatIndexMap::Create(_labels)).save(ar);
+    }
+    else if(isCompact) {
+        if(_pFlatLabels)
+            SerializeCompactIndexMap(ar, _pFlatLabels->template ToMap<IndexMap>());
+        else
+            SerializeCompactIndexMap(ar, _labels);
+    }
+    else if(_pFlatLabels)
+        Traits<IndexMap>::serialize(ar, _pFlatLabels->template ToMap<IndexMap>());
+    else
+        Traits<IndexMap>::serialize(ar, _labels);
+
     Traits<decltype(AllowMissingValues)>::serialize(ar, AllowMissingValues);
 }
 
+template <typename InputT>
+bool LabelEncoderTransformer<InputT>::IsView(void) const {
+    return static_cast<bool>(_pFlatLabels);
+}
+
+template <typename InputT>
+typename LabelEncoderTransformer<InputT>::IndexMap LabelEncoderTransformer<InputT>::GetLabels(void) const {
+    if(_pFlatLabels)
+        return _pFlatLabels->template ToMap<IndexMap>();
+
+    return _labels;
+}
+
 template <typename InputT>
 bool LabelEncoderTransformer<InputT>::operator==(LabelEncoderTransformer const &other) const {
-    return Labels == other.Labels
+    return IndexMapsAreEqual(_labels, _pFlatLabels.get(), other._labels, other._pFlatLabels.get())
         && AllowMissingValues == other.AllowMissingValues;
 }
 
+template <typename InputT>
+bool LabelEncoderTransformer<InputT>::find(typename BaseType::InputType const &input, std::uint32_t &label) const {
+    if(_pFlatLabels)
+        return _pFlatLabels->find(input, label);
+
+    typename IndexMap::const_iterator const iter(_labels.find(input));
+
+    if(iter == _labels.end())
+        return false;
+
+    label = iter->second;
+    return true;
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  LabelEncoderEstimator
@@ -53,6 +53,7 @@ public:
     bool operator==(MaxAbsScalerTransformer const &other) const;
 
     void save(Archive & ar) const override;
+    bool is_stateless(void) const override;
 
 private:
     // ----------------------------------------------------------------------
@@ -61,6 +62,10 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override;
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override;
+
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const;
 };
 
 namespace Details {
@@ -218,6 +223,11 @@ bool MaxAbsScalerTransformer<InputT, TransformedT>::operator==(MaxAbsScalerTrans
 #endif
 }
 
+template <typename InputT, typename TransformedT>
+bool MaxAbsScalerTransformer<InputT, TransformedT>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template <typename InputT, typename TransformedT>
 void MaxAbsScalerTransformer<InputT, TransformedT>::save(Archive &ar) const /*override*/ {
     // Version
@@ -233,22 +243,38 @@ void MaxAbsScalerTransformer<InputT, TransformedT>::save(Archive &ar) const /*ov
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
 void MaxAbsScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+template <typename InputT, typename TransformedT>
+void MaxAbsScalerTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) /*override*/ {
+    typename BaseType::InputType const * const          pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs)
+        *pOutputs++ = transform(*pInputs++);
+}
+
+template <typename InputT, typename TransformedT>
+typename MaxAbsScalerTransformer<InputT, TransformedT>::BaseType::TransformedType MaxAbsScalerTransformer<InputT, TransformedT>::transform_impl(typename BaseType::InputType const &input) /*override*/ {
+    return transform(input);
+}
+
+template <typename InputT, typename TransformedT>
+typename MaxAbsScalerTransformer<InputT, TransformedT>::BaseType::TransformedType MaxAbsScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input) const {
 
 #if (defined __clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wfloat-equal"
 #endif
 
-    if (Scale != static_cast<TransformedT>(0)) {
-        callback(static_cast<TransformedT>(input) / Scale);
-        return;
-    }
+    if (Scale != static_cast<TransformedT>(0))
+        return static_cast<TransformedT>(input) / Scale;
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
 #endif
 
-    callback(static_cast<TransformedT>(input));
+    return static_cast<TransformedT>(input);
 }
 
 
@@ -45,6 +45,7 @@ public:
     bool operator==(MinMaxScalerTransformer const &other) const;
 
     void save(Archive &ar) const override;
+    bool is_stateless(void) const override;
 
 private:
     // ----------------------------------------------------------------------
@@ -61,12 +62,14 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override;
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override;
 
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::true_type);
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::false_type);
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input, std::true_type) const;
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input, std::false_type) const;
 
     template <typename U>
-    void execute_implex(U const &input, typename BaseType::CallbackFunction const &callback);
+    typename BaseType::TransformedType transform_implex(U const &input) const;
 };
 
 namespace Details {
@@ -235,6 +238,11 @@ bool MinMaxScalerTransformer<InputT, TransformedT>::operator==(MinMaxScalerTrans
 
 }
 
+template <typename InputT, typename TransformedT>
+bool MinMaxScalerTransformer<InputT, TransformedT>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template <typename InputT, typename TransformedT>
 void MinMaxScalerTransformer<InputT, TransformedT>::save(Archive &ar) const /*override*/ {
     // Version
@@ -255,44 +263,53 @@ void MinMaxScalerTransformer<InputT, TransformedT>::save(Archive &ar) const /*ov
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
 void MinMaxScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
-    execute_impl(input, callback, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+    callback(transform(input, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>()));
+}
+
+template <typename InputT, typename TransformedT>
+void MinMaxScalerTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) /*override*/ {
+    typename BaseType::InputType const * const          pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs)
+        *pOutputs++ = transform(*pInputs++, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+}
+
+template <typename InputT, typename TransformedT>
+typename MinMaxScalerTransformer<InputT, TransformedT>::BaseType::TransformedType MinMaxScalerTransformer<InputT, TransformedT>::transform_impl(typename BaseType::InputType const &input) /*override*/ {
+    return transform(input, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
 }
 
 template <typename InputT, typename TransformedT>
-void MinMaxScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::true_type) {
+typename MinMaxScalerTransformer<InputT, TransformedT>::BaseType::TransformedType MinMaxScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input, std::true_type) const {
     // ----------------------------------------------------------------------
     using InputTraits                       = Traits<InputT>;
     using TransformedTraits                 = Traits<TransformedT>;
     // ----------------------------------------------------------------------
 
-    if(InputTraits::IsNull(input)) {
-        callback(TransformedTraits::CreateNullValue());
-        return;
-    }
+    if(InputTraits::IsNull(input))
+        return TransformedTraits::CreateNullValue();
 
-    execute_implex(InputTraits::GetNullableValue(input), callback);
+    return transform_implex(InputTraits::GetNullableValue(input));
 }
 
 template <typename InputT, typename TransformedT>
-void MinMaxScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::false_type) {
-    execute_implex(input, callback);
+typename MinMaxScalerTransformer<InputT, TransformedT>::BaseType::TransformedType MinMaxScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input, std::false_type) const {
+    return transform_implex(input);
 }
 
 template <typename InputT, typename TransformedT>
 template <typename U>
-void MinMaxScalerTransformer<InputT, TransformedT>::execute_implex(U const &input, typename BaseType::CallbackFunction const &callback) {
+typename MinMaxScalerTransformer<InputT, TransformedT>::BaseType::TransformedType MinMaxScalerTransformer<InputT, TransformedT>::transform_implex(U const &input) const {
 #if (defined __clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wdouble-promotion"
 #   pragma clang diagnostic ignored "-Wfloat-equal"
 #endif
 
-    if(_span == static_cast<InputT>(0)) {
-        callback(static_cast<TransformedT>(0));
-        return;
-    }
+    if(_span == static_cast<InputT>(0))
+        return static_cast<TransformedT>(0);
 
-    callback((static_cast<TransformedT>(input) - _min) / _span);
+    return (static_cast<TransformedT>(input) - _min) / _span;
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
@@ -52,6 +52,11 @@ public:
     ~MissingDummiesTransformer(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MissingDummiesTransformer);
+
+    bool is_stateless(void) const override {
+        return true;
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -63,6 +68,19 @@ private:
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
         callback(Traits<Type>::IsNull(input) ? 1 : 0);
     }
+
+    // MSVC has problems when the function is defined outside of the declaration
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        typename BaseType::InputType const * const      pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            *pOutputs++ = Traits<Type>::IsNull(*pInputs++) ? 1 : 0;
+    }
+
+    // MSVC has problems when the function is defined outside of the declaration
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override {
+        return Traits<Type>::IsNull(input) ? 1 : 0;
+    }
 };
 
 template <typename T>
@@ -8,10 +8,8 @@
 #include "../Featurizer.h"
 #include "../Traits.h"
 
-#include "Components/HistogramEstimator.h"
 #include "Components/ImputerTransformer.h"
 #include "Components/ModeEstimator.h"
-#include "Components/OrderEstimator.h"
 #include "Components/PipelineExecutionEstimatorImpl.h"
 
 namespace Microsoft {
@@ -71,7 +69,7 @@ private:
         // ----------------------------------------------------------------------
         using InputTypeTraits               = Traits<InputType>;
 
-        using ModeEstimator                 = Components::ModeEstimator<InputType, false, MaxNumTrainingItemsV>;
+        using ModeEstimator                 = Components::SinglePassModeEstimator<InputType, false, MaxNumTrainingItemsV>;
         using AnnotationData                = typename ModeEstimator::AnnotationData;
         // ----------------------------------------------------------------------
 
@@ -106,9 +104,7 @@ template <
 >
 class ModeImputerEstimator :
     public Components::PipelineExecutionEstimatorImpl<
-        Components::HistogramEstimator<typename Traits<TransformedT>::nullable_type, MaxNumTrainingItemsV>,
-        Components::OrderEstimator<typename Traits<TransformedT>::nullable_type, MaxNumTrainingItemsV>,
-        Components::ModeEstimator<typename Traits<TransformedT>::nullable_type, false, MaxNumTrainingItemsV>,
+        Components::SinglePassModeEstimator<typename Traits<TransformedT>::nullable_type, false, MaxNumTrainingItemsV>,
         Details::ModeImputerEstimatorImpl<TransformedT, MaxNumTrainingItemsV>
     > {
 public:
@@ -121,9 +117,7 @@ public:
 
     using BaseType =
         Components::PipelineExecutionEstimatorImpl<
-            Components::HistogramEstimator<typename Traits<TransformedT>::nullable_type, MaxNumTrainingItemsV>,
-            Components::OrderEstimator<typename Traits<TransformedT>::nullable_type, MaxNumTrainingItemsV>,
-            Components::ModeEstimator<typename Traits<TransformedT>::nullable_type, false, MaxNumTrainingItemsV>,
+            Components::SinglePassModeEstimator<typename Traits<TransformedT>::nullable_type, false, MaxNumTrainingItemsV>,
             Details::ModeImputerEstimatorImpl<TransformedT, MaxNumTrainingItemsV>
         >;
 
@@ -196,9 +190,7 @@ ModeImputerEstimator<TransformedT, MaxNumTrainingItemsV>::ModeImputerEstimator(A
     BaseType(
         "ModeImputerEstimator",
         pAllColumnAnnotations,
-        [pAllColumnAnnotations, colIndex](void) { return Components::HistogramEstimator<typename Traits<TransformedT>::nullable_type, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
-        [pAllColumnAnnotations, colIndex](void) { return Components::OrderEstimator<typename Traits<TransformedT>::nullable_type, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
-        [pAllColumnAnnotations, colIndex](void) { return Components::ModeEstimator<typename Traits<TransformedT>::nullable_type, false, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
+        [pAllColumnAnnotations, colIndex](void) { return Components::SinglePassModeEstimator<typename Traits<TransformedT>::nullable_type, false, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
         [pAllColumnAnnotations, colIndex](void) { return Details::ModeImputerEstimatorImpl<TransformedT, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); }
     ) {
 }
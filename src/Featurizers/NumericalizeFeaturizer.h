@@ -8,6 +8,7 @@
 #include "Components/HistogramEstimator.h"
 #include "Components/IndexMapEstimator.h"
 #include "Components/PipelineExecutionEstimatorImpl.h"
+#include "../CompactEncoding.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -41,6 +42,7 @@ public:
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY (NumericalizeTransformer);
 
     void save (Archive &ar) const override;
+    bool is_stateless(void) const override;
 
     bool operator==(NumericalizeTransformer const &other) const;
 
@@ -53,6 +55,24 @@ private:
 
     // MSVC has problems when the definition and declaration are separated
     void execute_impl(typename BaseType::InputType const& input, typename BaseType::CallbackFunction const& callback) override {
+        callback(transform(input));
+    }
+
+    // MSVC has problems when the definition and declaration are separated
+    void execute_batch_impl(typename BaseType::InputType const* pInputs, size_t cInputs, typename BaseType::TransformedType* pOutputs) override {
+        typename BaseType::InputType const* const       pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            *pOutputs++ = transform(*pInputs++);
+    }
+
+    // MSVC has problems when the definition and declaration are separated
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const& input) override {
+        return transform(input);
+    }
+
+    // MSVC has problems when the definition and declaration are separated
+    typename BaseType::TransformedType transform(typename BaseType::InputType const& input) const {
         typename IndexMap::const_iterator const         iter(labels_.find(input));
         double result = 0.;
         if(iter != labels_.end()) {
@@ -60,7 +80,7 @@ private:
         } else {
             result = std::numeric_limits<double>::quiet_NaN();
         }
-        callback(result);
+        return result;
     }
 
 private:
@@ -205,23 +225,36 @@ inline NumericalizeTransformer<InputT>::NumericalizeTransformer(Archive & ar) :
         std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
         std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
 
-        if(majorVersion != 1 || minorVersion != 0)
+        if(majorVersion != 1 || minorVersion > 1)
             throw std::runtime_error("Unsupported archive version");
 
-        // Data
+        // Data (1.1 archives contain compact labels)
+        if(minorVersion == 1)
+            return NumericalizeTransformer(DeserializeCompactIndexMap<IndexMap>(ar));
+
         return NumericalizeTransformer(Traits<IndexMap>::deserialize(ar));
         }()
     ) {
 }
 
+template<typename InputT>
+inline bool NumericalizeTransformer<InputT>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template<typename InputT>
 inline void NumericalizeTransformer<InputT>::save(Archive& ar) const {
+    bool const                              isCompact(ar.Layout == Archive::LayoutValue::Compact);
+
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
-    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+    Traits<std::uint16_t>::serialize(ar, isCompact ? 1 : 0); // Minor
 
     // Data
-    Traits<decltype(labels_)>::serialize(ar, labels_);
+    if(isCompact)
+        SerializeCompactIndexMap(ar, labels_);
+    else
+        Traits<decltype(labels_)>::serialize(ar, labels_);
 }
 
 template <typename InputT>
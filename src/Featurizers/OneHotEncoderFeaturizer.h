@@ -8,6 +8,8 @@
 #include "Components/HistogramEstimator.h"
 #include "Components/IndexMapEstimator.h"
 #include "Structs.h"
+#include "../CompactEncoding.h"
+#include "../FlatIndexMap.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -27,13 +29,13 @@ public:
     // ----------------------------------------------------------------------
     using BaseType                          = StandardTransformer<InputT, SingleValueSparseVectorEncoding<std::uint8_t>>;
     using IndexMap                          = typename Components::IndexMapAnnotationData<InputT>::IndexMap;
+    using FlatIndexMap                      = Microsoft::Featurizer::FlatIndexMap<InputT>;
 
     // ----------------------------------------------------------------------
     // |
     // |  Public Data
     // |
     // ----------------------------------------------------------------------
-    IndexMap  const                         Labels;
     bool const                              AllowMissingValues;
 
     // ----------------------------------------------------------------------
@@ -42,6 +44,19 @@ public:
     // |
     // ----------------------------------------------------------------------
     OneHotEncoderTransformer(IndexMap map, bool allowMissingValues);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            OneHotEncoderTransformer
+    ///  \brief         Creates a read-only view that looks up labels directly
+    ///                 within `labels` (which may reference a memory-mapped file).
+    ///
+    OneHotEncoderTransformer(FlatIndexMap labels, bool allowMissingValues);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            OneHotEncoderTransformer
+    ///  \brief         Deserializes the transformer; archives written with
+    ///                 `Archive::LayoutValue::Flat` produce a read-only view.
+    ///
     OneHotEncoderTransformer(Archive &ar);
 
     ~OneHotEncoderTransformer(void) override = default;
@@ -51,8 +66,28 @@ public:
     bool operator==(OneHotEncoderTransformer const &other) const;
 
     void save(Archive &ar) const override;
+    bool is_stateless(void) const override;
+
+    bool IsView(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            GetLabels
+    ///  \brief         Returns a copy of the labels; the map is created from
+    ///                 the flat data when the transformer is a read-only view.
+    ///
+    IndexMap GetLabels(void) const;
 
 private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+
+    // Only one of these is populated (`_pFlatLabels` when the transformer is a view)
+    IndexMap const                                      _labels;
+    std::shared_ptr<FlatIndexMap const> const           _pFlatLabels;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
@@ -61,25 +96,45 @@ private:
 
     // MSVC has problems when the definition and declaration are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        callback(transform(input));
+    }
+
+    // MSVC has problems when the definition and declaration are separated
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        typename BaseType::InputType const * const      pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            *pOutputs++ = transform(*pInputs++);
+    }
+
+    // MSVC has problems when the definition and declaration are separated
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override {
+        return transform(input);
+    }
+
+    // MSVC has problems when the definition and declaration are separated
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const {
         // when missing values are allowed, the total size is increased by 1 and the 0th element in the vector represent missing values
         std::uint64_t const                 offset(AllowMissingValues ? 1 : 0);
 
         // Create the encoding value
         std::uint64_t                       encodingIndex;
 
-        typename IndexMap::const_iterator const         label_iter(Labels.find(input));
+        std::uint32_t                       label;
 
-        if(label_iter == Labels.end()) {
+        if(find(input, label) == false) {
             if(AllowMissingValues == false)
                 throw std::invalid_argument("'input' was not found");
 
             encodingIndex = 0;
         }
         else
-            encodingIndex = static_cast<std::uint64_t>(label_iter->second + offset);
+            encodingIndex = static_cast<std::uint64_t>(label + offset);
 
-        callback(SingleValueSparseVectorEncoding<std::uint8_t>(Labels.size() + offset, 1, encodingIndex));
+        return SingleValueSparseVectorEncoding<std::uint8_t>((_pFlatLabels ? _pFlatLabels->size() : _labels.size()) + offset, 1, encodingIndex);
     }
+
+    bool find(typename BaseType::InputType const &input, std::uint32_t &label) const;
 };
 
 namespace Details {
@@ -211,7 +266,8 @@ public:
 // ----------------------------------------------------------------------
 template <typename InputT>
 OneHotEncoderTransformer<InputT>::OneHotEncoderTransformer(IndexMap map, bool allowMissingValues) :
-    Labels(
+    AllowMissingValues(std::move(allowMissingValues)),
+    _labels(
         std::move(
             [&map](void) ->  IndexMap & {
                 if (map.size() == 0) {
@@ -220,8 +276,20 @@ OneHotEncoderTransformer<InputT>::OneHotEncoderTransformer(IndexMap map, bool al
                 return map;
             }()
         )
-    ),
-    AllowMissingValues(std::move(allowMissingValues)) {
+    ) {
+}
+
+template <typename InputT>
+OneHotEncoderTransformer<InputT>::OneHotEncoderTransformer(FlatIndexMap labels, bool allowMissingValues) :
+    AllowMissingValues(std::move(allowMissingValues)),
+    _pFlatLabels(
+        [&labels](void) {
+            if(labels.empty())
+                throw std::invalid_argument("Index map is empty!");
+
+            return std::make_shared<FlatIndexMap>(std::move(labels));
+        }()
+    ) {
 }
 
 template <typename InputT>
@@ -232,11 +300,18 @@ OneHotEncoderTransformer<InputT>::OneHotEncoderTransformer(Archive &ar) :
             std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
             std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
 
-            if(majorVersion != 1 || minorVersion != 0)
+            if(majorVersion != 1 || minorVersion > 2)
                 throw std::runtime_error("Unsupported archive version");
 
-            // Data
-            IndexMap                        map(Traits<IndexMap>::deserialize(ar));
+            // Data (1.1 archives contain flat labels, 1.2 archives contain compact labels)
+            if(minorVersion == 1) {
+                FlatIndexMap                labels(ar);
+                bool                        allowMissingValues(Traits<bool>::deserialize(ar));
+
+                return OneHotEncoderTransformer(std::move(labels), std::move(allowMissingValues));
+            }
+
+            IndexMap                        map(minorVersion == 2 ? DeserializeCompactIndexMap<IndexMap>(ar) : Traits<IndexMap>::deserialize(ar));
             bool                            allowMissingValues(Traits<bool>::deserialize(ar));
 
             return OneHotEncoderTransformer(std::move(map), std::move(allowMissingValues));
@@ -244,23 +319,74 @@ OneHotEncoderTransformer<InputT>::OneHotEncoderTransformer(Archive &ar) :
     ) {
 }
 
+template <typename InputT>
+bool OneHotEncoderTransformer<InputT>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template <typename InputT>
 void OneHotEncoderTransformer<InputT>::save(Archive &ar) const /*override*/ {
+    bool const                              isFlat(ar.Layout == Archive::LayoutValue::Flat);
+    bool const                              isCompact(ar.Layout == Archive::LayoutValue::Compact);
+
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
-    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+    Traits<std::uint16_t>::serialize(ar, isFlat ? 1 : isCompact ? 2 : 0); // Minor
 
     // Data
-    Traits<decltype(Labels)>::serialize(ar, Labels);
+    if(isFlat) {
+        if(_pFlatLabels)
+            _pFlatLabels->save(ar);
+        else
+            FlatIndexMap(FlatIndexMap::Create(_labels)).save(ar);
+    }
+    else if(isCompact) {
+        if(_pFlatLabels)
+            SerializeCompactIndexMap(ar, _pFlatLabels->template ToMap<IndexMap>());
+        else
+            SerializeCompactIndexMap(ar, _labels);
+    }
+    else if(_pFlatLabels)
+        Traits<IndexMap>::serialize(ar, _pFlatLabels->template ToMap<IndexMap>());
+    else
+        Traits<IndexMap>::serialize(ar, _labels);
+
     Traits<decltype(AllowMissingValues)>::serialize(ar, AllowMissingValues);
 }
 
+template <typename InputT>
+bool OneHotEncoderTransformer<InputT>::IsView(void) const {
+    return static_cast<bool>(_pFlatLabels);
+}
+
+template <typename InputT>
+typename OneHotEncoderTransformer<InputT>::IndexMap OneHotEncoderTransformer<InputT>::GetLabels(void) const {
+    if(_pFlatLabels)
+        return _pFlatLabels->template ToMap<IndexMap>();
+
+    return _labels;
+}
+
 template <typename InputT>
 bool OneHotEncoderTransformer<InputT>::operator==(OneHotEncoderTransformer const &other) const {
-    return Labels == other.Labels
+    return IndexMapsAreEqual(_labels, _pFlatLabels.get(), other._labels, other._pFlatLabels.get())
         && AllowMissingValues == other.AllowMissingValues;
 }
 
+template <typename InputT>
+bool OneHotEncoderTransformer<InputT>::find(typename BaseType::InputType const &input, std::uint32_t &label) const {
+    if(_pFlatLabels)
+        return _pFlatLabels->find(input, label);
+
+    typename IndexMap::const_iterator const iter(_labels.find(input));
+
+    if(iter == _labels.end())
+        return false;
+
+    label = iter->second;
+    return true;
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  OneHotEncoderEstimator
@@ -48,6 +48,7 @@ public:
     bool operator==(PCATransformer const &other) const;
 
     void save(Archive &ar) const override;
+    bool is_stateless(void) const override;
 
     std::ptrdiff_t getEigenVectorRowsNumber() const;
     std::ptrdiff_t getEigenVectorColsNumber() const;
@@ -67,6 +68,24 @@ private:
     // ----------------------------------------------------------------------
      // MSVC has problems when the declaration and definition are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        callback(transform(input));
+    }
+
+     // MSVC has problems when the declaration and definition are separated
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        typename BaseType::InputType const * const      pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            *pOutputs++ = transform(*pInputs++);
+    }
+
+     // MSVC has problems when the declaration and definition are separated
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override {
+        return transform(input);
+    }
+
+     // MSVC has problems when the declaration and definition are separated
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const {
         if (input.size() == 0)
             throw std::invalid_argument("Input matrix size() invalid");
 
@@ -76,7 +95,7 @@ private:
 
         // TODO: We should compute this transformation during construction and cache that value rather
         //       then repeatedly calculating it here.
-        callback(input * _eigenvectors.transpose());
+        return input * _eigenvectors.transpose();
     }
 };
 
@@ -217,6 +236,11 @@ bool PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::operator==(PCATransf
     return true;
 }
 
+template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
+bool PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
 void PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::save(Archive &ar) const /*override*/ {
     // Version
@@ -50,6 +50,7 @@ public:
     bool operator==(RobustScalerTransformer const &other) const;
 
     void save(Archive &ar) const override;
+    bool is_stateless(void) const override;
 
 private:
     // ----------------------------------------------------------------------
@@ -58,6 +59,10 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override;
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override;
+
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const;
 };
 
 namespace Details {
@@ -265,6 +270,11 @@ bool RobustScalerTransformer<InputT, TransformedT>::operator==(RobustScalerTrans
 #endif
 }
 
+template <typename InputT, typename TransformedT>
+bool RobustScalerTransformer<InputT, TransformedT>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template <typename InputT, typename TransformedT>
 void RobustScalerTransformer<InputT, TransformedT>::save(Archive &ar) const /*override*/ {
     // Version
@@ -278,22 +288,38 @@ void RobustScalerTransformer<InputT, TransformedT>::save(Archive &ar) const /*ov
 
 template <typename InputT, typename TransformedT>
 void RobustScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+template <typename InputT, typename TransformedT>
+void RobustScalerTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) /*override*/ {
+    typename BaseType::InputType const * const          pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs)
+        *pOutputs++ = transform(*pInputs++);
+}
+
+template <typename InputT, typename TransformedT>
+typename RobustScalerTransformer<InputT, TransformedT>::BaseType::TransformedType RobustScalerTransformer<InputT, TransformedT>::transform_impl(typename BaseType::InputType const &input) /*override*/ {
+    return transform(input);
+}
+
+template <typename InputT, typename TransformedT>
+typename RobustScalerTransformer<InputT, TransformedT>::BaseType::TransformedType RobustScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input) const {
 
 #if (defined __clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wfloat-equal"
 #endif
 
-    if (Scale != static_cast<TransformedT>(0)) {
-        callback((static_cast<TransformedT>(input) - Median) / Scale);
-        return;
-    }
+    if (Scale != static_cast<TransformedT>(0))
+        return (static_cast<TransformedT>(input) - Median) / Scale;
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
 #endif
 
-    callback(static_cast<TransformedT>(input) - Median);
+    return static_cast<TransformedT>(input) - Median;
 }
 
 // ----------------------------------------------------------------------
@@ -55,12 +55,27 @@ public:
         ar.serialize(Delta);
     }
 
+    bool is_stateless(void) const override {
+        return true;
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |  Private Methods
     void execute_impl(InputType const &input, CallbackFunction const &callback) override {
         callback(input + Delta);
     }
+
+    void execute_batch_impl(InputType const *pInputs, size_t cInputs, TransformedType *pOutputs) override {
+        InputType const * const             pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            *pOutputs++ = *pInputs++ + Delta;
+    }
+
+    TransformedType transform_impl(InputType const &input) override {
+        return input + Delta;
+    }
 };
 
 // ----------------------------------------------------------------------
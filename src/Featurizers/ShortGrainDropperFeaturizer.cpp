@@ -41,6 +41,10 @@ bool ShortGrainDropperTransformer::operator==(ShortGrainDropperTransformer const
     return this->_grainsToDrop == other._grainsToDrop;
 }
 
+bool ShortGrainDropperTransformer::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 void ShortGrainDropperTransformer::save(Archive &ar) const /*override*/ {
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
@@ -54,6 +58,17 @@ void ShortGrainDropperTransformer::execute_impl(typename BaseType::InputType con
     callback(_grainsToDrop.find(input) != _grainsToDrop.end());
 }
 
+void ShortGrainDropperTransformer::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) /*override*/ {
+    typename BaseType::InputType const * const          pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs)
+        *pOutputs++ = _grainsToDrop.find(*pInputs++) != _grainsToDrop.end();
+}
+
+ShortGrainDropperTransformer::BaseType::TransformedType ShortGrainDropperTransformer::transform_impl(typename BaseType::InputType const &input) /*override*/ {
+    return _grainsToDrop.find(input) != _grainsToDrop.end();
+}
+
 } // namespace Featurizers
 } // namespace Featurizer
 } // namespace Microsoft
@@ -40,6 +40,7 @@ public:
     bool operator==(ShortGrainDropperTransformer const &other) const;
 
     void save(Archive &ar) const override;
+    bool is_stateless(void) const override;
 
 private:
     // ----------------------------------------------------------------------
@@ -55,6 +56,8 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override;
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -45,6 +45,7 @@ public:
     bool operator==(StandardScalerTransformer const &other) const;
 
     void save(Archive &ar) const override;
+    bool is_stateless(void) const override;
 
 private:
     // ----------------------------------------------------------------------
@@ -61,12 +62,14 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override;
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override;
 
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::true_type);
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::false_type);
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input, std::true_type) const;
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input, std::false_type) const;
 
     template <typename U>
-    void execute_implex(U const &input, typename BaseType::CallbackFunction const &callback);
+    typename BaseType::TransformedType transform_implex(U const &input) const;
 };
 
 namespace Details {
@@ -159,6 +162,8 @@ private:
 ///  \class         StandardScaleWrapperEstimator
 ///  \brief         Chains up StatisticalMetricsEstimator, StandardDeviationEstimator and StandardScalerTransformerImpl
 ///                 to scale input data set so that it's centered around 0 with unit standard deviation
+///                 StatisticalMetricsEstimator and StandardDeviationEstimator don't depend on each other
+///                 and are trained concurrently, so training requires a single pass over the data
 ///
 template <
     typename InputT,
@@ -232,6 +237,11 @@ StandardScalerTransformer<InputT, TransformedT>::StandardScalerTransformer(Archi
     ) {
 }
 
+template <typename InputT, typename TransformedT>
+bool StandardScalerTransformer<InputT, TransformedT>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template <typename InputT, typename TransformedT>
 void StandardScalerTransformer<InputT, TransformedT>::save(Archive &ar) const /*override*/ {
     Traits<std::double_t>::serialize(ar, _average);
@@ -261,11 +271,24 @@ bool StandardScalerTransformer<InputT, TransformedT>::operator==(StandardScalerT
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
 void StandardScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
-    execute_impl(input, callback, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+    callback(transform(input, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>()));
 }
 
 template <typename InputT, typename TransformedT>
-void StandardScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::true_type) {
+void StandardScalerTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) /*override*/ {
+    typename BaseType::InputType const * const          pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs)
+        *pOutputs++ = transform(*pInputs++, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+}
+
+template <typename InputT, typename TransformedT>
+typename StandardScalerTransformer<InputT, TransformedT>::BaseType::TransformedType StandardScalerTransformer<InputT, TransformedT>::transform_impl(typename BaseType::InputType const &input) /*override*/ {
+    return transform(input, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+}
+
+template <typename InputT, typename TransformedT>
+typename StandardScalerTransformer<InputT, TransformedT>::BaseType::TransformedType StandardScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input, std::true_type) const {
     // ----------------------------------------------------------------------
     using InputTraits                       = Traits<InputT>;
     using TransformedTraits                 = Traits<TransformedT>;
@@ -273,23 +296,21 @@ void StandardScalerTransformer<InputT, TransformedT>::execute_impl(typename Base
 
     // TODO: Implement different strategies to handle nulls
     // potential strategies can be returning 0s for nulls, throwing errors, returning nulls for nulls
-    if(InputTraits::IsNull(input)) {
-        callback(TransformedTraits::CreateNullValue());
-        return;
-    }
+    if(InputTraits::IsNull(input))
+        return TransformedTraits::CreateNullValue();
 
-    execute_implex(InputTraits::GetNullableValue(input), callback);
+    return transform_implex(InputTraits::GetNullableValue(input));
 }
 
 template <typename InputT, typename TransformedT>
-void StandardScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::false_type) {
-    execute_implex(input, callback);
+typename StandardScalerTransformer<InputT, TransformedT>::BaseType::TransformedType StandardScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input, std::false_type) const {
+    return transform_implex(input);
 }
 
 template <typename InputT, typename TransformedT>
 template <typename U>
-void StandardScalerTransformer<InputT, TransformedT>::execute_implex(U const &input, typename BaseType::CallbackFunction const &callback) {
-    callback((static_cast<TransformedT>(input) - _average) / _deviation);
+typename StandardScalerTransformer<InputT, TransformedT>::BaseType::TransformedType StandardScalerTransformer<InputT, TransformedT>::transform_implex(U const &input) const {
+    return (static_cast<TransformedT>(input) - _average) / _deviation;
 }
 
 // ----------------------------------------------------------------------
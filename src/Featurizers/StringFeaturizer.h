@@ -41,6 +41,7 @@ public:
     bool operator!=(StringTransformer const &other) const;
 
     void save(Archive &ar) const override;
+    bool is_stateless(void) const override;
 
 private:
     // ----------------------------------------------------------------------
@@ -69,6 +70,19 @@ private:
         callback(_impl(input));
     }
 
+    // MSVC has problems when the function is defined outside of the declaration
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        typename BaseType::InputType const * const      pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            *pOutputs++ = _impl(*pInputs++);
+    }
+
+    // MSVC has problems when the function is defined outside of the declaration
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override {
+        return _impl(input);
+    }
+
     static std::string ToString(T const &value);
     static std::string ToStringWithEmptyStringsForNullValues(T const &value);
     static std::string ToStringWithEmptyStringsForNullValuesImpl(T const &value, std::true_type);
@@ -178,6 +192,11 @@ bool StringTransformer<T>::operator!=(StringTransformer const &other) const {
     return (*this == other) == false;
 }
 
+template <typename T>
+bool StringTransformer<T>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template <typename T>
 void StringTransformer<T>::save(Archive &ar) const /*override*/ {
     // Version
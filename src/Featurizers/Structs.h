@@ -94,9 +94,9 @@ public:
     // |
     // ----------------------------------------------------------------------
     SingleValueSparseVectorEncoding(std::uint64_t numElements, value_type value, std::uint64_t index);
+    SingleValueSparseVectorEncoding(SingleValueSparseVectorEncoding && other);
 
-    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(SingleValueSparseVectorEncoding);
-
+    SingleValueSparseVectorEncoding & operator =(SingleValueSparseVectorEncoding && other);
     bool operator==(SingleValueSparseVectorEncoding const &other) const;
     bool operator!=(SingleValueSparseVectorEncoding const &other) const;
 };
@@ -254,6 +254,22 @@ SingleValueSparseVectorEncoding<T>::SingleValueSparseVectorEncoding(std::uint64_
     ) {
 }
 
+template <typename T>
+SingleValueSparseVectorEncoding<T>::SingleValueSparseVectorEncoding(SingleValueSparseVectorEncoding && other) :
+    NumElements(std::move(const_cast<std::uint64_t &>(other.NumElements))),
+    Value(std::move(const_cast<value_type &>(other.Value))),
+    Index(std::move(const_cast<std::uint64_t &>(other.Index))) {
+}
+
+template <typename T>
+SingleValueSparseVectorEncoding<T> & SingleValueSparseVectorEncoding<T>::operator =(SingleValueSparseVectorEncoding && other) {
+    const_cast<std::uint64_t &>(this->NumElements) = std::move(const_cast<std::uint64_t &>(other.NumElements));
+    const_cast<value_type &>(this->Value) = std::move(const_cast<value_type &>(other.Value));
+    const_cast<std::uint64_t &>(this->Index) = std::move(const_cast<std::uint64_t &>(other.Index));
+
+    return *this;
+}
+
 #if (defined __clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wfloat-equal"
@@ -82,7 +82,7 @@ std::vector<typename EstimatorT::TransformedType> Predict(EstimatorT &estimator,
     output.reserve(data.size());
 
     auto const                              callback(
-        [&output](typename EstimatorT::TransformedType value) {
+        [&output](typename EstimatorT::TransformedType &&value) {
             output.emplace_back(std::move(value));
         }
     );
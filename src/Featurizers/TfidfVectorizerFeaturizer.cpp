@@ -10,6 +10,15 @@ namespace Microsoft {
 namespace Featurizer {
 namespace Featurizers {
 
+namespace {
+
+unsigned char const * GetWordBytes(std::string::const_iterator wordBegin, std::string::const_iterator wordEnd) {
+    // The end iterator can't be dereferenced, so empty words don't have any bytes
+    return wordBegin == wordEnd ? nullptr : reinterpret_cast<unsigned char const *>(&*wordBegin);
+}
+
+} // anonymous namespace
+
 // ----------------------------------------------------------------------
 // |
 // |  TfidfVectorizerTransformer
@@ -56,6 +65,43 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(IndexMap labels,
     _parseFunc(Components::DocumentParseFuncGenerator(_analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax)) {
 }
 
+TfidfVectorizerTransformer::TfidfVectorizerTransformer(FlatIndexMap labels,
+                                                       FlatIndexMap docuFreq,
+                                                       std::uint32_t totalNumDocus,
+                                                       NormMethod norm,
+                                                       TfidfPolicy tfidfParameters,
+                                                       bool lowercase,
+                                                       AnalyzerMethod analyzer,
+                                                       std::string regexToken,
+                                                       std::uint32_t ngramRangeMin,
+                                                       std::uint32_t ngramRangeMax) :
+    _pFlatLabels(
+        [&labels](void) {
+            if (labels.empty()) {
+                throw std::invalid_argument("Index map is empty!");
+            }
+            return std::make_shared<FlatIndexMap>(std::move(labels));
+        }()
+    ),
+    _pFlatDocumentFreq(
+        [&docuFreq](void) {
+            if (docuFreq.empty()) {
+                throw std::invalid_argument("DocumentFrequency map is empty!");
+            }
+            return std::make_shared<FlatIndexMap>(std::move(docuFreq));
+        }()
+    ),
+    _totalNumsDocuments(std::move(totalNumDocus)),
+    _norm(std::move(norm)),
+    _tfidfParameters(std::move(tfidfParameters)),
+    _lowercase(std::move(lowercase)),
+    _analyzer(std::move(analyzer)),
+    _regexToken(std::move(regexToken)),
+    _ngramRangeMin(std::move(ngramRangeMin)),
+    _ngramRangeMax(std::move(ngramRangeMax)),
+    _parseFunc(Components::DocumentParseFuncGenerator(_analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax)) {
+}
+
 TfidfVectorizerTransformer::TfidfVectorizerTransformer(Archive &ar) :
     TfidfVectorizerTransformer(
         [&ar](void) {
@@ -63,12 +109,28 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(Archive &ar) :
             std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
             std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
 
-            if(majorVersion != 1 || minorVersion != 0)
+            if(majorVersion != 1 || minorVersion > 2)
                 throw std::runtime_error("Unsupported archive version");
 
-            // Data
-            IndexMap                       labels(Traits<IndexMap>::deserialize(ar));
-            FrequencyMap                   docuFreq(Traits<FrequencyMap>::deserialize(ar));
+            // Data (1.1 archives contain flat maps, 1.2 archives contain compact maps)
+            std::shared_ptr<FlatIndexMap>  pFlatLabels;
+            std::shared_ptr<FlatIndexMap>  pFlatDocuFreq;
+            IndexMap                       labels;
+            FrequencyMap                   docuFreq;
+
+            if(minorVersion == 1) {
+                pFlatLabels = std::make_shared<FlatIndexMap>(ar);
+                pFlatDocuFreq = std::make_shared<FlatIndexMap>(ar);
+            }
+            else if(minorVersion == 2) {
+                labels = DeserializeCompactIndexMap<IndexMap>(ar);
+                docuFreq = DeserializeCompactIndexMap<FrequencyMap>(ar);
+            }
+            else {
+                labels = Traits<IndexMap>::deserialize(ar);
+                docuFreq = Traits<FrequencyMap>::deserialize(ar);
+            }
+
             std::uint32_t                  totalNumDocus(Traits<std::uint32_t >::deserialize(ar));
             NormMethod                     norm(static_cast<NormMethod>(Traits<std::underlying_type<NormMethod>::type>::deserialize(ar)));
             TfidfPolicy                    tfidfParameters(static_cast<TfidfPolicy>(Traits<std::underlying_type<TfidfPolicy>::type>::deserialize(ar)));
@@ -78,6 +140,21 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(Archive &ar) :
             std::uint32_t                  ngramRangeMin(Traits<std::uint32_t>::deserialize(ar));
             std::uint32_t                  ngramRangeMax(Traits<std::uint32_t>::deserialize(ar));
 
+            if(pFlatLabels) {
+                return TfidfVectorizerTransformer(
+                            std::move(*pFlatLabels),
+                            std::move(*pFlatDocuFreq),
+                            std::move(totalNumDocus),
+                            std::move(norm),
+                            std::move(tfidfParameters),
+                            std::move(lowercase),
+                            std::move(analyzer),
+                            std::move(regexToken),
+                            std::move(ngramRangeMin),
+                            std::move(ngramRangeMax)
+                        );
+            }
+
             return TfidfVectorizerTransformer(
                         std::move(labels),
                         std::move(docuFreq),
@@ -94,14 +171,48 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(Archive &ar) :
     ) {
 }
 
+bool TfidfVectorizerTransformer::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 void TfidfVectorizerTransformer::save(Archive &ar) const /*override*/ {
+    bool const                              isFlat(ar.Layout == Archive::LayoutValue::Flat);
+    bool const                              isCompact(ar.Layout == Archive::LayoutValue::Compact);
+
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
-    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+    Traits<std::uint16_t>::serialize(ar, isFlat ? 1 : isCompact ? 2 : 0); // Minor
 
     // Data
-    Traits<decltype(_labels)>::serialize(ar, _labels);
-    Traits<decltype(_documentFreq)>::serialize(ar, _documentFreq);
+    if(isFlat) {
+        if(_pFlatLabels) {
+            _pFlatLabels->save(ar);
+            _pFlatDocumentFreq->save(ar);
+        }
+        else {
+            FlatIndexMap(FlatIndexMap::Create(_labels)).save(ar);
+            FlatIndexMap(FlatIndexMap::Create(_documentFreq)).save(ar);
+        }
+    }
+    else if(isCompact) {
+        if(_pFlatLabels) {
+            SerializeCompactIndexMap(ar, _pFlatLabels->ToMap<IndexMap>());
+            SerializeCompactIndexMap(ar, _pFlatDocumentFreq->ToMap<FrequencyMap>());
+        }
+        else {
+            SerializeCompactIndexMap(ar, _labels);
+            SerializeCompactIndexMap(ar, _documentFreq);
+        }
+    }
+    else if(_pFlatLabels) {
+        Traits<IndexMap>::serialize(ar, _pFlatLabels->ToMap<IndexMap>());
+        Traits<FrequencyMap>::serialize(ar, _pFlatDocumentFreq->ToMap<FrequencyMap>());
+    }
+    else {
+        Traits<decltype(_labels)>::serialize(ar, _labels);
+        Traits<decltype(_documentFreq)>::serialize(ar, _documentFreq);
+    }
+
     Traits<decltype(_totalNumsDocuments)>::serialize(ar, _totalNumsDocuments);
     Traits<std::underlying_type<NormMethod>::type>::serialize(ar, static_cast<std::underlying_type<NormMethod>::type>(_norm));
     Traits<std::underlying_type<TfidfPolicy>::type>::serialize(ar, static_cast<std::underlying_type<TfidfPolicy>::type>(_tfidfParameters));
@@ -112,9 +223,13 @@ void TfidfVectorizerTransformer::save(Archive &ar) const /*override*/ {
     Traits<decltype(_ngramRangeMax)>::serialize(ar, _ngramRangeMax);
 }
 
+bool TfidfVectorizerTransformer::IsView(void) const {
+    return static_cast<bool>(_pFlatLabels);
+}
+
 bool TfidfVectorizerTransformer::operator==(TfidfVectorizerTransformer const &other) const {
-    return _labels == other._labels
-        && _documentFreq == other._documentFreq
+    return IndexMapsAreEqual(_labels, _pFlatLabels.get(), other._labels, other._pFlatLabels.get())
+        && IndexMapsAreEqual(_documentFreq, _pFlatDocumentFreq.get(), other._documentFreq, other._pFlatDocumentFreq.get())
         && _totalNumsDocuments == other._totalNumsDocuments
         && _norm == other._norm
         && _tfidfParameters == other._tfidfParameters
@@ -129,6 +244,21 @@ bool TfidfVectorizerTransformer::operator==(TfidfVectorizerTransformer const &ot
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 void TfidfVectorizerTransformer::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+void TfidfVectorizerTransformer::execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) /*override*/ {
+    typename BaseType::InputType const * const          pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs)
+        *pOutputs++ = transform(*pInputs++);
+}
+
+TfidfVectorizerTransformer::BaseType::TransformedType TfidfVectorizerTransformer::transform_impl(typename BaseType::InputType const &input) /*override*/ {
+    return transform(input);
+}
+
+TfidfVectorizerTransformer::BaseType::TransformedType TfidfVectorizerTransformer::transform(typename BaseType::InputType const &input) const {
     //termfrequency for specific document
     MapWithIterRange documentTermFrequency;
 
@@ -149,11 +279,12 @@ void TfidfVectorizerTransformer::execute_impl(typename BaseType::InputType const
     std::float_t normVal = 0.0f;
     std::vector<std::tuple<std::uint32_t, std::float_t>> results;
     for (auto const & wordIteratorPair : documentTermFrequency) {
-        std::string const word(std::string(std::get<0>(wordIteratorPair.first), std::get<1>(wordIteratorPair.first)));
+        std::string::const_iterator const   wordBegin(std::get<0>(wordIteratorPair.first));
+        std::string::const_iterator const   wordEnd(std::get<1>(wordIteratorPair.first));
 
-        IndexMap::const_iterator const      labelIter(_labels.find(word));
+        std::uint32_t                       label;
 
-        if (labelIter != _labels.end()) {
+        if (find_label(wordBegin, wordEnd, label)) {
 
             double tf;
             double idf;
@@ -181,9 +312,9 @@ void TfidfVectorizerTransformer::execute_impl(typename BaseType::InputType const
             if (!((_tfidfParameters & TfidfPolicy::UseIdf) == TfidfPolicy::UseIdf)) {
                 idf = 1.0;
             } else if ((_tfidfParameters & TfidfPolicy::SmoothIdf) == TfidfPolicy::SmoothIdf) {
-                idf = 1.0 + std::log((1 + _totalNumsDocuments) / (1.0 + _documentFreq.at(word)));
+                idf = 1.0 + std::log((1 + _totalNumsDocuments) / (1.0 + get_document_frequency(wordBegin, wordEnd)));
             } else {
-                idf = 1.0 + std::log((1 + _totalNumsDocuments) / (0.0 + _documentFreq.at(word)));
+                idf = 1.0 + std::log((1 + _totalNumsDocuments) / (0.0 + get_document_frequency(wordBegin, wordEnd)));
             }
 
             //calculate tfidf (tfidf = tf * idf)
@@ -198,7 +329,7 @@ void TfidfVectorizerTransformer::execute_impl(typename BaseType::InputType const
             }
 
             //temperarily put output in a vector for future normalization
-            results.emplace_back(std::make_tuple(labelIter->second, tfidf));
+            results.emplace_back(std::make_tuple(label, tfidf));
         }
     }
      //normVal will be zero when the input is empty
@@ -226,7 +357,33 @@ void TfidfVectorizerTransformer::execute_impl(typename BaseType::InputType const
         }
     );
 
-    callback(SparseVectorEncoding<std::float_t>(_labels.size(), std::move(sparseVector)));
+    return SparseVectorEncoding<std::float_t>(_pFlatLabels ? _pFlatLabels->size() : _labels.size(), std::move(sparseVector));
+}
+
+bool TfidfVectorizerTransformer::find_label(std::string::const_iterator wordBegin, std::string::const_iterator wordEnd, std::uint32_t &label) const {
+    if(_pFlatLabels)
+        return _pFlatLabels->find(GetWordBytes(wordBegin, wordEnd), static_cast<size_t>(wordEnd - wordBegin), label);
+
+    IndexMap::const_iterator const          iter(_labels.find(std::string(wordBegin, wordEnd)));
+
+    if(iter == _labels.end())
+        return false;
+
+    label = iter->second;
+    return true;
+}
+
+std::uint32_t TfidfVectorizerTransformer::get_document_frequency(std::string::const_iterator wordBegin, std::string::const_iterator wordEnd) const {
+    if(_pFlatDocumentFreq) {
+        std::uint32_t                       result;
+
+        if(_pFlatDocumentFreq->find(GetWordBytes(wordBegin, wordEnd), static_cast<size_t>(wordEnd - wordBegin), result) == false)
+            throw std::out_of_range("word");
+
+        return result;
+    }
+
+    return _documentFreq.at(std::string(wordBegin, wordEnd));
 }
 
 } // namespace Featurizers
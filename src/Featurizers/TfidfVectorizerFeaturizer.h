@@ -9,6 +9,8 @@
 #include "Structs.h"
 #include "../Traits.h"
 #include "../Strings.h"
+#include "../CompactEncoding.h"
+#include "../FlatIndexMap.h"
 
 #include <cmath>
 
@@ -47,6 +49,7 @@ public:
     using BaseType                           = StandardTransformer<std::string, SparseVectorEncoding<std::float_t>>;
     using IndexMap                           = std::unordered_map<std::string, std::uint32_t>;
     using FrequencyMap                       = IndexMap;
+    using FlatIndexMap                       = Microsoft::Featurizer::FlatIndexMap<std::string>;
     using IterRangeType                      = std::tuple<std::string::const_iterator, std::string::const_iterator>;
     using MapWithIterRange                   = std::map<IterRangeType, std::uint32_t, Components::IterRangeComp>;
     using AnalyzerMethod                     = Components::AnalyzerMethod;
@@ -76,11 +79,39 @@ public:
         std::uint32_t ngramRangeMin,
         std::uint32_t ngramRangeMax
     );
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            TfidfVectorizerTransformer
+    ///  \brief         Creates a read-only view that looks up terms directly
+    ///                 within `labels` and `docuFreq` (which may reference a
+    ///                 memory-mapped file).
+    ///
+    explicit TfidfVectorizerTransformer(
+        FlatIndexMap labels,
+        FlatIndexMap docuFreq,
+        std::uint32_t totalNumDocus,
+        NormMethod norm,
+        TfidfPolicy tfidfParameters,
+        bool lowercase,
+        AnalyzerMethod analyzer,
+        std::string regexToken,
+        std::uint32_t ngramRangeMin,
+        std::uint32_t ngramRangeMax
+    );
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            TfidfVectorizerTransformer
+    ///  \brief         Deserializes the transformer; archives written with
+    ///                 `Archive::LayoutValue::Flat` produce a read-only view.
+    ///
     explicit TfidfVectorizerTransformer(Archive &ar);
 
     ~TfidfVectorizerTransformer(void) override = default;
 
     void save(Archive &ar) const override;
+    bool is_stateless(void) const override;
+
+    bool IsView(void) const;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TfidfVectorizerTransformer);
 
@@ -102,8 +133,11 @@ private:
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
+    // `_labels` and `_documentFreq` are empty when the transformer is a read-only view
     IndexMap const                          _labels;
     FrequencyMap const                      _documentFreq;
+    std::shared_ptr<FlatIndexMap const> const           _pFlatLabels;
+    std::shared_ptr<FlatIndexMap const> const           _pFlatDocumentFreq;
     std::uint32_t const                     _totalNumsDocuments;
     NormMethod const                        _norm;
     TfidfPolicy const                       _tfidfParameters;
@@ -123,6 +157,15 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override;
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override;
+
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const;
+
+    // Words are provided as ranges within the processed input so that lookups
+    // against flat maps don't require the creation of temporary strings.
+    bool find_label(std::string::const_iterator wordBegin, std::string::const_iterator wordEnd, std::uint32_t &label) const;
+    std::uint32_t get_document_frequency(std::string::const_iterator wordBegin, std::string::const_iterator wordEnd) const;
 };
 
 namespace Details {
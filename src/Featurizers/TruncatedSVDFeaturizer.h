@@ -70,6 +70,7 @@ public:
     bool operator==(TruncatedSVDTransformer const &other) const;
 
     void save(Archive &ar) const override;
+    bool is_stateless(void) const override;
 
     std::ptrdiff_t getEigenVectorRowsNumber() const;
     std::ptrdiff_t getEigenVectorColsNumber() const;
@@ -89,6 +90,24 @@ private:
     // ----------------------------------------------------------------------
      // MSVC has problems when the declaration and definition are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        callback(transform(input));
+    }
+
+     // MSVC has problems when the declaration and definition are separated
+    void execute_batch_impl(typename BaseType::InputType const *pInputs, size_t cInputs, typename BaseType::TransformedType *pOutputs) override {
+        typename BaseType::InputType const * const      pEndInputs(pInputs + cInputs);
+
+        while(pInputs != pEndInputs)
+            *pOutputs++ = transform(*pInputs++);
+    }
+
+     // MSVC has problems when the declaration and definition are separated
+    typename BaseType::TransformedType transform_impl(typename BaseType::InputType const &input) override {
+        return transform(input);
+    }
+
+     // MSVC has problems when the declaration and definition are separated
+    typename BaseType::TransformedType transform(typename BaseType::InputType const &input) const {
         if (input.size() == 0)
             throw std::invalid_argument("Input matrix size() invalid");
 
@@ -97,7 +116,8 @@ private:
 
         EigenMatrix result = input * _singularvectors;
 
-        callback(svd_flip(result));
+        svd_flip(result);
+        return result;
     }
 };
 
@@ -355,6 +375,11 @@ bool TruncatedSVDTransformer<InputEigenMatrixT, OutputEigenMatrixT>::operator==(
     return true;
 }
 
+template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
+bool TruncatedSVDTransformer<InputEigenMatrixT, OutputEigenMatrixT>::is_stateless(void) const /*override*/ {
+    return true;
+}
+
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
 void TruncatedSVDTransformer<InputEigenMatrixT, OutputEigenMatrixT>::save(Archive &ar) const /*override*/ {
     // Version
@@ -236,3 +236,32 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("Clone") {
+    // ----------------------------------------------------------------------
+    using Transformer                       = NS::Featurizers::BackwardFillImputerTransformer<double>;
+    // ----------------------------------------------------------------------
+
+    Transformer                             transformer(5.0);
+    std::vector<double>                     output;
+
+    auto const callback =
+        [&output](double value) {
+            output.emplace_back(std::move(value));
+        };
+
+    transformer.execute(NS::Traits<double>::CreateNullValue(), callback);
+    CHECK(transformer.has_pending());
+
+    std::unique_ptr<Transformer>            pClone(NS::CloneTransformer(transformer));
+
+    // The clone doesn't have the pending values of the original
+    CHECK(*pClone == transformer);
+    CHECK(pClone->has_pending() == false);
+
+    pClone->flush(callback);
+    CHECK(output.empty());
+
+    transformer.flush(callback);
+    CHECK(output == std::vector<double>{5.0});
+}
@@ -344,6 +344,42 @@ TEST_CASE("string - without binary with decorator, analyze word, maxdf = 1, mind
         )== inferencingOutput
     );
 }
+TEST_CASE("Trained transformer - single and batch execute") {
+    using EstimatorType                     = NS::Featurizers::CountVectorizerEstimator<std::numeric_limits<size_t>::max()>;
+    using TransformerType                   = EstimatorType::TransformerType;
+    using TransformedType                   = NS::Featurizers::SparseVectorEncoding<std::uint32_t>;
+
+    EstimatorType                           estimator(NS::CreateTestAnnotationMapsPtr(1), 0, true, AnalyzerMethod::Word, "", 1.0, 0, nonstd::optional<std::uint32_t>(), 1, 1, false);
+
+    estimator.begin_training();
+    estimator.fit(std::string("orange apple orange grape"));
+    estimator.fit(std::string("grape carrot carrot apple"));
+    estimator.complete_training();
+
+    EstimatorType::TransformerUniquePtr     pTransformer(estimator.create_transformer());
+    TransformerType &                       transformer(static_cast<TransformerType &>(*pTransformer));
+
+    std::vector<std::string> const          inputs{"apple apple grape", "carrot orange"};
+    TransformedType const                   expected0(transformer.execute(inputs[0]));
+    TransformedType const                   expected1(transformer.execute(inputs[1]));
+
+    std::vector<TransformedType>            outputs;
+
+    for(size_t i = 0; i < inputs.size(); ++i) {
+        std::vector<TransformedType::ValueEncoding>         values;
+
+        values.emplace_back(TransformedType::ValueEncoding(1, 0));
+        outputs.emplace_back(TransformedType(1, std::move(values)));
+    }
+
+    pTransformer->execute(inputs.data(), inputs.size(), outputs.data());
+
+    CHECK(outputs[0] == expected0);
+    CHECK(outputs[1] == expected1);
+    CHECK(expected0.NumElements == 4);
+    CHECK(expected0.Values.size() == 2);
+}
+
 TEST_CASE("Serialization/Deserialization") {
     using NormMethod = typename NS::Featurizers::TfidfVectorizerTransformer::NormMethod;
     using TfidfPolicy = NS::Featurizers::TfidfPolicy;
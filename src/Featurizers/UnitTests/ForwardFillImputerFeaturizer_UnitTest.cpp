@@ -89,6 +89,11 @@ TEST_CASE("Comparison") {
     CHECK(transformer != Transformer(1.0));
 }
 
+TEST_CASE("Stateless") {
+    // The last valid value is updated during each call to execute
+    CHECK(NS::Featurizers::ForwardFillImputerTransformer<double>().is_stateless() == false);
+}
+
 TEST_CASE("Serialization") {
     size_t                                  defaultArchiveSize(0);
     size_t                                  valueArchiveSize(0);
@@ -156,3 +161,23 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("Clone") {
+    // ----------------------------------------------------------------------
+    using Transformer                       = NS::Featurizers::ForwardFillImputerTransformer<double>;
+    // ----------------------------------------------------------------------
+
+    Transformer                             transformer(0.0);
+
+    CHECK(transformer.execute(1.0) == 1.0);
+
+    std::unique_ptr<Transformer>            pClone(NS::CloneTransformer(transformer));
+
+    CHECK(*pClone == transformer);
+
+    // The clone doesn't have the last value of the original
+    CHECK(pClone->execute(NS::Traits<double>::CreateNullValue()) == 0.0);
+    CHECK(transformer.execute(NS::Traits<double>::CreateNullValue()) == 1.0);
+
+    CHECK_THROWS_WITH(NS::CloneTransformer(Transformer())->execute(NS::Traits<double>::CreateNullValue()), "No source value for forward fill");
+}
@@ -158,6 +158,73 @@ TEST_CASE("Serialization/Deserialization- string") {
     CHECK(other == original);
 }
 
+TEST_CASE("Serialization/Deserialization- flat") {
+    using InputType       = std::string;
+    using TransformerType = NS::Featurizers::LabelEncoderTransformer<InputType>;
+
+    TransformerType                         original(IndexMap<InputType, std::uint32_t>({{"apple", 0}, {"banana", 1}, {"grape", 2}}), true);
+    NS::Archive                             out(0, NS::Archive::LayoutValue::Flat);
+
+    original.save(out);
+
+    NS::Archive                             in(out.commit());
+    TransformerType                         view(in);
+
+    CHECK(view.IsView());
+    CHECK(view.GetLabels() == original.GetLabels());
+    CHECK(view == original);
+
+    CHECK(view.execute("grape") == 3);
+    CHECK(view.execute("apple") == 1);
+    CHECK(view.execute("carrot") == 0);
+
+    // Views can be saved in the standard layout
+    NS::Archive                             standardOut;
+
+    view.save(standardOut);
+
+    NS::Archive                             standardIn(standardOut.commit());
+    TransformerType                         standard(standardIn);
+
+    CHECK(standard.IsView() == false);
+    CHECK(standard == original);
+}
+
+TEST_CASE("Serialization/Deserialization- compact") {
+    using InputType       = std::string;
+    using TransformerType = NS::Featurizers::LabelEncoderTransformer<InputType>;
+
+    TransformerType                         original(IndexMap<InputType, std::uint32_t>({{"apple", 0}, {"applesauce", 1}, {"banana", 2}, {"grape", 3}}), true);
+    NS::Archive                             out(0, NS::Archive::LayoutValue::Compact);
+    NS::Archive                             standardOut;
+
+    original.save(out);
+    original.save(standardOut);
+
+    NS::Archive::ByteArray const            buffer(out.commit());
+
+    CHECK(buffer.size() < standardOut.commit().size());
+
+    NS::Archive                             in(buffer);
+    TransformerType                         other(in);
+
+    CHECK(other.IsView() == false);
+    CHECK(other == original);
+    CHECK(other.execute("applesauce") == 2);
+
+    // Views can be saved in the compact layout
+    NS::Archive                             flatOut(0, NS::Archive::LayoutValue::Flat);
+
+    original.save(flatOut);
+
+    NS::Archive                             flatIn(flatOut.commit());
+    TransformerType                         view(flatIn);
+    NS::Archive                             compactOut(0, NS::Archive::LayoutValue::Compact);
+
+    view.save(compactOut);
+    CHECK(compactOut.commit() == buffer);
+}
+
 TEST_CASE("Serialization Version Error") {
     NS::Archive                             out;
 
@@ -143,3 +143,16 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("batch execute") {
+    using InputType       = std::int8_t;
+    using TransformedType = std::double_t;
+
+    NS::Featurizers::MinMaxScalerTransformer<InputType, TransformedType>    transformer(static_cast<InputType>(1), static_cast<InputType>(9));
+    std::vector<InputType> const            inputs(NS::TestHelpers::make_vector<InputType>(static_cast<InputType>(1), static_cast<InputType>(5), static_cast<InputType>(15)));
+    std::vector<TransformedType>            outputs(inputs.size());
+
+    transformer.execute(inputs.data(), inputs.size(), outputs.data());
+
+    CHECK(outputs == NS::TestHelpers::make_vector<TransformedType>(static_cast<TransformedType>(0), static_cast<TransformedType>(0.5), static_cast<TransformedType>(1.75)));
+}
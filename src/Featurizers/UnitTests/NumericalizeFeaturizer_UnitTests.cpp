@@ -158,6 +158,21 @@ TEST_CASE("Serialization/Deserialization- string") {
     CHECK(other == original);
     }
 
+TEST_CASE("Serialization/Deserialization- compact") {
+    using InputType = std::string;
+    using TransformerType = NS::Featurizers::NumericalizeTransformer<InputType>;
+
+    TransformerType                         original(IndexMap<InputType, std::uint32_t>({{"apple", 1}, {"banana", 2}, {"grape", 3}}));
+    NS::Archive                             out(0, NS::Archive::LayoutValue::Compact);
+
+    original.save(out);
+
+    NS::Archive                             in(out.commit());
+    TransformerType                         other(in);
+
+    CHECK(other == original);
+}
+
 TEST_CASE("Serialization Version Error") {
     NS::Archive                             out;
 
@@ -166,6 +166,55 @@ TEST_CASE("Serialization/Deserialization- string") {
     CHECK(other == original);
 }
 
+TEST_CASE("Serialization/Deserialization- flat") {
+    using InputType       = std::uint32_t;
+    using TransformedType = NS::Featurizers::SingleValueSparseVectorEncoding<std::uint8_t>;
+    using TransformerType = NS::Featurizers::OneHotEncoderTransformer<InputType>;
+
+    TransformerType                         original(IndexMap<InputType>{ {10, 0}, {20, 1}, {30, 2} }, true);
+    NS::Archive                             out(0, NS::Archive::LayoutValue::Flat);
+
+    original.save(out);
+
+    NS::Archive                             in(out.commit());
+    TransformerType                         view(in);
+
+    CHECK(view.IsView());
+    CHECK(view == original);
+    CHECK(view.GetLabels() == original.GetLabels());
+
+    CHECK(view.execute(30) == TransformedType(4, 1, 3));
+    CHECK(view.execute(99) == TransformedType(4, 1, 0));
+
+    // Views can be saved in the standard layout
+    NS::Archive                             standardOut;
+
+    view.save(standardOut);
+
+    NS::Archive                             standardIn(standardOut.commit());
+    TransformerType                         standard(standardIn);
+
+    CHECK(standard.IsView() == false);
+    CHECK(standard == original);
+}
+
+TEST_CASE("Serialization/Deserialization- compact") {
+    using InputType       = std::int32_t;
+    using TransformedType = NS::Featurizers::SingleValueSparseVectorEncoding<std::uint8_t>;
+    using TransformerType = NS::Featurizers::OneHotEncoderTransformer<InputType>;
+
+    TransformerType                         original(IndexMap<InputType>{ {-10, 0}, {20, 1}, {30, 2} }, true);
+    NS::Archive                             out(0, NS::Archive::LayoutValue::Compact);
+
+    original.save(out);
+
+    NS::Archive                             in(out.commit());
+    TransformerType                         other(in);
+
+    CHECK(other == original);
+    CHECK(other.execute(-10) == TransformedType(4, 1, 1));
+}
+
 TEST_CASE("Serialization Version Error") {
     NS::Archive                             out;
 
@@ -179,3 +228,28 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("batch execute") {
+    using InputType       = std::uint32_t;
+    using TransformedType = NS::Featurizers::SingleValueSparseVectorEncoding<std::uint8_t>;
+
+    NS::Featurizers::OneHotEncoderTransformer<InputType>                    transformer(IndexMap<InputType>{ {10, 0}, {20, 1}, {30, 2} }, true);
+    std::vector<InputType> const            inputs(NS::TestHelpers::make_vector<InputType>(30, 10, 99, 20));
+    std::vector<TransformedType>            outputs;
+
+    outputs.reserve(inputs.size());
+
+    while(outputs.size() != inputs.size())
+        outputs.emplace_back(1, 0, 0);
+
+    transformer.execute(inputs.data(), inputs.size(), outputs.data());
+
+    CHECK(
+        outputs == NS::TestHelpers::make_vector<TransformedType>(
+            TransformedType(4, 1, 3),
+            TransformedType(4, 1, 1),
+            TransformedType(4, 1, 0),
+            TransformedType(4, 1, 2)
+        )
+    );
+}
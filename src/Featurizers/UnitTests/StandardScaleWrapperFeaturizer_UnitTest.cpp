@@ -578,3 +578,54 @@ TEST_CASE("Serialization/Deserialization") {
     TransformerType modelLoaded(loader);
     CHECK(modelLoaded==*model);
 }
+
+TEST_CASE("batch execute") {
+    using InputType       = int;
+    using TransformedType = std::double_t;
+
+    NS::Featurizers::StandardScaleWrapperEstimator<InputType>               estimator(NS::CreateTestAnnotationMapsPtr(1), 0, true, true);
+
+    NS::TestHelpers::Train(estimator, NS::TestHelpers::make_vector<InputType>(1, 3, 5, 7, 9));
+
+    auto                                    pTransformer(estimator.create_transformer());
+    std::vector<InputType> const            inputs(NS::TestHelpers::make_vector<InputType>(2, 5, 8));
+    std::vector<TransformedType>            outputs(inputs.size());
+
+    pTransformer->execute(inputs.data(), inputs.size(), outputs.data());
+
+    CHECK(
+        NS::TestHelpers::FuzzyCheck(
+            outputs,
+            NS::TestHelpers::make_vector<TransformedType>(
+                static_cast<TransformedType>(-1.06066017),
+                static_cast<TransformedType>(0.0),
+                static_cast<TransformedType>(1.06066017)
+            )
+        )
+    );
+}
+
+TEST_CASE("clone") {
+    using InputType       = int;
+    using TransformedType = std::double_t;
+
+    NS::Featurizers::StandardScaleWrapperEstimator<InputType>               estimator(NS::CreateTestAnnotationMapsPtr(1), 0, true, true);
+
+    NS::TestHelpers::Train(estimator, NS::TestHelpers::make_vector<InputType>(1, 3, 5, 7, 9));
+
+    auto                                    pTransformer(estimator.create_transformer());
+
+    // The pipeline's Transformer is stateless, so it is shared with the clone
+    auto                                    pClone(pTransformer->clone());
+
+    REQUIRE(pClone);
+
+    std::vector<InputType> const            inputs(NS::TestHelpers::make_vector<InputType>(2, 5, 8));
+    std::vector<TransformedType>            outputs(inputs.size());
+    std::vector<TransformedType>            cloneOutputs(inputs.size());
+
+    pTransformer->execute(inputs.data(), inputs.size(), outputs.data());
+    pClone->execute(inputs.data(), inputs.size(), cloneOutputs.data());
+
+    CHECK(outputs == cloneOutputs);
+}
@@ -846,6 +846,58 @@ TEST_CASE("Serialization/Deserialization") {
     CHECK(other == original);
 }
 
+TEST_CASE("Serialization/Deserialization - flat") {
+    using TransformerType = NS::Featurizers::TfidfVectorizerTransformer;
+    using TransformedType = NS::Featurizers::SparseVectorEncoding<std::float_t>;
+
+    IndexMap labels({{"apple", 0}, {"banana", 1}, {"grape", 2}});
+    IndexMap docuFreq({{"apple", 2}, {"banana", 1}, {"grape", 1}});
+
+    TransformerType                         original(labels, docuFreq, 3, NormMethod::L2, TfidfPolicy::UseIdf | TfidfPolicy::SmoothIdf, true, AnalyzerMethod::Word, "", 1, 1);
+    NS::Archive                             out(0, NS::Archive::LayoutValue::Flat);
+
+    original.save(out);
+
+    NS::Archive                             in(out.commit());
+    TransformerType                         view(in);
+
+    CHECK(view.IsView());
+    CHECK(view == original);
+
+    TransformedType const                   expected(original.execute("Grape apple carrot apple"));
+
+    SparseVectorNumericCheck<std::float_t>(view.execute("Grape apple carrot apple"), expected);
+
+    // Views can be saved in the standard layout
+    NS::Archive                             standardOut;
+
+    view.save(standardOut);
+
+    NS::Archive                             standardIn(standardOut.commit());
+    TransformerType                         standard(standardIn);
+
+    CHECK(standard.IsView() == false);
+    CHECK(standard == original);
+}
+
+TEST_CASE("Serialization/Deserialization - compact") {
+    using TransformerType = NS::Featurizers::TfidfVectorizerTransformer;
+
+    IndexMap labels({{"apple", 0}, {"banana", 1}, {"grape", 2}});
+    IndexMap docuFreq({{"apple", 2}, {"banana", 1}, {"grape", 1}});
+
+    TransformerType                         original(labels, docuFreq, 3, NormMethod::L2, TfidfPolicy::UseIdf | TfidfPolicy::SmoothIdf, true, AnalyzerMethod::Word, "", 1, 1);
+    NS::Archive                             out(0, NS::Archive::LayoutValue::Compact);
+
+    original.save(out);
+
+    NS::Archive                             in(out.commit());
+    TransformerType                         other(in);
+
+    CHECK(other.IsView() == false);
+    CHECK(other == original);
+}
+
 TEST_CASE("Serialization Version Error") {
     NS::Archive                             out;
 
@@ -824,6 +824,69 @@ TEST_CASE("One Row input") {
             });
     }
 
+TEST_CASE("Clone") {
+    using TSImputerEstimator        = NS::Featurizers::TimeSeriesImputerEstimator;
+    using ComponentTransformer      = NS::Featurizers::Components::TimeSeriesImputerEstimator::Transformer;
+
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+
+    SECTION("Shared median values") {
+        ComponentTransformer        transformer(
+            std::chrono::hours(24),
+            std::vector<NS::TypeId>{NS::TypeId::Float64},
+            NS::Featurizers::Components::TimeSeriesImputeStrategy::Median,
+            false,
+            std::map<std::vector<std::string>,std::vector<double>>{
+                {{"a"},{14.75}}
+            }
+        );
+
+        std::unique_ptr<ComponentTransformer>                   pClone(NS::CloneTransformer(transformer));
+
+        CHECK(*pClone == transformer);
+        CHECK(&pClone->_medianValues == &transformer._medianValues);
+    }
+
+    SECTION("Fresh stream state") {
+        NS::AnnotationMapsPtr const     pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+        TSImputerEstimator              estimator(pAllColumnAnnotations, {NS::TypeId::Float64}, false, NS::Featurizers::Components::TimeSeriesImputeStrategy::Forward);
+
+        NS::TestHelpers::Train<TSImputerEstimator, InputType>(
+            estimator,
+            {
+                {
+                    std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1"}),
+                    std::make_tuple(GetTimePoint(now,1), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"2"})
+                }
+            }
+        );
+
+        TSImputerEstimator::TransformerUniquePtr                pTransformer(estimator.create_transformer());
+        TransformedType                                         output;
+        auto const                                              callback(
+            [&output](typename TransformedType::value_type value) {
+                output.emplace_back(std::move(value));
+            }
+        );
+
+        pTransformer->execute(std::make_tuple(GetTimePoint(now,0), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"1"}), callback);
+
+        TSImputerEstimator::TransformerUniquePtr                pClone(pTransformer->clone());
+
+        REQUIRE(pClone);
+
+        // The original fills the gap since the last row that it has seen...
+        output.clear();
+        pTransformer->execute(std::make_tuple(GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"3"}), callback);
+        CHECK(output.size() == 2);
+
+        // ...while the clone hasn't seen any rows
+        output.clear();
+        pClone->execute(std::make_tuple(GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"3"}), callback);
+        CHECK(output == TransformedType{std::make_tuple(false, GetTimePoint(now,2), std::vector<std::string>{"a"}, std::vector<nonstd::optional<std::string>>{"3"})});
+    }
+}
+
 #if (defined __clang__)
 #   pragma clang diagnostic pop
 #endif
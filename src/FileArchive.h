@@ -0,0 +1,181 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "Archive.h"
+
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#if (defined _WIN32)
+#   if (!defined NOMINMAX)
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#endif
+
+namespace Microsoft {
+namespace Featurizer {
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            CreateFileSerializingArchive
+///  \brief         Returns a serializing `Archive` that streams its data to
+///                 the file in chunks of `cbChunkSize` bytes rather than
+///                 accumulating it in memory. `Archive::commit` must be called
+///                 once serialization is complete; the file is closed when the
+///                 archive is destroyed.
+///
+Archive CreateFileSerializingArchive(
+    std::string const &filename,
+    Archive::LayoutValue layout=Archive::LayoutValue::Standard,
+    size_t cbChunkSize=Archive::DefaultChunkSize
+);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            SerializeToFile
+///  \brief         Invokes `func(Archive &)` with an archive that streams its
+///                 data to a temporary file in the same directory as `filename`,
+///                 and then renames the temporary file to `filename`. The
+///                 destination is only replaced once all of the data has been
+///                 written, so an error never leaves a partial file behind.
+///
+template <typename FuncT>
+void SerializeToFile(
+    std::string const &filename,
+    FuncT const &func,
+    Archive::LayoutValue layout=Archive::LayoutValue::Standard,
+    size_t cbChunkSize=Archive::DefaultChunkSize
+);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            CreateFileDeserializingArchive
+///  \brief         Returns a deserializing `Archive` that reads the file in
+///                 chunks of `cbChunkSize` bytes. Use `CreateMemoryMappedArchive`
+///                 (in MemoryMappedFile.h) instead for data saved with
+///                 `Archive::LayoutValue::Flat` that should be used in place.
+///
+Archive CreateFileDeserializingArchive(std::string const &filename, size_t cbChunkSize=Archive::DefaultChunkSize);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+namespace Details {
+
+inline std::shared_ptr<std::FILE> OpenFile(std::string const &filename, char const *mode) {
+#if (defined _MSC_VER)
+    std::FILE *                             pFile(nullptr);
+
+    if(fopen_s(&pFile, filename.c_str(), mode) != 0)
+        pFile = nullptr;
+#else
+    std::FILE * const                       pFile(std::fopen(filename.c_str(), mode));
+#endif
+
+    if(pFile == nullptr)
+        throw std::runtime_error("The file '" + filename + "' could not be opened");
+
+    std::shared_ptr<std::FILE>              result(pFile, [](std::FILE *p) { std::fclose(p); });
+
+    // The archive buffers the data in chunks, so there is no need for the
+    // runtime to buffer it as well. Unbuffered writes also ensure that errors
+    // are reported by the write itself rather than when the file is closed.
+    std::setvbuf(result.get(), nullptr, _IONBF, 0);
+
+    return result;
+}
+
+inline void ReplaceFile(std::string const &source, std::string const &dest) {
+#if (defined _WIN32)
+    // `std::rename` fails on Windows when the destination exists
+    bool const                              succeeded(MoveFileExA(source.c_str(), dest.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != FALSE);
+#else
+    bool const                              succeeded(std::rename(source.c_str(), dest.c_str()) == 0);
+#endif
+
+    if(succeeded == false)
+        throw std::runtime_error("The file '" + dest + "' could not be replaced");
+}
+
+} // namespace Details
+
+inline Archive CreateFileSerializingArchive(std::string const &filename, Archive::LayoutValue layout, size_t cbChunkSize) {
+    std::shared_ptr<std::FILE>              pFile(Details::OpenFile(filename, "wb"));
+
+    return Archive(
+        Archive::SinkFunc(
+            [pFile, filename](unsigned char const *pBuffer, size_t cbBuffer) {
+                if(std::fwrite(pBuffer, 1, cbBuffer, pFile.get()) != cbBuffer)
+                    throw std::runtime_error("The file '" + filename + "' could not be written");
+            }
+        ),
+        cbChunkSize,
+        layout
+    );
+}
+
+template <typename FuncT>
+void SerializeToFile(std::string const &filename, FuncT const &func, Archive::LayoutValue layout, size_t cbChunkSize) {
+    std::string const                       tempFilename(filename + ".tmp");
+    std::shared_ptr<std::FILE>              pFile(Details::OpenFile(tempFilename, "wb"));
+
+    try {
+        {
+            Archive                         archive(
+                Archive::SinkFunc(
+                    [pFile, &filename](unsigned char const *pBuffer, size_t cbBuffer) {
+                        if(std::fwrite(pBuffer, 1, cbBuffer, pFile.get()) != cbBuffer)
+                            throw std::runtime_error("The file '" + filename + "' could not be written");
+                    }
+                ),
+                cbChunkSize,
+                layout
+            );
+
+            func(archive);
+            archive.commit();
+        }
+
+        // The file is closed once the archive (and its copy of the file) has been
+        // destroyed; it must be closed before it can be renamed on Windows.
+        pFile.reset();
+
+        Details::ReplaceFile(tempFilename, filename);
+    }
+    catch(...) {
+        pFile.reset();
+        std::remove(tempFilename.c_str());
+
+        throw;
+    }
+}
+
+inline Archive CreateFileDeserializingArchive(std::string const &filename, size_t cbChunkSize) {
+    std::shared_ptr<std::FILE>              pFile(Details::OpenFile(filename, "rb"));
+
+    return Archive(
+        Archive::SourceFunc(
+            [pFile, filename](unsigned char *pBuffer, size_t cbBuffer) {
+                size_t const                cbRead(std::fread(pBuffer, 1, cbBuffer, pFile.get()));
+
+                if(cbRead == 0 && std::ferror(pFile.get()))
+                    throw std::runtime_error("The file '" + filename + "' could not be read");
+
+                return cbRead;
+            }
+        ),
+        cbChunkSize
+    );
+}
+
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,635 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "Archive.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft {
+namespace Featurizer {
+
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        FlatIndexMapKeyTraits
+///  \brief         Converts keys to and from the bytes stored within a
+///                 `FlatIndexMap`. Keys that compare as equal (according to
+///                 `Traits<T>::key_equal`) must produce the same bytes, and
+///                 arithmetic keys are stored in little endian order so that
+///                 the bytes (and their hashes) don't depend on the host.
+///
+template <typename T, bool IsArithmeticV=std::is_arithmetic<T>::value>
+struct FlatIndexMapKeyTraits;
+
+template <typename T>
+struct FlatIndexMapKeyTraits<T, true> {
+    using StorageType                       = T;
+
+    static unsigned char const * GetBytes(T const &key, StorageType &storage, size_t &cBytes) {
+        storage = ToLittleEndian(Normalize(key, std::is_floating_point<T>()), std::integral_constant<bool, ISLITTLEENDIAN>());
+        cBytes = sizeof(T);
+
+        return reinterpret_cast<unsigned char const *>(&storage);
+    }
+
+    static T FromBytes(unsigned char const *pBytes, size_t cBytes) {
+        if(cBytes != sizeof(T))
+            throw std::runtime_error("Invalid key");
+
+        T                                   result;
+
+        std::memcpy(&result, pBytes, sizeof(T));
+        return ToLittleEndian(result, std::integral_constant<bool, ISLITTLEENDIAN>());
+    }
+
+private:
+    static T ToLittleEndian(T const &value, std::true_type) {
+        return value;
+    }
+
+    static T ToLittleEndian(T const &value, std::false_type) {
+        return swap_endian<T>(value);
+    }
+
+    static T Normalize(T const &key, std::false_type) {
+        return key;
+    }
+
+    static T Normalize(T const &key, std::true_type) {
+        // All NaNs are considered to be the same key, as are 0.0 and -0.0
+        if(std::isnan(key))
+            return std::numeric_limits<T>::quiet_NaN();
+
+        if(std::fpclassify(key) == FP_ZERO)
+            return static_cast<T>(0);
+
+        return key;
+    }
+};
+
+template <>
+struct FlatIndexMapKeyTraits<std::string, false> {
+    using StorageType                       = std::nullptr_t;
+
+    static unsigned char const * GetBytes(std::string const &key, StorageType &, size_t &cBytes) {
+        cBytes = key.size();
+        return reinterpret_cast<unsigned char const *>(key.data());
+    }
+
+    static std::string FromBytes(unsigned char const *pBytes, size_t cBytes) {
+        return std::string(reinterpret_cast<char const *>(pBytes), cBytes);
+    }
+};
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         FlatIndexMap
+///  \brief         Read-only map of keys to `std::uint32_t` values that is
+///                 stored in a single, position-independent buffer.
+///
+///                 Lookups are performed directly against the buffer, which
+///                 means that a map can be used in place when it is part of
+///                 a memory-mapped file; loading it doesn't require any
+///                 allocations and the pages are shared by all processes
+///                 that map the same file.
+///
+///                 Buffer layout (little endian):
+///
+///                     Header:     Signature (4), Version (4), NumItems (8),
+///                                 NumSlots (8), KeysSize (8)
+///                     Slots:      NumSlots * [Tag (4), Value (4), KeyOffset (8)]
+///                     Keys:       NumItems * [Size (4), Bytes (Size)]
+///
+///                 Slots are an open-addressing hash table (with linear probing)
+///                 where the number of slots is a power of 2; empty slots have
+///                 a KeyOffset of `EmptyKeyOffset`. Fields are read with `memcpy`,
+///                 so the buffer doesn't need to be aligned; they are byte swapped
+///                 on big endian hosts (see `ISLITTLEENDIAN`), where lookups are
+///                 therefore slightly more expensive.
+///
+template <typename KeyT>
+class FlatIndexMap {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using ByteArray                         = std::vector<unsigned char>;
+    using BufferOwnerPtr                    = std::shared_ptr<void const>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Create
+    ///  \brief         Returns the flat representation of the provided map.
+    ///
+    template <typename MapT>
+    static ByteArray Create(MapT const &map);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            FlatIndexMap
+    ///  \brief         Creates an empty map.
+    ///
+    FlatIndexMap(void);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            FlatIndexMap
+    ///  \brief         Creates a map that owns the flat data.
+    ///
+    FlatIndexMap(ByteArray data);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            FlatIndexMap
+    ///  \brief         Creates a map that references the flat data in place;
+    ///                 `pBufferOwner` (if provided) is retained for the lifetime
+    ///                 of the map (and its copies) to keep the buffer alive.
+    ///
+    FlatIndexMap(unsigned char const *pBuffer, size_t cbBuffer, BufferOwnerPtr pBufferOwner);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            FlatIndexMap
+    ///  \brief         Reads a map written by `save`. The map references the
+    ///                 archive's buffer in place when the archive is able to
+    ///                 keep that buffer alive; it is copied otherwise.
+    ///
+    FlatIndexMap(Archive &ar);
+
+    ~FlatIndexMap(void) = default;
+
+    FlatIndexMap(FlatIndexMap const &) = default;
+    FlatIndexMap & operator =(FlatIndexMap const &) = default;
+    FlatIndexMap(FlatIndexMap &&) = default;
+    FlatIndexMap & operator =(FlatIndexMap &&) = default;
+
+    void save(Archive &ar) const;
+
+    bool empty(void) const;
+    size_t size(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            find
+    ///  \brief         Returns true and populates `value` if the key exists
+    ///                 within the map.
+    ///
+    bool find(KeyT const &key, std::uint32_t &value) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            find
+    ///  \brief         Returns true and populates `value` if a key with the
+    ///                 provided bytes exists within the map; this avoids the
+    ///                 creation of temporary keys (for example, when looking
+    ///                 up substrings).
+    ///
+    bool find(unsigned char const *pKey, size_t cKey, std::uint32_t &value) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            enumerate
+    ///  \brief         Invokes `func(KeyT, std::uint32_t)` for each item within
+    ///                 the map (in an unspecified order).
+    ///
+    template <typename FuncT>
+    void enumerate(FuncT const &func) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            ToMap
+    ///  \brief         Returns the contents of the map as an owning container.
+    ///
+    template <typename MapT>
+    MapT ToMap(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Equals
+    ///  \brief         Returns true if the map contains the same items as the
+    ///                 provided owning container.
+    ///
+    template <typename MapT>
+    bool Equals(MapT const &map) const;
+
+    bool operator==(FlatIndexMap const &other) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using KeyTraits                         = Details::FlatIndexMapKeyTraits<KeyT>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::uint32_t const    Signature = 0x50414d46; // 'FMAP'
+    static constexpr std::uint32_t const    Version = 1;
+
+    static constexpr size_t const           HeaderSize = 32;
+    static constexpr size_t const           SlotSize = 16;
+    static constexpr std::uint64_t const    EmptyKeyOffset = std::numeric_limits<std::uint64_t>::max();
+
+    BufferOwnerPtr                          _pBufferOwner;
+    unsigned char const *                   _pBuffer;
+    size_t                                  _cbBuffer;
+
+    std::uint64_t                           _numItems;
+    std::uint64_t                           _numSlots;
+    std::uint64_t                           _keysSize;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    static std::uint64_t Hash(unsigned char const *pKey, size_t cKey);
+
+    template <typename T>
+    static T Read(unsigned char const *ptr);
+
+    template <typename T>
+    static unsigned char * Write(unsigned char *ptr, T value);
+
+    template <typename T>
+    static T ToLittleEndian(T value, std::true_type);
+
+    template <typename T>
+    static T ToLittleEndian(T value, std::false_type);
+
+    FlatIndexMap(std::shared_ptr<ByteArray> pData);
+
+    void Initialize(void);
+
+    unsigned char const * GetSlot(std::uint64_t slotIndex) const;
+    unsigned char const * GetKey(std::uint64_t keyOffset, size_t &cKey) const;
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename KeyT>
+template <typename MapT>
+/*static*/ typename FlatIndexMap<KeyT>::ByteArray FlatIndexMap<KeyT>::Create(MapT const &map) {
+    // Use a load factor of at most 0.75 (which ensures that there is always an empty slot)
+    std::uint64_t const                     numItems(map.size());
+    std::uint64_t                           numSlots(1);
+
+    while(numSlots * 3 < numItems * 4)
+        numSlots *= 2;
+
+    std::uint64_t                           keysSize(0);
+
+    for(auto const &kvp : map) {
+        typename KeyTraits::StorageType     storage;
+        size_t                              cKey;
+
+        KeyTraits::GetBytes(kvp.first, storage, cKey);
+
+        if(cKey > std::numeric_limits<std::uint32_t>::max())
+            throw std::invalid_argument("map");
+
+        keysSize += sizeof(std::uint32_t) + cKey;
+    }
+
+    ByteArray                               result(static_cast<size_t>(HeaderSize + numSlots * SlotSize + keysSize));
+    unsigned char *                         pHeader(result.data());
+
+    pHeader = Write(pHeader, Signature);
+    pHeader = Write(pHeader, Version);
+    pHeader = Write(pHeader, numItems);
+    pHeader = Write(pHeader, numSlots);
+    Write(pHeader, keysSize);
+
+    unsigned char * const                   pSlots(result.data() + HeaderSize);
+    unsigned char * const                   pKeys(pSlots + numSlots * SlotSize);
+
+    for(std::uint64_t slotIndex = 0; slotIndex < numSlots; ++slotIndex)
+        Write(pSlots + slotIndex * SlotSize + sizeof(std::uint32_t) * 2, EmptyKeyOffset);
+
+    std::uint64_t const                     mask(numSlots - 1);
+    std::uint64_t                           keyOffset(0);
+
+    for(auto const &kvp : map) {
+        typename KeyTraits::StorageType     storage;
+        size_t                              cKey;
+        unsigned char const * const         pKey(KeyTraits::GetBytes(kvp.first, storage, cKey));
+        std::uint64_t const                 hash(Hash(pKey, cKey));
+        std::uint64_t                       slotIndex(hash & mask);
+
+        while(Read<std::uint64_t>(pSlots + slotIndex * SlotSize + sizeof(std::uint32_t) * 2) != EmptyKeyOffset)
+            slotIndex = (slotIndex + 1) & mask;
+
+        unsigned char *                     pSlot(pSlots + slotIndex * SlotSize);
+
+        pSlot = Write(pSlot, static_cast<std::uint32_t>(hash >> 32));
+        pSlot = Write(pSlot, static_cast<std::uint32_t>(kvp.second));
+        Write(pSlot, keyOffset);
+
+        unsigned char * const               pKeyDest(Write(pKeys + keyOffset, static_cast<std::uint32_t>(cKey)));
+
+        if(cKey != 0)
+            std::memcpy(pKeyDest, pKey, cKey);
+
+        keyOffset += sizeof(std::uint32_t) + cKey;
+    }
+
+    return result;
+}
+
+template <typename KeyT>
+FlatIndexMap<KeyT>::FlatIndexMap(void) :
+    FlatIndexMap(std::make_shared<ByteArray>(Create(std::unordered_map<KeyT, std::uint32_t>()))) {
+}
+
+template <typename KeyT>
+FlatIndexMap<KeyT>::FlatIndexMap(ByteArray data) :
+    FlatIndexMap(std::make_shared<ByteArray>(std::move(data))) {
+}
+
+template <typename KeyT>
+FlatIndexMap<KeyT>::FlatIndexMap(unsigned char const *pBuffer, size_t cbBuffer, BufferOwnerPtr pBufferOwner) :
+    _pBufferOwner(std::move(pBufferOwner)),
+    _pBuffer(pBuffer),
+    _cbBuffer(cbBuffer) {
+    if(_pBuffer == nullptr) throw std::invalid_argument("pBuffer");
+
+    Initialize();
+}
+
+template <typename KeyT>
+FlatIndexMap<KeyT>::FlatIndexMap(Archive &ar) :
+    FlatIndexMap(
+        [&ar](void) {
+            std::uint64_t const             cbBuffer(Traits<std::uint64_t>::deserialize(ar));
+            unsigned char const * const     pBuffer(ar.get_buffer_ptr(static_cast<size_t>(cbBuffer)));
+
+            ar.update_buffer_ptr(static_cast<size_t>(cbBuffer));
+
+            Archive::BufferOwnerPtr const & pBufferOwner(ar.get_buffer_owner());
+
+            if(pBufferOwner)
+                return FlatIndexMap(pBuffer, static_cast<size_t>(cbBuffer), pBufferOwner);
+
+            return FlatIndexMap(ByteArray(pBuffer, pBuffer + cbBuffer));
+        }()
+    ) {
+}
+
+template <typename KeyT>
+FlatIndexMap<KeyT>::FlatIndexMap(std::shared_ptr<ByteArray> pData) :
+    _pBufferOwner(pData),
+    _pBuffer(pData->data()),
+    _cbBuffer(pData->size()) {
+    Initialize();
+}
+
+template <typename KeyT>
+void FlatIndexMap<KeyT>::save(Archive &ar) const {
+    Traits<std::uint64_t>::serialize(ar, static_cast<std::uint64_t>(_cbBuffer));
+    ar.serialize(_pBuffer, _cbBuffer);
+}
+
+template <typename KeyT>
+bool FlatIndexMap<KeyT>::empty(void) const {
+    return _numItems == 0;
+}
+
+template <typename KeyT>
+size_t FlatIndexMap<KeyT>::size(void) const {
+    return static_cast<size_t>(_numItems);
+}
+
+template <typename KeyT>
+bool FlatIndexMap<KeyT>::find(KeyT const &key, std::uint32_t &value) const {
+    typename KeyTraits::StorageType         storage;
+    size_t                                  cKey;
+    unsigned char const * const             pKey(KeyTraits::GetBytes(key, storage, cKey));
+
+    return find(pKey, cKey, value);
+}
+
+template <typename KeyT>
+bool FlatIndexMap<KeyT>::find(unsigned char const *pKey, size_t cKey, std::uint32_t &value) const {
+    std::uint64_t const                     hash(Hash(pKey, cKey));
+    std::uint32_t const                     tag(static_cast<std::uint32_t>(hash >> 32));
+    std::uint64_t const                     mask(_numSlots - 1);
+    std::uint64_t                           slotIndex(hash & mask);
+
+    // Bound the number of probes so that corrupt data can't result in an infinite loop
+    for(std::uint64_t probe = 0; probe < _numSlots; ++probe) {
+        unsigned char const * const         pSlot(GetSlot(slotIndex));
+        std::uint64_t const                 keyOffset(Read<std::uint64_t>(pSlot + sizeof(std::uint32_t) * 2));
+
+        if(keyOffset == EmptyKeyOffset)
+            return false;
+
+        if(Read<std::uint32_t>(pSlot) == tag) {
+            size_t                          cSlotKey;
+            unsigned char const * const     pSlotKey(GetKey(keyOffset, cSlotKey));
+
+            if(cSlotKey == cKey && (cKey == 0 || std::memcmp(pSlotKey, pKey, cKey) == 0)) {
+                value = Read<std::uint32_t>(pSlot + sizeof(std::uint32_t));
+                return true;
+            }
+        }
+
+        slotIndex = (slotIndex + 1) & mask;
+    }
+
+    return false;
+}
+
+template <typename KeyT>
+template <typename FuncT>
+void FlatIndexMap<KeyT>::enumerate(FuncT const &func) const {
+    for(std::uint64_t slotIndex = 0; slotIndex < _numSlots; ++slotIndex) {
+        unsigned char const * const         pSlot(GetSlot(slotIndex));
+        std::uint64_t const                 keyOffset(Read<std::uint64_t>(pSlot + sizeof(std::uint32_t) * 2));
+
+        if(keyOffset == EmptyKeyOffset)
+            continue;
+
+        size_t                              cKey;
+        unsigned char const * const         pKey(GetKey(keyOffset, cKey));
+
+        func(KeyTraits::FromBytes(pKey, cKey), Read<std::uint32_t>(pSlot + sizeof(std::uint32_t)));
+    }
+}
+
+template <typename KeyT>
+template <typename MapT>
+MapT FlatIndexMap<KeyT>::ToMap(void) const {
+    MapT                                    result;
+
+    result.reserve(size());
+
+    enumerate(
+        [&result](KeyT key, std::uint32_t value) {
+            result.emplace(std::move(key), value);
+        }
+    );
+
+    return result;
+}
+
+template <typename KeyT>
+template <typename MapT>
+bool FlatIndexMap<KeyT>::Equals(MapT const &map) const {
+    if(map.size() != size())
+        return false;
+
+    for(auto const &kvp : map) {
+        std::uint32_t                       value;
+
+        if(find(kvp.first, value) == false || value != kvp.second)
+            return false;
+    }
+
+    return true;
+}
+
+template <typename KeyT>
+bool FlatIndexMap<KeyT>::operator==(FlatIndexMap const &other) const {
+    if(other.size() != size())
+        return false;
+
+    bool                                    result(true);
+
+    enumerate(
+        [&other, &result](KeyT const &key, std::uint32_t value) {
+            std::uint32_t                   otherValue;
+
+            if(result && (other.find(key, otherValue) == false || otherValue != value))
+                result = false;
+        }
+    );
+
+    return result;
+}
+
+template <typename KeyT>
+/*static*/ std::uint64_t FlatIndexMap<KeyT>::Hash(unsigned char const *pKey, size_t cKey) {
+    // FNV-1a; the hash is part of the persisted format, so it can't depend on `std::hash`
+    std::uint64_t                           result(14695981039346656037ULL);
+    unsigned char const * const             pEndKey(pKey + cKey);
+
+    while(pKey != pEndKey) {
+        result ^= *pKey++;
+        result *= 1099511628211ULL;
+    }
+
+    return result;
+}
+
+template <typename KeyT>
+template <typename T>
+/*static*/ T FlatIndexMap<KeyT>::Read(unsigned char const *ptr) {
+    T                                       result;
+
+    std::memcpy(&result, ptr, sizeof(T));
+    return ToLittleEndian(result, std::integral_constant<bool, ISLITTLEENDIAN>());
+}
+
+template <typename KeyT>
+template <typename T>
+/*static*/ unsigned char * FlatIndexMap<KeyT>::Write(unsigned char *ptr, T value) {
+    value = ToLittleEndian(value, std::integral_constant<bool, ISLITTLEENDIAN>());
+
+    std::memcpy(ptr, &value, sizeof(T));
+    return ptr + sizeof(T);
+}
+
+template <typename KeyT>
+template <typename T>
+/*static*/ T FlatIndexMap<KeyT>::ToLittleEndian(T value, std::true_type) {
+    return value;
+}
+
+template <typename KeyT>
+template <typename T>
+/*static*/ T FlatIndexMap<KeyT>::ToLittleEndian(T value, std::false_type) {
+    return swap_endian<T>(value);
+}
+
+template <typename KeyT>
+void FlatIndexMap<KeyT>::Initialize(void) {
+    if(_cbBuffer < HeaderSize)
+        throw std::runtime_error("Invalid flat index map");
+
+    if(Read<std::uint32_t>(_pBuffer) != Signature || Read<std::uint32_t>(_pBuffer + 4) != Version)
+        throw std::runtime_error("Unsupported flat index map");
+
+    _numItems = Read<std::uint64_t>(_pBuffer + 8);
+    _numSlots = Read<std::uint64_t>(_pBuffer + 16);
+    _keysSize = Read<std::uint64_t>(_pBuffer + 24);
+
+    if(
+        _numSlots == 0
+        || (_numSlots & (_numSlots - 1)) != 0
+        || _numItems >= _numSlots
+        || _numSlots > (_cbBuffer - HeaderSize) / SlotSize
+        || _keysSize != _cbBuffer - HeaderSize - _numSlots * SlotSize
+    )
+        throw std::runtime_error("Invalid flat index map");
+}
+
+template <typename KeyT>
+unsigned char const * FlatIndexMap<KeyT>::GetSlot(std::uint64_t slotIndex) const {
+    return _pBuffer + HeaderSize + slotIndex * SlotSize;
+}
+
+template <typename KeyT>
+unsigned char const * FlatIndexMap<KeyT>::GetKey(std::uint64_t keyOffset, size_t &cKey) const {
+    if(keyOffset > _keysSize || _keysSize - keyOffset < sizeof(std::uint32_t))
+        throw std::runtime_error("Invalid flat index map");
+
+    unsigned char const * const             pKey(_pBuffer + HeaderSize + _numSlots * SlotSize + keyOffset);
+    std::uint32_t const                     cBytes(Read<std::uint32_t>(pKey));
+
+    if(_keysSize - keyOffset - sizeof(std::uint32_t) < cBytes)
+        throw std::runtime_error("Invalid flat index map");
+
+    cKey = cBytes;
+    return pKey + sizeof(std::uint32_t);
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            IndexMapsAreEqual
+///  \brief         Compares lookup tables held by objects that store either an
+///                 owning map or (when `pFlat` is not null) a `FlatIndexMap`.
+///
+template <typename KeyT, typename MapT>
+bool IndexMapsAreEqual(MapT const &map1, FlatIndexMap<KeyT> const *pFlat1, MapT const &map2, FlatIndexMap<KeyT> const *pFlat2) {
+    if(pFlat1 && pFlat2)
+        return *pFlat1 == *pFlat2;
+
+    if(pFlat1)
+        return pFlat1->Equals(map2);
+
+    if(pFlat2)
+        return pFlat2->Equals(map1);
+
+    return map1 == map2;
+}
+
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Microsoft {
+namespace Featurizer {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         FunctionRef
+///  \brief         Non-owning, non-allocating reference to a callable object.
+///
+///                 Unlike `std::function`, a `FunctionRef` never copies the
+///                 callable that it refers to; it stores a pointer to the object
+///                 and a pointer to a function that knows how to invoke it. As a
+///                 result, it is cheap to create and pass by value, but it must
+///                 not outlive the callable that it was created from. It is
+///                 intended to be used as a parameter type for callbacks that are
+///                 invoked before the function that receives them returns.
+///
+template <typename FunctionT>
+class FunctionRef;
+
+template <typename ReturnT, typename... ArgTs>
+class FunctionRef<ReturnT (ArgTs...)> {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    FunctionRef(void) :
+        _pInvoke(nullptr) {
+        _storage.pObject = nullptr;
+    }
+
+    FunctionRef(std::nullptr_t) :
+        FunctionRef() {
+    }
+
+    template <
+        typename CallableT,
+        typename std::enable_if<
+            std::is_same<typename std::decay<CallableT>::type, FunctionRef>::value == false
+            && std::is_function<typename std::remove_reference<CallableT>::type>::value == false
+        >::type * = nullptr
+    >
+    FunctionRef(CallableT &&callable) :
+        _pInvoke(&InvokeObject<typename std::remove_reference<CallableT>::type>) {
+        _storage.pObject = const_cast<void *>(static_cast<void const *>(std::addressof(callable)));
+    }
+
+    template <
+        typename CallableT,
+        typename std::enable_if<std::is_function<CallableT>::value>::type * = nullptr
+    >
+    FunctionRef(CallableT &callable) :
+        _pInvoke(&InvokeFunction<CallableT>) {
+        _storage.pFunction = reinterpret_cast<void (*)(void)>(&callable);
+    }
+
+    FunctionRef(FunctionRef const &) = default;
+    FunctionRef & operator =(FunctionRef const &) = default;
+
+    ReturnT operator()(ArgTs... args) const {
+        return _pInvoke(_storage, std::forward<ArgTs>(args)...);
+    }
+
+    explicit operator bool(void) const {
+        return _pInvoke != nullptr;
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    union Storage {
+        void *                              pObject;
+        void (*pFunction)(void);
+    };
+
+    using InvokeFunc                        = ReturnT (*)(Storage const &, ArgTs &&...);
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    Storage                                 _storage;
+    InvokeFunc                              _pInvoke;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    template <typename CallableT>
+    static ReturnT InvokeObject(Storage const &storage, ArgTs &&... args) {
+        return (*static_cast<CallableT *>(storage.pObject))(std::forward<ArgTs>(args)...);
+    }
+
+    template <typename CallableT>
+    static ReturnT InvokeFunction(Storage const &storage, ArgTs &&... args) {
+        return (*reinterpret_cast<CallableT *>(storage.pFunction))(std::forward<ArgTs>(args)...);
+    }
+};
+
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "Archive.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#if (defined _WIN32)
+#   if (!defined NOMINMAX)
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace Microsoft {
+namespace Featurizer {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         MemoryMappedFile
+///  \brief         Maps the contents of a file into memory as read-only data.
+///
+///                 The pages are shared with all other processes that map the
+///                 same file and are only loaded when they are accessed.
+///
+class MemoryMappedFile {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    MemoryMappedFile(std::string const &filename);
+    ~MemoryMappedFile(void);
+
+    MemoryMappedFile(MemoryMappedFile const &) = delete;
+    MemoryMappedFile & operator =(MemoryMappedFile const &) = delete;
+    MemoryMappedFile(MemoryMappedFile &&) = delete;
+    MemoryMappedFile & operator =(MemoryMappedFile &&) = delete;
+
+    unsigned char const * data(void) const;
+    size_t size(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    unsigned char const *                   _pData;
+    size_t                                  _cbData;
+
+#if (defined _WIN32)
+    HANDLE                                  _hMapping;
+#endif
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            CreateMemoryMappedArchive
+///  \brief         Returns a deserializing `Archive` that reads the contents of
+///                 the file in place; objects that support it (for example,
+///                 transformers saved with `Archive::LayoutValue::Flat`) will
+///                 reference the mapped data directly and keep the mapping
+///                 alive for as long as they need it.
+///
+Archive CreateMemoryMappedArchive(std::string const &filename);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+#if (defined _WIN32)
+
+inline MemoryMappedFile::MemoryMappedFile(std::string const &filename) :
+    _pData(nullptr),
+    _cbData(0),
+    _hMapping(nullptr) {
+    HANDLE const                            hFile(CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+
+    if(hFile == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("The file '" + filename + "' could not be opened");
+
+    LARGE_INTEGER                           fileSize;
+
+    if(GetFileSizeEx(hFile, &fileSize) == FALSE) {
+        CloseHandle(hFile);
+        throw std::runtime_error("The size of the file '" + filename + "' could not be determined");
+    }
+
+    _cbData = static_cast<size_t>(fileSize.QuadPart);
+
+    // Empty files can't be mapped
+    if(_cbData != 0) {
+        _hMapping = CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if(_hMapping != nullptr) {
+            _pData = static_cast<unsigned char const *>(MapViewOfFile(_hMapping, FILE_MAP_READ, 0, 0, 0));
+
+            if(_pData == nullptr) {
+                CloseHandle(_hMapping);
+                _hMapping = nullptr;
+            }
+        }
+    }
+
+    // The mapping remains valid after the file is closed
+    CloseHandle(hFile);
+
+    if(_cbData != 0 && _pData == nullptr)
+        throw std::runtime_error("The file '" + filename + "' could not be mapped");
+}
+
+inline MemoryMappedFile::~MemoryMappedFile(void) {
+    if(_pData)
+        UnmapViewOfFile(_pData);
+
+    if(_hMapping)
+        CloseHandle(_hMapping);
+}
+
+#else
+
+inline MemoryMappedFile::MemoryMappedFile(std::string const &filename) :
+    _pData(nullptr),
+    _cbData(0) {
+    int const                               fd(open(filename.c_str(), O_RDONLY));
+
+    if(fd == -1)
+        throw std::runtime_error("The file '" + filename + "' could not be opened");
+
+    struct stat                             fileInfo;
+
+    if(fstat(fd, &fileInfo) != 0) {
+        close(fd);
+        throw std::runtime_error("The size of the file '" + filename + "' could not be determined");
+    }
+
+    _cbData = static_cast<size_t>(fileInfo.st_size);
+
+    // Empty files can't be mapped
+    if(_cbData != 0) {
+        void * const                        pData(mmap(nullptr, _cbData, PROT_READ, MAP_SHARED, fd, 0));
+
+        if(pData != MAP_FAILED)
+            _pData = static_cast<unsigned char const *>(pData);
+    }
+
+    // The mapping remains valid after the file is closed
+    close(fd);
+
+    if(_cbData != 0 && _pData == nullptr)
+        throw std::runtime_error("The file '" + filename + "' could not be mapped");
+}
+
+inline MemoryMappedFile::~MemoryMappedFile(void) {
+    if(_pData)
+        munmap(const_cast<unsigned char *>(_pData), _cbData);
+}
+
+#endif
+
+inline unsigned char const * MemoryMappedFile::data(void) const {
+    return _pData;
+}
+
+inline size_t MemoryMappedFile::size(void) const {
+    return _cbData;
+}
+
+inline Archive CreateMemoryMappedArchive(std::string const &filename) {
+    std::shared_ptr<MemoryMappedFile>       pFile(std::make_shared<MemoryMappedFile>(filename));
+
+    if(pFile->size() == 0)
+        throw std::runtime_error("The file '" + filename + "' is empty");
+
+    return Archive(pFile->data(), pFile->size(), pFile);
+}
+
+} // namespace Featurizer
+} // namespace Microsoft
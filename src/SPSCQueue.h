@@ -0,0 +1,256 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace Microsoft {
+namespace Featurizer {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SPSCQueue
+///  \brief         Bounded, lock-free queue that supports exactly one thread
+///                 pushing items and exactly one (potentially different) thread
+///                 popping items.
+///
+///                 `push` and `pop` briefly retry while the queue is full or
+///                 empty and then block until the other thread makes progress;
+///                 use `try_push` and `try_pop` to avoid waiting. A lock is only
+///                 acquired when a thread blocks (or must be woken).
+///
+template <typename T>
+class SPSCQueue {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    SPSCQueue(size_t capacity);
+    ~SPSCQueue(void) = default;
+
+    SPSCQueue(SPSCQueue const &) = delete;
+    SPSCQueue & operator =(SPSCQueue const &) = delete;
+    SPSCQueue(SPSCQueue &&) = delete;
+    SPSCQueue & operator =(SPSCQueue &&) = delete;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            capacity
+    ///  \brief         Returns the maximum number of items that can be in the
+    ///                 queue at the same time.
+    ///
+    size_t capacity(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            try_push
+    ///  \brief         Moves the value into the queue and returns true, or returns
+    ///                 false (leaving the value unmodified) if the queue is full.
+    ///                 Must only be invoked on the producer thread.
+    ///
+    bool try_push(T &value);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            try_pop
+    ///  \brief         Moves the oldest value in the queue into `value` and returns
+    ///                 true, or returns false if the queue is empty. Must only be
+    ///                 invoked on the consumer thread.
+    ///
+    bool try_pop(T &value);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            push
+    ///  \brief         Moves the value into the queue, waiting until there is
+    ///                 space available.
+    ///
+    void push(T value);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            pop
+    ///  \brief         Returns the oldest value in the queue, waiting until a
+    ///                 value is available.
+    ///
+    T pop(void);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+
+    // One slot is always empty so that a full queue can be distinguished from
+    // an empty queue.
+    std::vector<T>                          _items;
+
+    // `_head` is only written by the consumer and `_tail` is only written by
+    // the producer.
+    std::atomic<size_t>                     _head;
+    std::atomic<size_t>                     _tail;
+
+    // Used when a thread blocks because the queue is full or empty
+    std::mutex                              _mutex;
+    std::condition_variable                 _changed;
+    std::atomic<size_t>                     _cWaiting;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    bool try_push_impl(T &value);
+    bool try_pop_impl(T &value);
+
+    template <typename TryFuncT>
+    void wait(TryFuncT const &tryFunc);
+
+    void notify_waiting(void);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename T>
+SPSCQueue<T>::SPSCQueue(size_t capacity) :
+    _items(
+        [&capacity](void) {
+            if(capacity == 0)
+                throw std::invalid_argument("capacity");
+
+            return capacity + 1;
+        }()
+    ),
+    _head(0),
+    _tail(0),
+    _cWaiting(0) {
+}
+
+template <typename T>
+size_t SPSCQueue<T>::capacity(void) const {
+    return _items.size() - 1;
+}
+
+template <typename T>
+bool SPSCQueue<T>::try_push(T &value) {
+    if(try_push_impl(value) == false)
+        return false;
+
+    notify_waiting();
+    return true;
+}
+
+template <typename T>
+bool SPSCQueue<T>::try_pop(T &value) {
+    if(try_pop_impl(value) == false)
+        return false;
+
+    notify_waiting();
+    return true;
+}
+
+template <typename T>
+void SPSCQueue<T>::push(T value) {
+    wait([this, &value](void) { return try_push_impl(value); });
+}
+
+template <typename T>
+T SPSCQueue<T>::pop(void) {
+    T                                       value;
+
+    wait([this, &value](void) { return try_pop_impl(value); });
+    return value;
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename T>
+bool SPSCQueue<T>::try_push_impl(T &value) {
+    size_t const                            tail(_tail.load(std::memory_order_relaxed));
+    size_t const                            nextTail(tail + 1 == _items.size() ? 0 : tail + 1);
+
+    if(nextTail == _head.load(std::memory_order_acquire))
+        return false;
+
+    _items[tail] = std::move(value);
+    _tail.store(nextTail, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T>
+bool SPSCQueue<T>::try_pop_impl(T &value) {
+    size_t const                            head(_head.load(std::memory_order_relaxed));
+
+    if(head == _tail.load(std::memory_order_acquire))
+        return false;
+
+    value = std::move(_items[head]);
+    _head.store(head + 1 == _items.size() ? 0 : head + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T>
+template <typename TryFuncT>
+void SPSCQueue<T>::wait(TryFuncT const &tryFunc) {
+    // The other thread is generally close behind, so retry briefly before blocking
+    static constexpr int const              NumSpins = 64;
+
+    bool                                    succeeded(false);
+
+    for(int spin = 0; spin < NumSpins && succeeded == false; ++spin) {
+        succeeded = tryFunc();
+
+        if(succeeded == false)
+            std::this_thread::yield();
+    }
+
+    if(succeeded == false) {
+        std::unique_lock<std::mutex>        lock(_mutex);
+
+        // Register as waiting before checking the queue again, so that the other thread
+        // either sees the registration or this thread sees the other thread's change
+        // (see `notify_waiting`).
+        ++_cWaiting;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        _changed.wait(lock, tryFunc);
+
+        --_cWaiting;
+    }
+
+    // This thread's change may unblock the other thread
+    notify_waiting();
+}
+
+template <typename T>
+void SPSCQueue<T>::notify_waiting(void) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if(_cWaiting.load(std::memory_order_relaxed) == 0)
+        return;
+
+    // Acquiring the lock ensures that a thread that has registered as waiting is
+    // blocked (rather than about to block) before it is notified.
+    {
+        std::lock_guard<std::mutex>         lock(_mutex);
+    }
+
+    _changed.notify_all();
+}
+
+} // namespace Featurizer
+} // namespace Microsoft
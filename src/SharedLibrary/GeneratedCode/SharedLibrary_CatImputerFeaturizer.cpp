@@ -6,13 +6,68 @@
 
 #include "SharedLibrary_CatImputerFeaturizer.h"
 #include "SharedLibrary_PointerTable.h"
+#include "../SharedLibrary_Arrow.h"
 
 #include "Archive.h"
+#include "FileArchive.h"
 #include "CatImputerFeaturizer.h"
 
 // These method(s) are defined in SharedLibrary_Common.cpp
 ErrorInfoHandle * CreateErrorInfo(std::exception const &ex);
 std::chrono::system_clock::time_point CreateDateTime(DateTimeParameter const &param);
+Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout);
+
+namespace {
+
+// Transforms the inputs with a single call to the transformer's batch
+// `execute` method and invokes `outputFunc` for each result.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::true_type /*is_default_constructible*/) {
+    std::unique_ptr<typename TransformerT::TransformedType []> pResults(new typename TransformerT::TransformedType[cInputs]);
+
+    transformer.execute(pInputs, cInputs, pResults.get());
+
+    for(std::size_t index = 0; index < cInputs; ++index)
+        outputFunc(pResults[index]);
+}
+
+// The batch `execute` method writes to constructed items; results that can't be
+// default constructed are transformed one at a time.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::false_type /*is_default_constructible*/) {
+    typename TransformerT::InputType const * const  pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs) {
+        typename TransformerT::TransformedType      result(transformer.execute(*pInputs));
+
+        outputFunc(result);
+        ++pInputs;
+    }
+}
+
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc, std::is_default_constructible<typename TransformerT::TransformedType>());
+}
+
+// Results are written directly to the caller's buffer when its type is the
+// transformed type; otherwise, each result is converted by `outputFunc`.
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &/*outputFunc*/, std::true_type /*is_transformed_type*/) {
+    transformer.execute(pInputs, cInputs, pOutputs);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT * /*pOutputs*/, OutputFuncT const &outputFunc, std::false_type /*is_transformed_type*/) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &outputFunc) {
+    TransformBatchToOutput(transformer, pInputs, cInputs, pOutputs, outputFunc, std::is_same<OutputT, typename TransformerT::TransformedType>());
+}
+
+} // anonymous namespace
 
 extern "C" {
 
@@ -188,6 +243,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_FitBuffer(/*in*/ CatImpute
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_FitArrow(/*in*/ CatImputerFeaturizer_int8_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int8_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_OnDataCompleted(/*in*/ CatImputerFeaturizer_int8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -284,6 +367,55 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_CreateTransformerFromSaved
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CatImputerFeaturizer_int8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CatImputerFeaturizer_int8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_CloneTransformer(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ CatImputerFeaturizer_int8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CatImputerFeaturizer_int8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_DestroyTransformer(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -309,6 +441,10 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_DestroyTransformer(/*in*/
 }
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CatImputerFeaturizer_int8_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_CreateTransformerSaveDataWithLayout(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -320,11 +456,12 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_CreateTransformerSaveData(
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -341,6 +478,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_CreateTransformerSaveData(
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_CreateTransformerSaveDataFile(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_Transform(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input, /*out*/ int8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -370,6 +535,100 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_Transform(/*in*/ CatImpute
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_TransformBatch(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::int8_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::int8_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int8_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int8_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_TransformArrow(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int8_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  CatImputerFeaturizer <int16> */
@@ -535,6 +794,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_FitBuffer(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_FitArrow(/*in*/ CatImputerFeaturizer_int16_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int16_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_OnDataCompleted(/*in*/ CatImputerFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -631,21 +918,22 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_CreateTransformerFromSave
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_DestroyTransformer(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CatImputerFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CatImputerFeaturizer_int16_TransformerHandle*>(index);
     
         return true;
     }
@@ -655,7 +943,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_DestroyTransformer(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_CloneTransformer(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ CatImputerFeaturizer_int16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -663,22 +951,13 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_CreateTransformerSaveData
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CatImputerFeaturizer_int16_TransformerHandle*>(index);
     
         return true;
     }
@@ -688,7 +967,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_CreateTransformerSaveData
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_Transform(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_DestroyTransformer(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -697,17 +976,12 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_Transform(/*in*/ CatImput
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int16_t>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -717,27 +991,35 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_Transform(/*in*/ CatImput
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  CatImputerFeaturizer <int32> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CreateEstimator(/*out*/ CatImputerFeaturizer_int32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CatImputerFeaturizer_int16_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_CreateTransformerSaveDataWithLayout(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<CatImputerFeaturizer_int32_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -747,7 +1029,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CreateEstimator(/*out*/ C
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_DestroyEstimator(/*in*/ CatImputerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_CreateTransformerSaveDataFile(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -755,8 +1037,189 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_DestroyEstimator(/*in*/ C
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_Transform(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int16_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_TransformBatch(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::int16_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::int16_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int16_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int16_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_TransformArrow(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int16_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  CatImputerFeaturizer <int32> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CreateEstimator(/*out*/ CatImputerFeaturizer_int32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<CatImputerFeaturizer_int32_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_DestroyEstimator(/*in*/ CatImputerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>>(index);
         g_pointerTable.Remove(index);
 
@@ -882,6 +1345,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_FitBuffer(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_FitArrow(/*in*/ CatImputerFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int32_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_OnDataCompleted(/*in*/ CatImputerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -978,21 +1469,22 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CreateTransformerFromSave
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_DestroyTransformer(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CatImputerFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CatImputerFeaturizer_int32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1002,7 +1494,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_DestroyTransformer(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CloneTransformer(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ CatImputerFeaturizer_int32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1010,22 +1502,13 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CreateTransformerSaveData
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
-
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CatImputerFeaturizer_int32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1035,7 +1518,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CreateTransformerSaveData
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_Transform(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_DestroyTransformer(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1044,17 +1527,12 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_Transform(/*in*/ CatImput
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int32_t>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -1064,27 +1542,35 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_Transform(/*in*/ CatImput
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  CatImputerFeaturizer <int64> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CreateEstimator(/*out*/ CatImputerFeaturizer_int64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CatImputerFeaturizer_int32_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CreateTransformerSaveDataWithLayout(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<CatImputerFeaturizer_int64_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -1094,7 +1580,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CreateEstimator(/*out*/ C
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_DestroyEstimator(/*in*/ CatImputerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_CreateTransformerSaveDataFile(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1102,12 +1588,17 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_DestroyEstimator(/*in*/ C
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -1117,7 +1608,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_DestroyEstimator(/*in*/ C
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_GetState(/*in*/ CatImputerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_Transform(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1125,11 +1616,18 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_GetState(/*in*/ CatImpute
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int32_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -1139,7 +1637,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_GetState(/*in*/ CatImpute
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_IsTrainingComplete(/*in*/ CatImputerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_TransformBatch(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1147,13 +1645,182 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_IsTrainingComplete(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
-    
-        return true;
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::int32_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::int32_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int32_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int32_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_TransformArrow(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int32_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  CatImputerFeaturizer <int64> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CreateEstimator(/*out*/ CatImputerFeaturizer_int64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<CatImputerFeaturizer_int64_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_DestroyEstimator(/*in*/ CatImputerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_GetState(/*in*/ CatImputerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_IsTrainingComplete(/*in*/ CatImputerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
     }
     catch(std::exception const &ex) {
         *ppErrorInfo = CreateErrorInfo(ex);
@@ -1229,6 +1896,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_FitBuffer(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_FitArrow(/*in*/ CatImputerFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int64_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_OnDataCompleted(/*in*/ CatImputerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1325,21 +2020,22 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CreateTransformerFromSave
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_DestroyTransformer(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CatImputerFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CatImputerFeaturizer_int64_TransformerHandle*>(index);
     
         return true;
     }
@@ -1349,7 +2045,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_DestroyTransformer(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CloneTransformer(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ CatImputerFeaturizer_int64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1357,22 +2053,13 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CreateTransformerSaveData
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CatImputerFeaturizer_int64_TransformerHandle*>(index);
     
         return true;
     }
@@ -1382,7 +2069,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CreateTransformerSaveData
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_Transform(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_DestroyTransformer(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1391,17 +2078,12 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_Transform(/*in*/ CatImput
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int64_t>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -1411,27 +2093,35 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_Transform(/*in*/ CatImput
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  CatImputerFeaturizer <uint8> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CreateEstimator(/*out*/ CatImputerFeaturizer_uint8_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CatImputerFeaturizer_int64_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CreateTransformerSaveDataWithLayout(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<CatImputerFeaturizer_uint8_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -1441,7 +2131,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CreateEstimator(/*out*/ C
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_DestroyEstimator(/*in*/ CatImputerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_CreateTransformerSaveDataFile(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1449,12 +2139,17 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_DestroyEstimator(/*in*/ C
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -1464,7 +2159,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_DestroyEstimator(/*in*/ C
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_GetState(/*in*/ CatImputerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_Transform(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1472,11 +2167,18 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_GetState(/*in*/ CatImpute
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int64_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -1486,7 +2188,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_GetState(/*in*/ CatImpute
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_IsTrainingComplete(/*in*/ CatImputerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_TransformBatch(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1494,12 +2196,181 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_IsTrainingComplete(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
-    
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::int64_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::int64_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int64_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int64_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_TransformArrow(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int64_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  CatImputerFeaturizer <uint8> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CreateEstimator(/*out*/ CatImputerFeaturizer_uint8_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<CatImputerFeaturizer_uint8_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_DestroyEstimator(/*in*/ CatImputerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_GetState(/*in*/ CatImputerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_IsTrainingComplete(/*in*/ CatImputerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
         return true;
     }
     catch(std::exception const &ex) {
@@ -1576,6 +2447,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_FitBuffer(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_FitArrow(/*in*/ CatImputerFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint8_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_OnDataCompleted(/*in*/ CatImputerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1672,21 +2571,22 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CreateTransformerFromSave
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_DestroyTransformer(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CatImputerFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CatImputerFeaturizer_uint8_TransformerHandle*>(index);
     
         return true;
     }
@@ -1696,7 +2596,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_DestroyTransformer(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CloneTransformer(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ CatImputerFeaturizer_uint8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1704,22 +2604,13 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CreateTransformerSaveData
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
-
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CatImputerFeaturizer_uint8_TransformerHandle*>(index);
     
         return true;
     }
@@ -1729,7 +2620,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CreateTransformerSaveData
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_Transform(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_DestroyTransformer(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1738,17 +2629,12 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_Transform(/*in*/ CatImput
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -1758,27 +2644,35 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_Transform(/*in*/ CatImput
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  CatImputerFeaturizer <uint16> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CreateEstimator(/*out*/ CatImputerFeaturizer_uint16_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CatImputerFeaturizer_uint8_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CreateTransformerSaveDataWithLayout(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<CatImputerFeaturizer_uint16_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -1788,7 +2682,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_DestroyEstimator(/*in*/ CatImputerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_CreateTransformerSaveDataFile(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1796,12 +2690,17 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_DestroyEstimator(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -1811,7 +2710,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_GetState(/*in*/ CatImputerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_Transform(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1819,11 +2718,18 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_GetState(/*in*/ CatImput
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -1833,7 +2739,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_GetState(/*in*/ CatImput
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_IsTrainingComplete(/*in*/ CatImputerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_TransformBatch(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1841,13 +2747,182 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_IsTrainingComplete(/*in*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
-    
-        return true;
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint8_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::uint8_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_TransformArrow(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint8_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  CatImputerFeaturizer <uint16> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CreateEstimator(/*out*/ CatImputerFeaturizer_uint16_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<CatImputerFeaturizer_uint16_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_DestroyEstimator(/*in*/ CatImputerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_GetState(/*in*/ CatImputerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_IsTrainingComplete(/*in*/ CatImputerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
     }
     catch(std::exception const &ex) {
         *ppErrorInfo = CreateErrorInfo(ex);
@@ -1923,6 +2998,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_FitBuffer(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_FitArrow(/*in*/ CatImputerFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint16_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_OnDataCompleted(/*in*/ CatImputerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2019,21 +3122,22 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CreateTransformerFromSav
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_DestroyTransformer(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CatImputerFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CatImputerFeaturizer_uint16_TransformerHandle*>(index);
     
         return true;
     }
@@ -2043,7 +3147,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_DestroyTransformer(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CloneTransformer(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ CatImputerFeaturizer_uint16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2051,22 +3155,13 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CreateTransformerSaveDat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CatImputerFeaturizer_uint16_TransformerHandle*>(index);
     
         return true;
     }
@@ -2076,7 +3171,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CreateTransformerSaveDat
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_Transform(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_DestroyTransformer(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2085,17 +3180,12 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_Transform(/*in*/ CatImpu
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -2105,27 +3195,35 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_Transform(/*in*/ CatImpu
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  CatImputerFeaturizer <uint32> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CreateEstimator(/*out*/ CatImputerFeaturizer_uint32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CatImputerFeaturizer_uint16_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CreateTransformerSaveDataWithLayout(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<CatImputerFeaturizer_uint32_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -2135,7 +3233,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_DestroyEstimator(/*in*/ CatImputerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_CreateTransformerSaveDataFile(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2143,12 +3241,17 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_DestroyEstimator(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -2158,7 +3261,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_GetState(/*in*/ CatImputerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_Transform(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2166,11 +3269,18 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_GetState(/*in*/ CatImput
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -2180,7 +3290,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_GetState(/*in*/ CatImput
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_IsTrainingComplete(/*in*/ CatImputerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_TransformBatch(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2188,12 +3298,181 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_IsTrainingComplete(/*in*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
-    
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint16_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::uint16_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_TransformArrow(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint16_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  CatImputerFeaturizer <uint32> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CreateEstimator(/*out*/ CatImputerFeaturizer_uint32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<CatImputerFeaturizer_uint32_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_DestroyEstimator(/*in*/ CatImputerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_GetState(/*in*/ CatImputerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_IsTrainingComplete(/*in*/ CatImputerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
         return true;
     }
     catch(std::exception const &ex) {
@@ -2270,6 +3549,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_FitBuffer(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_FitArrow(/*in*/ CatImputerFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint32_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_OnDataCompleted(/*in*/ CatImputerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2366,21 +3673,22 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CreateTransformerFromSav
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_DestroyTransformer(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CatImputerFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CatImputerFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -2390,7 +3698,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_DestroyTransformer(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CloneTransformer(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ CatImputerFeaturizer_uint32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2398,22 +3706,13 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CreateTransformerSaveDat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
-
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CatImputerFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -2423,7 +3722,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CreateTransformerSaveDat
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_Transform(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_DestroyTransformer(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2432,17 +3731,12 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_Transform(/*in*/ CatImpu
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -2452,27 +3746,35 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_Transform(/*in*/ CatImpu
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  CatImputerFeaturizer <uint64> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CreateEstimator(/*out*/ CatImputerFeaturizer_uint64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CatImputerFeaturizer_uint32_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CreateTransformerSaveDataWithLayout(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<CatImputerFeaturizer_uint64_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -2482,7 +3784,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_DestroyEstimator(/*in*/ CatImputerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_CreateTransformerSaveDataFile(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2490,12 +3792,17 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_DestroyEstimator(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -2505,7 +3812,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_GetState(/*in*/ CatImputerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_Transform(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2513,11 +3820,18 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_GetState(/*in*/ CatImput
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -2527,7 +3841,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_GetState(/*in*/ CatImput
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_IsTrainingComplete(/*in*/ CatImputerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_TransformBatch(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2535,13 +3849,182 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_IsTrainingComplete(/*in*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
-    
-        return true;
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint32_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::uint32_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_TransformArrow(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint32_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  CatImputerFeaturizer <uint64> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CreateEstimator(/*out*/ CatImputerFeaturizer_uint64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<CatImputerFeaturizer_uint64_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_DestroyEstimator(/*in*/ CatImputerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_GetState(/*in*/ CatImputerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_IsTrainingComplete(/*in*/ CatImputerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
     }
     catch(std::exception const &ex) {
         *ppErrorInfo = CreateErrorInfo(ex);
@@ -2617,6 +4100,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_FitBuffer(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_FitArrow(/*in*/ CatImputerFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint64_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_OnDataCompleted(/*in*/ CatImputerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2713,21 +4224,22 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CreateTransformerFromSav
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_DestroyTransformer(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CatImputerFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CatImputerFeaturizer_uint64_TransformerHandle*>(index);
     
         return true;
     }
@@ -2737,7 +4249,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_DestroyTransformer(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CloneTransformer(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ CatImputerFeaturizer_uint64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2745,22 +4257,13 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CreateTransformerSaveDat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CatImputerFeaturizer_uint64_TransformerHandle*>(index);
     
         return true;
     }
@@ -2770,7 +4273,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CreateTransformerSaveDat
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_Transform(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_DestroyTransformer(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2779,17 +4282,12 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_Transform(/*in*/ CatImpu
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -2799,27 +4297,35 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_Transform(/*in*/ CatImpu
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  CatImputerFeaturizer <float> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CreateEstimator(/*out*/ CatImputerFeaturizer_float_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CatImputerFeaturizer_uint64_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CreateTransformerSaveDataWithLayout(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<CatImputerFeaturizer_float_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -2829,7 +4335,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CreateEstimator(/*out*/ C
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_DestroyEstimator(/*in*/ CatImputerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_CreateTransformerSaveDataFile(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2837,12 +4343,17 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_DestroyEstimator(/*in*/ C
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -2852,7 +4363,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_DestroyEstimator(/*in*/ C
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_GetState(/*in*/ CatImputerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_Transform(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2860,11 +4371,18 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_GetState(/*in*/ CatImpute
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -2874,7 +4392,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_GetState(/*in*/ CatImpute
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_IsTrainingComplete(/*in*/ CatImputerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_TransformBatch(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2882,12 +4400,181 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_IsTrainingComplete(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
-    
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint64_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::uint64_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_TransformArrow(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint64_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  CatImputerFeaturizer <float> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CreateEstimator(/*out*/ CatImputerFeaturizer_float_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<CatImputerFeaturizer_float_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_DestroyEstimator(/*in*/ CatImputerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_GetState(/*in*/ CatImputerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_IsTrainingComplete(/*in*/ CatImputerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
         return true;
     }
     catch(std::exception const &ex) {
@@ -2964,6 +4651,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_FitBuffer(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_FitArrow(/*in*/ CatImputerFeaturizer_float_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::float_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_OnDataCompleted(/*in*/ CatImputerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3060,21 +4775,22 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CreateTransformerFromSave
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_DestroyTransformer(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CatImputerFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CatImputerFeaturizer_float_TransformerHandle*>(index);
     
         return true;
     }
@@ -3084,7 +4800,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_DestroyTransformer(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CloneTransformer(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*out*/ CatImputerFeaturizer_float_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3092,22 +4808,13 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CreateTransformerSaveData
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
-
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CatImputerFeaturizer_float_TransformerHandle*>(index);
     
         return true;
     }
@@ -3117,7 +4824,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CreateTransformerSaveData
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_Transform(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_DestroyTransformer(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3126,17 +4833,12 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_Transform(/*in*/ CatImput
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -3146,27 +4848,35 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_Transform(/*in*/ CatImput
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  CatImputerFeaturizer <double> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CreateEstimator(/*out*/ CatImputerFeaturizer_double_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CatImputerFeaturizer_float_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CreateTransformerSaveDataWithLayout(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<CatImputerFeaturizer_double_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -3176,7 +4886,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_DestroyEstimator(/*in*/ CatImputerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_CreateTransformerSaveDataFile(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3184,12 +4894,17 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_DestroyEstimator(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -3199,7 +4914,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_GetState(/*in*/ CatImputerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_Transform(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3207,11 +4922,18 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_GetState(/*in*/ CatImput
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -3221,7 +4943,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_GetState(/*in*/ CatImput
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_IsTrainingComplete(/*in*/ CatImputerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_TransformBatch(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3229,13 +4951,182 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_IsTrainingComplete(/*in*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
-    
-        return true;
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::float_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::float_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_TransformArrow(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::float_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  CatImputerFeaturizer <double> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CreateEstimator(/*out*/ CatImputerFeaturizer_double_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<CatImputerFeaturizer_double_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_DestroyEstimator(/*in*/ CatImputerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_GetState(/*in*/ CatImputerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_IsTrainingComplete(/*in*/ CatImputerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
     }
     catch(std::exception const &ex) {
         *ppErrorInfo = CreateErrorInfo(ex);
@@ -3311,6 +5202,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_FitBuffer(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_FitArrow(/*in*/ CatImputerFeaturizer_double_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::double_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_OnDataCompleted(/*in*/ CatImputerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3407,21 +5326,22 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CreateTransformerFromSav
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_DestroyTransformer(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CatImputerFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CatImputerFeaturizer_double_TransformerHandle*>(index);
     
         return true;
     }
@@ -3431,7 +5351,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_DestroyTransformer(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CloneTransformer(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*out*/ CatImputerFeaturizer_double_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3439,22 +5359,13 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CreateTransformerSaveDat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CatImputerFeaturizer_double_TransformerHandle*>(index);
     
         return true;
     }
@@ -3464,7 +5375,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CreateTransformerSaveDat
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_Transform(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_DestroyTransformer(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3473,17 +5384,12 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_Transform(/*in*/ CatImpu
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -3493,27 +5399,35 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_Transform(/*in*/ CatImpu
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  CatImputerFeaturizer <bool> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CreateEstimator(/*out*/ CatImputerFeaturizer_bool_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CatImputerFeaturizer_double_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CreateTransformerSaveDataWithLayout(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<CatImputerFeaturizer_bool_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -3523,7 +5437,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CreateEstimator(/*out*/ Ca
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_DestroyEstimator(/*in*/ CatImputerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_CreateTransformerSaveDataFile(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3531,12 +5445,17 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_DestroyEstimator(/*in*/ Ca
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -3546,7 +5465,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_DestroyEstimator(/*in*/ Ca
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_GetState(/*in*/ CatImputerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_Transform(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3554,11 +5473,18 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_GetState(/*in*/ CatImputer
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -3568,7 +5494,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_GetState(/*in*/ CatImputer
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_IsTrainingComplete(/*in*/ CatImputerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_TransformBatch(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3576,12 +5502,181 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_IsTrainingComplete(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
-    
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::double_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::double_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_TransformArrow(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::double_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  CatImputerFeaturizer <bool> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CreateEstimator(/*out*/ CatImputerFeaturizer_bool_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<CatImputerFeaturizer_bool_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_DestroyEstimator(/*in*/ CatImputerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_GetState(/*in*/ CatImputerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_IsTrainingComplete(/*in*/ CatImputerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
         return true;
     }
     catch(std::exception const &ex) {
@@ -3658,6 +5753,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_FitBuffer(/*in*/ CatImpute
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_FitArrow(/*in*/ CatImputerFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<bool>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_OnDataCompleted(/*in*/ CatImputerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3754,21 +5877,22 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CreateTransformerFromSaved
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_DestroyTransformer(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CatImputerFeaturizer_bool_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CatImputerFeaturizer_bool_TransformerHandle*>(index);
     
         return true;
     }
@@ -3778,7 +5902,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_DestroyTransformer(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CloneTransformer(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ CatImputerFeaturizer_bool_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3786,22 +5910,13 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CreateTransformerSaveData(
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
-
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CatImputerFeaturizer_bool_TransformerHandle*>(index);
     
         return true;
     }
@@ -3811,7 +5926,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CreateTransformerSaveData(
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_Transform(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_DestroyTransformer(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3820,17 +5935,12 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_Transform(/*in*/ CatImpute
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<bool>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -3840,27 +5950,35 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_Transform(/*in*/ CatImpute
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  CatImputerFeaturizer <string> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_CreateEstimator(/*out*/ CatImputerFeaturizer_string_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CatImputerFeaturizer_bool_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CreateTransformerSaveDataWithLayout(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<CatImputerFeaturizer_string_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -3870,7 +5988,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_DestroyEstimator(/*in*/ CatImputerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_CreateTransformerSaveDataFile(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3878,12 +5996,17 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_DestroyEstimator(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -3893,7 +6016,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_GetState(/*in*/ CatImputerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_Transform(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3901,11 +6024,18 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_GetState(/*in*/ CatImput
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<bool>::CreateNullValue()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -3915,7 +6045,7 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_GetState(/*in*/ CatImput
     }
 }
 
-FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_IsTrainingComplete(/*in*/ CatImputerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_TransformBatch(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3923,13 +6053,182 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_IsTrainingComplete(/*in*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
-    
-        return true;
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<bool>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        bool const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<bool>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<bool>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_TransformArrow(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<bool>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  CatImputerFeaturizer <string> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_CreateEstimator(/*out*/ CatImputerFeaturizer_string_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>* pEstimator = new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<CatImputerFeaturizer_string_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_DestroyEstimator(/*in*/ CatImputerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_GetState(/*in*/ CatImputerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_IsTrainingComplete(/*in*/ CatImputerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
     }
     catch(std::exception const &ex) {
         *ppErrorInfo = CreateErrorInfo(ex);
@@ -3963,6 +6262,32 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_Fit(/*in*/ CatImputerFea
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_FitView(/*in*/ CatImputerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        // No validation
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : nonstd::optional<std::string>()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_FitBuffer(/*in*/ CatImputerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -4005,6 +6330,80 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_FitBuffer(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_FitBufferView(/*in*/ CatImputerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ unsigned char const *input_validity, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<nonstd::optional<std::string>> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            if(input_validity != nullptr && (input_validity[input_index / 8] & (1 << (input_index % 8))) == 0) {
+                input_buffer.push_back(nonstd::optional<std::string>());
+                continue;
+            }
+
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_FitArrow(/*in*/ CatImputerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<nonstd::optional<std::string> []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_OnDataCompleted(/*in*/ CatImputerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -4101,6 +6500,55 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_CreateTransformerFromSav
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CatImputerFeaturizer_string_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CatImputerFeaturizer_string_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_CloneTransformer(/*in*/ CatImputerFeaturizer_string_TransformerHandle *pHandle, /*out*/ CatImputerFeaturizer_string_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CatImputerFeaturizer_string_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_DestroyTransformer(/*in*/ CatImputerFeaturizer_string_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -4126,6 +6574,10 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_DestroyTransformer(/*in*
 }
 
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_CreateTransformerSaveData(/*in*/ CatImputerFeaturizer_string_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CatImputerFeaturizer_string_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_CreateTransformerSaveDataWithLayout(/*in*/ CatImputerFeaturizer_string_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -4137,11 +6589,12 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_CreateTransformerSaveDat
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -4158,6 +6611,34 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_CreateTransformerSaveDat
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_CreateTransformerSaveDataFile(/*in*/ CatImputerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_Transform(/*in*/ CatImputerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ char const ** output_ptr, /*out*/ std::size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -4200,6 +6681,288 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_Transform(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_TransformView(/*in*/ CatImputerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ char const ** output_ptr, /*out*/ std::size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        // No input validation
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_items == nullptr) throw std::invalid_argument("'output_items' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : nonstd::optional<std::string>()));
+
+        // Output
+        if(result.empty()) {
+            *output_ptr = nullptr;
+            *output_items = 0;
+        }
+        else {
+            char * string_buffer(new char[result.size() + 1]);
+
+            std::copy(result.begin(), result.end(), string_buffer);
+            string_buffer[result.size()] = 0;
+
+            *output_ptr = string_buffer;
+            *output_items = result.size();
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_TransformBatch(/*in*/ CatImputerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ char const ** output_ptr, /*out*/ std::size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<nonstd::optional<std::string>> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? *input_ptr : nonstd::optional<std::string>());
+        #else
+            input_buffer.emplace_back(*input_ptr ? *input_ptr : nonstd::optional<std::string>());
+        #endif
+            ++input_ptr;
+        }
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_items == nullptr) throw std::invalid_argument("'output_items' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_items_begin(output_items);
+        auto const output_func(
+            [&output_ptr, &output_items](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_items = 0;
+                }
+                else {
+                    char * string_buffer(new char[result.size() + 1]);
+
+                    std::copy(result.begin(), result.end(), string_buffer);
+                    string_buffer[result.size()] = 0;
+
+                    *output_ptr = string_buffer;
+                    *output_items = result.size();
+                }
+
+                ++output_ptr;
+                ++output_items;
+            }
+        );
+
+        // Input
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(CatImputerFeaturizer_string_DestroyTransformedData(output_ptr_begin[result_index], output_items_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_TransformBatchView(/*in*/ CatImputerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ unsigned char const *input_validity, /*in*/ std::size_t input_items, /*out*/ char const ** output_ptr, /*out*/ std::size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_items == nullptr) throw std::invalid_argument("'output_items' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_items_begin(output_items);
+        auto const output_func(
+            [&output_ptr, &output_items](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_items = 0;
+                }
+                else {
+                    char * string_buffer(new char[result.size() + 1]);
+
+                    std::copy(result.begin(), result.end(), string_buffer);
+                    string_buffer[result.size()] = 0;
+
+                    *output_ptr = string_buffer;
+                    *output_items = result.size();
+                }
+
+                ++output_ptr;
+                ++output_items;
+            }
+        );
+
+        // Input
+        std::vector<nonstd::optional<std::string>> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            if(input_validity != nullptr && (input_validity[input_index / 8] & (1 << (input_index % 8))) == 0) {
+                input_buffer.push_back(nonstd::optional<std::string>());
+                continue;
+            }
+
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        }
+
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(CatImputerFeaturizer_string_DestroyTransformedData(output_ptr_begin[result_index], output_items_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_TransformArrow(/*in*/ CatImputerFeaturizer_string_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<nonstd::optional<std::string> []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_TransformIntoBuffer(/*in*/ CatImputerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ char *output_ptr, /*in*/ std::size_t output_capacity, /*out*/ std::size_t *output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        // No input validation
+        if(output_ptr == nullptr && output_capacity != 0) throw std::invalid_argument("'output_ptr' is null");
+        if(output_items == nullptr) throw std::invalid_argument("'output_items' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input ? std::string(input) : nonstd::optional<std::string>()));
+
+        // Output
+        *output_items = result.size();
+
+        if(result.size() <= output_capacity)
+            std::copy(result.begin(), result.end(), output_ptr);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_string_DestroyTransformedData(/*in*/ char const *result_ptr, /*in*/ std::size_t result_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
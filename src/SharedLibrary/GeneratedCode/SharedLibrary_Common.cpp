@@ -9,6 +9,7 @@
 
 #include "SharedLibrary_Common.h"
 #include "SharedLibrary_PointerTable.h"
+#include "Archive.h"
 #include "Traits.h"
 
 // Forward declaration for DestroyTransformerSaveData
@@ -96,3 +97,16 @@ std::chrono::system_clock::time_point CreateDateTime(DateTimeParameter const &pa
 
     throw std::runtime_error("'type' is invalid");
 }
+
+Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout) {
+    if(layout == ArchiveLayoutValue::StandardLayout)
+        return Microsoft::Featurizer::Archive::LayoutValue::Standard;
+
+    if(layout == ArchiveLayoutValue::FlatLayout)
+        return Microsoft::Featurizer::Archive::LayoutValue::Flat;
+
+    if(layout == ArchiveLayoutValue::CompactLayout)
+        return Microsoft::Featurizer::Archive::LayoutValue::Compact;
+
+    throw std::invalid_argument("'layout' is invalid");
+}
@@ -99,6 +99,15 @@ enum FitResultValue {
 
 typedef unsigned char FitResult;
 
+// These values should match the values in Archive.h
+enum ArchiveLayoutValue {
+    StandardLayout = 1,
+    FlatLayout,
+    CompactLayout
+};
+
+typedef unsigned char ArchiveLayout;
+
 // These values should match the values in Traits.h
 enum TypeIdValue {
     StringId = 0x00000001,
@@ -133,4 +142,48 @@ enum TypeIdValue {
 
 typedef uint32_t TypeId;
 
+// Arrow C Data Interface (https://arrow.apache.org/docs/format/CDataInterface.html);
+// these definitions are part of the Arrow ABI and must not be changed.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    // Array type description
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+struct ArrowArray {
+    // Array data description
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray*);
+    // Opaque producer-specific data
+    void* private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
 } // extern "C"
@@ -6,13 +6,68 @@
 
 #include "SharedLibrary_CountVectorizerFeaturizer.h"
 #include "SharedLibrary_PointerTable.h"
+#include "../SharedLibrary_Arrow.h"
 
 #include "Archive.h"
+#include "FileArchive.h"
 #include "CountVectorizerFeaturizer.h"
 
 // These method(s) are defined in SharedLibrary_Common.cpp
 ErrorInfoHandle * CreateErrorInfo(std::exception const &ex);
 std::chrono::system_clock::time_point CreateDateTime(DateTimeParameter const &param);
+Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout);
+
+namespace {
+
+// Transforms the inputs with a single call to the transformer's batch
+// `execute` method and invokes `outputFunc` for each result.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::true_type /*is_default_constructible*/) {
+    std::unique_ptr<typename TransformerT::TransformedType []> pResults(new typename TransformerT::TransformedType[cInputs]);
+
+    transformer.execute(pInputs, cInputs, pResults.get());
+
+    for(std::size_t index = 0; index < cInputs; ++index)
+        outputFunc(pResults[index]);
+}
+
+// The batch `execute` method writes to constructed items; results that can't be
+// default constructed are transformed one at a time.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::false_type /*is_default_constructible*/) {
+    typename TransformerT::InputType const * const  pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs) {
+        typename TransformerT::TransformedType      result(transformer.execute(*pInputs));
+
+        outputFunc(result);
+        ++pInputs;
+    }
+}
+
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc, std::is_default_constructible<typename TransformerT::TransformedType>());
+}
+
+// Results are written directly to the caller's buffer when its type is the
+// transformed type; otherwise, each result is converted by `outputFunc`.
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &/*outputFunc*/, std::true_type /*is_transformed_type*/) {
+    transformer.execute(pInputs, cInputs, pOutputs);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT * /*pOutputs*/, OutputFuncT const &outputFunc, std::false_type /*is_transformed_type*/) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &outputFunc) {
+    TransformBatchToOutput(transformer, pInputs, cInputs, pOutputs, outputFunc, std::is_same<OutputT, typename TransformerT::TransformedType>());
+}
+
+} // anonymous namespace
 
 extern "C" {
 
@@ -146,6 +201,32 @@ FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_Fit(/*in*/ CountVectorizer
     }
 }
 
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_FitView(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_FitBuffer(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -188,6 +269,79 @@ FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_FitBuffer(/*in*/ CountVect
     }
 }
 
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_FitBufferView(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_FitArrow(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_OnDataCompleted(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -284,6 +438,55 @@ FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerFromSaved
     }
 }
 
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CountVectorizerFeaturizer_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<CountVectorizerFeaturizer_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CloneTransformer(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*out*/ CountVectorizerFeaturizer_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<CountVectorizerFeaturizer_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_DestroyTransformer(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -309,6 +512,10 @@ FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_DestroyTransformer(/*in*/
 }
 
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerSaveData(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return CountVectorizerFeaturizer_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerSaveDataWithLayout(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -320,11 +527,12 @@ FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerSaveData(
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -341,6 +549,34 @@ FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerSaveData(
     }
 }
 
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerSaveDataFile(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_Transform(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ uint32_t **output_values, /*out*/ uint64_t **output_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -388,6 +624,274 @@ FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_Transform(/*in*/ CountVect
     }
 }
 
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_TransformView(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ uint32_t **output_values, /*out*/ uint64_t **output_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_numValues == nullptr) throw std::invalid_argument("'output_numValues' is null");
+        if(output_values == nullptr) throw std::invalid_argument("'output_values' is null");
+        if(output_indexes == nullptr) throw std::invalid_argument("'output_indexes' is null");
+
+        Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+
+        // Output
+        std::unique_ptr<std::uint32_t []> pValues(new std::uint32_t [result.Values.size()]);
+        std::unique_ptr<uint64_t []> pIndexes(new uint64_t [result.Values.size()]);
+
+        std::uint32_t * pValue(pValues.get());
+        uint64_t * pIndex(pIndexes.get());
+
+        for(auto const & encoding : result.Values) {
+            *pValue++ = encoding.Value;
+            *pIndex++ = encoding.Index;
+        }
+
+        *output_numElements = result.NumElements;
+        *output_numValues = result.Values.size();
+
+        *output_values = pValues.release();
+        *output_indexes = pIndexes.release();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_TransformBatch(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ uint32_t **output_values, /*out*/ uint64_t **output_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_numValues == nullptr) throw std::invalid_argument("'output_numValues' is null");
+        if(output_values == nullptr) throw std::invalid_argument("'output_values' is null");
+        if(output_indexes == nullptr) throw std::invalid_argument("'output_indexes' is null");
+
+        Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_numElements_begin(output_numElements);
+        auto * const output_numValues_begin(output_numValues);
+        auto * const output_values_begin(output_values);
+        auto * const output_indexes_begin(output_indexes);
+        auto const output_func(
+            [&output_numElements, &output_numValues, &output_values, &output_indexes](Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType::TransformedType &result) {
+                std::unique_ptr<std::uint32_t []> pValues(new std::uint32_t [result.Values.size()]);
+                std::unique_ptr<uint64_t []> pIndexes(new uint64_t [result.Values.size()]);
+
+                std::uint32_t * pValue(pValues.get());
+                uint64_t * pIndex(pIndexes.get());
+
+                for(auto const & encoding : result.Values) {
+                    *pValue++ = encoding.Value;
+                    *pIndex++ = encoding.Index;
+                }
+
+                *output_numElements = result.NumElements;
+                *output_numValues = result.Values.size();
+
+                *output_values = pValues.release();
+                *output_indexes = pIndexes.release();
+
+                ++output_numElements;
+                ++output_numValues;
+                ++output_values;
+                ++output_indexes;
+            }
+        );
+
+        // Input
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_numElements_begin + result_index != output_numElements; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(CountVectorizerFeaturizer_DestroyTransformedData(output_numElements_begin[result_index], output_numValues_begin[result_index], output_values_begin[result_index], output_indexes_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_TransformBatchView(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ uint32_t **output_values, /*out*/ uint64_t **output_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_numValues == nullptr) throw std::invalid_argument("'output_numValues' is null");
+        if(output_values == nullptr) throw std::invalid_argument("'output_values' is null");
+        if(output_indexes == nullptr) throw std::invalid_argument("'output_indexes' is null");
+
+        Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_numElements_begin(output_numElements);
+        auto * const output_numValues_begin(output_numValues);
+        auto * const output_values_begin(output_values);
+        auto * const output_indexes_begin(output_indexes);
+        auto const output_func(
+            [&output_numElements, &output_numValues, &output_values, &output_indexes](Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType::TransformedType &result) {
+                std::unique_ptr<std::uint32_t []> pValues(new std::uint32_t [result.Values.size()]);
+                std::unique_ptr<uint64_t []> pIndexes(new uint64_t [result.Values.size()]);
+
+                std::uint32_t * pValue(pValues.get());
+                uint64_t * pIndex(pIndexes.get());
+
+                for(auto const & encoding : result.Values) {
+                    *pValue++ = encoding.Value;
+                    *pIndex++ = encoding.Index;
+                }
+
+                *output_numElements = result.NumElements;
+                *output_numValues = result.Values.size();
+
+                *output_values = pValues.release();
+                *output_indexes = pIndexes.release();
+
+                ++output_numElements;
+                ++output_numValues;
+                ++output_values;
+                ++output_indexes;
+            }
+        );
+
+        // Input
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_numElements_begin + result_index != output_numElements; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(CountVectorizerFeaturizer_DestroyTransformedData(output_numElements_begin[result_index], output_numValues_begin[result_index], output_values_begin[result_index], output_indexes_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_TransformIntoBuffer(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint32_t *output_values, /*out*/ uint64_t *output_indexes, /*in*/ uint64_t output_capacity, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output_values == nullptr && output_capacity != 0) throw std::invalid_argument("'output_values' is null");
+        if(output_indexes == nullptr && output_capacity != 0) throw std::invalid_argument("'output_indexes' is null");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_numValues == nullptr) throw std::invalid_argument("'output_numValues' is null");
+
+        Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CountVectorizerEstimator<>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output_numElements = result.NumElements;
+        *output_numValues = result.Values.size();
+
+        if(result.Values.size() <= output_capacity) {
+            for(auto const & encoding : result.Values) {
+                *output_values++ = encoding.Value;
+                *output_indexes++ = encoding.Index;
+            }
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_DestroyTransformedData(/*in*/ uint64_t result_numElements, /*in*/ uint64_t result_numValues, /*in*/ uint32_t const * result_values, /*in*/ uint64_t const * result_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
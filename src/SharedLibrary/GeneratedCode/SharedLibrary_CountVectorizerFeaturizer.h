@@ -30,17 +30,31 @@ FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_GetState(/*in*/ CountVecto
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_IsTrainingComplete(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_Fit(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_FitBuffer(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_FitView(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_FitBufferView(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_FitArrow(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_OnDataCompleted(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*out*/ /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CompleteTraining(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerFromEstimator(/*in*/ CountVectorizerFeaturizer_EstimatorHandle *pEstimatorHandle, /*out*/ CountVectorizerFeaturizer_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ CountVectorizerFeaturizer_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ CountVectorizerFeaturizer_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CloneTransformer(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*out*/ CountVectorizerFeaturizer_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_DestroyTransformer(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerSaveData(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerSaveDataWithLayout(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerSaveDataFile(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_Transform(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ uint32_t **output_values, /*out*/ uint64_t **output_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_TransformBatch(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ uint32_t **output_values, /*out*/ uint64_t **output_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_TransformView(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ uint32_t **output_values, /*out*/ uint64_t **output_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_TransformBatchView(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ uint32_t **output_values, /*out*/ uint64_t **output_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo);
+// Writes the result to the caller's buffer when it fits within the capacity provided; the required size is always
+// returned. Querying the size with an empty buffer runs the full transform (and the transform runs again when the
+// data is retrieved), so this method is not available for transformers that maintain state across calls.
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_TransformIntoBuffer(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint32_t *output_values, /*out*/ uint64_t *output_indexes, /*in*/ uint64_t output_capacity, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_DestroyTransformedData(/*in*/ uint64_t result_numElements, /*in*/ uint64_t result_numValues, /*in*/ uint32_t const * result_values, /*in*/ uint64_t const * result_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 } // extern "C"
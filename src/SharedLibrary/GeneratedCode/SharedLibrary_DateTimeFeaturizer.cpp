@@ -6,13 +6,68 @@
 
 #include "SharedLibrary_DateTimeFeaturizer.h"
 #include "SharedLibrary_PointerTable.h"
+#include "../SharedLibrary_Arrow.h"
 
 #include "Archive.h"
+#include "FileArchive.h"
 #include "DateTimeFeaturizer.h"
 
 // These method(s) are defined in SharedLibrary_Common.cpp
 ErrorInfoHandle * CreateErrorInfo(std::exception const &ex);
 std::chrono::system_clock::time_point CreateDateTime(DateTimeParameter const &param);
+Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout);
+
+namespace {
+
+// Transforms the inputs with a single call to the transformer's batch
+// `execute` method and invokes `outputFunc` for each result.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::true_type /*is_default_constructible*/) {
+    std::unique_ptr<typename TransformerT::TransformedType []> pResults(new typename TransformerT::TransformedType[cInputs]);
+
+    transformer.execute(pInputs, cInputs, pResults.get());
+
+    for(std::size_t index = 0; index < cInputs; ++index)
+        outputFunc(pResults[index]);
+}
+
+// The batch `execute` method writes to constructed items; results that can't be
+// default constructed are transformed one at a time.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::false_type /*is_default_constructible*/) {
+    typename TransformerT::InputType const * const  pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs) {
+        typename TransformerT::TransformedType      result(transformer.execute(*pInputs));
+
+        outputFunc(result);
+        ++pInputs;
+    }
+}
+
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc, std::is_default_constructible<typename TransformerT::TransformedType>());
+}
+
+// Results are written directly to the caller's buffer when its type is the
+// transformed type; otherwise, each result is converted by `outputFunc`.
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &/*outputFunc*/, std::true_type /*is_transformed_type*/) {
+    transformer.execute(pInputs, cInputs, pOutputs);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT * /*pOutputs*/, OutputFuncT const &outputFunc, std::false_type /*is_transformed_type*/) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &outputFunc) {
+    TransformBatchToOutput(transformer, pInputs, cInputs, pOutputs, outputFunc, std::is_same<OutputT, typename TransformerT::TransformedType>());
+}
+
+} // anonymous namespace
 
 extern "C" {
 
@@ -284,6 +339,55 @@ FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_CreateTransformerFromSavedData(/*
     }
 }
 
+FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ DateTimeFeaturizer_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<DateTimeFeaturizer_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_CloneTransformer(/*in*/ DateTimeFeaturizer_TransformerHandle *pHandle, /*out*/ DateTimeFeaturizer_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<DateTimeFeaturizer_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_DestroyTransformer(/*in*/ DateTimeFeaturizer_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -309,6 +413,10 @@ FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_DestroyTransformer(/*in*/ DateTim
 }
 
 FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_CreateTransformerSaveData(/*in*/ DateTimeFeaturizer_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return DateTimeFeaturizer_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_CreateTransformerSaveDataWithLayout(/*in*/ DateTimeFeaturizer_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -320,11 +428,12 @@ FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_CreateTransformerSaveData(/*in*/
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -341,6 +450,34 @@ FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_CreateTransformerSaveData(/*in*/
     }
 }
 
+FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_CreateTransformerSaveDataFile(/*in*/ DateTimeFeaturizer_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_Transform(/*in*/ DateTimeFeaturizer_TransformerHandle *pHandle, /*in*/ DateTimeParameter input, /*out via struct*/ TimePoint * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -442,6 +579,143 @@ FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_Transform(/*in*/ DateTimeFeaturiz
     }
 }
 
+FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_TransformBatch(/*in*/ DateTimeFeaturizer_TransformerHandle *pHandle, /*in*/ DateTimeParameter const * input_ptr, /*in*/ std::size_t input_items, /*out via struct*/ TimePoint * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::chrono::system_clock::time_point> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        DateTimeParameter const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(CreateDateTime(*input_ptr));
+        #else
+            input_buffer.emplace_back(CreateDateTime(*input_ptr));
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_begin(output);
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::DateTimeEstimator::TransformerType::TransformedType &result) {
+                output->year = result.year;
+                output->month = result.month;
+                output->day = result.day;
+                output->hour = result.hour;
+                output->minute = result.minute;
+                output->second = result.second;
+                output->amPm = result.amPm;
+                output->hour12 = result.hour12;
+                output->dayOfWeek = result.dayOfWeek;
+                output->dayOfQuarter = result.dayOfQuarter;
+                output->dayOfYear = result.dayOfYear;
+                output->weekOfMonth = result.weekOfMonth;
+                output->quarterOfYear = result.quarterOfYear;
+                output->halfOfYear = result.halfOfYear;
+                output->weekIso = result.weekIso;
+                output->yearIso = result.yearIso;
+                if(result.monthLabel.empty()) {
+                    output->monthLabel_ptr = nullptr;
+                    output->monthLabel_items = 0;
+                }
+                else {
+                    char * string_buffer(new char[result.monthLabel.size() + 1]);
+
+                    std::copy(result.monthLabel.begin(), result.monthLabel.end(), string_buffer);
+                    string_buffer[result.monthLabel.size()] = 0;
+
+                    output->monthLabel_ptr = string_buffer;
+                    output->monthLabel_items = result.monthLabel.size();
+                }
+
+                if(result.amPmLabel.empty()) {
+                    output->amPmLabel_ptr = nullptr;
+                    output->amPmLabel_items = 0;
+                }
+                else {
+                    char * string_buffer(new char[result.amPmLabel.size() + 1]);
+
+                    std::copy(result.amPmLabel.begin(), result.amPmLabel.end(), string_buffer);
+                    string_buffer[result.amPmLabel.size()] = 0;
+
+                    output->amPmLabel_ptr = string_buffer;
+                    output->amPmLabel_items = result.amPmLabel.size();
+                }
+
+                if(result.dayOfWeekLabel.empty()) {
+                    output->dayOfWeekLabel_ptr = nullptr;
+                    output->dayOfWeekLabel_items = 0;
+                }
+                else {
+                    char * string_buffer(new char[result.dayOfWeekLabel.size() + 1]);
+
+                    std::copy(result.dayOfWeekLabel.begin(), result.dayOfWeekLabel.end(), string_buffer);
+                    string_buffer[result.dayOfWeekLabel.size()] = 0;
+
+                    output->dayOfWeekLabel_ptr = string_buffer;
+                    output->dayOfWeekLabel_items = result.dayOfWeekLabel.size();
+                }
+
+                if(result.holidayName.empty()) {
+                    output->holidayName_ptr = nullptr;
+                    output->holidayName_items = 0;
+                }
+                else {
+                    char * string_buffer(new char[result.holidayName.size() + 1]);
+
+                    std::copy(result.holidayName.begin(), result.holidayName.end(), string_buffer);
+                    string_buffer[result.holidayName.size()] = 0;
+
+                    output->holidayName_ptr = string_buffer;
+                    output->holidayName_items = result.holidayName.size();
+                }
+
+                output->isPaidTimeOff = result.isPaidTimeOff;
+
+                ++output;
+            }
+        );
+
+        // Input
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_begin + result_index != output; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(DateTimeFeaturizer_DestroyTransformedData(output_begin + result_index, &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool DateTimeFeaturizer_DestroyTransformedData(/*in*/ TimePoint * result, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
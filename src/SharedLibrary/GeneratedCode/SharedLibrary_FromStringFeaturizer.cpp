@@ -6,13 +6,68 @@
 
 #include "SharedLibrary_FromStringFeaturizer.h"
 #include "SharedLibrary_PointerTable.h"
+#include "../SharedLibrary_Arrow.h"
 
 #include "Archive.h"
+#include "FileArchive.h"
 #include "FromStringFeaturizer.h"
 
 // These method(s) are defined in SharedLibrary_Common.cpp
 ErrorInfoHandle * CreateErrorInfo(std::exception const &ex);
 std::chrono::system_clock::time_point CreateDateTime(DateTimeParameter const &param);
+Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout);
+
+namespace {
+
+// Transforms the inputs with a single call to the transformer's batch
+// `execute` method and invokes `outputFunc` for each result.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::true_type /*is_default_constructible*/) {
+    std::unique_ptr<typename TransformerT::TransformedType []> pResults(new typename TransformerT::TransformedType[cInputs]);
+
+    transformer.execute(pInputs, cInputs, pResults.get());
+
+    for(std::size_t index = 0; index < cInputs; ++index)
+        outputFunc(pResults[index]);
+}
+
+// The batch `execute` method writes to constructed items; results that can't be
+// default constructed are transformed one at a time.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::false_type /*is_default_constructible*/) {
+    typename TransformerT::InputType const * const  pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs) {
+        typename TransformerT::TransformedType      result(transformer.execute(*pInputs));
+
+        outputFunc(result);
+        ++pInputs;
+    }
+}
+
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc, std::is_default_constructible<typename TransformerT::TransformedType>());
+}
+
+// Results are written directly to the caller's buffer when its type is the
+// transformed type; otherwise, each result is converted by `outputFunc`.
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &/*outputFunc*/, std::true_type /*is_transformed_type*/) {
+    transformer.execute(pInputs, cInputs, pOutputs);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT * /*pOutputs*/, OutputFuncT const &outputFunc, std::false_type /*is_transformed_type*/) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &outputFunc) {
+    TransformBatchToOutput(transformer, pInputs, cInputs, pOutputs, outputFunc, std::is_same<OutputT, typename TransformerT::TransformedType>());
+}
+
+} // anonymous namespace
 
 extern "C" {
 
@@ -146,6 +201,32 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_Fit(/*in*/ FromStringFeatu
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_FitView(/*in*/ FromStringFeaturizer_int8_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_FitBuffer(/*in*/ FromStringFeaturizer_int8_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -188,6 +269,79 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_FitBuffer(/*in*/ FromStrin
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_FitBufferView(/*in*/ FromStringFeaturizer_int8_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_FitArrow(/*in*/ FromStringFeaturizer_int8_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_OnDataCompleted(/*in*/ FromStringFeaturizer_int8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -284,21 +438,22 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_CreateTransformerFromSaved
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_DestroyTransformer(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ FromStringFeaturizer_int8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int8_TransformerHandle*>(index);
     
         return true;
     }
@@ -308,7 +463,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_DestroyTransformer(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_CloneTransformer(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*out*/ FromStringFeaturizer_int8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -316,22 +471,13 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_CreateTransformerSaveData(
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<FromStringFeaturizer_int8_TransformerHandle*>(index);
     
         return true;
     }
@@ -341,7 +487,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_CreateTransformerSaveData(
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_Transform(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ int8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_DestroyTransformer(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -350,17 +496,12 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_Transform(/*in*/ FromStrin
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -370,27 +511,35 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_Transform(/*in*/ FromStrin
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  FromStringFeaturizer <int16> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateEstimator(/*out*/ FromStringFeaturizer_int16_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return FromStringFeaturizer_int8_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_CreateTransformerSaveDataWithLayout(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<FromStringFeaturizer_int16_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -400,7 +549,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateEstimator(/*out*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_DestroyEstimator(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_CreateTransformerSaveDataFile(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -408,12 +557,17 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_DestroyEstimator(/*in*/ F
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -423,7 +577,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_DestroyEstimator(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_GetState(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_Transform(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ int8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -431,33 +585,18 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_GetState(/*in*/ FromStrin
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
-
-        *pState = static_cast<TrainingState>(estimator.get_state());
-    
-        return true;
-    }
-    catch(std::exception const &ex) {
-        *ppErrorInfo = CreateErrorInfo(ex);
-        return false;
-    }
-}
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_IsTrainingComplete(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
-    if(ppErrorInfo == nullptr)
-        return false;
 
-    try {
-        *ppErrorInfo = nullptr;
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
+        // Input
+        auto result(transformer.execute(input));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        // Output
+        *output = result;
     
         return true;
     }
@@ -467,7 +606,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_IsTrainingComplete(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Fit(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_TransformView(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ int8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -475,15 +614,18 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Fit(/*in*/ FromStringFeat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+        // Output
+        *output = result;
     
         return true;
     }
@@ -493,7 +635,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Fit(/*in*/ FromStringFeat
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_FitBuffer(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_TransformBatch(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -501,8 +643,6 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_FitBuffer(/*in*/ FromStri
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
 
 
         if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
@@ -522,10 +662,21 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_FitBuffer(/*in*/ FromStri
         #endif
             ++input_ptr;
         }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -535,7 +686,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_FitBuffer(/*in*/ FromStri
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_OnDataCompleted(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_TransformBatchView(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ int8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -544,9 +695,42 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_OnDataCompleted(/*in*/ Fr
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.on_data_completed();
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -556,7 +740,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_OnDataCompleted(/*in*/ Fr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CompleteTraining(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_TransformArrow(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -565,9 +749,31 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CompleteTraining(/*in*/ F
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        estimator.complete_training();
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -577,25 +783,27 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CompleteTraining(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
-    if(ppErrorInfo == nullptr)
-        return false;
-
-    try {
-        *ppErrorInfo = nullptr;
-
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  FromStringFeaturizer <int16> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateEstimator(/*out*/ FromStringFeaturizer_int16_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
 
+    try {
+        *ppErrorInfo = nullptr;
 
+        // No validation
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+        pEstimator->begin_training();
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType*>(estimator.create_transformer().release());
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<FromStringFeaturizer_int16_EstimatorHandle*>(index);
 
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int16_TransformerHandle*>(index);
     
         return true;
     }
@@ -605,23 +813,20 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerFromEsti
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_DestroyEstimator(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType(archive));
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(index);
+        g_pointerTable.Remove(index);
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int16_TransformerHandle*>(index);
+        delete pEstimator;
     
         return true;
     }
@@ -631,7 +836,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerFromSave
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_DestroyTransformer(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_GetState(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -639,13 +844,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_DestroyTransformer(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
-
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pTransformer;
+        *pState = static_cast<TrainingState>(estimator.get_state());
     
         return true;
     }
@@ -655,7 +858,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_DestroyTransformer(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_IsTrainingComplete(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -663,22 +866,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerSaveData
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
         return true;
     }
@@ -688,7 +880,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerSaveData
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Transform(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Fit(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -696,18 +888,15 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Transform(/*in*/ FromStri
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
         if(input == nullptr) throw std::invalid_argument("'input' is null");
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        // Input
-        auto result(transformer.execute(input));
 
-        // Output
-        *output = result;
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
     
         return true;
     }
@@ -717,27 +906,23 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Transform(/*in*/ FromStri
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  FromStringFeaturizer <int32> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateEstimator(/*out*/ FromStringFeaturizer_int32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_FitView(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        pEstimator->begin_training();
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<FromStringFeaturizer_int32_EstimatorHandle*>(index);
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
 
 
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
     
         return true;
     }
@@ -747,7 +932,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateEstimator(/*out*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_DestroyEstimator(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_FitBuffer(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -755,12 +940,31 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_DestroyEstimator(/*in*/ F
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(index);
-        g_pointerTable.Remove(index);
 
-        delete pEstimator;
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -770,7 +974,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_DestroyEstimator(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_GetState(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_FitBufferView(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -778,11 +982,34 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_GetState(/*in*/ FromStrin
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -792,7 +1019,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_GetState(/*in*/ FromStrin
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_IsTrainingComplete(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_FitArrow(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -800,11 +1027,17 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_IsTrainingComplete(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -814,7 +1047,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_IsTrainingComplete(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Fit(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_OnDataCompleted(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -822,15 +1055,10 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Fit(/*in*/ FromStringFeat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+        estimator.on_data_completed();
     
         return true;
     }
@@ -840,7 +1068,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Fit(/*in*/ FromStringFeat
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_FitBuffer(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CompleteTraining(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -848,31 +1076,10 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_FitBuffer(/*in*/ FromStri
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
-
-        std::vector<std::string> input_buffer;
-
-        input_buffer.reserve(input_items);
-
-        char const * const * const input_end(input_ptr + input_items);
-
-        while(input_ptr != input_end) {
-        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr);
-        #else
-            input_buffer.emplace_back(*input_ptr);
-        #endif
-            ++input_ptr;
-        }
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        estimator.complete_training();
     
         return true;
     }
@@ -882,18 +1089,25 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_FitBuffer(/*in*/ FromStri
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_OnDataCompleted(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_int16_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.on_data_completed();
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int16_TransformerHandle*>(index);
     
         return true;
     }
@@ -903,18 +1117,23 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_OnDataCompleted(/*in*/ Fr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CompleteTraining(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        estimator.complete_training();
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int16_TransformerHandle*>(index);
     
         return true;
     }
@@ -924,25 +1143,22 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CompleteTraining(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ FromStringFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
         if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType*>(estimator.create_transformer().release());
-
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType(archive));
 
         size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int32_TransformerHandle*>(index);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int16_TransformerHandle*>(index);
     
         return true;
     }
@@ -952,23 +1168,21 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerFromEsti
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CloneTransformer(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*out*/ FromStringFeaturizer_int16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int32_TransformerHandle*>(index);
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<FromStringFeaturizer_int16_TransformerHandle*>(index);
     
         return true;
     }
@@ -978,7 +1192,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerFromSave
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_DestroyTransformer(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_DestroyTransformer(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -988,7 +1202,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_DestroyTransformer(/*in*/
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
         size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(index);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(index);
         g_pointerTable.Remove(index);
 
 
@@ -1002,7 +1216,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_DestroyTransformer(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return FromStringFeaturizer_int16_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerSaveDataWithLayout(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1013,12 +1231,13 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerSaveData
         if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -1035,7 +1254,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerSaveData
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Transform(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerSaveDataFile(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1043,18 +1262,17 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Transform(/*in*/ FromStri
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input));
-
-        // Output
-        *output = result;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -1064,27 +1282,26 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Transform(/*in*/ FromStri
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  FromStringFeaturizer <int64> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateEstimator(/*out*/ FromStringFeaturizer_int64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Transform(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        pEstimator->begin_training();
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<FromStringFeaturizer_int64_EstimatorHandle*>(index);
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Input
+        auto result(transformer.execute(input));
 
+        // Output
+        *output = result;
     
         return true;
     }
@@ -1094,7 +1311,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateEstimator(/*out*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_DestroyEstimator(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_TransformView(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1103,11 +1320,17 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_DestroyEstimator(/*in*/ F
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(index);
-        g_pointerTable.Remove(index);
 
-        delete pEstimator;
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -1117,7 +1340,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_DestroyEstimator(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_GetState(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_TransformBatch(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1125,11 +1348,40 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_GetState(/*in*/ FromStrin
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -1139,7 +1391,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_GetState(/*in*/ FromStrin
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_IsTrainingComplete(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_TransformBatchView(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1147,11 +1399,43 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_IsTrainingComplete(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -1161,7 +1445,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_IsTrainingComplete(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Fit(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_TransformArrow(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1169,15 +1453,32 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Fit(/*in*/ FromStringFeat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType::TransformedType> output_builder(input_values.second);
 
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -1187,39 +1488,27 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Fit(/*in*/ FromStringFeat
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_FitBuffer(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  FromStringFeaturizer <int32> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateEstimator(/*out*/ FromStringFeaturizer_int32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
-
-        std::vector<std::string> input_buffer;
-
-        input_buffer.reserve(input_items);
+        // No validation
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
 
-        char const * const * const input_end(input_ptr + input_items);
+        pEstimator->begin_training();
 
-        while(input_ptr != input_end) {
-        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr);
-        #else
-            input_buffer.emplace_back(*input_ptr);
-        #endif
-            ++input_ptr;
-        }
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<FromStringFeaturizer_int32_EstimatorHandle*>(index);
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -1229,7 +1518,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_FitBuffer(/*in*/ FromStri
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_OnDataCompleted(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_DestroyEstimator(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1238,9 +1527,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_OnDataCompleted(/*in*/ Fr
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(index);
+        g_pointerTable.Remove(index);
 
-        estimator.on_data_completed();
+        delete pEstimator;
     
         return true;
     }
@@ -1250,7 +1541,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_OnDataCompleted(/*in*/ Fr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CompleteTraining(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_GetState(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1258,10 +1549,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CompleteTraining(/*in*/ F
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.complete_training();
+        *pState = static_cast<TrainingState>(estimator.get_state());
     
         return true;
     }
@@ -1271,25 +1563,19 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CompleteTraining(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_IsTrainingComplete(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType*>(estimator.create_transformer().release());
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int64_TransformerHandle*>(index);
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
         return true;
     }
@@ -1299,23 +1585,23 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerFromEsti
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Fit(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType(archive));
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int64_TransformerHandle*>(index);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
     
         return true;
     }
@@ -1325,7 +1611,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerFromSave
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_DestroyTransformer(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_FitView(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1333,13 +1619,15 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_DestroyTransformer(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
 
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
 
-        delete pTransformer;
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
     
         return true;
     }
@@ -1349,7 +1637,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_DestroyTransformer(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_FitBuffer(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1357,22 +1645,31 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerSaveData
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
 
-        transformer.save(archive);
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        std::vector<std::string> input_buffer;
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        input_buffer.reserve(input_items);
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -1382,7 +1679,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerSaveData
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Transform(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_FitBufferView(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1390,18 +1687,34 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Transform(/*in*/ FromStri
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        // Input
-        auto result(transformer.execute(input));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        // Output
-        *output = result;
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -1411,27 +1724,25 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Transform(/*in*/ FromStri
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  FromStringFeaturizer <uint8> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateEstimator(/*out*/ FromStringFeaturizer_uint8_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_FitArrow(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        pEstimator->begin_training();
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<FromStringFeaturizer_uint8_EstimatorHandle*>(index);
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
 
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -1441,7 +1752,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateEstimator(/*out*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_DestroyEstimator(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_OnDataCompleted(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1450,11 +1761,9 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_DestroyEstimator(/*in*/ F
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        estimator.on_data_completed();
     
         return true;
     }
@@ -1464,7 +1773,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_DestroyEstimator(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_GetState(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CompleteTraining(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1472,11 +1781,10 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_GetState(/*in*/ FromStrin
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        estimator.complete_training();
     
         return true;
     }
@@ -1486,19 +1794,25 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_GetState(/*in*/ FromStrin
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_IsTrainingComplete(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_int32_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1508,23 +1822,48 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_IsTrainingComplete(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Fit(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType(archive));
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int32_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ FromStringFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1534,7 +1873,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Fit(/*in*/ FromStringFeat
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_FitBuffer(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CloneTransformer(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*out*/ FromStringFeaturizer_int32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1542,31 +1881,37 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_FitBuffer(/*in*/ FromStri
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<FromStringFeaturizer_int32_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
 
-        std::vector<std::string> input_buffer;
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_DestroyTransformer(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
 
-        input_buffer.reserve(input_items);
+    try {
+        *ppErrorInfo = nullptr;
 
-        char const * const * const input_end(input_ptr + input_items);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        while(input_ptr != input_end) {
-        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr);
-        #else
-            input_buffer.emplace_back(*input_ptr);
-        #endif
-            ++input_ptr;
-        }
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        delete pTransformer;
     
         return true;
     }
@@ -1576,7 +1921,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_FitBuffer(/*in*/ FromStri
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_OnDataCompleted(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return FromStringFeaturizer_int32_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerSaveDataWithLayout(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1584,10 +1933,23 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_OnDataCompleted(/*in*/ Fr
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        estimator.on_data_completed();
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -1597,7 +1959,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_OnDataCompleted(/*in*/ Fr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CompleteTraining(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerSaveDataFile(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1605,10 +1967,17 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CompleteTraining(/*in*/ F
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.complete_training();
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -1618,25 +1987,26 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CompleteTraining(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Transform(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType*>(estimator.create_transformer().release());
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Input
+        auto result(transformer.execute(input));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint8_TransformerHandle*>(index);
+        // Output
+        *output = result;
     
         return true;
     }
@@ -1646,23 +2016,26 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerFromEsti
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_TransformView(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType(archive));
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint8_TransformerHandle*>(index);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -1672,7 +2045,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerFromSave
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_DestroyTransformer(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_TransformBatch(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1681,12 +2054,39 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_DestroyTransformer(/*in*/
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
 
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        delete pTransformer;
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -1696,7 +2096,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_DestroyTransformer(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_TransformBatchView(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1704,22 +2104,43 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerSaveData
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
 
-        transformer.save(archive);
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType::TransformedType &result) {
+                *output = result;
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+                ++output;
+            }
+        );
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        // Input
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -1729,7 +2150,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerSaveData
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Transform(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_TransformArrow(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1738,17 +2159,31 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Transform(/*in*/ FromStri
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
 
         // Input
-        auto result(transformer.execute(input));
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
 
-        // Output
-        *output = result;
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -1760,10 +2195,10 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Transform(/*in*/ FromStri
 
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
-/* |  FromStringFeaturizer <uint16> */
+/* |  FromStringFeaturizer <int64> */
 /* |                                                                      */
 /* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateEstimator(/*out*/ FromStringFeaturizer_uint16_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateEstimator(/*out*/ FromStringFeaturizer_int64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1771,12 +2206,12 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateEstimator(/*out*/
         *ppErrorInfo = nullptr;
 
         // No validation
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
 
         pEstimator->begin_training();
 
         size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<FromStringFeaturizer_uint16_EstimatorHandle*>(index);
+        *ppHandle = reinterpret_cast<FromStringFeaturizer_int64_EstimatorHandle*>(index);
 
 
     
@@ -1788,7 +2223,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_DestroyEstimator(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_DestroyEstimator(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1798,7 +2233,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_DestroyEstimator(/*in*/
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
         size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(index);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(index);
         g_pointerTable.Remove(index);
 
         delete pEstimator;
@@ -1811,7 +2246,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_GetState(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_GetState(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1821,7 +2256,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_GetState(/*in*/ FromStri
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
         if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
         *pState = static_cast<TrainingState>(estimator.get_state());
     
@@ -1833,7 +2268,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_GetState(/*in*/ FromStri
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_IsTrainingComplete(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_IsTrainingComplete(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1843,7 +2278,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_IsTrainingComplete(/*in*
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
         if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
         *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
@@ -1855,7 +2290,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_IsTrainingComplete(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Fit(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Fit(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1868,7 +2303,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Fit(/*in*/ FromStringFea
 
         if(input == nullptr) throw std::invalid_argument("'input' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
 
         *pFitResult = static_cast<unsigned char>(estimator.fit(input));
@@ -1881,7 +2316,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Fit(/*in*/ FromStringFea
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_FitBuffer(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_FitView(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1892,15 +2327,41 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_FitBuffer(/*in*/ FromStr
         if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
 
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        std::vector<std::string> input_buffer;
 
-        input_buffer.reserve(input_items);
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
 
-        char const * const * const input_end(input_ptr + input_items);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_FitBuffer(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
 
         while(input_ptr != input_end) {
         #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
@@ -1911,7 +2372,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_FitBuffer(/*in*/ FromStr
             ++input_ptr;
         }
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
         *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
@@ -1923,7 +2384,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_FitBuffer(/*in*/ FromStr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_OnDataCompleted(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_FitBufferView(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1931,10 +2392,34 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_OnDataCompleted(/*in*/ F
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.on_data_completed();
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -1944,7 +2429,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_OnDataCompleted(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CompleteTraining(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_FitArrow(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1952,10 +2437,17 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CompleteTraining(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        estimator.complete_training();
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -1965,25 +2457,39 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CompleteTraining(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_OnDataCompleted(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CompleteTraining(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+    try {
+        *ppErrorInfo = nullptr;
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType*>(estimator.create_transformer().release());
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint16_TransformerHandle*>(index);
+        estimator.complete_training();
     
         return true;
     }
@@ -1993,23 +2499,25 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerFromEst
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_int64_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
         if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType(archive));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType*>(estimator.create_transformer().release());
+
 
         size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint16_TransformerHandle*>(index);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int64_TransformerHandle*>(index);
     
         return true;
     }
@@ -2019,21 +2527,23 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerFromSav
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_DestroyTransformer(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int64_TransformerHandle*>(index);
     
         return true;
     }
@@ -2043,30 +2553,22 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_DestroyTransformer(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ FromStringFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType(archive));
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_int64_TransformerHandle*>(index);
     
         return true;
     }
@@ -2076,7 +2578,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerSaveDat
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Transform(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CloneTransformer(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*out*/ FromStringFeaturizer_int64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2084,18 +2586,13 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Transform(/*in*/ FromStr
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input));
-
-        // Output
-        *output = result;
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<FromStringFeaturizer_int64_TransformerHandle*>(index);
     
         return true;
     }
@@ -2105,27 +2602,21 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Transform(/*in*/ FromStr
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  FromStringFeaturizer <uint32> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateEstimator(/*out*/ FromStringFeaturizer_uint32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_DestroyTransformer(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
-
-        pEstimator->begin_training();
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<FromStringFeaturizer_uint32_EstimatorHandle*>(index);
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
 
+        delete pTransformer;
     
         return true;
     }
@@ -2135,7 +2626,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_DestroyEstimator(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return FromStringFeaturizer_int64_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerSaveDataWithLayout(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2143,12 +2638,23 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_DestroyEstimator(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        delete pEstimator;
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -2158,7 +2664,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_GetState(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerSaveDataFile(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2166,11 +2672,17 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_GetState(/*in*/ FromStri
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -2180,7 +2692,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_GetState(/*in*/ FromStri
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_IsTrainingComplete(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Transform(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2188,11 +2700,18 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_IsTrainingComplete(/*in*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -2202,7 +2721,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_IsTrainingComplete(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Fit(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_TransformView(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2210,15 +2729,18 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Fit(/*in*/ FromStringFea
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+        // Output
+        *output = result;
     
         return true;
     }
@@ -2228,7 +2750,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Fit(/*in*/ FromStringFea
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_FitBuffer(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_TransformBatch(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2236,8 +2758,6 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_FitBuffer(/*in*/ FromStr
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
 
 
         if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
@@ -2257,10 +2777,21 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_FitBuffer(/*in*/ FromStr
         #endif
             ++input_ptr;
         }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -2270,7 +2801,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_FitBuffer(/*in*/ FromStr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_OnDataCompleted(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_TransformBatchView(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2279,30 +2810,42 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_OnDataCompleted(/*in*/ F
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.on_data_completed();
-    
-        return true;
-    }
-    catch(std::exception const &ex) {
-        *ppErrorInfo = CreateErrorInfo(ex);
-        return false;
-    }
-}
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CompleteTraining(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
-    if(ppErrorInfo == nullptr)
-        return false;
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-    try {
-        *ppErrorInfo = nullptr;
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType::TransformedType &result) {
+                *output = result;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+                ++output;
+            }
+        );
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+        // Input
+        std::vector<std::string> input_buffer;
 
-        estimator.complete_training();
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -2312,25 +2855,40 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CompleteTraining(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_TransformArrow(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType*>(estimator.create_transformer().release());
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType::TransformedType> output_builder(input_values.second);
 
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint32_TransformerHandle*>(index);
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -2340,23 +2898,27 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerFromEst
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  FromStringFeaturizer <uint8> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateEstimator(/*out*/ FromStringFeaturizer_uint8_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+        // No validation
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
 
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<FromStringFeaturizer_uint8_EstimatorHandle*>(index);
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType(archive));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -2366,7 +2928,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerFromSav
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_DestroyTransformer(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_DestroyEstimator(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2376,11 +2938,10 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_DestroyTransformer(/*in*
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
         size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(index);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(index);
         g_pointerTable.Remove(index);
 
-
-        delete pTransformer;
+        delete pEstimator;
     
         return true;
     }
@@ -2390,7 +2951,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_DestroyTransformer(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_GetState(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2398,22 +2959,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerSaveDat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        *pState = static_cast<TrainingState>(estimator.get_state());
     
         return true;
     }
@@ -2423,7 +2973,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerSaveDat
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Transform(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_IsTrainingComplete(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2431,18 +2981,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Transform(/*in*/ FromStr
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input));
-
-        // Output
-        *output = result;
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
         return true;
     }
@@ -2452,27 +2995,23 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Transform(/*in*/ FromStr
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  FromStringFeaturizer <uint64> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateEstimator(/*out*/ FromStringFeaturizer_uint64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Fit(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        pEstimator->begin_training();
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<FromStringFeaturizer_uint64_EstimatorHandle*>(index);
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
 
 
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
     
         return true;
     }
@@ -2482,7 +3021,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_DestroyEstimator(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_FitView(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2490,12 +3029,15 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_DestroyEstimator(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(index);
-        g_pointerTable.Remove(index);
 
-        delete pEstimator;
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
     
         return true;
     }
@@ -2505,7 +3047,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_GetState(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_FitBuffer(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2513,33 +3055,31 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_GetState(/*in*/ FromStri
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
-    
-        return true;
-    }
-    catch(std::exception const &ex) {
-        *ppErrorInfo = CreateErrorInfo(ex);
-        return false;
-    }
-}
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_IsTrainingComplete(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
-    if(ppErrorInfo == nullptr)
-        return false;
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-    try {
-        *ppErrorInfo = nullptr;
+        std::vector<std::string> input_buffer;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        input_buffer.reserve(input_items);
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+        char const * const * const input_end(input_ptr + input_items);
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -2549,7 +3089,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_IsTrainingComplete(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Fit(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_FitBufferView(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2560,12 +3100,31 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Fit(/*in*/ FromStringFea
         if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -2575,7 +3134,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Fit(/*in*/ FromStringFea
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_FitBuffer(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_FitArrow(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2585,29 +3144,15 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_FitBuffer(/*in*/ FromStr
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
         if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
-
-        std::vector<std::string> input_buffer;
-
-        input_buffer.reserve(input_items);
-
-        char const * const * const input_end(input_ptr + input_items);
-
-        while(input_ptr != input_end) {
-        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr);
-        #else
-            input_buffer.emplace_back(*input_ptr);
-        #endif
-            ++input_ptr;
-        }
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -2617,7 +3162,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_FitBuffer(/*in*/ FromStr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_OnDataCompleted(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_OnDataCompleted(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2626,7 +3171,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_OnDataCompleted(/*in*/ F
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
 
         estimator.on_data_completed();
     
@@ -2638,7 +3183,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_OnDataCompleted(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CompleteTraining(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CompleteTraining(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2647,7 +3192,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CompleteTraining(/*in*/
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
 
         estimator.complete_training();
     
@@ -2659,7 +3204,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CompleteTraining(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_uint8_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2671,13 +3216,13 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerFromEst
 
 
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType*>(estimator.create_transformer().release());
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType*>(estimator.create_transformer().release());
 
 
         size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint64_TransformerHandle*>(index);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint8_TransformerHandle*>(index);
     
         return true;
     }
@@ -2687,7 +3232,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerFromEst
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2700,10 +3245,10 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerFromSav
 
         Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType(archive));
 
         size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint64_TransformerHandle*>(index);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint8_TransformerHandle*>(index);
     
         return true;
     }
@@ -2713,21 +3258,22 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerFromSav
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_DestroyTransformer(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ FromStringFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint8_TransformerHandle*>(index);
     
         return true;
     }
@@ -2737,7 +3283,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_DestroyTransformer(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CloneTransformer(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ FromStringFeaturizer_uint8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2745,22 +3291,13 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerSaveDat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<FromStringFeaturizer_uint8_TransformerHandle*>(index);
     
         return true;
     }
@@ -2770,7 +3307,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerSaveDat
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Transform(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_DestroyTransformer(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2779,17 +3316,12 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Transform(/*in*/ FromStr
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -2799,27 +3331,35 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Transform(/*in*/ FromStr
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  FromStringFeaturizer <float> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateEstimator(/*out*/ FromStringFeaturizer_float_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return FromStringFeaturizer_uint8_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerSaveDataWithLayout(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<FromStringFeaturizer_float_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -2829,7 +3369,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateEstimator(/*out*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_DestroyEstimator(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerSaveDataFile(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2837,12 +3377,17 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_DestroyEstimator(/*in*/ F
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -2852,7 +3397,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_DestroyEstimator(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_GetState(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Transform(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2860,11 +3405,18 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_GetState(/*in*/ FromStrin
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -2874,7 +3426,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_GetState(/*in*/ FromStrin
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_IsTrainingComplete(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_TransformView(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2882,11 +3434,18 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_IsTrainingComplete(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -2896,7 +3455,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_IsTrainingComplete(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Fit(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_TransformBatch(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2904,15 +3463,40 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Fit(/*in*/ FromStringFeat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        std::vector<std::string> input_buffer;
 
+        input_buffer.reserve(input_items);
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -2922,7 +3506,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Fit(/*in*/ FromStringFeat
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_FitBuffer(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_TransformBatchView(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2930,31 +3514,43 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_FitBuffer(/*in*/ FromStri
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
         if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
 
+        // Input
         std::vector<std::string> input_buffer;
 
         input_buffer.reserve(input_items);
 
-        char const * const * const input_end(input_ptr + input_items);
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
 
-        while(input_ptr != input_end) {
         #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr);
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
         #else
-            input_buffer.emplace_back(*input_ptr);
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
         #endif
-            ++input_ptr;
         }
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
-
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -2964,7 +3560,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_FitBuffer(/*in*/ FromStri
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_OnDataCompleted(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_TransformArrow(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2973,9 +3569,31 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_OnDataCompleted(/*in*/ Fr
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        estimator.on_data_completed();
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -2985,18 +3603,27 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_OnDataCompleted(/*in*/ Fr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CompleteTraining(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  FromStringFeaturizer <uint16> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateEstimator(/*out*/ FromStringFeaturizer_uint16_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        // No validation
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<FromStringFeaturizer_uint16_EstimatorHandle*>(index);
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.complete_training();
     
         return true;
     }
@@ -3006,25 +3633,20 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CompleteTraining(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_DestroyEstimator(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType*>(estimator.create_transformer().release());
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(index);
+        g_pointerTable.Remove(index);
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_float_TransformerHandle*>(index);
+        delete pEstimator;
     
         return true;
     }
@@ -3034,23 +3656,19 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerFromEsti
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_GetState(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_float_TransformerHandle*>(index);
+        *pState = static_cast<TrainingState>(estimator.get_state());
     
         return true;
     }
@@ -3060,7 +3678,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerFromSave
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_DestroyTransformer(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_IsTrainingComplete(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3068,13 +3686,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_DestroyTransformer(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
-
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pTransformer;
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
         return true;
     }
@@ -3084,7 +3700,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_DestroyTransformer(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Fit(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3092,22 +3708,15 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerSaveData
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        transformer.save(archive);
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
     
         return true;
     }
@@ -3117,7 +3726,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerSaveData
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Transform(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_FitView(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3125,18 +3734,15 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Transform(/*in*/ FromStri
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        // Input
-        auto result(transformer.execute(input));
 
-        // Output
-        *output = result;
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
     
         return true;
     }
@@ -3146,27 +3752,39 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Transform(/*in*/ FromStri
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  FromStringFeaturizer <double> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateEstimator(/*out*/ FromStringFeaturizer_double_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_FitBuffer(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        pEstimator->begin_training();
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<FromStringFeaturizer_double_EstimatorHandle*>(index);
 
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
 
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -3176,7 +3794,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_DestroyEstimator(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_FitBufferView(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3184,12 +3802,34 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_DestroyEstimator(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(index);
-        g_pointerTable.Remove(index);
 
-        delete pEstimator;
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -3199,7 +3839,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_GetState(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_FitArrow(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3207,11 +3847,17 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_GetState(/*in*/ FromStri
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -3221,7 +3867,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_GetState(/*in*/ FromStri
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_IsTrainingComplete(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_OnDataCompleted(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3229,11 +3875,10 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_IsTrainingComplete(/*in*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        estimator.on_data_completed();
     
         return true;
     }
@@ -3243,7 +3888,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_IsTrainingComplete(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Fit(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CompleteTraining(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3251,15 +3896,10 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Fit(/*in*/ FromStringFea
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+        estimator.complete_training();
     
         return true;
     }
@@ -3269,39 +3909,25 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Fit(/*in*/ FromStringFea
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_FitBuffer(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_uint16_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
 
 
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
-
-        std::vector<std::string> input_buffer;
-
-        input_buffer.reserve(input_items);
-
-        char const * const * const input_end(input_ptr + input_items);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
 
-        while(input_ptr != input_end) {
-        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr);
-        #else
-            input_buffer.emplace_back(*input_ptr);
-        #endif
-            ++input_ptr;
-        }
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType*>(estimator.create_transformer().release());
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint16_TransformerHandle*>(index);
     
         return true;
     }
@@ -3311,18 +3937,23 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_FitBuffer(/*in*/ FromStr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_OnDataCompleted(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        estimator.on_data_completed();
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint16_TransformerHandle*>(index);
     
         return true;
     }
@@ -3332,18 +3963,22 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_OnDataCompleted(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CompleteTraining(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ FromStringFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-        estimator.complete_training();
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint16_TransformerHandle*>(index);
     
         return true;
     }
@@ -3353,25 +3988,21 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CompleteTraining(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CloneTransformer(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ FromStringFeaturizer_uint16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType*>(estimator.create_transformer().release());
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_double_TransformerHandle*>(index);
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<FromStringFeaturizer_uint16_TransformerHandle*>(index);
     
         return true;
     }
@@ -3381,23 +4012,21 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerFromEst
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_DestroyTransformer(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType(archive));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_double_TransformerHandle*>(index);
+        delete pTransformer;
     
         return true;
     }
@@ -3407,7 +4036,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerFromSav
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_DestroyTransformer(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return FromStringFeaturizer_uint16_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerSaveDataWithLayout(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3415,13 +4048,23 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_DestroyTransformer(/*in*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
-        delete pTransformer;
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -3431,7 +4074,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_DestroyTransformer(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerSaveDataFile(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3439,22 +4082,17 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerSaveDat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -3464,7 +4102,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerSaveDat
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Transform(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Transform(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3477,7 +4115,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Transform(/*in*/ FromStr
         if(input == nullptr) throw std::invalid_argument("'input' is null");
         if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
         // Input
         auto result(transformer.execute(input));
@@ -3493,27 +4131,26 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Transform(/*in*/ FromStr
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  FromStringFeaturizer <bool> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateEstimator(/*out*/ FromStringFeaturizer_bool_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_TransformView(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        pEstimator->begin_training();
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<FromStringFeaturizer_bool_EstimatorHandle*>(index);
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
 
+        // Output
+        *output = result;
     
         return true;
     }
@@ -3523,7 +4160,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateEstimator(/*out*/ Fr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_DestroyEstimator(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_TransformBatch(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3532,11 +4169,39 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_DestroyEstimator(/*in*/ Fr
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(index);
-        g_pointerTable.Remove(index);
 
-        delete pEstimator;
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -3546,7 +4211,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_DestroyEstimator(/*in*/ Fr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_GetState(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_TransformBatchView(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3554,11 +4219,43 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_GetState(/*in*/ FromString
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -3568,7 +4265,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_GetState(/*in*/ FromString
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_IsTrainingComplete(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_TransformArrow(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3576,11 +4273,32 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_IsTrainingComplete(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -3590,23 +4308,27 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_IsTrainingComplete(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Fit(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  FromStringFeaturizer <uint32> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateEstimator(/*out*/ FromStringFeaturizer_uint32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
+        // No validation
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        pEstimator->begin_training();
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<FromStringFeaturizer_uint32_EstimatorHandle*>(index);
 
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
     
         return true;
     }
@@ -3616,7 +4338,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Fit(/*in*/ FromStringFeatu
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_FitBuffer(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_DestroyEstimator(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3624,31 +4346,12 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_FitBuffer(/*in*/ FromStrin
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
-
-        std::vector<std::string> input_buffer;
-
-        input_buffer.reserve(input_items);
-
-        char const * const * const input_end(input_ptr + input_items);
-
-        while(input_ptr != input_end) {
-        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr);
-        #else
-            input_buffer.emplace_back(*input_ptr);
-        #endif
-            ++input_ptr;
-        }
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(index);
+        g_pointerTable.Remove(index);
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        delete pEstimator;
     
         return true;
     }
@@ -3658,7 +4361,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_FitBuffer(/*in*/ FromStrin
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_OnDataCompleted(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_GetState(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3666,10 +4369,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_OnDataCompleted(/*in*/ Fro
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.on_data_completed();
+        *pState = static_cast<TrainingState>(estimator.get_state());
     
         return true;
     }
@@ -3679,7 +4383,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_OnDataCompleted(/*in*/ Fro
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CompleteTraining(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_IsTrainingComplete(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3687,10 +4391,11 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CompleteTraining(/*in*/ Fr
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.complete_training();
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
         return true;
     }
@@ -3700,25 +4405,23 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CompleteTraining(/*in*/ Fr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_bool_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Fit(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pEstimatorHandle)));
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType*>(estimator.create_transformer().release());
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
 
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_bool_TransformerHandle*>(index);
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
     
         return true;
     }
@@ -3728,23 +4431,23 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerFromEstim
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_bool_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_FitView(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType(archive));
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_bool_TransformerHandle*>(index);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
     
         return true;
     }
@@ -3754,7 +4457,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerFromSaved
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_DestroyTransformer(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_FitBuffer(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3762,46 +4465,31 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_DestroyTransformer(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(index);
-        g_pointerTable.Remove(index);
-
-
-        delete pTransformer;
-    
-        return true;
-    }
-    catch(std::exception const &ex) {
-        *ppErrorInfo = CreateErrorInfo(ex);
-        return false;
-    }
-}
-
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
-    if(ppErrorInfo == nullptr)
-        return false;
 
-    try {
-        *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        std::vector<std::string> input_buffer;
 
-        transformer.save(archive);
+        input_buffer.reserve(input_items);
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        char const * const * const input_end(input_ptr + input_items);
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -3811,7 +4499,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerSaveData(
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Transform(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_FitBufferView(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3819,18 +4507,34 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Transform(/*in*/ FromStrin
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        // Input
-        auto result(transformer.execute(input));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        // Output
-        *output = result;
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -3840,27 +4544,25 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Transform(/*in*/ FromStrin
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  FromStringFeaturizer <string> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateEstimator(/*out*/ FromStringFeaturizer_string_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_FitArrow(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        pEstimator->begin_training();
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<FromStringFeaturizer_string_EstimatorHandle*>(index);
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
 
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -3870,7 +4572,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_DestroyEstimator(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_OnDataCompleted(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3879,11 +4581,9 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_DestroyEstimator(/*in*/
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        estimator.on_data_completed();
     
         return true;
     }
@@ -3893,7 +4593,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_GetState(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CompleteTraining(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3901,11 +4601,10 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_GetState(/*in*/ FromStri
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        estimator.complete_training();
     
         return true;
     }
@@ -3915,19 +4614,25 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_GetState(/*in*/ FromStri
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_IsTrainingComplete(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_uint32_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -3937,23 +4642,23 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_IsTrainingComplete(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_Fit(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType(archive));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -3963,39 +4668,22 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_Fit(/*in*/ FromStringFea
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_FitBuffer(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ FromStringFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
-
-        std::vector<std::string> input_buffer;
-
-        input_buffer.reserve(input_items);
-
-        char const * const * const input_end(input_ptr + input_items);
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        while(input_ptr != input_end) {
-        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr);
-        #else
-            input_buffer.emplace_back(*input_ptr);
-        #endif
-            ++input_ptr;
-        }
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType(archive));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -4005,7 +4693,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_FitBuffer(/*in*/ FromStr
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_OnDataCompleted(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CloneTransformer(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ FromStringFeaturizer_uint32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -4013,10 +4701,13 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_OnDataCompleted(/*in*/ F
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        estimator.on_data_completed();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<FromStringFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -4026,7 +4717,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_OnDataCompleted(/*in*/ F
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CompleteTraining(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_DestroyTransformer(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -4035,9 +4726,12 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CompleteTraining(/*in*/
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        estimator.complete_training();
+
+        delete pTransformer;
     
         return true;
     }
@@ -4047,25 +4741,35 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CompleteTraining(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_string_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return FromStringFeaturizer_uint32_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerSaveDataWithLayout(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType*>(estimator.create_transformer().release());
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_string_TransformerHandle*>(index);
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -4075,23 +4779,25 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerFromEst
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_string_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerSaveDataFile(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_string_TransformerHandle*>(index);
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -4101,7 +4807,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerFromSav
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_DestroyTransformer(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Transform(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -4110,12 +4816,17 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_DestroyTransformer(/*in*
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(index);
-        g_pointerTable.Remove(index);
 
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        delete pTransformer;
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -4125,7 +4836,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_DestroyTransformer(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_TransformView(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -4133,22 +4844,18 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerSaveDat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
 
-        transformer.save(archive);
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        // Output
+        *output = result;
     
         return true;
     }
@@ -4158,7 +4865,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerSaveDat
     }
 }
 
-FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_Transform(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ char const ** output_ptr, /*out*/ std::size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_TransformBatch(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -4168,11 +4875,3478 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_Transform(/*in*/ FromStr
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
 
-        if(input == nullptr) throw std::invalid_argument("'input' is null");
-        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
-        if(output_items == nullptr) throw std::invalid_argument("'output_items' is null");
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_TransformBatchView(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_TransformArrow(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  FromStringFeaturizer <uint64> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateEstimator(/*out*/ FromStringFeaturizer_uint64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<FromStringFeaturizer_uint64_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_DestroyEstimator(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_GetState(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_IsTrainingComplete(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Fit(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_FitView(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_FitBuffer(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_FitBufferView(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_FitArrow(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_OnDataCompleted(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CompleteTraining(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.complete_training();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_uint64_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ FromStringFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_uint64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CloneTransformer(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ FromStringFeaturizer_uint64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<FromStringFeaturizer_uint64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_DestroyTransformer(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return FromStringFeaturizer_uint64_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerSaveDataWithLayout(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerSaveDataFile(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Transform(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_TransformView(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_TransformBatch(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_TransformBatchView(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_TransformArrow(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  FromStringFeaturizer <float> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateEstimator(/*out*/ FromStringFeaturizer_float_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<FromStringFeaturizer_float_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_DestroyEstimator(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_GetState(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_IsTrainingComplete(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Fit(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_FitView(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_FitBuffer(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_FitBufferView(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_FitArrow(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_OnDataCompleted(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CompleteTraining(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.complete_training();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_float_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ FromStringFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CloneTransformer(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*out*/ FromStringFeaturizer_float_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<FromStringFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_DestroyTransformer(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return FromStringFeaturizer_float_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerSaveDataWithLayout(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerSaveDataFile(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Transform(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_TransformView(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_TransformBatch(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_TransformBatchView(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_TransformArrow(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  FromStringFeaturizer <double> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateEstimator(/*out*/ FromStringFeaturizer_double_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<FromStringFeaturizer_double_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_DestroyEstimator(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_GetState(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_IsTrainingComplete(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Fit(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_FitView(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_FitBuffer(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_FitBufferView(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_FitArrow(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_OnDataCompleted(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CompleteTraining(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.complete_training();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_double_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ FromStringFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CloneTransformer(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*out*/ FromStringFeaturizer_double_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<FromStringFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_DestroyTransformer(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return FromStringFeaturizer_double_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerSaveDataWithLayout(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerSaveDataFile(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Transform(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_TransformView(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_TransformBatch(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_TransformBatchView(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_TransformArrow(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  FromStringFeaturizer <bool> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateEstimator(/*out*/ FromStringFeaturizer_bool_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<FromStringFeaturizer_bool_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_DestroyEstimator(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_GetState(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_IsTrainingComplete(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Fit(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_FitView(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_FitBuffer(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_FitBufferView(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_FitArrow(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_OnDataCompleted(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CompleteTraining(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.complete_training();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_bool_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_bool_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_bool_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_bool_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_bool_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ FromStringFeaturizer_bool_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_bool_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CloneTransformer(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*out*/ FromStringFeaturizer_bool_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<FromStringFeaturizer_bool_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_DestroyTransformer(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return FromStringFeaturizer_bool_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerSaveDataWithLayout(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerSaveDataFile(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Transform(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_TransformView(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_TransformBatch(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_TransformBatchView(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_TransformArrow(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  FromStringFeaturizer <string> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateEstimator(/*out*/ FromStringFeaturizer_string_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>* pEstimator = new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<FromStringFeaturizer_string_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_DestroyEstimator(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_GetState(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_IsTrainingComplete(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_Fit(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_FitView(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_FitBuffer(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_FitBufferView(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_FitArrow(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_OnDataCompleted(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CompleteTraining(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.complete_training();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerFromEstimator(/*in*/ FromStringFeaturizer_string_EstimatorHandle *pEstimatorHandle, /*out*/ FromStringFeaturizer_string_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_string_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ FromStringFeaturizer_string_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_string_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ FromStringFeaturizer_string_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<FromStringFeaturizer_string_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CloneTransformer(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*out*/ FromStringFeaturizer_string_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<FromStringFeaturizer_string_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_DestroyTransformer(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return FromStringFeaturizer_string_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerSaveDataWithLayout(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_CreateTransformerSaveDataFile(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_Transform(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ char const ** output_ptr, /*out*/ std::size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_items == nullptr) throw std::invalid_argument("'output_items' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
         // Input
         auto result(transformer.execute(input));
@@ -4200,6 +8374,287 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_Transform(/*in*/ FromStr
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_TransformView(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ char const ** output_ptr, /*out*/ std::size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_items == nullptr) throw std::invalid_argument("'output_items' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+
+        // Output
+        if(result.empty()) {
+            *output_ptr = nullptr;
+            *output_items = 0;
+        }
+        else {
+            char * string_buffer(new char[result.size() + 1]);
+
+            std::copy(result.begin(), result.end(), string_buffer);
+            string_buffer[result.size()] = 0;
+
+            *output_ptr = string_buffer;
+            *output_items = result.size();
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_TransformBatch(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ char const ** output_ptr, /*out*/ std::size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_items == nullptr) throw std::invalid_argument("'output_items' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_items_begin(output_items);
+        auto const output_func(
+            [&output_ptr, &output_items](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_items = 0;
+                }
+                else {
+                    char * string_buffer(new char[result.size() + 1]);
+
+                    std::copy(result.begin(), result.end(), string_buffer);
+                    string_buffer[result.size()] = 0;
+
+                    *output_ptr = string_buffer;
+                    *output_items = result.size();
+                }
+
+                ++output_ptr;
+                ++output_items;
+            }
+        );
+
+        // Input
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(FromStringFeaturizer_string_DestroyTransformedData(output_ptr_begin[result_index], output_items_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_TransformBatchView(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ char const ** output_ptr, /*out*/ std::size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_items == nullptr) throw std::invalid_argument("'output_items' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_items_begin(output_items);
+        auto const output_func(
+            [&output_ptr, &output_items](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_items = 0;
+                }
+                else {
+                    char * string_buffer(new char[result.size() + 1]);
+
+                    std::copy(result.begin(), result.end(), string_buffer);
+                    string_buffer[result.size()] = 0;
+
+                    *output_ptr = string_buffer;
+                    *output_items = result.size();
+                }
+
+                ++output_ptr;
+                ++output_items;
+            }
+        );
+
+        // Input
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(FromStringFeaturizer_string_DestroyTransformedData(output_ptr_begin[result_index], output_items_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_TransformArrow(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_TransformIntoBuffer(/*in*/ FromStringFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ char *output_ptr, /*in*/ std::size_t output_capacity, /*out*/ std::size_t *output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input == nullptr) throw std::invalid_argument("'input' is null");
+        if(output_ptr == nullptr && output_capacity != 0) throw std::invalid_argument("'output_ptr' is null");
+        if(output_items == nullptr) throw std::invalid_argument("'output_items' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output_items = result.size();
+
+        if(result.size() <= output_capacity)
+            std::copy(result.begin(), result.end(), output_ptr);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_string_DestroyTransformedData(/*in*/ char const *result_ptr, /*in*/ std::size_t result_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
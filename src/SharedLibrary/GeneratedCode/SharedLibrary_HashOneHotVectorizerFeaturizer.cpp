@@ -6,13 +6,68 @@
 
 #include "SharedLibrary_HashOneHotVectorizerFeaturizer.h"
 #include "SharedLibrary_PointerTable.h"
+#include "../SharedLibrary_Arrow.h"
 
 #include "Archive.h"
+#include "FileArchive.h"
 #include "HashOneHotVectorizerFeaturizer.h"
 
 // These method(s) are defined in SharedLibrary_Common.cpp
 ErrorInfoHandle * CreateErrorInfo(std::exception const &ex);
 std::chrono::system_clock::time_point CreateDateTime(DateTimeParameter const &param);
+Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout);
+
+namespace {
+
+// Transforms the inputs with a single call to the transformer's batch
+// `execute` method and invokes `outputFunc` for each result.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::true_type /*is_default_constructible*/) {
+    std::unique_ptr<typename TransformerT::TransformedType []> pResults(new typename TransformerT::TransformedType[cInputs]);
+
+    transformer.execute(pInputs, cInputs, pResults.get());
+
+    for(std::size_t index = 0; index < cInputs; ++index)
+        outputFunc(pResults[index]);
+}
+
+// The batch `execute` method writes to constructed items; results that can't be
+// default constructed are transformed one at a time.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::false_type /*is_default_constructible*/) {
+    typename TransformerT::InputType const * const  pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs) {
+        typename TransformerT::TransformedType      result(transformer.execute(*pInputs));
+
+        outputFunc(result);
+        ++pInputs;
+    }
+}
+
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc, std::is_default_constructible<typename TransformerT::TransformedType>());
+}
+
+// Results are written directly to the caller's buffer when its type is the
+// transformed type; otherwise, each result is converted by `outputFunc`.
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &/*outputFunc*/, std::true_type /*is_transformed_type*/) {
+    transformer.execute(pInputs, cInputs, pOutputs);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT * /*pOutputs*/, OutputFuncT const &outputFunc, std::false_type /*is_transformed_type*/) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &outputFunc) {
+    TransformBatchToOutput(transformer, pInputs, cInputs, pOutputs, outputFunc, std::is_same<OutputT, typename TransformerT::TransformedType>());
+}
+
+} // anonymous namespace
 
 extern "C" {
 
@@ -173,6 +228,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_FitBuffer(/*in*/
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_FitArrow(/*in*/ HashOneHotVectorizerFeaturizer_int8_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::int8_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_int8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -269,6 +352,55 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_CreateTransforme
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ HashOneHotVectorizerFeaturizer_int8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_int8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_CloneTransformer(/*in*/ HashOneHotVectorizerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ HashOneHotVectorizerFeaturizer_int8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_int8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -294,6 +426,10 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_DestroyTransform
 }
 
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return HashOneHotVectorizerFeaturizer_int8_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_CreateTransformerSaveDataWithLayout(/*in*/ HashOneHotVectorizerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -305,11 +441,12 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_CreateTransforme
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -326,6 +463,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_CreateTransforme
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_CreateTransformerSaveDataFile(/*in*/ HashOneHotVectorizerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_Transform(/*in*/ HashOneHotVectorizerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t input, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -359,6 +524,48 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_Transform(/*in*/
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_TransformBatch(/*in*/ HashOneHotVectorizerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_ptr, input_items, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  HashOneHotVectorizerFeaturizer <int16> */
@@ -509,6 +716,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_FitBuffer(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_FitArrow(/*in*/ HashOneHotVectorizerFeaturizer_int16_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::int16_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -605,6 +840,55 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_CreateTransform
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ HashOneHotVectorizerFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_int16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_CloneTransformer(/*in*/ HashOneHotVectorizerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ HashOneHotVectorizerFeaturizer_int16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_int16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -630,6 +914,10 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_DestroyTransfor
 }
 
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return HashOneHotVectorizerFeaturizer_int16_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_CreateTransformerSaveDataWithLayout(/*in*/ HashOneHotVectorizerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -641,11 +929,12 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_CreateTransform
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -662,6 +951,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_CreateTransform
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_CreateTransformerSaveDataFile(/*in*/ HashOneHotVectorizerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_Transform(/*in*/ HashOneHotVectorizerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t input, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -695,6 +1012,48 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_Transform(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_TransformBatch(/*in*/ HashOneHotVectorizerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_ptr, input_items, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  HashOneHotVectorizerFeaturizer <int32> */
@@ -845,7 +1204,7 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_FitBuffer(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_FitArrow(/*in*/ HashOneHotVectorizerFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -853,10 +1212,17 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_OnDataCompleted
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::int32_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.on_data_completed();
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -866,7 +1232,28 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_OnDataCompleted
     }
 }
 
-FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_CompleteTraining(/*in*/ HashOneHotVectorizerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_CompleteTraining(/*in*/ HashOneHotVectorizerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -941,6 +1328,55 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_CreateTransform
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ HashOneHotVectorizerFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_int32_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_CloneTransformer(/*in*/ HashOneHotVectorizerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ HashOneHotVectorizerFeaturizer_int32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_int32_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -966,6 +1402,10 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_DestroyTransfor
 }
 
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return HashOneHotVectorizerFeaturizer_int32_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_CreateTransformerSaveDataWithLayout(/*in*/ HashOneHotVectorizerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -977,11 +1417,12 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_CreateTransform
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -998,6 +1439,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_CreateTransform
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_CreateTransformerSaveDataFile(/*in*/ HashOneHotVectorizerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_Transform(/*in*/ HashOneHotVectorizerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t input, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1031,6 +1500,48 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_Transform(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_TransformBatch(/*in*/ HashOneHotVectorizerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_ptr, input_items, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  HashOneHotVectorizerFeaturizer <int64> */
@@ -1181,6 +1692,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_FitBuffer(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_FitArrow(/*in*/ HashOneHotVectorizerFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::int64_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1277,6 +1816,55 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_CreateTransform
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ HashOneHotVectorizerFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_int64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_CloneTransformer(/*in*/ HashOneHotVectorizerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ HashOneHotVectorizerFeaturizer_int64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_int64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1302,6 +1890,10 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_DestroyTransfor
 }
 
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return HashOneHotVectorizerFeaturizer_int64_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_CreateTransformerSaveDataWithLayout(/*in*/ HashOneHotVectorizerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1313,11 +1905,12 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_CreateTransform
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -1334,6 +1927,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_CreateTransform
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_CreateTransformerSaveDataFile(/*in*/ HashOneHotVectorizerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_Transform(/*in*/ HashOneHotVectorizerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t input, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1367,6 +1988,48 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_Transform(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_TransformBatch(/*in*/ HashOneHotVectorizerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_ptr, input_items, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  HashOneHotVectorizerFeaturizer <uint8> */
@@ -1517,6 +2180,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_FitBuffer(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_FitArrow(/*in*/ HashOneHotVectorizerFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::uint8_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1613,17 +2304,66 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_CreateTransform
     }
 }
 
-FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ HashOneHotVectorizerFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType>(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_uint8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_CloneTransformer(/*in*/ HashOneHotVectorizerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ HashOneHotVectorizerFeaturizer_uint8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_uint8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType>(index);
         g_pointerTable.Remove(index);
 
 
@@ -1638,6 +2378,10 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_DestroyTransfor
 }
 
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return HashOneHotVectorizerFeaturizer_uint8_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_CreateTransformerSaveDataWithLayout(/*in*/ HashOneHotVectorizerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1649,11 +2393,12 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_CreateTransform
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -1670,6 +2415,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_CreateTransform
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_CreateTransformerSaveDataFile(/*in*/ HashOneHotVectorizerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_Transform(/*in*/ HashOneHotVectorizerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t input, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1703,6 +2476,48 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_Transform(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_TransformBatch(/*in*/ HashOneHotVectorizerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_ptr, input_items, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  HashOneHotVectorizerFeaturizer <uint16> */
@@ -1853,6 +2668,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_FitBuffer(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_FitArrow(/*in*/ HashOneHotVectorizerFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::uint16_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1949,6 +2792,55 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_CreateTransfor
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ HashOneHotVectorizerFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_uint16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_CloneTransformer(/*in*/ HashOneHotVectorizerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ HashOneHotVectorizerFeaturizer_uint16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_uint16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1974,6 +2866,10 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_DestroyTransfo
 }
 
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return HashOneHotVectorizerFeaturizer_uint16_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_CreateTransformerSaveDataWithLayout(/*in*/ HashOneHotVectorizerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1985,11 +2881,12 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_CreateTransfor
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -2006,6 +2903,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_CreateTransfor
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_CreateTransformerSaveDataFile(/*in*/ HashOneHotVectorizerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_Transform(/*in*/ HashOneHotVectorizerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t input, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2039,6 +2964,48 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_Transform(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_TransformBatch(/*in*/ HashOneHotVectorizerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_ptr, input_items, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  HashOneHotVectorizerFeaturizer <uint32> */
@@ -2189,6 +3156,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_FitBuffer(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_FitArrow(/*in*/ HashOneHotVectorizerFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::uint32_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2285,21 +3280,22 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_CreateTransfor
     }
 }
 
-FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -2309,7 +3305,7 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_DestroyTransfo
     }
 }
 
-FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_CloneTransformer(/*in*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2317,22 +3313,13 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_CreateTransfor
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
-
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -2342,7 +3329,97 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_CreateTransfor
     }
 }
 
-FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_Transform(/*in*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t input, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return HashOneHotVectorizerFeaturizer_uint32_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_CreateTransformerSaveDataWithLayout(/*in*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_CreateTransformerSaveDataFile(/*in*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_Transform(/*in*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t input, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2375,6 +3452,48 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_Transform(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_TransformBatch(/*in*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_ptr, input_items, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  HashOneHotVectorizerFeaturizer <uint64> */
@@ -2525,6 +3644,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_FitBuffer(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_FitArrow(/*in*/ HashOneHotVectorizerFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::uint64_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2621,6 +3768,55 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_CreateTransfor
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ HashOneHotVectorizerFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_uint64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_CloneTransformer(/*in*/ HashOneHotVectorizerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ HashOneHotVectorizerFeaturizer_uint64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_uint64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2646,6 +3842,10 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_DestroyTransfo
 }
 
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return HashOneHotVectorizerFeaturizer_uint64_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_CreateTransformerSaveDataWithLayout(/*in*/ HashOneHotVectorizerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2657,11 +3857,12 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_CreateTransfor
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -2678,6 +3879,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_CreateTransfor
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_CreateTransformerSaveDataFile(/*in*/ HashOneHotVectorizerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_Transform(/*in*/ HashOneHotVectorizerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t input, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2711,6 +3940,48 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_Transform(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_TransformBatch(/*in*/ HashOneHotVectorizerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_ptr, input_items, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  HashOneHotVectorizerFeaturizer <float> */
@@ -2861,6 +4132,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_FitBuffer(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_FitArrow(/*in*/ HashOneHotVectorizerFeaturizer_float_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::float_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2957,21 +4256,22 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_CreateTransform
     }
 }
 
-FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_float_TransformerHandle*>(index);
     
         return true;
     }
@@ -2981,7 +4281,7 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_DestroyTransfor
     }
 }
 
-FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_CloneTransformer(/*in*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle *pHandle, /*out*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2989,17 +4289,70 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_CreateTransform
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return HashOneHotVectorizerFeaturizer_float_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_CreateTransformerSaveDataWithLayout(/*in*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
         std::copy(buffer.begin(), buffer.end(), new_buffer);
 
@@ -3014,6 +4367,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_CreateTransform
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_CreateTransformerSaveDataFile(/*in*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_Transform(/*in*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float input, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3047,6 +4428,48 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_Transform(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_TransformBatch(/*in*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_ptr, input_items, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  HashOneHotVectorizerFeaturizer <double> */
@@ -3197,6 +4620,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_FitBuffer(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_FitArrow(/*in*/ HashOneHotVectorizerFeaturizer_double_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::double_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3293,6 +4744,55 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_CreateTransfor
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ HashOneHotVectorizerFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_CloneTransformer(/*in*/ HashOneHotVectorizerFeaturizer_double_TransformerHandle *pHandle, /*out*/ HashOneHotVectorizerFeaturizer_double_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_double_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3318,6 +4818,10 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_DestroyTransfo
 }
 
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return HashOneHotVectorizerFeaturizer_double_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_CreateTransformerSaveDataWithLayout(/*in*/ HashOneHotVectorizerFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3329,11 +4833,12 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_CreateTransfor
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -3350,6 +4855,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_CreateTransfor
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_CreateTransformerSaveDataFile(/*in*/ HashOneHotVectorizerFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_Transform(/*in*/ HashOneHotVectorizerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double input, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3383,6 +4916,48 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_Transform(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_TransformBatch(/*in*/ HashOneHotVectorizerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_ptr, input_items, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  HashOneHotVectorizerFeaturizer <bool> */
@@ -3533,6 +5108,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_FitBuffer(/*in*/
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_FitArrow(/*in*/ HashOneHotVectorizerFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<bool []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3629,21 +5232,22 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_CreateTransforme
     }
 }
 
-FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ HashOneHotVectorizerFeaturizer_bool_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_bool_TransformerHandle*>(index);
     
         return true;
     }
@@ -3653,7 +5257,7 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_DestroyTransform
     }
 }
 
-FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_CloneTransformer(/*in*/ HashOneHotVectorizerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ HashOneHotVectorizerFeaturizer_bool_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3661,22 +5265,103 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_CreateTransforme
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
-
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_bool_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return HashOneHotVectorizerFeaturizer_bool_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_CreateTransformerSaveDataWithLayout(/*in*/ HashOneHotVectorizerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_CreateTransformerSaveDataFile(/*in*/ HashOneHotVectorizerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -3719,6 +5404,48 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_Transform(/*in*/
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_TransformBatch(/*in*/ HashOneHotVectorizerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_ptr, input_items, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  HashOneHotVectorizerFeaturizer <string> */
@@ -3842,6 +5569,32 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_Fit(/*in*/ Has
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_FitView(/*in*/ HashOneHotVectorizerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_FitBuffer(/*in*/ HashOneHotVectorizerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3884,6 +5637,79 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_FitBuffer(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_FitBufferView(/*in*/ HashOneHotVectorizerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_FitArrow(/*in*/ HashOneHotVectorizerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::string []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_OnDataCompleted(/*in*/ HashOneHotVectorizerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3980,6 +5806,55 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_CreateTransfor
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_string_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_CloneTransformer(/*in*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle *pHandle, /*out*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<HashOneHotVectorizerFeaturizer_string_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_DestroyTransformer(/*in*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -4005,6 +5880,10 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_DestroyTransfo
 }
 
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_CreateTransformerSaveData(/*in*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return HashOneHotVectorizerFeaturizer_string_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_CreateTransformerSaveDataWithLayout(/*in*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -4016,11 +5895,12 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_CreateTransfor
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -4037,6 +5917,34 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_CreateTransfor
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_CreateTransformerSaveDataFile(/*in*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_Transform(/*in*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -4070,6 +5978,156 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_Transform(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_TransformView(/*in*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr && input_length != 0) throw std::invalid_argument("'input_ptr' is null");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : std::string()));
+
+        // Output
+        *output_numElements = result.NumElements;
+        *output_value = result.Value;
+        *output_index = result.Index;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_TransformBatch(/*in*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr);
+        #else
+            input_buffer.emplace_back(*input_ptr);
+        #endif
+            ++input_ptr;
+        }
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_TransformBatchView(/*in*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ std::size_t input_items, /*out*/ uint64_t * output_numElements, /*out*/ uint8_t *output_value, /*out*/ uint64_t *output_index, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_value == nullptr) throw std::invalid_argument("'output_value' is null");
+        if(output_index == nullptr) throw std::invalid_argument("'output_index' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output_numElements, &output_value, &output_index](Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType::TransformedType &result) {
+                *output_numElements = result.NumElements;
+                *output_value = result.Value;
+                *output_index = result.Index;
+
+                ++output_numElements;
+                ++output_value;
+                ++output_index;
+            }
+        );
+
+        // Input
+        std::vector<std::string> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        #else
+            input_buffer.emplace_back(input_data + input_begin, input_end - input_begin);
+        #endif
+        }
+
+        TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 
 #if (defined _MSC_VER)
 #   pragma warning(pop)
@@ -6,13 +6,68 @@
 
 #include "SharedLibrary_ImputationMarkerFeaturizer.h"
 #include "SharedLibrary_PointerTable.h"
+#include "../SharedLibrary_Arrow.h"
 
 #include "Archive.h"
+#include "FileArchive.h"
 #include "ImputationMarkerFeaturizer.h"
 
 // These method(s) are defined in SharedLibrary_Common.cpp
 ErrorInfoHandle * CreateErrorInfo(std::exception const &ex);
 std::chrono::system_clock::time_point CreateDateTime(DateTimeParameter const &param);
+Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout);
+
+namespace {
+
+// Transforms the inputs with a single call to the transformer's batch
+// `execute` method and invokes `outputFunc` for each result.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::true_type /*is_default_constructible*/) {
+    std::unique_ptr<typename TransformerT::TransformedType []> pResults(new typename TransformerT::TransformedType[cInputs]);
+
+    transformer.execute(pInputs, cInputs, pResults.get());
+
+    for(std::size_t index = 0; index < cInputs; ++index)
+        outputFunc(pResults[index]);
+}
+
+// The batch `execute` method writes to constructed items; results that can't be
+// default constructed are transformed one at a time.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::false_type /*is_default_constructible*/) {
+    typename TransformerT::InputType const * const  pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs) {
+        typename TransformerT::TransformedType      result(transformer.execute(*pInputs));
+
+        outputFunc(result);
+        ++pInputs;
+    }
+}
+
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc, std::is_default_constructible<typename TransformerT::TransformedType>());
+}
+
+// Results are written directly to the caller's buffer when its type is the
+// transformed type; otherwise, each result is converted by `outputFunc`.
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &/*outputFunc*/, std::true_type /*is_transformed_type*/) {
+    transformer.execute(pInputs, cInputs, pOutputs);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT * /*pOutputs*/, OutputFuncT const &outputFunc, std::false_type /*is_transformed_type*/) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &outputFunc) {
+    TransformBatchToOutput(transformer, pInputs, cInputs, pOutputs, outputFunc, std::is_same<OutputT, typename TransformerT::TransformedType>());
+}
+
+} // anonymous namespace
 
 extern "C" {
 
@@ -188,6 +243,34 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_FitBuffer(/*in*/ Imp
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_FitArrow(/*in*/ ImputationMarkerFeaturizer_int8_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int8_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_int8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -284,6 +367,55 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_CreateTransformerFro
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ ImputationMarkerFeaturizer_int8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_int8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_CloneTransformer(/*in*/ ImputationMarkerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ ImputationMarkerFeaturizer_int8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<ImputationMarkerFeaturizer_int8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -309,6 +441,10 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_DestroyTransformer(/
 }
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return ImputationMarkerFeaturizer_int8_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_CreateTransformerSaveDataWithLayout(/*in*/ ImputationMarkerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -320,11 +456,12 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_CreateTransformerSav
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -341,6 +478,34 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_CreateTransformerSav
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_CreateTransformerSaveDataFile(/*in*/ ImputationMarkerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_Transform(/*in*/ ImputationMarkerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -370,6 +535,100 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_Transform(/*in*/ Imp
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_TransformBatch(/*in*/ ImputationMarkerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::int8_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::int8_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int8_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int8_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int8_TransformArrow(/*in*/ ImputationMarkerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int8_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int8_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  ImputationMarkerFeaturizer <int16> */
@@ -535,6 +794,34 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_FitBuffer(/*in*/ Im
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_FitArrow(/*in*/ ImputationMarkerFeaturizer_int16_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int16_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -631,21 +918,22 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_CreateTransformerFr
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ ImputationMarkerFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_int16_TransformerHandle*>(index);
     
         return true;
     }
@@ -655,7 +943,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_DestroyTransformer(
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_CloneTransformer(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ ImputationMarkerFeaturizer_int16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -663,22 +951,13 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_CreateTransformerSa
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<ImputationMarkerFeaturizer_int16_TransformerHandle*>(index);
     
         return true;
     }
@@ -688,7 +967,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_CreateTransformerSa
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_Transform(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -697,17 +976,12 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_Transform(/*in*/ Im
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int16_t>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -717,27 +991,35 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_Transform(/*in*/ Im
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  ImputationMarkerFeaturizer <int32> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_int32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return ImputationMarkerFeaturizer_int16_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_CreateTransformerSaveDataWithLayout(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_int32_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -747,7 +1029,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CreateEstimator(/*o
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_CreateTransformerSaveDataFile(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -755,8 +1037,189 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_DestroyEstimator(/*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_Transform(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int16_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_TransformBatch(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::int16_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::int16_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int16_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int16_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int16_TransformArrow(/*in*/ ImputationMarkerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int16_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int16_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  ImputationMarkerFeaturizer <int32> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_int32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_int32_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
         Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>>(index);
         g_pointerTable.Remove(index);
 
@@ -882,6 +1345,34 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_FitBuffer(/*in*/ Im
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_FitArrow(/*in*/ ImputationMarkerFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int32_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -978,21 +1469,22 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CreateTransformerFr
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ ImputationMarkerFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_int32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1002,7 +1494,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_DestroyTransformer(
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CloneTransformer(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ImputationMarkerFeaturizer_int32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1010,22 +1502,13 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CreateTransformerSa
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
-
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<ImputationMarkerFeaturizer_int32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1035,7 +1518,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CreateTransformerSa
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_Transform(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1044,17 +1527,12 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_Transform(/*in*/ Im
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int32_t>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -1064,27 +1542,35 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_Transform(/*in*/ Im
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  ImputationMarkerFeaturizer <int64> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_int64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return ImputationMarkerFeaturizer_int32_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CreateTransformerSaveDataWithLayout(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_int64_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -1094,7 +1580,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_CreateEstimator(/*o
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_CreateTransformerSaveDataFile(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1102,12 +1588,17 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_DestroyEstimator(/*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -1117,7 +1608,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_DestroyEstimator(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_GetState(/*in*/ ImputationMarkerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_Transform(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1125,11 +1616,18 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_GetState(/*in*/ Imp
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int32_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -1139,7 +1637,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_GetState(/*in*/ Imp
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_TransformBatch(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1147,13 +1645,182 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_IsTrainingComplete(
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
-    
-        return true;
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::int32_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::int32_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int32_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int32_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int32_TransformArrow(/*in*/ ImputationMarkerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int32_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int32_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  ImputationMarkerFeaturizer <int64> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_int64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_int64_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_GetState(/*in*/ ImputationMarkerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
     }
     catch(std::exception const &ex) {
         *ppErrorInfo = CreateErrorInfo(ex);
@@ -1229,6 +1896,34 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_FitBuffer(/*in*/ Im
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_FitArrow(/*in*/ ImputationMarkerFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int64_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1325,6 +2020,55 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_CreateTransformerFr
     }
 }
 
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ ImputationMarkerFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_int64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_CloneTransformer(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ ImputationMarkerFeaturizer_int64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<ImputationMarkerFeaturizer_int64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1350,6 +2094,10 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_DestroyTransformer(
 }
 
 FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return ImputationMarkerFeaturizer_int64_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_CreateTransformerSaveDataWithLayout(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1361,18 +2109,1561 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_CreateTransformerSa
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_CreateTransformerSaveDataFile(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_Transform(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
 
-        transformer.save(archive);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int64_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_TransformBatch(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::int64_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::int64_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int64_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int64_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_TransformArrow(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::int64_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  ImputationMarkerFeaturizer <uint8> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint8_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_GetState(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_Fit(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ uint8_t const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        // No validation
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_FitBuffer(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ uint8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint8_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::uint8_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_FitArrow(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint8_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.complete_training();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ ImputationMarkerFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CloneTransformer(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ImputationMarkerFeaturizer_uint8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return ImputationMarkerFeaturizer_uint8_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerSaveDataWithLayout(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerSaveDataFile(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_Transform(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_TransformBatch(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint8_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::uint8_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_TransformArrow(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint8_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  ImputationMarkerFeaturizer <uint16> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint16_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_GetState(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_Fit(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ uint16_t const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        // No validation
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_FitBuffer(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ uint16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint16_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::uint16_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_FitArrow(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint16_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.complete_training();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ ImputationMarkerFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CloneTransformer(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ ImputationMarkerFeaturizer_uint16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return ImputationMarkerFeaturizer_uint16_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerSaveDataWithLayout(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerSaveDataFile(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_Transform(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_TransformBatch(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint16_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::uint16_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_TransformArrow(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint16_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  ImputationMarkerFeaturizer <uint32> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint32_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_GetState(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_Fit(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ uint32_t const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        // No validation
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_FitBuffer(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ uint32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint32_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::uint32_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_FitArrow(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint32_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.complete_training();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint32_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType(archive));
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1382,26 +3673,22 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_CreateTransformerSa
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_Transform(/*in*/ ImputationMarkerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ ImputationMarkerFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-
-
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::int64_t>::CreateNullValue()));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType(archive));
 
-        // Output
-        *output = result;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1411,27 +3698,21 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_int64_Transform(/*in*/ Im
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  ImputationMarkerFeaturizer <uint8> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CloneTransformer(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ImputationMarkerFeaturizer_uint32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
-
-        pEstimator->begin_training();
-
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint8_EstimatorHandle*>(index);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1441,7 +3722,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateEstimator(/*o
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1451,10 +3732,11 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_DestroyEstimator(/*
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
         size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(index);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType>(index);
         g_pointerTable.Remove(index);
 
-        delete pEstimator;
+
+        delete pTransformer;
     
         return true;
     }
@@ -1464,7 +3746,11 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_DestroyEstimator(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_GetState(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return ImputationMarkerFeaturizer_uint32_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateTransformerSaveDataWithLayout(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1472,11 +3758,23 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_GetState(/*in*/ Imp
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -1486,7 +3784,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_GetState(/*in*/ Imp
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateTransformerSaveDataFile(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1494,11 +3792,17 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_IsTrainingComplete(
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -1508,7 +3812,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_IsTrainingComplete(
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_Fit(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ uint8_t const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_Transform(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1516,15 +3820,18 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_Fit(/*in*/ Imputati
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        // No validation
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue()));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue()));
+        // Output
+        *output = result;
     
         return true;
     }
@@ -1534,7 +3841,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_Fit(/*in*/ Imputati
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_FitBuffer(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ uint8_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_TransformBatch(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1542,31 +3849,40 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_FitBuffer(/*in*/ Im
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
 
 
         if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
         if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        std::vector<Microsoft::Featurizer::Traits<std::uint8_t>::nullable_type> input_buffer;
+        std::vector<Microsoft::Featurizer::Traits<std::uint32_t>::nullable_type> input_buffer;
 
         input_buffer.reserve(input_items);
 
-        std::uint8_t const * const * const input_end(input_ptr + input_items);
+        std::uint32_t const * const * const input_end(input_ptr + input_items);
 
         while(input_ptr != input_end) {
         #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue());
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue());
         #else
-            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue());
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue());
         #endif
             ++input_ptr;
         }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -1576,7 +3892,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_FitBuffer(/*in*/ Im
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_TransformArrow(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1585,9 +3901,31 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_OnDataCompleted(/*i
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        estimator.on_data_completed();
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint32_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -1597,18 +3935,27 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_OnDataCompleted(/*i
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  ImputationMarkerFeaturizer <uint64> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        // No validation
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint64_EstimatorHandle*>(index);
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.complete_training();
     
         return true;
     }
@@ -1618,25 +3965,20 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CompleteTraining(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_uint8_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType*>(estimator.create_transformer().release());
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(index);
+        g_pointerTable.Remove(index);
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint8_TransformerHandle*>(index);
+        delete pEstimator;
     
         return true;
     }
@@ -1646,23 +3988,19 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerFr
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_GetState(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint8_TransformerHandle*>(index);
+        *pState = static_cast<TrainingState>(estimator.get_state());
     
         return true;
     }
@@ -1672,7 +4010,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerFr
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1680,13 +4018,11 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_DestroyTransformer(
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
-
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pTransformer;
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
         return true;
     }
@@ -1696,7 +4032,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_DestroyTransformer(
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_Fit(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ uint64_t const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1704,22 +4040,15 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerSa
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        transformer.save(archive);
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        // No validation
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue()));
     
         return true;
     }
@@ -1729,7 +4058,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_CreateTransformerSa
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_Transform(/*in*/ ImputationMarkerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_FitBuffer(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ uint64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1737,18 +4066,31 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_Transform(/*in*/ Im
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue()));
+        std::vector<Microsoft::Featurizer::Traits<std::uint64_t>::nullable_type> input_buffer;
 
-        // Output
-        *output = result;
+        input_buffer.reserve(input_items);
+
+        std::uint64_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -1758,27 +4100,25 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint8_Transform(/*in*/ Im
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  ImputationMarkerFeaturizer <uint16> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_FitArrow(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        pEstimator->begin_training();
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint16_EstimatorHandle*>(index);
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint64_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
 
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -1788,7 +4128,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateEstimator(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1797,11 +4137,9 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_DestroyEstimator(/
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        estimator.on_data_completed();
     
         return true;
     }
@@ -1811,7 +4149,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_DestroyEstimator(/
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_GetState(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1819,11 +4157,10 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_GetState(/*in*/ Im
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        estimator.complete_training();
     
         return true;
     }
@@ -1833,19 +4170,25 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_GetState(/*in*/ Im
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint64_TransformerHandle*>(index);
     
         return true;
     }
@@ -1855,23 +4198,23 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_IsTrainingComplete
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_Fit(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ uint16_t const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-        // No validation
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType(archive));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue()));
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint64_TransformerHandle*>(index);
     
         return true;
     }
@@ -1881,39 +4224,22 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_Fit(/*in*/ Imputat
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_FitBuffer(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ uint16_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ ImputationMarkerFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
-
-        std::vector<Microsoft::Featurizer::Traits<std::uint16_t>::nullable_type> input_buffer;
-
-        input_buffer.reserve(input_items);
-
-        std::uint16_t const * const * const input_end(input_ptr + input_items);
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        while(input_ptr != input_end) {
-        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue());
-        #else
-            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue());
-        #endif
-            ++input_ptr;
-        }
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType(archive));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint64_TransformerHandle*>(index);
     
         return true;
     }
@@ -1923,7 +4249,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_FitBuffer(/*in*/ I
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CloneTransformer(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ ImputationMarkerFeaturizer_uint64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1931,10 +4257,13 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_OnDataCompleted(/*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        estimator.on_data_completed();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint64_TransformerHandle*>(index);
     
         return true;
     }
@@ -1944,7 +4273,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_OnDataCompleted(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1953,9 +4282,12 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CompleteTraining(/
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pHandle)));
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        estimator.complete_training();
+
+        delete pTransformer;
     
         return true;
     }
@@ -1965,25 +4297,35 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CompleteTraining(/
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_uint16_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return ImputationMarkerFeaturizer_uint64_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerSaveDataWithLayout(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType*>(estimator.create_transformer().release());
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint16_TransformerHandle*>(index);
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -1993,23 +4335,25 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerF
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerSaveDataFile(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint16_TransformerHandle*>(index);
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -2019,7 +4363,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerF
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_Transform(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2028,12 +4372,17 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_DestroyTransformer
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
 
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pTransformer;
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -2043,7 +4392,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_DestroyTransformer
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_TransformBatch(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2051,22 +4400,40 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerS
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
 
-        transformer.save(archive);
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint64_t>::nullable_type> input_buffer;
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        input_buffer.reserve(input_items);
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        std::uint64_t const * const * const input_end(input_ptr + input_items);
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -2076,7 +4443,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_CreateTransformerS
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_Transform(/*in*/ ImputationMarkerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_TransformArrow(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2085,17 +4452,31 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_Transform(/*in*/ I
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::uint64_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
 
         // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue()));
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
 
-        // Output
-        *output = result;
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -2107,10 +4488,10 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint16_Transform(/*in*/ I
 
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
-/* |  ImputationMarkerFeaturizer <uint32> */
+/* |  ImputationMarkerFeaturizer <float> */
 /* |                                                                      */
 /* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_float_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2118,12 +4499,12 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateEstimator(/*
         *ppErrorInfo = nullptr;
 
         // No validation
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
 
         pEstimator->begin_training();
 
         size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint32_EstimatorHandle*>(index);
+        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_float_EstimatorHandle*>(index);
 
 
     
@@ -2135,7 +4516,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateEstimator(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2145,7 +4526,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_DestroyEstimator(/
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
         size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(index);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(index);
         g_pointerTable.Remove(index);
 
         delete pEstimator;
@@ -2158,7 +4539,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_DestroyEstimator(/
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_GetState(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_GetState(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2168,7 +4549,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_GetState(/*in*/ Im
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
         if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
         *pState = static_cast<TrainingState>(estimator.get_state());
     
@@ -2180,7 +4561,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_GetState(/*in*/ Im
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2190,7 +4571,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_IsTrainingComplete
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
         if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
         *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
@@ -2202,7 +4583,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_IsTrainingComplete
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_Fit(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ uint32_t const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_Fit(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*in*/ float const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2215,10 +4596,10 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_Fit(/*in*/ Imputat
 
         // No validation
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue()));
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue()));
     
         return true;
     }
@@ -2228,7 +4609,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_Fit(/*in*/ Imputat
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_FitBuffer(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ uint32_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_FitBuffer(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*in*/ float const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2243,22 +4624,22 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_FitBuffer(/*in*/ I
         if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
         if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        std::vector<Microsoft::Featurizer::Traits<std::uint32_t>::nullable_type> input_buffer;
+        std::vector<Microsoft::Featurizer::Traits<std::float_t>::nullable_type> input_buffer;
 
         input_buffer.reserve(input_items);
 
-        std::uint32_t const * const * const input_end(input_ptr + input_items);
+        std::float_t const * const * const input_end(input_ptr + input_items);
 
         while(input_ptr != input_end) {
         #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue());
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue());
         #else
-            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue());
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue());
         #endif
             ++input_ptr;
         }
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
         *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
@@ -2270,7 +4651,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_FitBuffer(/*in*/ I
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_FitArrow(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2278,10 +4659,17 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_OnDataCompleted(/*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        estimator.on_data_completed();
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::float_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -2291,7 +4679,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_OnDataCompleted(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2300,9 +4688,9 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CompleteTraining(/
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.complete_training();
+        estimator.on_data_completed();
     
         return true;
     }
@@ -2312,25 +4700,18 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CompleteTraining(/
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_uint32_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType*>(estimator.create_transformer().release());
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint32_TransformerHandle*>(index);
+        estimator.complete_training();
     
         return true;
     }
@@ -2340,47 +4721,25 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateTransformerF
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
         if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType(archive));
-
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint32_TransformerHandle*>(index);
-    
-        return true;
-    }
-    catch(std::exception const &ex) {
-        *ppErrorInfo = CreateErrorInfo(ex);
-        return false;
-    }
-}
-
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
-    if(ppErrorInfo == nullptr)
-        return false;
 
-    try {
-        *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType*>(estimator.create_transformer().release());
 
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_float_TransformerHandle*>(index);
     
         return true;
     }
@@ -2390,30 +4749,23 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_DestroyTransformer
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
-    try {
-        *ppErrorInfo = nullptr;
-
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
+    try {
+        *ppErrorInfo = nullptr;
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType(archive));
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_float_TransformerHandle*>(index);
     
         return true;
     }
@@ -2423,26 +4775,22 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_CreateTransformerS
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_Transform(/*in*/ ImputationMarkerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ ImputationMarkerFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-
-
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue()));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType(archive));
 
-        // Output
-        *output = result;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_float_TransformerHandle*>(index);
     
         return true;
     }
@@ -2452,27 +4800,21 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint32_Transform(/*in*/ I
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  ImputationMarkerFeaturizer <uint64> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CloneTransformer(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*out*/ ImputationMarkerFeaturizer_float_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
-
-        pEstimator->begin_training();
-
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint64_EstimatorHandle*>(index);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<ImputationMarkerFeaturizer_float_TransformerHandle*>(index);
     
         return true;
     }
@@ -2482,7 +4824,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateEstimator(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2492,10 +4834,11 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_DestroyEstimator(/
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
         size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(index);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType>(index);
         g_pointerTable.Remove(index);
 
-        delete pEstimator;
+
+        delete pTransformer;
     
         return true;
     }
@@ -2505,7 +4848,11 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_DestroyEstimator(/
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_GetState(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return ImputationMarkerFeaturizer_float_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerSaveDataWithLayout(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2513,11 +4860,23 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_GetState(/*in*/ Im
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -2527,7 +4886,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_GetState(/*in*/ Im
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerSaveDataFile(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2535,11 +4894,17 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_IsTrainingComplete
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -2549,7 +4914,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_IsTrainingComplete
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_Fit(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ uint64_t const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_Transform(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2557,15 +4922,18 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_Fit(/*in*/ Imputat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        // No validation
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue()));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue()));
+        // Output
+        *output = result;
     
         return true;
     }
@@ -2575,7 +4943,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_Fit(/*in*/ Imputat
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_FitBuffer(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ uint64_t const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_TransformBatch(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2583,31 +4951,40 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_FitBuffer(/*in*/ I
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
 
 
         if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
         if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        std::vector<Microsoft::Featurizer::Traits<std::uint64_t>::nullable_type> input_buffer;
+        std::vector<Microsoft::Featurizer::Traits<std::float_t>::nullable_type> input_buffer;
 
         input_buffer.reserve(input_items);
 
-        std::uint64_t const * const * const input_end(input_ptr + input_items);
+        std::float_t const * const * const input_end(input_ptr + input_items);
 
         while(input_ptr != input_end) {
         #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue());
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue());
         #else
-            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue());
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue());
         #endif
             ++input_ptr;
         }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -2617,7 +4994,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_FitBuffer(/*in*/ I
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_TransformArrow(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2626,30 +5003,31 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_OnDataCompleted(/*
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        estimator.on_data_completed();
-    
-        return true;
-    }
-    catch(std::exception const &ex) {
-        *ppErrorInfo = CreateErrorInfo(ex);
-        return false;
-    }
-}
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::float_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
-    if(ppErrorInfo == nullptr)
-        return false;
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-    try {
-        *ppErrorInfo = nullptr;
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType::TransformedType> output_builder(input_values.second);
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pHandle)));
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
 
-        estimator.complete_training();
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -2659,25 +5037,27 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CompleteTraining(/
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_uint64_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  ImputationMarkerFeaturizer <double> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_double_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
+        // No validation
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+        pEstimator->begin_training();
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType*>(estimator.create_transformer().release());
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_double_EstimatorHandle*>(index);
 
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint64_TransformerHandle*>(index);
     
         return true;
     }
@@ -2687,23 +5067,20 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerF
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType(archive));
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(index);
+        g_pointerTable.Remove(index);
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_uint64_TransformerHandle*>(index);
+        delete pEstimator;
     
         return true;
     }
@@ -2713,7 +5090,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerF
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_GetState(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2721,13 +5098,11 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_DestroyTransformer
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
-
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pTransformer;
+        *pState = static_cast<TrainingState>(estimator.get_state());
     
         return true;
     }
@@ -2737,7 +5112,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_DestroyTransformer
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2745,22 +5120,11 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerS
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
         return true;
     }
@@ -2770,7 +5134,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_CreateTransformerS
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_Transform(/*in*/ ImputationMarkerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_Fit(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*in*/ double const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2778,18 +5142,15 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_Transform(/*in*/ I
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
+        // No validation
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue()));
 
-        // Output
-        *output = result;
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue()));
     
         return true;
     }
@@ -2799,27 +5160,39 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_uint64_Transform(/*in*/ I
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  ImputationMarkerFeaturizer <float> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_float_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_FitBuffer(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*in*/ double const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        pEstimator->begin_training();
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_float_EstimatorHandle*>(index);
 
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::double_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        std::double_t const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -2829,7 +5202,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateEstimator(/*o
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_FitArrow(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2837,12 +5210,17 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_DestroyEstimator(/*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(index);
-        g_pointerTable.Remove(index);
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        delete pEstimator;
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::double_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -2852,7 +5230,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_DestroyEstimator(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_GetState(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2860,11 +5238,10 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_GetState(/*in*/ Imp
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        estimator.on_data_completed();
     
         return true;
     }
@@ -2874,7 +5251,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_GetState(/*in*/ Imp
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2882,11 +5259,10 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_IsTrainingComplete(
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        estimator.complete_training();
     
         return true;
     }
@@ -2896,23 +5272,25 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_IsTrainingComplete(
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_Fit(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*in*/ float const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
 
-        // No validation
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType*>(estimator.create_transformer().release());
 
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue()));
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_double_TransformerHandle*>(index);
     
         return true;
     }
@@ -2922,39 +5300,48 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_Fit(/*in*/ Imputati
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_FitBuffer(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*in*/ float const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType(archive));
 
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
 
-        std::vector<Microsoft::Featurizer::Traits<std::float_t>::nullable_type> input_buffer;
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ ImputationMarkerFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
 
-        input_buffer.reserve(input_items);
+    try {
+        *ppErrorInfo = nullptr;
 
-        std::float_t const * const * const input_end(input_ptr + input_items);
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        while(input_ptr != input_end) {
-        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue());
-        #else
-            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue());
-        #endif
-            ++input_ptr;
-        }
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType(archive));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_double_TransformerHandle*>(index);
     
         return true;
     }
@@ -2964,7 +5351,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_FitBuffer(/*in*/ Im
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CloneTransformer(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*out*/ ImputationMarkerFeaturizer_double_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2972,10 +5359,13 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_OnDataCompleted(/*i
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        estimator.on_data_completed();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<ImputationMarkerFeaturizer_double_TransformerHandle*>(index);
     
         return true;
     }
@@ -2985,7 +5375,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_OnDataCompleted(/*i
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2994,9 +5384,12 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CompleteTraining(/*
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        estimator.complete_training();
+
+        delete pTransformer;
     
         return true;
     }
@@ -3006,25 +5399,35 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CompleteTraining(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_float_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return ImputationMarkerFeaturizer_double_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerSaveDataWithLayout(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType*>(estimator.create_transformer().release());
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_float_TransformerHandle*>(index);
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -3034,23 +5437,25 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerFr
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerSaveDataFile(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_float_TransformerHandle*>(index);
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -3060,7 +5465,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerFr
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_Transform(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3069,12 +5474,17 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_DestroyTransformer(
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
 
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        delete pTransformer;
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -3084,7 +5494,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_DestroyTransformer(
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_TransformBatch(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3092,22 +5502,40 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerSa
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
 
-        transformer.save(archive);
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        std::vector<Microsoft::Featurizer::Traits<std::double_t>::nullable_type> input_buffer;
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        input_buffer.reserve(input_items);
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        std::double_t const * const * const input_end(input_ptr + input_items);
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -3117,7 +5545,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_CreateTransformerSa
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_Transform(/*in*/ ImputationMarkerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_TransformArrow(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3126,17 +5554,31 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_Transform(/*in*/ Im
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
+        std::unique_ptr<Microsoft::Featurizer::Traits<std::double_t>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
 
         // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::float_t>::CreateNullValue()));
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
 
-        // Output
-        *output = result;
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -3148,10 +5590,10 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_float_Transform(/*in*/ Im
 
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
-/* |  ImputationMarkerFeaturizer <double> */
+/* |  ImputationMarkerFeaturizer <bool> */
 /* |                                                                      */
 /* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_double_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_bool_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3159,12 +5601,12 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateEstimator(/*
         *ppErrorInfo = nullptr;
 
         // No validation
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
 
         pEstimator->begin_training();
 
         size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_double_EstimatorHandle*>(index);
+        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_bool_EstimatorHandle*>(index);
 
 
     
@@ -3176,7 +5618,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateEstimator(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3186,7 +5628,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_DestroyEstimator(/
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
         size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(index);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(index);
         g_pointerTable.Remove(index);
 
         delete pEstimator;
@@ -3199,7 +5641,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_DestroyEstimator(/
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_GetState(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_GetState(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3209,7 +5651,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_GetState(/*in*/ Im
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
         if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
 
         *pState = static_cast<TrainingState>(estimator.get_state());
     
@@ -3221,7 +5663,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_GetState(/*in*/ Im
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3231,7 +5673,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_IsTrainingComplete
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
         if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
 
         *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
@@ -3243,7 +5685,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_IsTrainingComplete
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_Fit(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*in*/ double const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_Fit(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ bool const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3256,10 +5698,10 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_Fit(/*in*/ Imputat
 
         // No validation
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
 
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue()));
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<bool>::CreateNullValue()));
     
         return true;
     }
@@ -3269,7 +5711,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_Fit(/*in*/ Imputat
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_FitBuffer(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*in*/ double const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_FitBuffer(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ bool const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3284,24 +5726,94 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_FitBuffer(/*in*/ I
         if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
         if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        std::vector<Microsoft::Featurizer::Traits<std::double_t>::nullable_type> input_buffer;
+        std::vector<Microsoft::Featurizer::Traits<bool>::nullable_type> input_buffer;
 
         input_buffer.reserve(input_items);
 
-        std::double_t const * const * const input_end(input_ptr + input_items);
+        bool const * const * const input_end(input_ptr + input_items);
 
         while(input_ptr != input_end) {
         #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue());
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<bool>::CreateNullValue());
         #else
-            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue());
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<bool>::CreateNullValue());
         #endif
             ++input_ptr;
         }
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_FitArrow(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<Microsoft::Featurizer::Traits<bool>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        estimator.complete_training();
     
         return true;
     }
@@ -3311,18 +5823,25 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_FitBuffer(/*in*/ I
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_bool_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.on_data_completed();
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_bool_TransformerHandle*>(index);
     
         return true;
     }
@@ -3332,18 +5851,23 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_OnDataCompleted(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_bool_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        estimator.complete_training();
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_bool_TransformerHandle*>(index);
     
         return true;
     }
@@ -3353,25 +5877,22 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CompleteTraining(/
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_double_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ ImputationMarkerFeaturizer_bool_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
         if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType*>(estimator.create_transformer().release());
-
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType(archive));
 
         size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_double_TransformerHandle*>(index);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_bool_TransformerHandle*>(index);
     
         return true;
     }
@@ -3381,23 +5902,21 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerF
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CloneTransformer(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ ImputationMarkerFeaturizer_bool_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_double_TransformerHandle*>(index);
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<ImputationMarkerFeaturizer_bool_TransformerHandle*>(index);
     
         return true;
     }
@@ -3407,7 +5926,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerF
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3417,7 +5936,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_DestroyTransformer
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
         size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType>(index);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType>(index);
         g_pointerTable.Remove(index);
 
 
@@ -3431,7 +5950,11 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_DestroyTransformer
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return ImputationMarkerFeaturizer_bool_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerSaveDataWithLayout(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3442,12 +5965,13 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerS
         if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -3464,7 +5988,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_CreateTransformerS
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_Transform(/*in*/ ImputationMarkerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerSaveDataFile(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3472,18 +5996,17 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_Transform(/*in*/ I
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<std::double_t>::CreateNullValue()));
-
-        // Output
-        *output = result;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -3493,27 +6016,26 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_double_Transform(/*in*/ I
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  ImputationMarkerFeaturizer <bool> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_bool_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_Transform(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        pEstimator->begin_training();
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_bool_EstimatorHandle*>(index);
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Input
+        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<bool>::CreateNullValue()));
 
+        // Output
+        *output = result;
     
         return true;
     }
@@ -3523,7 +6045,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateEstimator(/*ou
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_TransformBatch(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3532,11 +6054,39 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_DestroyEstimator(/*i
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(index);
-        g_pointerTable.Remove(index);
 
-        delete pEstimator;
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<bool>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        bool const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<bool>::CreateNullValue());
+        #else
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<bool>::CreateNullValue());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -3546,7 +6096,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_DestroyEstimator(/*i
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_GetState(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_TransformArrow(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3554,11 +6104,32 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_GetState(/*in*/ Impu
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        std::unique_ptr<Microsoft::Featurizer::Traits<bool>::nullable_type []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -3568,19 +6139,27 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_GetState(/*in*/ Impu
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  ImputationMarkerFeaturizer <string> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_string_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        // No validation
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_string_EstimatorHandle*>(index);
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
         return true;
     }
@@ -3590,7 +6169,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_IsTrainingComplete(/
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_Fit(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ bool const * input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3598,15 +6177,12 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_Fit(/*in*/ Imputatio
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-        // No validation
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(index);
+        g_pointerTable.Remove(index);
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input != nullptr ? *input : Microsoft::Featurizer::Traits<bool>::CreateNullValue()));
+        delete pEstimator;
     
         return true;
     }
@@ -3616,7 +6192,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_Fit(/*in*/ Imputatio
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_FitBuffer(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*in*/ bool const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_GetState(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3624,31 +6200,11 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_FitBuffer(/*in*/ Imp
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
-
-        std::vector<Microsoft::Featurizer::Traits<bool>::nullable_type> input_buffer;
-
-        input_buffer.reserve(input_items);
-
-        bool const * const * const input_end(input_ptr + input_items);
-
-        while(input_ptr != input_end) {
-        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<bool>::CreateNullValue());
-        #else
-            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<bool>::CreateNullValue());
-        #endif
-            ++input_ptr;
-        }
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        *pState = static_cast<TrainingState>(estimator.get_state());
     
         return true;
     }
@@ -3658,7 +6214,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_FitBuffer(/*in*/ Imp
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3666,10 +6222,11 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_OnDataCompleted(/*in
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.on_data_completed();
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
         return true;
     }
@@ -3679,7 +6236,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_OnDataCompleted(/*in
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_Fit(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3687,10 +6244,15 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CompleteTraining(/*i
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.complete_training();
+        // No validation
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input ? std::string(input) : nonstd::optional<std::string>()));
     
         return true;
     }
@@ -3700,25 +6262,23 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CompleteTraining(/*i
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_bool_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_bool_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_FitView(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+        // No validation
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType*>(estimator.create_transformer().release());
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
 
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_bool_TransformerHandle*>(index);
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr ? std::string(input_ptr, input_length) : nonstd::optional<std::string>()));
     
         return true;
     }
@@ -3728,23 +6288,39 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerFro
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_bool_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_FitBuffer(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType(archive));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_bool_TransformerHandle*>(index);
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<nonstd::optional<std::string>> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? *input_ptr : nonstd::optional<std::string>());
+        #else
+            input_buffer.emplace_back(*input_ptr ? *input_ptr : nonstd::optional<std::string>());
+        #endif
+            ++input_ptr;
+        }
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -3754,7 +6330,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerFro
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_FitBufferView(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ unsigned char const *input_validity, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3762,13 +6338,35 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_DestroyTransformer(/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType>(index);
-        g_pointerTable.Remove(index);
 
 
-        delete pTransformer;
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+
+        std::vector<nonstd::optional<std::string>> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            if(input_validity != nullptr && (input_validity[input_index / 8] & (1 << (input_index % 8))) == 0) {
+                input_buffer.push_back(nonstd::optional<std::string>());
+                continue;
+            }
+
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        }
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
     
         return true;
     }
@@ -3778,7 +6376,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_DestroyTransformer(/
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_FitArrow(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3786,22 +6384,17 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerSav
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        std::unique_ptr<nonstd::optional<std::string> []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -3811,7 +6404,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_CreateTransformerSav
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_Transform(/*in*/ ImputationMarkerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3820,17 +6413,9 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_Transform(/*in*/ Imp
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input != nullptr ? *input : Microsoft::Featurizer::Traits<bool>::CreateNullValue()));
-
-        // Output
-        *output = result;
+        estimator.on_data_completed();
     
         return true;
     }
@@ -3840,27 +6425,18 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_bool_Transform(/*in*/ Imp
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  ImputationMarkerFeaturizer <string> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateEstimator(/*out*/ ImputationMarkerFeaturizer_string_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>* pEstimator = new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1) );
-
-        pEstimator->begin_training();
-
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<ImputationMarkerFeaturizer_string_EstimatorHandle*>(index);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
 
+        estimator.complete_training();
     
         return true;
     }
@@ -3870,20 +6446,25 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateEstimator(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_DestroyEstimator(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_string_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(index);
-        g_pointerTable.Remove(index);
 
-        delete pEstimator;
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_string_TransformerHandle*>(index);
     
         return true;
     }
@@ -3893,19 +6474,23 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_DestroyEstimator(/
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_GetState(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_string_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_string_TransformerHandle*>(index);
     
         return true;
     }
@@ -3915,19 +6500,22 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_GetState(/*in*/ Im
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_IsTrainingComplete(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ ImputationMarkerFeaturizer_string_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_string_TransformerHandle*>(index);
     
         return true;
     }
@@ -3937,7 +6525,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_IsTrainingComplete
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_Fit(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const *input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CloneTransformer(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*out*/ ImputationMarkerFeaturizer_string_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3945,15 +6533,13 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_Fit(/*in*/ Imputat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-        // No validation
-
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input ? std::string(input) : nonstd::optional<std::string>()));
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<ImputationMarkerFeaturizer_string_TransformerHandle*>(index);
     
         return true;
     }
@@ -3963,7 +6549,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_Fit(/*in*/ Imputat
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_FitBuffer(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3971,31 +6557,13 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_FitBuffer(/*in*/ I
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
-
-        std::vector<nonstd::optional<std::string>> input_buffer;
-
-        input_buffer.reserve(input_items);
-
-        char const * const * const input_end(input_ptr + input_items);
 
-        while(input_ptr != input_end) {
-        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
-            input_buffer.push_back(*input_ptr ? *input_ptr : nonstd::optional<std::string>());
-        #else
-            input_buffer.emplace_back(*input_ptr ? *input_ptr : nonstd::optional<std::string>());
-        #endif
-            ++input_ptr;
-        }
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_buffer.data(), input_buffer.size()));
+        delete pTransformer;
     
         return true;
     }
@@ -4005,7 +6573,11 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_FitBuffer(/*in*/ I
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_OnDataCompleted(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return ImputationMarkerFeaturizer_string_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerSaveDataWithLayout(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -4013,10 +6585,23 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_OnDataCompleted(/*
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        estimator.on_data_completed();
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -4026,7 +6611,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_OnDataCompleted(/*
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CompleteTraining(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerSaveDataFile(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -4034,10 +6619,17 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CompleteTraining(/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.complete_training();
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -4047,25 +6639,26 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CompleteTraining(/
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerFromEstimator(/*in*/ ImputationMarkerFeaturizer_string_EstimatorHandle *pEstimatorHandle, /*out*/ ImputationMarkerFeaturizer_string_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_Transform(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType*>(estimator.create_transformer().release());
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Input
+        auto result(transformer.execute(input ? std::string(input) : nonstd::optional<std::string>()));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_string_TransformerHandle*>(index);
+        // Output
+        *output = result;
     
         return true;
     }
@@ -4075,23 +6668,26 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerF
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ ImputationMarkerFeaturizer_string_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_TransformView(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input_ptr, /*in*/ std::size_t input_length, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType(archive));
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<ImputationMarkerFeaturizer_string_TransformerHandle*>(index);
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input_ptr ? std::string(input_ptr, input_length) : nonstd::optional<std::string>()));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -4101,7 +6697,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerF
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_DestroyTransformer(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_TransformBatch(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -4110,12 +6706,39 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_DestroyTransformer
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType>(index);
-        g_pointerTable.Remove(index);
 
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<nonstd::optional<std::string>> input_buffer;
 
-        delete pTransformer;
+        input_buffer.reserve(input_items);
+
+        char const * const * const input_end(input_ptr + input_items);
+
+        while(input_ptr != input_end) {
+        #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+            input_buffer.push_back(*input_ptr ? *input_ptr : nonstd::optional<std::string>());
+        #else
+            input_buffer.emplace_back(*input_ptr ? *input_ptr : nonstd::optional<std::string>());
+        #endif
+            ++input_ptr;
+        }
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -4125,7 +6748,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_DestroyTransformer
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerSaveData(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_TransformBatchView(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input_data, /*in*/ std::size_t const *input_offsets, /*in*/ unsigned char const *input_validity, /*in*/ std::size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -4133,22 +6756,44 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerS
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+
+        if(input_data == nullptr) throw std::invalid_argument("'input_data' is null");
+        if(input_offsets == nullptr) throw std::invalid_argument("'input_offsets' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
         Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
 
-        transformer.save(archive);
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType::TransformedType &result) {
+                *output = result;
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+                ++output;
+            }
+        );
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        // Input
+        std::vector<nonstd::optional<std::string>> input_buffer;
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        input_buffer.reserve(input_items);
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        for(std::size_t input_index = 0; input_index < input_items; ++input_index) {
+            if(input_validity != nullptr && (input_validity[input_index / 8] & (1 << (input_index % 8))) == 0) {
+                input_buffer.push_back(nonstd::optional<std::string>());
+                continue;
+            }
+
+            std::size_t const input_begin(input_offsets[input_index]);
+            std::size_t const input_end(input_offsets[input_index + 1]);
+
+            if(input_end < input_begin) throw std::invalid_argument("'input_offsets' is not sorted");
+
+            input_buffer.push_back(std::string(input_data + input_begin, input_end - input_begin));
+        }
+
+        TransformBatchToOutput(transformer, input_buffer.data(), input_buffer.size(), output, output_func);
     
         return true;
     }
@@ -4158,7 +6803,7 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_CreateTransformerS
     }
 }
 
-FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_Transform(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const *input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_TransformArrow(/*in*/ ImputationMarkerFeaturizer_string_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -4167,17 +6812,31 @@ FEATURIZER_LIBRARY_API bool ImputationMarkerFeaturizer_string_Transform(/*in*/ I
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
+        std::unique_ptr<nonstd::optional<std::string> []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
         Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::ImputationMarkerEstimator<std::string>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
         // Input
-        auto result(transformer.execute(input ? std::string(input) : nonstd::optional<std::string>()));
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
 
-        // Output
-        *output = result;
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -6,13 +6,68 @@
 
 #include "SharedLibrary_L1NormalizeFeaturizer.h"
 #include "SharedLibrary_PointerTable.h"
+#include "../SharedLibrary_Arrow.h"
 
 #include "Archive.h"
+#include "FileArchive.h"
 #include "L1NormalizeFeaturizer.h"
 
 // These method(s) are defined in SharedLibrary_Common.cpp
 ErrorInfoHandle * CreateErrorInfo(std::exception const &ex);
 std::chrono::system_clock::time_point CreateDateTime(DateTimeParameter const &param);
+Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout);
+
+namespace {
+
+// Transforms the inputs with a single call to the transformer's batch
+// `execute` method and invokes `outputFunc` for each result.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::true_type /*is_default_constructible*/) {
+    std::unique_ptr<typename TransformerT::TransformedType []> pResults(new typename TransformerT::TransformedType[cInputs]);
+
+    transformer.execute(pInputs, cInputs, pResults.get());
+
+    for(std::size_t index = 0; index < cInputs; ++index)
+        outputFunc(pResults[index]);
+}
+
+// The batch `execute` method writes to constructed items; results that can't be
+// default constructed are transformed one at a time.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::false_type /*is_default_constructible*/) {
+    typename TransformerT::InputType const * const  pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs) {
+        typename TransformerT::TransformedType      result(transformer.execute(*pInputs));
+
+        outputFunc(result);
+        ++pInputs;
+    }
+}
+
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc, std::is_default_constructible<typename TransformerT::TransformedType>());
+}
+
+// Results are written directly to the caller's buffer when its type is the
+// transformed type; otherwise, each result is converted by `outputFunc`.
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &/*outputFunc*/, std::true_type /*is_transformed_type*/) {
+    transformer.execute(pInputs, cInputs, pOutputs);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT * /*pOutputs*/, OutputFuncT const &outputFunc, std::false_type /*is_transformed_type*/) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &outputFunc) {
+    TransformBatchToOutput(transformer, pInputs, cInputs, pOutputs, outputFunc, std::is_same<OutputT, typename TransformerT::TransformedType>());
+}
+
+} // anonymous namespace
 
 extern "C" {
 
@@ -283,6 +338,55 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_CreateTransformerFromSave
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L1NormalizeFeaturizer_int8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int8_t *, std::int8_t *>>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int8_t *, std::int8_t *>>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<L1NormalizeFeaturizer_int8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_CloneTransformer(/*in*/ L1NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*out*/ L1NormalizeFeaturizer_int8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int8_t *, std::int8_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int8_t *, std::int8_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int8_t *, std::int8_t *>>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<L1NormalizeFeaturizer_int8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_DestroyTransformer(/*in*/ L1NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -308,6 +412,10 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_DestroyTransformer(/*in*/
 }
 
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_CreateTransformerSaveData(/*in*/ L1NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return L1NormalizeFeaturizer_int8_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_CreateTransformerSaveDataWithLayout(/*in*/ L1NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -319,11 +427,12 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_CreateTransformerSaveData
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int8_t *, std::int8_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int8_t *, std::int8_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -340,6 +449,34 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_CreateTransformerSaveData
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_CreateTransformerSaveDataFile(/*in*/ L1NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int8_t *, std::int8_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int8_t *, std::int8_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_Transform(/*in*/ L1NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -390,6 +527,91 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_Transform(/*in*/ L1Normal
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_TransformBatch(/*in*/ L1NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_values_ptr == nullptr) throw std::invalid_argument("'input_values_ptr' is null");
+        if(input_sizes_ptr == nullptr) throw std::invalid_argument("'input_sizes_ptr' is null");
+        if(input_elements == 0) throw std::invalid_argument("'input_elements' is 0");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_elements == nullptr) throw std::invalid_argument("'output_elements' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int8_t *, std::int8_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int8_t *, std::int8_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_elements_begin(output_elements);
+        auto const output_func(
+            [&output_ptr, &output_elements](Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int8_t *, std::int8_t *>>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_elements = 0;
+                }
+                else {
+                    struct outputInternal {
+                        static void Deleter(double *pData) {
+                            delete [] pData;
+                        }
+                    };
+
+                    std::unique_ptr<double, void (*)(double *)> pBuffer(new double[result.size()], outputInternal::Deleter);
+                    double * ptr(pBuffer.get());
+
+                    for(auto &value : result)
+                        *ptr++ = std::move(value);
+
+                    *output_ptr = pBuffer.release();
+                    *output_elements = result.size();
+                }
+
+                ++output_ptr;
+                ++output_elements;
+            }
+        );
+
+        // Input
+        std::vector<std::tuple<int8_t *, int8_t *>> input_buffer;
+
+        input_buffer.reserve(input_elements);
+
+        int8_t const * const * const input_values_end_ptr(input_values_ptr + input_elements);
+
+        while(input_values_ptr != input_values_end_ptr) {
+            input_buffer.emplace_back(const_cast<int8_t *>(*input_values_ptr), const_cast<int8_t *>(*input_values_ptr) + *input_sizes_ptr);
+            ++input_values_ptr;
+            ++input_sizes_ptr;
+        }
+
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(L1NormalizeFeaturizer_int8_DestroyTransformedData(output_ptr_begin[result_index], output_elements_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int8_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -671,6 +893,55 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_CreateTransformerFromSav
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L1NormalizeFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int16_t *, std::int16_t *>>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int16_t *, std::int16_t *>>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<L1NormalizeFeaturizer_int16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_CloneTransformer(/*in*/ L1NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*out*/ L1NormalizeFeaturizer_int16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int16_t *, std::int16_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int16_t *, std::int16_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int16_t *, std::int16_t *>>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<L1NormalizeFeaturizer_int16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_DestroyTransformer(/*in*/ L1NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -696,6 +967,10 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_DestroyTransformer(/*in*
 }
 
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_CreateTransformerSaveData(/*in*/ L1NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return L1NormalizeFeaturizer_int16_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_CreateTransformerSaveDataWithLayout(/*in*/ L1NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -707,11 +982,12 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_CreateTransformerSaveDat
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int16_t *, std::int16_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int16_t *, std::int16_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -728,6 +1004,34 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_CreateTransformerSaveDat
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_CreateTransformerSaveDataFile(/*in*/ L1NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int16_t *, std::int16_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int16_t *, std::int16_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_Transform(/*in*/ L1NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -778,6 +1082,91 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_Transform(/*in*/ L1Norma
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_TransformBatch(/*in*/ L1NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_values_ptr == nullptr) throw std::invalid_argument("'input_values_ptr' is null");
+        if(input_sizes_ptr == nullptr) throw std::invalid_argument("'input_sizes_ptr' is null");
+        if(input_elements == 0) throw std::invalid_argument("'input_elements' is 0");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_elements == nullptr) throw std::invalid_argument("'output_elements' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int16_t *, std::int16_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int16_t *, std::int16_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_elements_begin(output_elements);
+        auto const output_func(
+            [&output_ptr, &output_elements](Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int16_t *, std::int16_t *>>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_elements = 0;
+                }
+                else {
+                    struct outputInternal {
+                        static void Deleter(double *pData) {
+                            delete [] pData;
+                        }
+                    };
+
+                    std::unique_ptr<double, void (*)(double *)> pBuffer(new double[result.size()], outputInternal::Deleter);
+                    double * ptr(pBuffer.get());
+
+                    for(auto &value : result)
+                        *ptr++ = std::move(value);
+
+                    *output_ptr = pBuffer.release();
+                    *output_elements = result.size();
+                }
+
+                ++output_ptr;
+                ++output_elements;
+            }
+        );
+
+        // Input
+        std::vector<std::tuple<int16_t *, int16_t *>> input_buffer;
+
+        input_buffer.reserve(input_elements);
+
+        int16_t const * const * const input_values_end_ptr(input_values_ptr + input_elements);
+
+        while(input_values_ptr != input_values_end_ptr) {
+            input_buffer.emplace_back(const_cast<int16_t *>(*input_values_ptr), const_cast<int16_t *>(*input_values_ptr) + *input_sizes_ptr);
+            ++input_values_ptr;
+            ++input_sizes_ptr;
+        }
+
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(L1NormalizeFeaturizer_int16_DestroyTransformedData(output_ptr_begin[result_index], output_elements_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int16_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1059,18 +1448,67 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_CreateTransformerFromSav
     }
 }
 
-FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_DestroyTransformer(/*in*/ L1NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L1NormalizeFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<L1NormalizeFeaturizer_int32_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_CloneTransformer(/*in*/ L1NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*out*/ L1NormalizeFeaturizer_int32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<L1NormalizeFeaturizer_int32_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_DestroyTransformer(/*in*/ L1NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
 
         delete pTransformer;
@@ -1084,6 +1522,10 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_DestroyTransformer(/*in*
 }
 
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_CreateTransformerSaveData(/*in*/ L1NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return L1NormalizeFeaturizer_int32_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_CreateTransformerSaveDataWithLayout(/*in*/ L1NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1095,11 +1537,12 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_CreateTransformerSaveDat
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -1116,6 +1559,34 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_CreateTransformerSaveDat
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_CreateTransformerSaveDataFile(/*in*/ L1NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_Transform(/*in*/ L1NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1166,6 +1637,91 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_Transform(/*in*/ L1Norma
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_TransformBatch(/*in*/ L1NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_values_ptr == nullptr) throw std::invalid_argument("'input_values_ptr' is null");
+        if(input_sizes_ptr == nullptr) throw std::invalid_argument("'input_sizes_ptr' is null");
+        if(input_elements == 0) throw std::invalid_argument("'input_elements' is 0");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_elements == nullptr) throw std::invalid_argument("'output_elements' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_elements_begin(output_elements);
+        auto const output_func(
+            [&output_ptr, &output_elements](Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int32_t *, std::int32_t *>>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_elements = 0;
+                }
+                else {
+                    struct outputInternal {
+                        static void Deleter(double *pData) {
+                            delete [] pData;
+                        }
+                    };
+
+                    std::unique_ptr<double, void (*)(double *)> pBuffer(new double[result.size()], outputInternal::Deleter);
+                    double * ptr(pBuffer.get());
+
+                    for(auto &value : result)
+                        *ptr++ = std::move(value);
+
+                    *output_ptr = pBuffer.release();
+                    *output_elements = result.size();
+                }
+
+                ++output_ptr;
+                ++output_elements;
+            }
+        );
+
+        // Input
+        std::vector<std::tuple<int32_t *, int32_t *>> input_buffer;
+
+        input_buffer.reserve(input_elements);
+
+        int32_t const * const * const input_values_end_ptr(input_values_ptr + input_elements);
+
+        while(input_values_ptr != input_values_end_ptr) {
+            input_buffer.emplace_back(const_cast<int32_t *>(*input_values_ptr), const_cast<int32_t *>(*input_values_ptr) + *input_sizes_ptr);
+            ++input_values_ptr;
+            ++input_sizes_ptr;
+        }
+
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(L1NormalizeFeaturizer_int32_DestroyTransformedData(output_ptr_begin[result_index], output_elements_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int32_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1447,6 +2003,55 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_CreateTransformerFromSav
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L1NormalizeFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int64_t *, std::int64_t *>>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int64_t *, std::int64_t *>>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<L1NormalizeFeaturizer_int64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_CloneTransformer(/*in*/ L1NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*out*/ L1NormalizeFeaturizer_int64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int64_t *, std::int64_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int64_t *, std::int64_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int64_t *, std::int64_t *>>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<L1NormalizeFeaturizer_int64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_DestroyTransformer(/*in*/ L1NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1472,6 +2077,10 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_DestroyTransformer(/*in*
 }
 
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_CreateTransformerSaveData(/*in*/ L1NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return L1NormalizeFeaturizer_int64_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_CreateTransformerSaveDataWithLayout(/*in*/ L1NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1483,11 +2092,12 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_CreateTransformerSaveDat
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int64_t *, std::int64_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int64_t *, std::int64_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -1504,6 +2114,34 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_CreateTransformerSaveDat
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_CreateTransformerSaveDataFile(/*in*/ L1NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int64_t *, std::int64_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int64_t *, std::int64_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_Transform(/*in*/ L1NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1554,6 +2192,91 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_Transform(/*in*/ L1Norma
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_TransformBatch(/*in*/ L1NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_values_ptr == nullptr) throw std::invalid_argument("'input_values_ptr' is null");
+        if(input_sizes_ptr == nullptr) throw std::invalid_argument("'input_sizes_ptr' is null");
+        if(input_elements == 0) throw std::invalid_argument("'input_elements' is 0");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_elements == nullptr) throw std::invalid_argument("'output_elements' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int64_t *, std::int64_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int64_t *, std::int64_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_elements_begin(output_elements);
+        auto const output_func(
+            [&output_ptr, &output_elements](Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::int64_t *, std::int64_t *>>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_elements = 0;
+                }
+                else {
+                    struct outputInternal {
+                        static void Deleter(double *pData) {
+                            delete [] pData;
+                        }
+                    };
+
+                    std::unique_ptr<double, void (*)(double *)> pBuffer(new double[result.size()], outputInternal::Deleter);
+                    double * ptr(pBuffer.get());
+
+                    for(auto &value : result)
+                        *ptr++ = std::move(value);
+
+                    *output_ptr = pBuffer.release();
+                    *output_elements = result.size();
+                }
+
+                ++output_ptr;
+                ++output_elements;
+            }
+        );
+
+        // Input
+        std::vector<std::tuple<int64_t *, int64_t *>> input_buffer;
+
+        input_buffer.reserve(input_elements);
+
+        int64_t const * const * const input_values_end_ptr(input_values_ptr + input_elements);
+
+        while(input_values_ptr != input_values_end_ptr) {
+            input_buffer.emplace_back(const_cast<int64_t *>(*input_values_ptr), const_cast<int64_t *>(*input_values_ptr) + *input_sizes_ptr);
+            ++input_values_ptr;
+            ++input_sizes_ptr;
+        }
+
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(L1NormalizeFeaturizer_int64_DestroyTransformedData(output_ptr_begin[result_index], output_elements_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_int64_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1835,21 +2558,22 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_CreateTransformerFromSav
     }
 }
 
-FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_DestroyTransformer(/*in*/ L1NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L1NormalizeFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<L1NormalizeFeaturizer_uint8_TransformerHandle*>(index);
     
         return true;
     }
@@ -1859,7 +2583,7 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_DestroyTransformer(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_CreateTransformerSaveData(/*in*/ L1NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_CloneTransformer(/*in*/ L1NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ L1NormalizeFeaturizer_uint8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1867,22 +2591,13 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_CreateTransformerSaveDat
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
-
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<L1NormalizeFeaturizer_uint8_TransformerHandle*>(index);
     
         return true;
     }
@@ -1892,7 +2607,97 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_CreateTransformerSaveDat
     }
 }
 
-FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_Transform(/*in*/ L1NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_DestroyTransformer(/*in*/ L1NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_CreateTransformerSaveData(/*in*/ L1NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return L1NormalizeFeaturizer_uint8_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_CreateTransformerSaveDataWithLayout(/*in*/ L1NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_CreateTransformerSaveDataFile(/*in*/ L1NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_Transform(/*in*/ L1NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1942,6 +2747,91 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_Transform(/*in*/ L1Norma
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_TransformBatch(/*in*/ L1NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_values_ptr == nullptr) throw std::invalid_argument("'input_values_ptr' is null");
+        if(input_sizes_ptr == nullptr) throw std::invalid_argument("'input_sizes_ptr' is null");
+        if(input_elements == 0) throw std::invalid_argument("'input_elements' is 0");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_elements == nullptr) throw std::invalid_argument("'output_elements' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_elements_begin(output_elements);
+        auto const output_func(
+            [&output_ptr, &output_elements](Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint8_t *, std::uint8_t *>>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_elements = 0;
+                }
+                else {
+                    struct outputInternal {
+                        static void Deleter(double *pData) {
+                            delete [] pData;
+                        }
+                    };
+
+                    std::unique_ptr<double, void (*)(double *)> pBuffer(new double[result.size()], outputInternal::Deleter);
+                    double * ptr(pBuffer.get());
+
+                    for(auto &value : result)
+                        *ptr++ = std::move(value);
+
+                    *output_ptr = pBuffer.release();
+                    *output_elements = result.size();
+                }
+
+                ++output_ptr;
+                ++output_elements;
+            }
+        );
+
+        // Input
+        std::vector<std::tuple<uint8_t *, uint8_t *>> input_buffer;
+
+        input_buffer.reserve(input_elements);
+
+        uint8_t const * const * const input_values_end_ptr(input_values_ptr + input_elements);
+
+        while(input_values_ptr != input_values_end_ptr) {
+            input_buffer.emplace_back(const_cast<uint8_t *>(*input_values_ptr), const_cast<uint8_t *>(*input_values_ptr) + *input_sizes_ptr);
+            ++input_values_ptr;
+            ++input_sizes_ptr;
+        }
+
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(L1NormalizeFeaturizer_uint8_DestroyTransformedData(output_ptr_begin[result_index], output_elements_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint8_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2223,6 +3113,55 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_CreateTransformerFromSa
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L1NormalizeFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint16_t *, std::uint16_t *>>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint16_t *, std::uint16_t *>>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<L1NormalizeFeaturizer_uint16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_CloneTransformer(/*in*/ L1NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ L1NormalizeFeaturizer_uint16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint16_t *, std::uint16_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint16_t *, std::uint16_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint16_t *, std::uint16_t *>>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<L1NormalizeFeaturizer_uint16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_DestroyTransformer(/*in*/ L1NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2248,6 +3187,10 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_DestroyTransformer(/*in
 }
 
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_CreateTransformerSaveData(/*in*/ L1NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return L1NormalizeFeaturizer_uint16_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_CreateTransformerSaveDataWithLayout(/*in*/ L1NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2259,11 +3202,12 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_CreateTransformerSaveDa
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint16_t *, std::uint16_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint16_t *, std::uint16_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -2280,6 +3224,34 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_CreateTransformerSaveDa
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_CreateTransformerSaveDataFile(/*in*/ L1NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint16_t *, std::uint16_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint16_t *, std::uint16_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_Transform(/*in*/ L1NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2330,6 +3302,91 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_Transform(/*in*/ L1Norm
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_TransformBatch(/*in*/ L1NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_values_ptr == nullptr) throw std::invalid_argument("'input_values_ptr' is null");
+        if(input_sizes_ptr == nullptr) throw std::invalid_argument("'input_sizes_ptr' is null");
+        if(input_elements == 0) throw std::invalid_argument("'input_elements' is 0");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_elements == nullptr) throw std::invalid_argument("'output_elements' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint16_t *, std::uint16_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint16_t *, std::uint16_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_elements_begin(output_elements);
+        auto const output_func(
+            [&output_ptr, &output_elements](Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint16_t *, std::uint16_t *>>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_elements = 0;
+                }
+                else {
+                    struct outputInternal {
+                        static void Deleter(double *pData) {
+                            delete [] pData;
+                        }
+                    };
+
+                    std::unique_ptr<double, void (*)(double *)> pBuffer(new double[result.size()], outputInternal::Deleter);
+                    double * ptr(pBuffer.get());
+
+                    for(auto &value : result)
+                        *ptr++ = std::move(value);
+
+                    *output_ptr = pBuffer.release();
+                    *output_elements = result.size();
+                }
+
+                ++output_ptr;
+                ++output_elements;
+            }
+        );
+
+        // Input
+        std::vector<std::tuple<uint16_t *, uint16_t *>> input_buffer;
+
+        input_buffer.reserve(input_elements);
+
+        uint16_t const * const * const input_values_end_ptr(input_values_ptr + input_elements);
+
+        while(input_values_ptr != input_values_end_ptr) {
+            input_buffer.emplace_back(const_cast<uint16_t *>(*input_values_ptr), const_cast<uint16_t *>(*input_values_ptr) + *input_sizes_ptr);
+            ++input_values_ptr;
+            ++input_sizes_ptr;
+        }
+
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(L1NormalizeFeaturizer_uint16_DestroyTransformedData(output_ptr_begin[result_index], output_elements_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint16_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2611,6 +3668,55 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_CreateTransformerFromSa
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L1NormalizeFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint32_t *, std::uint32_t *>>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint32_t *, std::uint32_t *>>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<L1NormalizeFeaturizer_uint32_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_CloneTransformer(/*in*/ L1NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ L1NormalizeFeaturizer_uint32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint32_t *, std::uint32_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint32_t *, std::uint32_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint32_t *, std::uint32_t *>>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<L1NormalizeFeaturizer_uint32_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_DestroyTransformer(/*in*/ L1NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2636,6 +3742,10 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_DestroyTransformer(/*in
 }
 
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_CreateTransformerSaveData(/*in*/ L1NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return L1NormalizeFeaturizer_uint32_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_CreateTransformerSaveDataWithLayout(/*in*/ L1NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2647,11 +3757,12 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_CreateTransformerSaveDa
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint32_t *, std::uint32_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint32_t *, std::uint32_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -2668,6 +3779,34 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_CreateTransformerSaveDa
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_CreateTransformerSaveDataFile(/*in*/ L1NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint32_t *, std::uint32_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint32_t *, std::uint32_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_Transform(/*in*/ L1NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2718,6 +3857,91 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_Transform(/*in*/ L1Norm
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_TransformBatch(/*in*/ L1NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_values_ptr == nullptr) throw std::invalid_argument("'input_values_ptr' is null");
+        if(input_sizes_ptr == nullptr) throw std::invalid_argument("'input_sizes_ptr' is null");
+        if(input_elements == 0) throw std::invalid_argument("'input_elements' is 0");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_elements == nullptr) throw std::invalid_argument("'output_elements' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint32_t *, std::uint32_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint32_t *, std::uint32_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_elements_begin(output_elements);
+        auto const output_func(
+            [&output_ptr, &output_elements](Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint32_t *, std::uint32_t *>>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_elements = 0;
+                }
+                else {
+                    struct outputInternal {
+                        static void Deleter(double *pData) {
+                            delete [] pData;
+                        }
+                    };
+
+                    std::unique_ptr<double, void (*)(double *)> pBuffer(new double[result.size()], outputInternal::Deleter);
+                    double * ptr(pBuffer.get());
+
+                    for(auto &value : result)
+                        *ptr++ = std::move(value);
+
+                    *output_ptr = pBuffer.release();
+                    *output_elements = result.size();
+                }
+
+                ++output_ptr;
+                ++output_elements;
+            }
+        );
+
+        // Input
+        std::vector<std::tuple<uint32_t *, uint32_t *>> input_buffer;
+
+        input_buffer.reserve(input_elements);
+
+        uint32_t const * const * const input_values_end_ptr(input_values_ptr + input_elements);
+
+        while(input_values_ptr != input_values_end_ptr) {
+            input_buffer.emplace_back(const_cast<uint32_t *>(*input_values_ptr), const_cast<uint32_t *>(*input_values_ptr) + *input_sizes_ptr);
+            ++input_values_ptr;
+            ++input_sizes_ptr;
+        }
+
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(L1NormalizeFeaturizer_uint32_DestroyTransformedData(output_ptr_begin[result_index], output_elements_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint32_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2999,6 +4223,55 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_CreateTransformerFromSa
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L1NormalizeFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<L1NormalizeFeaturizer_uint64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_CloneTransformer(/*in*/ L1NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ L1NormalizeFeaturizer_uint64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<L1NormalizeFeaturizer_uint64_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_DestroyTransformer(/*in*/ L1NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3024,6 +4297,10 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_DestroyTransformer(/*in
 }
 
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_CreateTransformerSaveData(/*in*/ L1NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return L1NormalizeFeaturizer_uint64_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_CreateTransformerSaveDataWithLayout(/*in*/ L1NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3035,11 +4312,12 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_CreateTransformerSaveDa
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -3056,6 +4334,34 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_CreateTransformerSaveDa
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_CreateTransformerSaveDataFile(/*in*/ L1NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_Transform(/*in*/ L1NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3071,31 +4377,116 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_Transform(/*in*/ L1Norm
         if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
         if(output_elements == nullptr) throw std::invalid_argument("'output_elements' is null");
 
-        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(std::make_tuple(const_cast<uint64_t *>(input_ptr), const_cast<uint64_t *>(input_ptr) + input_elements)));
+
+        // Output
+        if(result.empty()) {
+            *output_ptr = nullptr;
+            *output_elements = 0;
+        }
+        else {
+            struct outputInternal {
+                static void Deleter(double *pData) {
+                    delete [] pData;
+                }
+            };
+
+            std::unique_ptr<double, void (*)(double *)> pBuffer(new double[result.size()], outputInternal::Deleter);
+            double * ptr(pBuffer.get());
+
+            for(auto &value : result)
+                *ptr++ = std::move(value);
+
+            *output_ptr = pBuffer.release();
+            *output_elements = result.size();
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_uint64_TransformBatch(/*in*/ L1NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_values_ptr == nullptr) throw std::invalid_argument("'input_values_ptr' is null");
+        if(input_sizes_ptr == nullptr) throw std::invalid_argument("'input_sizes_ptr' is null");
+        if(input_elements == 0) throw std::invalid_argument("'input_elements' is 0");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_elements == nullptr) throw std::invalid_argument("'output_elements' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_elements_begin(output_elements);
+        auto const output_func(
+            [&output_ptr, &output_elements](Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::uint64_t *, std::uint64_t *>>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_elements = 0;
+                }
+                else {
+                    struct outputInternal {
+                        static void Deleter(double *pData) {
+                            delete [] pData;
+                        }
+                    };
+
+                    std::unique_ptr<double, void (*)(double *)> pBuffer(new double[result.size()], outputInternal::Deleter);
+                    double * ptr(pBuffer.get());
+
+                    for(auto &value : result)
+                        *ptr++ = std::move(value);
+
+                    *output_ptr = pBuffer.release();
+                    *output_elements = result.size();
+                }
+
+                ++output_ptr;
+                ++output_elements;
+            }
+        );
+
+        // Input
+        std::vector<std::tuple<uint64_t *, uint64_t *>> input_buffer;
+
+        input_buffer.reserve(input_elements);
 
-        // Input
-        auto result(transformer.execute(std::make_tuple(const_cast<uint64_t *>(input_ptr), const_cast<uint64_t *>(input_ptr) + input_elements)));
+        uint64_t const * const * const input_values_end_ptr(input_values_ptr + input_elements);
 
-        // Output
-        if(result.empty()) {
-            *output_ptr = nullptr;
-            *output_elements = 0;
+        while(input_values_ptr != input_values_end_ptr) {
+            input_buffer.emplace_back(const_cast<uint64_t *>(*input_values_ptr), const_cast<uint64_t *>(*input_values_ptr) + *input_sizes_ptr);
+            ++input_values_ptr;
+            ++input_sizes_ptr;
         }
-        else {
-            struct outputInternal {
-                static void Deleter(double *pData) {
-                    delete [] pData;
-                }
-            };
 
-            std::unique_ptr<double, void (*)(double *)> pBuffer(new double[result.size()], outputInternal::Deleter);
-            double * ptr(pBuffer.get());
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
 
-            for(auto &value : result)
-                *ptr++ = std::move(value);
+                if(L1NormalizeFeaturizer_uint64_DestroyTransformedData(output_ptr_begin[result_index], output_elements_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
 
-            *output_ptr = pBuffer.release();
-            *output_elements = result.size();
+            throw;
         }
     
         return true;
@@ -3387,6 +4778,55 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_CreateTransformerFromSav
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L1NormalizeFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::float_t *, std::float_t *>>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::float_t *, std::float_t *>>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<L1NormalizeFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_CloneTransformer(/*in*/ L1NormalizeFeaturizer_float_TransformerHandle *pHandle, /*out*/ L1NormalizeFeaturizer_float_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::float_t *, std::float_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::float_t *, std::float_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::float_t *, std::float_t *>>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<L1NormalizeFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_DestroyTransformer(/*in*/ L1NormalizeFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3412,6 +4852,10 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_DestroyTransformer(/*in*
 }
 
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_CreateTransformerSaveData(/*in*/ L1NormalizeFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return L1NormalizeFeaturizer_float_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_CreateTransformerSaveDataWithLayout(/*in*/ L1NormalizeFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3423,11 +4867,12 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_CreateTransformerSaveDat
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::float_t *, std::float_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::float_t *, std::float_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -3444,6 +4889,34 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_CreateTransformerSaveDat
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_CreateTransformerSaveDataFile(/*in*/ L1NormalizeFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::float_t *, std::float_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::float_t *, std::float_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_Transform(/*in*/ L1NormalizeFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3494,6 +4967,91 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_Transform(/*in*/ L1Norma
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_TransformBatch(/*in*/ L1NormalizeFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_values_ptr == nullptr) throw std::invalid_argument("'input_values_ptr' is null");
+        if(input_sizes_ptr == nullptr) throw std::invalid_argument("'input_sizes_ptr' is null");
+        if(input_elements == 0) throw std::invalid_argument("'input_elements' is 0");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_elements == nullptr) throw std::invalid_argument("'output_elements' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::float_t *, std::float_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::float_t *, std::float_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_elements_begin(output_elements);
+        auto const output_func(
+            [&output_ptr, &output_elements](Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::float_t *, std::float_t *>>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_elements = 0;
+                }
+                else {
+                    struct outputInternal {
+                        static void Deleter(double *pData) {
+                            delete [] pData;
+                        }
+                    };
+
+                    std::unique_ptr<double, void (*)(double *)> pBuffer(new double[result.size()], outputInternal::Deleter);
+                    double * ptr(pBuffer.get());
+
+                    for(auto &value : result)
+                        *ptr++ = std::move(value);
+
+                    *output_ptr = pBuffer.release();
+                    *output_elements = result.size();
+                }
+
+                ++output_ptr;
+                ++output_elements;
+            }
+        );
+
+        // Input
+        std::vector<std::tuple<float *, float *>> input_buffer;
+
+        input_buffer.reserve(input_elements);
+
+        float const * const * const input_values_end_ptr(input_values_ptr + input_elements);
+
+        while(input_values_ptr != input_values_end_ptr) {
+            input_buffer.emplace_back(const_cast<float *>(*input_values_ptr), const_cast<float *>(*input_values_ptr) + *input_sizes_ptr);
+            ++input_values_ptr;
+            ++input_sizes_ptr;
+        }
+
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(L1NormalizeFeaturizer_float_DestroyTransformedData(output_ptr_begin[result_index], output_elements_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_float_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3775,6 +5333,55 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_CreateTransformerFromSa
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L1NormalizeFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::double_t *, std::double_t *>>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::double_t *, std::double_t *>>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<L1NormalizeFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_CloneTransformer(/*in*/ L1NormalizeFeaturizer_double_TransformerHandle *pHandle, /*out*/ L1NormalizeFeaturizer_double_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::double_t *, std::double_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::double_t *, std::double_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::double_t *, std::double_t *>>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<L1NormalizeFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_DestroyTransformer(/*in*/ L1NormalizeFeaturizer_double_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3800,6 +5407,10 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_DestroyTransformer(/*in
 }
 
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_CreateTransformerSaveData(/*in*/ L1NormalizeFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return L1NormalizeFeaturizer_double_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_CreateTransformerSaveDataWithLayout(/*in*/ L1NormalizeFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3811,11 +5422,12 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_CreateTransformerSaveDa
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::double_t *, std::double_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::double_t *, std::double_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -3832,6 +5444,34 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_CreateTransformerSaveDa
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_CreateTransformerSaveDataFile(/*in*/ L1NormalizeFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::double_t *, std::double_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::double_t *, std::double_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_Transform(/*in*/ L1NormalizeFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3882,6 +5522,91 @@ FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_Transform(/*in*/ L1Norm
     }
 }
 
+FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_TransformBatch(/*in*/ L1NormalizeFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_values_ptr == nullptr) throw std::invalid_argument("'input_values_ptr' is null");
+        if(input_sizes_ptr == nullptr) throw std::invalid_argument("'input_sizes_ptr' is null");
+        if(input_elements == 0) throw std::invalid_argument("'input_elements' is 0");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+        if(output_elements == nullptr) throw std::invalid_argument("'output_elements' is null");
+
+        Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::double_t *, std::double_t *>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::double_t *, std::double_t *>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_ptr_begin(output_ptr);
+        auto * const output_elements_begin(output_elements);
+        auto const output_func(
+            [&output_ptr, &output_elements](Microsoft::Featurizer::Featurizers::L1NormalizeEstimator<std::tuple<std::double_t *, std::double_t *>>::TransformerType::TransformedType &result) {
+                if(result.empty()) {
+                    *output_ptr = nullptr;
+                    *output_elements = 0;
+                }
+                else {
+                    struct outputInternal {
+                        static void Deleter(double *pData) {
+                            delete [] pData;
+                        }
+                    };
+
+                    std::unique_ptr<double, void (*)(double *)> pBuffer(new double[result.size()], outputInternal::Deleter);
+                    double * ptr(pBuffer.get());
+
+                    for(auto &value : result)
+                        *ptr++ = std::move(value);
+
+                    *output_ptr = pBuffer.release();
+                    *output_elements = result.size();
+                }
+
+                ++output_ptr;
+                ++output_elements;
+            }
+        );
+
+        // Input
+        std::vector<std::tuple<double *, double *>> input_buffer;
+
+        input_buffer.reserve(input_elements);
+
+        double const * const * const input_values_end_ptr(input_values_ptr + input_elements);
+
+        while(input_values_ptr != input_values_end_ptr) {
+            input_buffer.emplace_back(const_cast<double *>(*input_values_ptr), const_cast<double *>(*input_values_ptr) + *input_sizes_ptr);
+            ++input_values_ptr;
+            ++input_sizes_ptr;
+        }
+
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_ptr_begin + result_index != output_ptr; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(L1NormalizeFeaturizer_double_DestroyTransformedData(output_ptr_begin[result_index], output_elements_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool L1NormalizeFeaturizer_double_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
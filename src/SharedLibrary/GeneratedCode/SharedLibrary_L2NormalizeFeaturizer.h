@@ -27,11 +27,16 @@ FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int8_CompleteTraining(/*in*/ L
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int8_CreateTransformerFromEstimator(/*in*/ L2NormalizeFeaturizer_int8_EstimatorHandle *pEstimatorHandle, /*out*/ L2NormalizeFeaturizer_int8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int8_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ L2NormalizeFeaturizer_int8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L2NormalizeFeaturizer_int8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int8_CloneTransformer(/*in*/ L2NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*out*/ L2NormalizeFeaturizer_int8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int8_DestroyTransformer(/*in*/ L2NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int8_CreateTransformerSaveData(/*in*/ L2NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int8_CreateTransformerSaveDataWithLayout(/*in*/ L2NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int8_CreateTransformerSaveDataFile(/*in*/ L2NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int8_Transform(/*in*/ L2NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int8_TransformBatch(/*in*/ L2NormalizeFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int8_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -53,11 +58,16 @@ FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int16_CompleteTraining(/*in*/
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int16_CreateTransformerFromEstimator(/*in*/ L2NormalizeFeaturizer_int16_EstimatorHandle *pEstimatorHandle, /*out*/ L2NormalizeFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int16_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ L2NormalizeFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L2NormalizeFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int16_CloneTransformer(/*in*/ L2NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*out*/ L2NormalizeFeaturizer_int16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int16_DestroyTransformer(/*in*/ L2NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int16_CreateTransformerSaveData(/*in*/ L2NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int16_CreateTransformerSaveDataWithLayout(/*in*/ L2NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int16_CreateTransformerSaveDataFile(/*in*/ L2NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int16_Transform(/*in*/ L2NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int16_TransformBatch(/*in*/ L2NormalizeFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int16_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -79,11 +89,16 @@ FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int32_CompleteTraining(/*in*/
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int32_CreateTransformerFromEstimator(/*in*/ L2NormalizeFeaturizer_int32_EstimatorHandle *pEstimatorHandle, /*out*/ L2NormalizeFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int32_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ L2NormalizeFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L2NormalizeFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int32_CloneTransformer(/*in*/ L2NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*out*/ L2NormalizeFeaturizer_int32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int32_DestroyTransformer(/*in*/ L2NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int32_CreateTransformerSaveData(/*in*/ L2NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int32_CreateTransformerSaveDataWithLayout(/*in*/ L2NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int32_CreateTransformerSaveDataFile(/*in*/ L2NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int32_Transform(/*in*/ L2NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int32_TransformBatch(/*in*/ L2NormalizeFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int32_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -105,11 +120,16 @@ FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int64_CompleteTraining(/*in*/
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int64_CreateTransformerFromEstimator(/*in*/ L2NormalizeFeaturizer_int64_EstimatorHandle *pEstimatorHandle, /*out*/ L2NormalizeFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int64_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ L2NormalizeFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L2NormalizeFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int64_CloneTransformer(/*in*/ L2NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*out*/ L2NormalizeFeaturizer_int64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int64_DestroyTransformer(/*in*/ L2NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int64_CreateTransformerSaveData(/*in*/ L2NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int64_CreateTransformerSaveDataWithLayout(/*in*/ L2NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int64_CreateTransformerSaveDataFile(/*in*/ L2NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int64_Transform(/*in*/ L2NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int64_TransformBatch(/*in*/ L2NormalizeFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_int64_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -131,11 +151,16 @@ FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint8_CompleteTraining(/*in*/
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint8_CreateTransformerFromEstimator(/*in*/ L2NormalizeFeaturizer_uint8_EstimatorHandle *pEstimatorHandle, /*out*/ L2NormalizeFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint8_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ L2NormalizeFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L2NormalizeFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint8_CloneTransformer(/*in*/ L2NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ L2NormalizeFeaturizer_uint8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint8_DestroyTransformer(/*in*/ L2NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint8_CreateTransformerSaveData(/*in*/ L2NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint8_CreateTransformerSaveDataWithLayout(/*in*/ L2NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint8_CreateTransformerSaveDataFile(/*in*/ L2NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint8_Transform(/*in*/ L2NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint8_TransformBatch(/*in*/ L2NormalizeFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint8_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -157,11 +182,16 @@ FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint16_CompleteTraining(/*in*/
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint16_CreateTransformerFromEstimator(/*in*/ L2NormalizeFeaturizer_uint16_EstimatorHandle *pEstimatorHandle, /*out*/ L2NormalizeFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint16_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ L2NormalizeFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L2NormalizeFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint16_CloneTransformer(/*in*/ L2NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ L2NormalizeFeaturizer_uint16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint16_DestroyTransformer(/*in*/ L2NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint16_CreateTransformerSaveData(/*in*/ L2NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint16_CreateTransformerSaveDataWithLayout(/*in*/ L2NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint16_CreateTransformerSaveDataFile(/*in*/ L2NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint16_Transform(/*in*/ L2NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint16_TransformBatch(/*in*/ L2NormalizeFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint16_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -183,11 +213,16 @@ FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint32_CompleteTraining(/*in*/
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint32_CreateTransformerFromEstimator(/*in*/ L2NormalizeFeaturizer_uint32_EstimatorHandle *pEstimatorHandle, /*out*/ L2NormalizeFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint32_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ L2NormalizeFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L2NormalizeFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint32_CloneTransformer(/*in*/ L2NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ L2NormalizeFeaturizer_uint32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint32_DestroyTransformer(/*in*/ L2NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint32_CreateTransformerSaveData(/*in*/ L2NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint32_CreateTransformerSaveDataWithLayout(/*in*/ L2NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint32_CreateTransformerSaveDataFile(/*in*/ L2NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint32_Transform(/*in*/ L2NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint32_TransformBatch(/*in*/ L2NormalizeFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint32_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -209,11 +244,16 @@ FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint64_CompleteTraining(/*in*/
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint64_CreateTransformerFromEstimator(/*in*/ L2NormalizeFeaturizer_uint64_EstimatorHandle *pEstimatorHandle, /*out*/ L2NormalizeFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint64_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ L2NormalizeFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L2NormalizeFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint64_CloneTransformer(/*in*/ L2NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ L2NormalizeFeaturizer_uint64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint64_DestroyTransformer(/*in*/ L2NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint64_CreateTransformerSaveData(/*in*/ L2NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint64_CreateTransformerSaveDataWithLayout(/*in*/ L2NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint64_CreateTransformerSaveDataFile(/*in*/ L2NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint64_Transform(/*in*/ L2NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint64_TransformBatch(/*in*/ L2NormalizeFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_uint64_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -235,11 +275,16 @@ FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_float_CompleteTraining(/*in*/
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_float_CreateTransformerFromEstimator(/*in*/ L2NormalizeFeaturizer_float_EstimatorHandle *pEstimatorHandle, /*out*/ L2NormalizeFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_float_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ L2NormalizeFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_float_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L2NormalizeFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_float_CloneTransformer(/*in*/ L2NormalizeFeaturizer_float_TransformerHandle *pHandle, /*out*/ L2NormalizeFeaturizer_float_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_float_DestroyTransformer(/*in*/ L2NormalizeFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_float_CreateTransformerSaveData(/*in*/ L2NormalizeFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_float_CreateTransformerSaveDataWithLayout(/*in*/ L2NormalizeFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_float_CreateTransformerSaveDataFile(/*in*/ L2NormalizeFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_float_Transform(/*in*/ L2NormalizeFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_float_TransformBatch(/*in*/ L2NormalizeFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_float_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -261,11 +306,16 @@ FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_double_CompleteTraining(/*in*/
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_double_CreateTransformerFromEstimator(/*in*/ L2NormalizeFeaturizer_double_EstimatorHandle *pEstimatorHandle, /*out*/ L2NormalizeFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_double_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ L2NormalizeFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_double_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ L2NormalizeFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_double_CloneTransformer(/*in*/ L2NormalizeFeaturizer_double_TransformerHandle *pHandle, /*out*/ L2NormalizeFeaturizer_double_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_double_DestroyTransformer(/*in*/ L2NormalizeFeaturizer_double_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_double_CreateTransformerSaveData(/*in*/ L2NormalizeFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_double_CreateTransformerSaveDataWithLayout(/*in*/ L2NormalizeFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_double_CreateTransformerSaveDataFile(/*in*/ L2NormalizeFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_double_Transform(/*in*/ L2NormalizeFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const *input_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_double_TransformBatch(/*in*/ L2NormalizeFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const **input_values_ptr, /*in*/ size_t const *input_sizes_ptr, /*in*/ size_t input_elements, /*out*/ double **output_ptr, /*out*/ size_t *output_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool L2NormalizeFeaturizer_double_DestroyTransformedData(/*in*/ double *result_ptr, /*in*/ size_t result_elements, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 } // extern "C"
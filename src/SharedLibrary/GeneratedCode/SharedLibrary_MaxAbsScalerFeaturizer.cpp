@@ -6,13 +6,68 @@
 
 #include "SharedLibrary_MaxAbsScalerFeaturizer.h"
 #include "SharedLibrary_PointerTable.h"
+#include "../SharedLibrary_Arrow.h"
 
 #include "Archive.h"
+#include "FileArchive.h"
 #include "MaxAbsScalerFeaturizer.h"
 
 // These method(s) are defined in SharedLibrary_Common.cpp
 ErrorInfoHandle * CreateErrorInfo(std::exception const &ex);
 std::chrono::system_clock::time_point CreateDateTime(DateTimeParameter const &param);
+Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout);
+
+namespace {
+
+// Transforms the inputs with a single call to the transformer's batch
+// `execute` method and invokes `outputFunc` for each result.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::true_type /*is_default_constructible*/) {
+    std::unique_ptr<typename TransformerT::TransformedType []> pResults(new typename TransformerT::TransformedType[cInputs]);
+
+    transformer.execute(pInputs, cInputs, pResults.get());
+
+    for(std::size_t index = 0; index < cInputs; ++index)
+        outputFunc(pResults[index]);
+}
+
+// The batch `execute` method writes to constructed items; results that can't be
+// default constructed are transformed one at a time.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::false_type /*is_default_constructible*/) {
+    typename TransformerT::InputType const * const  pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs) {
+        typename TransformerT::TransformedType      result(transformer.execute(*pInputs));
+
+        outputFunc(result);
+        ++pInputs;
+    }
+}
+
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc, std::is_default_constructible<typename TransformerT::TransformedType>());
+}
+
+// Results are written directly to the caller's buffer when its type is the
+// transformed type; otherwise, each result is converted by `outputFunc`.
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &/*outputFunc*/, std::true_type /*is_transformed_type*/) {
+    transformer.execute(pInputs, cInputs, pOutputs);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT * /*pOutputs*/, OutputFuncT const &outputFunc, std::false_type /*is_transformed_type*/) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &outputFunc) {
+    TransformBatchToOutput(transformer, pInputs, cInputs, pOutputs, outputFunc, std::is_same<OutputT, typename TransformerT::TransformedType>());
+}
+
+} // anonymous namespace
 
 extern "C" {
 
@@ -173,6 +228,34 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_FitBuffer(/*in*/ MaxAbsS
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_FitArrow(/*in*/ MaxAbsScalerFeaturizer_int8_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::int8_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_int8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -269,6 +352,55 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_CreateTransformerFromSav
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ MaxAbsScalerFeaturizer_int8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_CloneTransformer(/*in*/ MaxAbsScalerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ MaxAbsScalerFeaturizer_int8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -294,6 +426,10 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_DestroyTransformer(/*in*
 }
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return MaxAbsScalerFeaturizer_int8_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_CreateTransformerSaveDataWithLayout(/*in*/ MaxAbsScalerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -305,11 +441,12 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_CreateTransformerSaveDat
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -326,6 +463,34 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_CreateTransformerSaveDat
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_CreateTransformerSaveDataFile(/*in*/ MaxAbsScalerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_Transform(/*in*/ MaxAbsScalerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -355,6 +520,85 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_Transform(/*in*/ MaxAbsS
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_TransformBatch(/*in*/ MaxAbsScalerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_ptr, input_items, output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_TransformArrow(/*in*/ MaxAbsScalerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::int8_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int8_t, std::float_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
 /* |  MaxAbsScalerFeaturizer <int16> */
@@ -505,6 +749,34 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_FitBuffer(/*in*/ MaxAbs
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_FitArrow(/*in*/ MaxAbsScalerFeaturizer_int16_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::int16_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_int16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -601,21 +873,22 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_CreateTransformerFromSa
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ MaxAbsScalerFeaturizer_int16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType(archive));
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int16_TransformerHandle*>(index);
     
         return true;
     }
@@ -625,7 +898,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_DestroyTransformer(/*in
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_CloneTransformer(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ MaxAbsScalerFeaturizer_int16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -633,22 +906,13 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_CreateTransformerSaveDa
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
         Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
-
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
-
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int16_TransformerHandle*>(index);
     
         return true;
     }
@@ -658,7 +922,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_CreateTransformerSaveDa
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_Transform(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -667,17 +931,12 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_Transform(/*in*/ MaxAbs
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-
-        // Input
-        auto result(transformer.execute(input));
 
-        // Output
-        *output = result;
+        delete pTransformer;
     
         return true;
     }
@@ -687,27 +946,35 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_Transform(/*in*/ MaxAbs
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  MaxAbsScalerFeaturizer <uint8> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_uint8_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return MaxAbsScalerFeaturizer_int16_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_CreateTransformerSaveDataWithLayout(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        pEstimator->begin_training();
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint8_EstimatorHandle*>(index);
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -717,7 +984,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_CreateTransformerSaveDataFile(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -725,12 +992,17 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_DestroyEstimator(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -740,7 +1012,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_GetState(/*in*/ MaxAbsScalerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_Transform(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -748,17 +1020,178 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_GetState(/*in*/ MaxAbsS
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
-    
-        return true;
-    }
-    catch(std::exception const &ex) {
-        *ppErrorInfo = CreateErrorInfo(ex);
-        return false;
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_TransformBatch(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_ptr, input_items, output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_TransformArrow(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::int16_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int16_t, std::float_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  MaxAbsScalerFeaturizer <uint8> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_uint8_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint8_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_GetState(/*in*/ MaxAbsScalerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
     }
 }
 
@@ -837,6 +1270,34 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_FitBuffer(/*in*/ MaxAbs
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_FitArrow(/*in*/ MaxAbsScalerFeaturizer_uint8_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::uint8_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_uint8_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -933,6 +1394,55 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_CreateTransformerFromSa
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_CloneTransformer(/*in*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint8_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -958,6 +1468,10 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_DestroyTransformer(/*in
 }
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return MaxAbsScalerFeaturizer_uint8_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_CreateTransformerSaveDataWithLayout(/*in*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -969,11 +1483,12 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_CreateTransformerSaveDa
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -990,6 +1505,34 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_CreateTransformerSaveDa
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_CreateTransformerSaveDataFile(/*in*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_Transform(/*in*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1019,27 +1562,33 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_Transform(/*in*/ MaxAbs
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  MaxAbsScalerFeaturizer <uint16> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_TransformBatch(/*in*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        pEstimator->begin_training();
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint16_EstimatorHandle*>(index);
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
 
+        // Input
+        TransformBatchToOutput(transformer, input_ptr, input_items, output, output_func);
     
         return true;
     }
@@ -1049,7 +1598,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateEstimator(/*out*
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_TransformArrow(/*in*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1058,8 +1607,1123 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_DestroyEstimator(/*in*
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(index);
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::uint8_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint8_t, std::float_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  MaxAbsScalerFeaturizer <uint16> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint16_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_GetState(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_IsTrainingComplete(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_Fit(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ uint16_t input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        // No validation
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_FitBuffer(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ uint16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr, input_items));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_FitArrow(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::uint16_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CompleteTraining(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.complete_training();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateTransformerFromEstimator(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pEstimatorHandle, /*out*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CloneTransformer(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint16_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return MaxAbsScalerFeaturizer_uint16_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateTransformerSaveDataWithLayout(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateTransformerSaveDataFile(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_Transform(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_TransformBatch(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_ptr, input_items, output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_TransformArrow(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::uint16_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  MaxAbsScalerFeaturizer <float> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_float_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_float_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(index);
+        g_pointerTable.Remove(index);
+
+        delete pEstimator;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_GetState(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pState = static_cast<TrainingState>(estimator.get_state());
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_IsTrainingComplete(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_Fit(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*in*/ float input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+        // No validation
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_FitBuffer(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr, input_items));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_FitArrow(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::float_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.on_data_completed();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CompleteTraining(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        estimator.complete_training();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerFromEstimator(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pEstimatorHandle, /*out*/ MaxAbsScalerFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ MaxAbsScalerFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ MaxAbsScalerFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CloneTransformer(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*out*/ MaxAbsScalerFeaturizer_float_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<MaxAbsScalerFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
+
+
+        delete pTransformer;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return MaxAbsScalerFeaturizer_float_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerSaveDataWithLayout(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
+
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerSaveDataFile(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_Transform(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output = result;
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_TransformBatch(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ std::size_t input_items, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_ptr, input_items, output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_TransformArrow(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::float_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  MaxAbsScalerFeaturizer <int32> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        // No validation
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int32_EstimatorHandle*>(index);
+
+
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(index);
         g_pointerTable.Remove(index);
 
         delete pEstimator;
@@ -1072,7 +2736,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_DestroyEstimator(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_GetState(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_GetState(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1082,7 +2746,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_GetState(/*in*/ MaxAbs
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
         if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
         *pState = static_cast<TrainingState>(estimator.get_state());
     
@@ -1094,7 +2758,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_GetState(/*in*/ MaxAbs
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_IsTrainingComplete(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_IsTrainingComplete(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1104,7 +2768,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_IsTrainingComplete(/*i
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
         if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
         *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
@@ -1116,7 +2780,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_IsTrainingComplete(/*i
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_Fit(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ uint16_t input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_Fit(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ int32_t input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1129,7 +2793,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_Fit(/*in*/ MaxAbsScale
 
         // No validation
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
 
         *pFitResult = static_cast<unsigned char>(estimator.fit(input));
@@ -1142,7 +2806,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_Fit(/*in*/ MaxAbsScale
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_FitBuffer(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*in*/ uint16_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_FitBuffer(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ int32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1157,7 +2821,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_FitBuffer(/*in*/ MaxAb
         if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
         if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
         *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr, input_items));
     
@@ -1169,7 +2833,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_FitBuffer(/*in*/ MaxAb
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_FitArrow(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1177,10 +2841,17 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_OnDataCompleted(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        estimator.on_data_completed();
+        std::unique_ptr<std::int32_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -1190,7 +2861,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_OnDataCompleted(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CompleteTraining(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1199,9 +2870,9 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CompleteTraining(/*in*
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.complete_training();
+        estimator.on_data_completed();
     
         return true;
     }
@@ -1211,25 +2882,18 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CompleteTraining(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateTransformerFromEstimator(/*in*/ MaxAbsScalerFeaturizer_uint16_EstimatorHandle *pEstimatorHandle, /*out*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CompleteTraining(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType*>(estimator.create_transformer().release());
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint16_TransformerHandle*>(index);
+        estimator.complete_training();
     
         return true;
     }
@@ -1239,47 +2903,25 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateTransformerFromE
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerFromEstimator(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pEstimatorHandle, /*out*/ MaxAbsScalerFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
         if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType(archive));
-
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint16_TransformerHandle*>(index);
-    
-        return true;
-    }
-    catch(std::exception const &ex) {
-        *ppErrorInfo = CreateErrorInfo(ex);
-        return false;
-    }
-}
-
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
-    if(ppErrorInfo == nullptr)
-        return false;
 
-    try {
-        *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType*>(estimator.create_transformer().release());
 
 
-        delete pTransformer;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1289,30 +2931,23 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_DestroyTransformer(/*i
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ MaxAbsScalerFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType(archive));
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1322,26 +2957,22 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateTransformerSaveD
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_Transform(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ MaxAbsScalerFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-
-
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint16_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-        // Input
-        auto result(transformer.execute(input));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType(archive));
 
-        // Output
-        *output = result;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1351,27 +2982,21 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_Transform(/*in*/ MaxAb
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  MaxAbsScalerFeaturizer <float> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_float_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CloneTransformer(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ MaxAbsScalerFeaturizer_int32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
-
-        pEstimator->begin_training();
-
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_float_EstimatorHandle*>(index);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int32_TransformerHandle*>(index);
     
         return true;
     }
@@ -1381,7 +3006,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1391,10 +3016,11 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_DestroyEstimator(/*in*/
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
         size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(index);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType>(index);
         g_pointerTable.Remove(index);
 
-        delete pEstimator;
+
+        delete pTransformer;
     
         return true;
     }
@@ -1404,7 +3030,11 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_GetState(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return MaxAbsScalerFeaturizer_int32_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerSaveDataWithLayout(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1412,11 +3042,23 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_GetState(/*in*/ MaxAbsS
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -1426,7 +3068,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_GetState(/*in*/ MaxAbsS
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_IsTrainingComplete(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerSaveDataFile(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1434,11 +3076,17 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_IsTrainingComplete(/*in
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -1448,7 +3096,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_IsTrainingComplete(/*in
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_Fit(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*in*/ float input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_Transform(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1456,15 +3104,18 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_Fit(/*in*/ MaxAbsScaler
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        // No validation
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Input
+        auto result(transformer.execute(input));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+        // Output
+        *output = result;
     
         return true;
     }
@@ -1474,7 +3125,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_Fit(/*in*/ MaxAbsScaler
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_FitBuffer(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_TransformBatch(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1482,16 +3133,25 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_FitBuffer(/*in*/ MaxAbs
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
 
 
         if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
         if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr, input_items));
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_ptr, input_items, output, output_func);
     
         return true;
     }
@@ -1501,7 +3161,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_FitBuffer(/*in*/ MaxAbs
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_TransformArrow(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1510,9 +3170,31 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_OnDataCompleted(/*in*/
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        estimator.on_data_completed();
+        std::unique_ptr<std::int32_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -1522,18 +3204,27 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_OnDataCompleted(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CompleteTraining(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  MaxAbsScalerFeaturizer <int64> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        // No validation
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int64_EstimatorHandle*>(index);
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.complete_training();
     
         return true;
     }
@@ -1543,25 +3234,20 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CompleteTraining(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerFromEstimator(/*in*/ MaxAbsScalerFeaturizer_float_EstimatorHandle *pEstimatorHandle, /*out*/ MaxAbsScalerFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType*>(estimator.create_transformer().release());
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(index);
+        g_pointerTable.Remove(index);
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_float_TransformerHandle*>(index);
+        delete pEstimator;
     
         return true;
     }
@@ -1571,23 +3257,19 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerFromEs
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ MaxAbsScalerFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_GetState(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_float_TransformerHandle*>(index);
+        *pState = static_cast<TrainingState>(estimator.get_state());
     
         return true;
     }
@@ -1597,7 +3279,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerFromSa
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_IsTrainingComplete(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1605,13 +3287,11 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_DestroyTransformer(/*in
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
-
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pTransformer;
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
         return true;
     }
@@ -1621,7 +3301,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_DestroyTransformer(/*in
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_Fit(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ int64_t input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1629,22 +3309,15 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerSaveDa
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        transformer.save(archive);
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        // No validation
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
     
         return true;
     }
@@ -1654,7 +3327,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerSaveDa
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_Transform(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_FitBuffer(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ int64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1662,18 +3335,16 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_Transform(/*in*/ MaxAbs
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::float_t, std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        // Input
-        auto result(transformer.execute(input));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        // Output
-        *output = result;
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr, input_items));
     
         return true;
     }
@@ -1683,27 +3354,25 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_Transform(/*in*/ MaxAbs
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  MaxAbsScalerFeaturizer <int32> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_FitArrow(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        pEstimator->begin_training();
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int32_EstimatorHandle*>(index);
+        std::unique_ptr<std::int64_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -1713,7 +3382,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1722,11 +3391,9 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_DestroyEstimator(/*in*/
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        estimator.on_data_completed();
     
         return true;
     }
@@ -1736,7 +3403,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_GetState(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CompleteTraining(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1744,11 +3411,10 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_GetState(/*in*/ MaxAbsS
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        estimator.complete_training();
     
         return true;
     }
@@ -1758,19 +3424,25 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_GetState(/*in*/ MaxAbsS
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_IsTrainingComplete(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerFromEstimator(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pEstimatorHandle, /*out*/ MaxAbsScalerFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int64_TransformerHandle*>(index);
     
         return true;
     }
@@ -1780,23 +3452,23 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_IsTrainingComplete(/*in
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_Fit(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ int32_t input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ MaxAbsScalerFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-        // No validation
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType(archive));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int64_TransformerHandle*>(index);
     
         return true;
     }
@@ -1806,24 +3478,22 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_Fit(/*in*/ MaxAbsScaler
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_FitBuffer(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*in*/ int32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ MaxAbsScalerFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType(archive));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr, input_items));
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int64_TransformerHandle*>(index);
     
         return true;
     }
@@ -1833,7 +3503,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_FitBuffer(/*in*/ MaxAbs
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CloneTransformer(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ MaxAbsScalerFeaturizer_int64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1841,10 +3511,13 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_OnDataCompleted(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        estimator.on_data_completed();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int64_TransformerHandle*>(index);
     
         return true;
     }
@@ -1854,7 +3527,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_OnDataCompleted(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CompleteTraining(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1863,9 +3536,12 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CompleteTraining(/*in*/
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        estimator.complete_training();
+
+        delete pTransformer;
     
         return true;
     }
@@ -1875,25 +3551,35 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CompleteTraining(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerFromEstimator(/*in*/ MaxAbsScalerFeaturizer_int32_EstimatorHandle *pEstimatorHandle, /*out*/ MaxAbsScalerFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return MaxAbsScalerFeaturizer_int64_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerSaveDataWithLayout(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType*>(estimator.create_transformer().release());
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int32_TransformerHandle*>(index);
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -1903,23 +3589,25 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerFromEs
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ MaxAbsScalerFeaturizer_int32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerSaveDataFile(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int32_TransformerHandle*>(index);
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -1929,7 +3617,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerFromSa
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_Transform(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1938,12 +3626,17 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_DestroyTransformer(/*in
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
 
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        delete pTransformer;
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -1953,7 +3646,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_DestroyTransformer(/*in
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_TransformBatch(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1961,22 +3654,25 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerSaveDa
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
 
-        transformer.save(archive);
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType::TransformedType &result) {
+                *output = result;
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+                ++output;
+            }
+        );
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        // Input
+        TransformBatchToOutput(transformer, input_ptr, input_items, output, output_func);
     
         return true;
     }
@@ -1986,7 +3682,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerSaveDa
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_Transform(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_TransformArrow(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -1995,17 +3691,31 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_Transform(/*in*/ MaxAbs
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
+        std::unique_ptr<std::int64_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
 
         // Input
-        auto result(transformer.execute(input));
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
 
-        // Output
-        *output = result;
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -2017,10 +3727,10 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_Transform(/*in*/ MaxAbs
 
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
-/* |  MaxAbsScalerFeaturizer <int64> */
+/* |  MaxAbsScalerFeaturizer <uint32> */
 /* |                                                                      */
 /* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2028,12 +3738,12 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateEstimator(/*out*/
         *ppErrorInfo = nullptr;
 
         // No validation
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
 
         pEstimator->begin_training();
 
         size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int64_EstimatorHandle*>(index);
+        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint32_EstimatorHandle*>(index);
 
 
     
@@ -2045,7 +3755,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateEstimator(/*out*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2055,7 +3765,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_DestroyEstimator(/*in*/
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
         size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(index);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(index);
         g_pointerTable.Remove(index);
 
         delete pEstimator;
@@ -2068,7 +3778,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_DestroyEstimator(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_GetState(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_GetState(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2078,7 +3788,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_GetState(/*in*/ MaxAbsS
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
         if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
         *pState = static_cast<TrainingState>(estimator.get_state());
     
@@ -2090,7 +3800,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_GetState(/*in*/ MaxAbsS
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_IsTrainingComplete(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_IsTrainingComplete(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2100,7 +3810,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_IsTrainingComplete(/*in
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
         if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
         *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
@@ -2112,7 +3822,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_IsTrainingComplete(/*in
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_Fit(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ int64_t input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_Fit(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ uint32_t input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2125,7 +3835,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_Fit(/*in*/ MaxAbsScaler
 
         // No validation
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
 
         *pFitResult = static_cast<unsigned char>(estimator.fit(input));
@@ -2138,7 +3848,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_Fit(/*in*/ MaxAbsScaler
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_FitBuffer(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*in*/ int64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_FitBuffer(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ uint32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2153,7 +3863,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_FitBuffer(/*in*/ MaxAbs
         if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
         if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
         *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr, input_items));
     
@@ -2165,7 +3875,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_FitBuffer(/*in*/ MaxAbs
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_FitArrow(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2173,31 +3883,17 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_OnDataCompleted(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
-
-        estimator.on_data_completed();
-    
-        return true;
-    }
-    catch(std::exception const &ex) {
-        *ppErrorInfo = CreateErrorInfo(ex);
-        return false;
-    }
-}
-
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CompleteTraining(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
-    if(ppErrorInfo == nullptr)
-        return false;
-
-    try {
-        *ppErrorInfo = nullptr;
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        std::unique_ptr<std::uint32_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.complete_training();
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -2207,25 +3903,18 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CompleteTraining(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerFromEstimator(/*in*/ MaxAbsScalerFeaturizer_int64_EstimatorHandle *pEstimatorHandle, /*out*/ MaxAbsScalerFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType*>(estimator.create_transformer().release());
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int64_TransformerHandle*>(index);
+        estimator.on_data_completed();
     
         return true;
     }
@@ -2235,23 +3924,18 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerFromEs
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ MaxAbsScalerFeaturizer_int64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CompleteTraining(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_int64_TransformerHandle*>(index);
+        estimator.complete_training();
     
         return true;
     }
@@ -2261,21 +3945,25 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerFromSa
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerFromEstimator(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pEstimatorHandle, /*out*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
 
 
-        delete pTransformer;
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType*>(estimator.create_transformer().release());
+
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -2285,30 +3973,23 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_DestroyTransformer(/*in
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType(archive));
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -2318,26 +3999,22 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerSaveDa
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_Transform(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-
-
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::int64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-        // Input
-        auto result(transformer.execute(input));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType(archive));
 
-        // Output
-        *output = result;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -2347,27 +4024,21 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_Transform(/*in*/ MaxAbs
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  MaxAbsScalerFeaturizer <uint32> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CloneTransformer(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
-
-        pEstimator->begin_training();
-
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint32_EstimatorHandle*>(index);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint32_TransformerHandle*>(index);
     
         return true;
     }
@@ -2377,7 +4048,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateEstimator(/*out*
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2387,10 +4058,11 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_DestroyEstimator(/*in*
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
         size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(index);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType>(index);
         g_pointerTable.Remove(index);
 
-        delete pEstimator;
+
+        delete pTransformer;
     
         return true;
     }
@@ -2400,7 +4072,11 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_DestroyEstimator(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_GetState(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return MaxAbsScalerFeaturizer_uint32_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerSaveDataWithLayout(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2408,11 +4084,23 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_GetState(/*in*/ MaxAbs
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
+
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -2422,7 +4110,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_GetState(/*in*/ MaxAbs
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_IsTrainingComplete(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerSaveDataFile(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2430,11 +4118,17 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_IsTrainingComplete(/*i
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -2444,7 +4138,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_IsTrainingComplete(/*i
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_Fit(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ uint32_t input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_Transform(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2452,15 +4146,18 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_Fit(/*in*/ MaxAbsScale
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        // No validation
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Input
+        auto result(transformer.execute(input));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+        // Output
+        *output = result;
     
         return true;
     }
@@ -2470,7 +4167,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_Fit(/*in*/ MaxAbsScale
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_FitBuffer(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*in*/ uint32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_TransformBatch(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2478,16 +4175,25 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_FitBuffer(/*in*/ MaxAb
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
 
 
         if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
         if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr, input_items));
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_ptr, input_items, output, output_func);
     
         return true;
     }
@@ -2497,7 +4203,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_FitBuffer(/*in*/ MaxAb
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_TransformArrow(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2506,9 +4212,31 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_OnDataCompleted(/*in*/
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        estimator.on_data_completed();
+        std::unique_ptr<std::uint32_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -2518,18 +4246,27 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_OnDataCompleted(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CompleteTraining(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+/* ---------------------------------------------------------------------- */
+/* |                                                                      */
+/* |  MaxAbsScalerFeaturizer <uint64> */
+/* |                                                                      */
+/* ---------------------------------------------------------------------- */
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        // No validation
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+
+        pEstimator->begin_training();
+
+        size_t index(g_pointerTable.Add(pEstimator));
+        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint64_EstimatorHandle*>(index);
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        estimator.complete_training();
     
         return true;
     }
@@ -2539,25 +4276,20 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CompleteTraining(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerFromEstimator(/*in*/ MaxAbsScalerFeaturizer_uint32_EstimatorHandle *pEstimatorHandle, /*out*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType*>(estimator.create_transformer().release());
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(index);
+        g_pointerTable.Remove(index);
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint32_TransformerHandle*>(index);
+        delete pEstimator;
     
         return true;
     }
@@ -2567,23 +4299,19 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerFromE
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_GetState(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint32_TransformerHandle*>(index);
+        *pState = static_cast<TrainingState>(estimator.get_state());
     
         return true;
     }
@@ -2593,7 +4321,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerFromS
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_IsTrainingComplete(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2601,13 +4329,11 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_DestroyTransformer(/*i
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
-
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pTransformer;
+        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
     
         return true;
     }
@@ -2617,7 +4343,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_DestroyTransformer(/*i
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_Fit(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ uint64_t input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2625,22 +4351,15 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerSaveD
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
-
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        transformer.save(archive);
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        // No validation
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
     
         return true;
     }
@@ -2650,7 +4369,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerSaveD
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_Transform(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_FitBuffer(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ uint64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2658,18 +4377,16 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_Transform(/*in*/ MaxAb
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint32_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
 
-        // Input
-        auto result(transformer.execute(input));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        // Output
-        *output = result;
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr, input_items));
     
         return true;
     }
@@ -2679,27 +4396,25 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_Transform(/*in*/ MaxAb
     }
 }
 
-/* ---------------------------------------------------------------------- */
-/* |                                                                      */
-/* |  MaxAbsScalerFeaturizer <uint64> */
-/* |                                                                      */
-/* ---------------------------------------------------------------------- */
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateEstimator(/*out*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle **ppHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_FitArrow(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        // No validation
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>* pEstimator = new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>(std::make_shared<Microsoft::Featurizer::AnnotationMaps>(1), 0 );
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
-        pEstimator->begin_training();
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        size_t index(g_pointerTable.Add(pEstimator));
-        *ppHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint64_EstimatorHandle*>(index);
+        std::unique_ptr<std::uint64_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
     
         return true;
     }
@@ -2709,7 +4424,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateEstimator(/*out*
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_DestroyEstimator(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2718,11 +4433,9 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_DestroyEstimator(/*in*
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> * pEstimator = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(index);
-        g_pointerTable.Remove(index);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pEstimator;
+        estimator.on_data_completed();
     
         return true;
     }
@@ -2732,7 +4445,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_DestroyEstimator(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_GetState(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ TrainingState *pState, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CompleteTraining(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2740,11 +4453,10 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_GetState(/*in*/ MaxAbs
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pState == nullptr) throw std::invalid_argument("'pState' is null");
 
         Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pState = static_cast<TrainingState>(estimator.get_state());
+        estimator.complete_training();
     
         return true;
     }
@@ -2754,19 +4466,25 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_GetState(/*in*/ MaxAbs
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_IsTrainingComplete(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerFromEstimator(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pEstimatorHandle, /*out*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pIsTrainingComplete == nullptr) throw std::invalid_argument("'pIsTrainingComplete' is null");
+        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType*>(estimator.create_transformer().release());
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> const & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
 
-        *pIsTrainingComplete = estimator.get_state() != Microsoft::Featurizer::TrainingState::Training;
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint64_TransformerHandle*>(index);
     
         return true;
     }
@@ -2776,23 +4494,23 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_IsTrainingComplete(/*i
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_Fit(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ uint64_t input, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
-        // No validation
+        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
+        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
 
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType(archive));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input));
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint64_TransformerHandle*>(index);
     
         return true;
     }
@@ -2802,24 +4520,22 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_Fit(/*in*/ MaxAbsScale
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_FitBuffer(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*in*/ uint64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
-
-
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
 
-        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
-        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType(archive));
 
-        *pFitResult = static_cast<unsigned char>(estimator.fit(input_ptr, input_items));
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint64_TransformerHandle*>(index);
     
         return true;
     }
@@ -2829,7 +4545,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_FitBuffer(/*in*/ MaxAb
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CloneTransformer(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2837,10 +4553,13 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_OnDataCompleted(/*in*/
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
 
-        estimator.on_data_completed();
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint64_TransformerHandle*>(index);
     
         return true;
     }
@@ -2850,7 +4569,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_OnDataCompleted(/*in*/
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CompleteTraining(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2859,9 +4578,12 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CompleteTraining(/*in*
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+        size_t index = reinterpret_cast<size_t>(pHandle);
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType>(index);
+        g_pointerTable.Remove(index);
 
-        estimator.complete_training();
+
+        delete pTransformer;
     
         return true;
     }
@@ -2871,25 +4593,35 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CompleteTraining(/*in*
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerFromEstimator(/*in*/ MaxAbsScalerFeaturizer_uint64_EstimatorHandle *pEstimatorHandle, /*out*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return MaxAbsScalerFeaturizer_uint64_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerSaveDataWithLayout(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pEstimatorHandle == nullptr) throw std::invalid_argument("'pEstimatorHandle' is null");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>>(reinterpret_cast<size_t>(pEstimatorHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType * pTransformer = reinterpret_cast<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType*>(estimator.create_transformer().release());
+        unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
+        std::copy(buffer.begin(), buffer.end(), new_buffer);
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint64_TransformerHandle*>(index);
+        *ppBuffer = new_buffer;
+        *pBufferSize = buffer.size();
     
         return true;
     }
@@ -2899,23 +4631,25 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerFromE
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerSaveDataFile(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
     try {
         *ppErrorInfo = nullptr;
 
-        if(pBuffer == nullptr) throw std::invalid_argument("'pBuffer' is null");
-        if(cBufferSize == 0) throw std::invalid_argument("'cBufferSize' is 0");
-        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
-
-        Microsoft::Featurizer::Archive archive(pBuffer, cBufferSize);
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType(archive));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        size_t index = g_pointerTable.Add(pTransformer);
-        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_uint64_TransformerHandle*>(index);
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
     
         return true;
     }
@@ -2925,7 +4659,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerFromS
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_Transform(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2934,12 +4668,17 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_DestroyTransformer(/*i
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
-        size_t index = reinterpret_cast<size_t>(pHandle);
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType* pTransformer = g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType>(index);
-        g_pointerTable.Remove(index);
 
+        // No input validation
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        delete pTransformer;
+        // Input
+        auto result(transformer.execute(input));
+
+        // Output
+        *output = result;
     
         return true;
     }
@@ -2949,7 +4688,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_DestroyTransformer(/*i
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_TransformBatch(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2957,22 +4696,25 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerSaveD
         *ppErrorInfo = nullptr;
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-        if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
-        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
-        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
 
-        transformer.save(archive);
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
 
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-        unsigned char * new_buffer(new unsigned char[buffer.size()]);
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType::TransformedType &result) {
+                *output = result;
 
-        std::copy(buffer.begin(), buffer.end(), new_buffer);
+                ++output;
+            }
+        );
 
-        *ppBuffer = new_buffer;
-        *pBufferSize = buffer.size();
+        // Input
+        TransformBatchToOutput(transformer, input_ptr, input_items, output, output_func);
     
         return true;
     }
@@ -2982,7 +4724,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerSaveD
     }
 }
 
-FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_Transform(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_TransformArrow(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -2991,17 +4733,31 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_Transform(/*in*/ MaxAb
 
         if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
 
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
 
-        // No input validation
-        if(output == nullptr) throw std::invalid_argument("'output' is null");
+        std::unique_ptr<std::uint64_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
 
         Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::uint64_t, std::double_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
         // Input
-        auto result(transformer.execute(input));
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
 
-        // Output
-        *output = result;
+        output_builder.Release(*output_schema, *output_array);
     
         return true;
     }
@@ -3161,6 +4917,34 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_FitBuffer(/*in*/ MaxAb
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_FitArrow(/*in*/ MaxAbsScalerFeaturizer_double_EstimatorHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::double_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t> & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>>(reinterpret_cast<size_t>(pHandle)));
+
+        *pFitResult = static_cast<unsigned char>(estimator.fit(input_values.first, input_values.second));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_OnDataCompleted(/*in*/ MaxAbsScalerFeaturizer_double_EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3257,6 +5041,55 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_CreateTransformerFromS
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ MaxAbsScalerFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<MaxAbsScalerFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_CloneTransformer(/*in*/ MaxAbsScalerFeaturizer_double_TransformerHandle *pHandle, /*out*/ MaxAbsScalerFeaturizer_double_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<MaxAbsScalerFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_DestroyTransformer(/*in*/ MaxAbsScalerFeaturizer_double_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3282,6 +5115,10 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_DestroyTransformer(/*i
 }
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return MaxAbsScalerFeaturizer_double_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_CreateTransformerSaveDataWithLayout(/*in*/ MaxAbsScalerFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -3293,11 +5130,12 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_CreateTransformerSaveD
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -3314,6 +5152,34 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_CreateTransformerSaveD
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_CreateTransformerSaveDataFile(/*in*/ MaxAbsScalerFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_Transform(/*in*/ MaxAbsScalerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3343,6 +5209,85 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_Transform(/*in*/ MaxAb
     }
 }
 
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_TransformBatch(/*in*/ MaxAbsScalerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input_ptr, /*in*/ std::size_t input_items, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+        if(output == nullptr) throw std::invalid_argument("'output' is null");
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto const output_func(
+            [&output](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType::TransformedType &result) {
+                *output = result;
+
+                ++output;
+            }
+        );
+
+        // Input
+        TransformBatchToOutput(transformer, input_ptr, input_items, output, output_func);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_TransformArrow(/*in*/ MaxAbsScalerFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArrowSchema const *input_schema, /*in*/ ArrowArray const *input_array, /*out*/ ArrowSchema *output_schema, /*out*/ ArrowArray *output_array, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        // The input validation reads the input values, so the outputs are
+        // validated first.
+        if(output_schema == nullptr) throw std::invalid_argument("'output_schema' is null");
+        if(output_array == nullptr) throw std::invalid_argument("'output_array' is null");
+        if(input_schema == nullptr) throw std::invalid_argument("'input_schema' is null");
+        if(input_array == nullptr) throw std::invalid_argument("'input_array' is null");
+
+        std::unique_ptr<std::double_t []> input_buffer;
+        auto const input_values(Microsoft::Featurizer::Arrow::GetValues(*input_schema, *input_array, input_buffer));
+
+        Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType::TransformedType> output_builder(input_values.second);
+
+        auto const output_func(
+            [&output_builder](Microsoft::Featurizer::Featurizers::MaxAbsScalerEstimator<std::double_t, std::double_t>::TransformerType::TransformedType &result) {
+                output_builder.Append(result);
+            }
+        );
+
+        // Input
+        TransformBatch(transformer, input_values.first, input_values.second, output_func);
+
+        output_builder.Release(*output_schema, *output_array);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 
 #if (defined _MSC_VER)
 #   pragma warning(pop)
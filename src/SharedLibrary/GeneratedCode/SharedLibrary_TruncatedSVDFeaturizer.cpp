@@ -6,13 +6,68 @@
 
 #include "SharedLibrary_TruncatedSVDFeaturizer.h"
 #include "SharedLibrary_PointerTable.h"
+#include "../SharedLibrary_Arrow.h"
 
 #include "Archive.h"
+#include "FileArchive.h"
 #include "TruncatedSVDFeaturizer.h"
 
 // These method(s) are defined in SharedLibrary_Common.cpp
 ErrorInfoHandle * CreateErrorInfo(std::exception const &ex);
 std::chrono::system_clock::time_point CreateDateTime(DateTimeParameter const &param);
+Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout);
+
+namespace {
+
+// Transforms the inputs with a single call to the transformer's batch
+// `execute` method and invokes `outputFunc` for each result.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::true_type /*is_default_constructible*/) {
+    std::unique_ptr<typename TransformerT::TransformedType []> pResults(new typename TransformerT::TransformedType[cInputs]);
+
+    transformer.execute(pInputs, cInputs, pResults.get());
+
+    for(std::size_t index = 0; index < cInputs; ++index)
+        outputFunc(pResults[index]);
+}
+
+// The batch `execute` method writes to constructed items; results that can't be
+// default constructed are transformed one at a time.
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::false_type /*is_default_constructible*/) {
+    typename TransformerT::InputType const * const  pEndInputs(pInputs + cInputs);
+
+    while(pInputs != pEndInputs) {
+        typename TransformerT::TransformedType      result(transformer.execute(*pInputs));
+
+        outputFunc(result);
+        ++pInputs;
+    }
+}
+
+template <typename TransformerT, typename OutputFuncT>
+void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc, std::is_default_constructible<typename TransformerT::TransformedType>());
+}
+
+// Results are written directly to the caller's buffer when its type is the
+// transformed type; otherwise, each result is converted by `outputFunc`.
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &/*outputFunc*/, std::true_type /*is_transformed_type*/) {
+    transformer.execute(pInputs, cInputs, pOutputs);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT * /*pOutputs*/, OutputFuncT const &outputFunc, std::false_type /*is_transformed_type*/) {
+    TransformBatch(transformer, pInputs, cInputs, outputFunc);
+}
+
+template <typename TransformerT, typename OutputT, typename OutputFuncT>
+void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &outputFunc) {
+    TransformBatchToOutput(transformer, pInputs, cInputs, pOutputs, outputFunc, std::is_same<OutputT, typename TransformerT::TransformedType>());
+}
+
+} // anonymous namespace
 
 extern "C" {
 
@@ -288,6 +343,55 @@ FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerFromSa
     }
 }
 
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ TruncatedSVDFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<TruncatedSVDFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CloneTransformer(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*out*/ TruncatedSVDFeaturizer_float_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<TruncatedSVDFeaturizer_float_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_DestroyTransformer(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -313,6 +417,10 @@ FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_DestroyTransformer(/*in
 }
 
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerSaveData(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return TruncatedSVDFeaturizer_float_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerSaveDataWithLayout(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -324,11 +432,12 @@ FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerSaveDa
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -345,6 +454,34 @@ FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerSaveDa
     }
 }
 
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerSaveDataFile(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_Transform(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*in*/ size_t input_cols, /*in*/ size_t input_rows, /*in*/ float const * input_ptr, /*out*/ size_t *output_cols, /*out*/ size_t *output_rows, /*out*/ float **output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -390,6 +527,128 @@ FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_Transform(/*in*/ Trunca
     }
 }
 
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_TransformBatch(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*in*/ size_t input_cols, /*in*/ size_t input_rows, /*in*/ float const **input_values_ptr, /*in*/ size_t input_elements, /*out*/ size_t *output_cols, /*out*/ size_t *output_rows, /*out*/ float **output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_cols == 0) throw std::invalid_argument("'input_cols' is 0");
+        if(input_rows == 0) throw std::invalid_argument("'input_rows' is 0");
+        if(input_values_ptr == nullptr) throw std::invalid_argument("'input_values_ptr' is null");
+        if(input_elements == 0) throw std::invalid_argument("'input_elements' is 0");
+
+        std::vector<Eigen::Map<Eigen::MatrixX<float>>> input_buffer;
+
+        input_buffer.reserve(input_elements);
+
+        float const * const * const input_values_end(input_values_ptr + input_elements);
+
+        while(input_values_ptr != input_values_end) {
+        #if (defined __apple_build_verion__)
+            input_buffer.push_back(Eigen::Map<Eigen::MatrixX<float>>(const_cast<float *>(*input_values_ptr), static_cast<Eigen::Index>(input_rows), static_cast<Eigen::Index>(input_cols)));
+        #else
+            input_buffer.emplace_back(Eigen::Map<Eigen::MatrixX<float>>(const_cast<float *>(*input_values_ptr), static_cast<Eigen::Index>(input_rows), static_cast<Eigen::Index>(input_cols)));
+        #endif
+            ++input_values_ptr;
+        }
+        if(output_cols == nullptr) throw std::invalid_argument("'output_cols' is null");
+        if(output_rows == nullptr) throw std::invalid_argument("'output_rows' is null");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_cols_begin(output_cols);
+        auto * const output_rows_begin(output_rows);
+        auto * const output_ptr_begin(output_ptr);
+        auto const output_func(
+            [&output_cols, &output_rows, &output_ptr](Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType::TransformedType &result) {
+                struct outputInternal {
+                    static void Deleter(float *pData) {
+                        delete [] pData;
+                    }
+                };
+
+                std::unique_ptr<float, void (*)(float *)> output_buffer(new float[static_cast<size_t>(result.size())], outputInternal::Deleter);
+
+                memcpy(output_buffer.get(), result.data(), static_cast<size_t>(result.size()) * sizeof(float));
+
+                *output_ptr = output_buffer.release();
+                *output_cols = static_cast<size_t>(result.cols());
+                *output_rows = static_cast<size_t>(result.rows());
+
+                ++output_cols;
+                ++output_rows;
+                ++output_ptr;
+            }
+        );
+
+        // Input
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_cols_begin + result_index != output_cols; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(TruncatedSVDFeaturizer_float_DestroyTransformedData(output_cols_begin[result_index], output_rows_begin[result_index], output_ptr_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_TransformIntoBuffer(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*in*/ size_t input_cols, /*in*/ size_t input_rows, /*in*/ float const * input_ptr, /*out*/ float *output_ptr, /*in*/ size_t output_capacity, /*out*/ size_t *output_cols, /*out*/ size_t *output_rows, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_cols == 0) throw std::invalid_argument("'input_cols' is 0");
+        if(input_rows == 0) throw std::invalid_argument("'input_rows' is 0");
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && output_capacity != 0) throw std::invalid_argument("'output_ptr' is null");
+        if(output_cols == nullptr) throw std::invalid_argument("'output_cols' is null");
+        if(output_rows == nullptr) throw std::invalid_argument("'output_rows' is null");
+
+        Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<float>>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(Eigen::Map<Eigen::MatrixX<float>>(const_cast<float *>(input_ptr), static_cast<Eigen::Index>(input_rows), static_cast<Eigen::Index>(input_cols))));
+
+        // Output
+        *output_cols = static_cast<size_t>(result.cols());
+        *output_rows = static_cast<size_t>(result.rows());
+
+        if(static_cast<size_t>(result.size()) <= output_capacity)
+            memcpy(output_ptr, result.data(), static_cast<size_t>(result.size()) * sizeof(float));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_DestroyTransformedData(/*in*/ size_t result_cols, /*in*/ size_t result_rows, /*in*/ float *result_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -676,6 +935,55 @@ FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerFromS
     }
 }
 
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ TruncatedSVDFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+        Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType(archive));
+
+        size_t index = g_pointerTable.Add(pTransformer);
+        *ppTransformerHandle = reinterpret_cast<TruncatedSVDFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CloneTransformer(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*out*/ TruncatedSVDFeaturizer_double_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+        Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+        size_t index = g_pointerTable.Add(pClone);
+        *ppCloneHandle = reinterpret_cast<TruncatedSVDFeaturizer_double_TransformerHandle*>(index);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_DestroyTransformer(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -701,6 +1009,10 @@ FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_DestroyTransformer(/*i
 }
 
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerSaveData(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return TruncatedSVDFeaturizer_double_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerSaveDataWithLayout(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -712,11 +1024,12 @@ FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerSaveD
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive archive;
-
-        transformer.save(archive);
-
-        Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+        Microsoft::Featurizer::Archive::ByteArray const buffer(
+            Microsoft::Featurizer::Archive::Serialize(
+                [&transformer](Microsoft::Featurizer::Archive &archive) { transformer.save(archive); },
+                CreateArchiveLayout(layout)
+            )
+        );
 
         unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -733,6 +1046,34 @@ FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerSaveD
     }
 }
 
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerSaveDataFile(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&transformer](Microsoft::Featurizer::Archive &archive) {
+                transformer.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_Transform(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*in*/ size_t input_cols, /*in*/ size_t input_rows, /*in*/ double const * input_ptr, /*out*/ size_t *output_cols, /*out*/ size_t *output_rows, /*out*/ double **output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -778,6 +1119,128 @@ FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_Transform(/*in*/ Trunc
     }
 }
 
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_TransformBatch(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*in*/ size_t input_cols, /*in*/ size_t input_rows, /*in*/ double const **input_values_ptr, /*in*/ size_t input_elements, /*out*/ size_t *output_cols, /*out*/ size_t *output_rows, /*out*/ double **output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_cols == 0) throw std::invalid_argument("'input_cols' is 0");
+        if(input_rows == 0) throw std::invalid_argument("'input_rows' is 0");
+        if(input_values_ptr == nullptr) throw std::invalid_argument("'input_values_ptr' is null");
+        if(input_elements == 0) throw std::invalid_argument("'input_elements' is 0");
+
+        std::vector<Eigen::Map<Eigen::MatrixX<double>>> input_buffer;
+
+        input_buffer.reserve(input_elements);
+
+        double const * const * const input_values_end(input_values_ptr + input_elements);
+
+        while(input_values_ptr != input_values_end) {
+        #if (defined __apple_build_verion__)
+            input_buffer.push_back(Eigen::Map<Eigen::MatrixX<double>>(const_cast<double *>(*input_values_ptr), static_cast<Eigen::Index>(input_rows), static_cast<Eigen::Index>(input_cols)));
+        #else
+            input_buffer.emplace_back(Eigen::Map<Eigen::MatrixX<double>>(const_cast<double *>(*input_values_ptr), static_cast<Eigen::Index>(input_rows), static_cast<Eigen::Index>(input_cols)));
+        #endif
+            ++input_values_ptr;
+        }
+        if(output_cols == nullptr) throw std::invalid_argument("'output_cols' is null");
+        if(output_rows == nullptr) throw std::invalid_argument("'output_rows' is null");
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Output
+        auto * const output_cols_begin(output_cols);
+        auto * const output_rows_begin(output_rows);
+        auto * const output_ptr_begin(output_ptr);
+        auto const output_func(
+            [&output_cols, &output_rows, &output_ptr](Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType::TransformedType &result) {
+                struct outputInternal {
+                    static void Deleter(double *pData) {
+                        delete [] pData;
+                    }
+                };
+
+                std::unique_ptr<double, void (*)(double *)> output_buffer(new double[static_cast<size_t>(result.size())], outputInternal::Deleter);
+
+                memcpy(output_buffer.get(), result.data(), static_cast<size_t>(result.size()) * sizeof(double));
+
+                *output_ptr = output_buffer.release();
+                *output_cols = static_cast<size_t>(result.cols());
+                *output_rows = static_cast<size_t>(result.rows());
+
+                ++output_cols;
+                ++output_rows;
+                ++output_ptr;
+            }
+        );
+
+        // Input
+        try {
+            TransformBatch(transformer, input_buffer.data(), input_buffer.size(), output_func);
+        }
+        catch(...) {
+            // Destroy the results that were written before the error
+            for(std::size_t result_index = 0; output_cols_begin + result_index != output_cols; ++result_index) {
+                ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                if(TruncatedSVDFeaturizer_double_DestroyTransformedData(output_cols_begin[result_index], output_rows_begin[result_index], output_ptr_begin[result_index], &pDestroyErrorInfo) == false)
+                    DestroyErrorInfo(pDestroyErrorInfo);
+            }
+
+            throw;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_TransformIntoBuffer(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*in*/ size_t input_cols, /*in*/ size_t input_rows, /*in*/ double const * input_ptr, /*out*/ double *output_ptr, /*in*/ size_t output_capacity, /*out*/ size_t *output_cols, /*out*/ size_t *output_rows, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+        if(input_cols == 0) throw std::invalid_argument("'input_cols' is 0");
+        if(input_rows == 0) throw std::invalid_argument("'input_rows' is 0");
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(output_ptr == nullptr && output_capacity != 0) throw std::invalid_argument("'output_ptr' is null");
+        if(output_cols == nullptr) throw std::invalid_argument("'output_cols' is null");
+        if(output_rows == nullptr) throw std::invalid_argument("'output_rows' is null");
+
+        Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::TruncatedSVDEstimator<Eigen::Map<Eigen::MatrixX<double>>>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // Input
+        auto result(transformer.execute(Eigen::Map<Eigen::MatrixX<double>>(const_cast<double *>(input_ptr), static_cast<Eigen::Index>(input_rows), static_cast<Eigen::Index>(input_cols))));
+
+        // Output
+        *output_cols = static_cast<size_t>(result.cols());
+        *output_rows = static_cast<size_t>(result.rows());
+
+        if(static_cast<size_t>(result.size()) <= output_capacity)
+            memcpy(output_ptr, result.data(), static_cast<size_t>(result.size()) * sizeof(double));
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_DestroyTransformedData(/*in*/ size_t result_cols, /*in*/ size_t result_rows, /*in*/ double *result_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -27,11 +27,20 @@ FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CompleteTraining(/*in*/
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerFromEstimator(/*in*/ TruncatedSVDFeaturizer_float_EstimatorHandle *pEstimatorHandle, /*out*/ TruncatedSVDFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ TruncatedSVDFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ TruncatedSVDFeaturizer_float_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CloneTransformer(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*out*/ TruncatedSVDFeaturizer_float_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_DestroyTransformer(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerSaveData(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerSaveDataWithLayout(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_CreateTransformerSaveDataFile(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_Transform(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*in*/ size_t input_cols, /*in*/ size_t input_rows, /*in*/ float const * input_ptr, /*out*/ size_t *output_cols, /*out*/ size_t *output_rows, /*out*/ float **output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_TransformBatch(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*in*/ size_t input_cols, /*in*/ size_t input_rows, /*in*/ float const **input_values_ptr, /*in*/ size_t input_elements, /*out*/ size_t *output_cols, /*out*/ size_t *output_rows, /*out*/ float **output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
+// Writes the result to the caller's buffer when it fits within the capacity provided; the required size is always
+// returned. Querying the size with an empty buffer runs the full transform (and the transform runs again when the
+// data is retrieved), so this method is not available for transformers that maintain state across calls.
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_TransformIntoBuffer(/*in*/ TruncatedSVDFeaturizer_float_TransformerHandle *pHandle, /*in*/ size_t input_cols, /*in*/ size_t input_rows, /*in*/ float const * input_ptr, /*out*/ float *output_ptr, /*in*/ size_t output_capacity, /*out*/ size_t *output_cols, /*out*/ size_t *output_rows, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_float_DestroyTransformedData(/*in*/ size_t result_cols, /*in*/ size_t result_rows, /*in*/ float *result_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -53,11 +62,20 @@ FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CompleteTraining(/*in*
 /* Inference Methods */
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerFromEstimator(/*in*/ TruncatedSVDFeaturizer_double_EstimatorHandle *pEstimatorHandle, /*out*/ TruncatedSVDFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ TruncatedSVDFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ TruncatedSVDFeaturizer_double_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CloneTransformer(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*out*/ TruncatedSVDFeaturizer_double_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_DestroyTransformer(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerSaveData(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerSaveDataWithLayout(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_CreateTransformerSaveDataFile(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_Transform(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*in*/ size_t input_cols, /*in*/ size_t input_rows, /*in*/ double const * input_ptr, /*out*/ size_t *output_cols, /*out*/ size_t *output_rows, /*out*/ double **output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_TransformBatch(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*in*/ size_t input_cols, /*in*/ size_t input_rows, /*in*/ double const **input_values_ptr, /*in*/ size_t input_elements, /*out*/ size_t *output_cols, /*out*/ size_t *output_rows, /*out*/ double **output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
+// Writes the result to the caller's buffer when it fits within the capacity provided; the required size is always
+// returned. Querying the size with an empty buffer runs the full transform (and the transform runs again when the
+// data is retrieved), so this method is not available for transformers that maintain state across calls.
+FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_TransformIntoBuffer(/*in*/ TruncatedSVDFeaturizer_double_TransformerHandle *pHandle, /*in*/ size_t input_cols, /*in*/ size_t input_rows, /*in*/ double const * input_ptr, /*out*/ double *output_ptr, /*in*/ size_t output_capacity, /*out*/ size_t *output_cols, /*out*/ size_t *output_rows, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool TruncatedSVDFeaturizer_double_DestroyTransformedData(/*in*/ size_t result_cols, /*in*/ size_t result_rows, /*in*/ double *result_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 } // extern "C"
@@ -8,6 +8,8 @@
 #include "GeneratedCode/SharedLibraryTests_CatImputerFeaturizer.h"
 #include "../../3rdParty/optional.h"
 
+#include <cstring>
+
 TEST_CASE("int8") {
     CatImputerFeaturizer_int8_Test(
         std::vector<nonstd::optional<std::int8_t>>{
@@ -55,3 +57,164 @@ TEST_CASE("string") {
         }
     );
 }
+
+TEST_CASE("string - views") {
+    ErrorInfoHandle *                       pErrorInfo(nullptr);
+    CatImputerFeaturizer_string_EstimatorHandle *   pEstimatorHandle(nullptr);
+
+    REQUIRE(CatImputerFeaturizer_string_CreateEstimator(&pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Contiguous data with offsets; the second item is null
+    char const                              trainingData[] = "worldhelloworld";
+    std::size_t const                       trainingOffsets[] = {0, 5, 5, 10, 15};
+    unsigned char const                     trainingValidity[] = {0x0D};
+    FitResult                               result(0);
+
+    REQUIRE(CatImputerFeaturizer_string_FitBufferView(pEstimatorHandle, trainingData, trainingOffsets, trainingValidity, 4, &result, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(result == Continue);
+
+    // The data isn't null-terminated
+    REQUIRE(CatImputerFeaturizer_string_FitView(pEstimatorHandle, "world!", 5, &result, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(result == Continue);
+
+    // Unsorted offsets
+    std::size_t const                       invalidOffsets[] = {0, 5, 4};
+
+    CHECK(CatImputerFeaturizer_string_FitBufferView(pEstimatorHandle, trainingData, invalidOffsets, nullptr, 2, &result, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    REQUIRE(CatImputerFeaturizer_string_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CatImputerFeaturizer_string_TransformerHandle * pTransformerHandle(nullptr);
+
+    REQUIRE(CatImputerFeaturizer_string_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(CatImputerFeaturizer_string_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // TransformView
+    char const *                            pOutput(nullptr);
+    std::size_t                             outputItems(0);
+
+    REQUIRE(CatImputerFeaturizer_string_TransformView(pTransformerHandle, "hello!", 5, &pOutput, &outputItems, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(std::string(pOutput, outputItems) == "hello");
+
+    REQUIRE(CatImputerFeaturizer_string_DestroyTransformedData(pOutput, outputItems, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(CatImputerFeaturizer_string_TransformView(pTransformerHandle, nullptr, 0, &pOutput, &outputItems, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(std::string(pOutput, outputItems) == "world");
+
+    REQUIRE(CatImputerFeaturizer_string_DestroyTransformedData(pOutput, outputItems, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // TransformBatchView
+    char const                              inferencingData[] = "hello";
+    std::size_t const                       inferencingOffsets[] = {0, 5, 5};
+    unsigned char const                     inferencingValidity[] = {0x01};
+    char const *                            outputs[2] = {nullptr, nullptr};
+    std::size_t                             outputsItems[2] = {0, 0};
+
+    REQUIRE(CatImputerFeaturizer_string_TransformBatchView(pTransformerHandle, inferencingData, inferencingOffsets, inferencingValidity, 2, outputs, outputsItems, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(std::string(outputs[0], outputsItems[0]) == "hello");
+    CHECK(std::string(outputs[1], outputsItems[1]) == "world");
+
+    for(std::size_t index = 0; index < 2; ++index) {
+        REQUIRE(CatImputerFeaturizer_string_DestroyTransformedData(outputs[index], outputsItems[index], &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+    }
+
+    REQUIRE(CatImputerFeaturizer_string_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
+
+TEST_CASE("float - Arrow") {
+    ErrorInfoHandle *                       pErrorInfo(nullptr);
+    CatImputerFeaturizer_float_EstimatorHandle *    pEstimatorHandle(nullptr);
+
+    REQUIRE(CatImputerFeaturizer_float_CreateEstimator(&pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // The second value is null
+    float const                             values[] = {1.0f, 0.0f, 2.0f, 2.0f};
+    unsigned char const                     validity[] = {0x0D};
+    void const *                            buffers[] = {validity, values};
+
+    ArrowSchema                             schema;
+
+    std::memset(&schema, 0, sizeof(schema));
+    schema.format = "f";
+    schema.release = [](ArrowSchema *pSchema) { pSchema->release = nullptr; };
+
+    ArrowArray                              array;
+
+    std::memset(&array, 0, sizeof(array));
+    array.length = 4;
+    array.null_count = 1;
+    array.n_buffers = 2;
+    array.buffers = buffers;
+    array.release = [](ArrowArray *pArray) { pArray->release = nullptr; };
+
+    FitResult                               result(0);
+
+    REQUIRE(CatImputerFeaturizer_float_FitArrow(pEstimatorHandle, &schema, &array, &result, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(result == Continue);
+
+    // Invalid format
+    schema.format = "g";
+
+    CHECK(CatImputerFeaturizer_float_FitArrow(pEstimatorHandle, &schema, &array, &result, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    schema.format = "f";
+
+    REQUIRE(CatImputerFeaturizer_float_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CatImputerFeaturizer_float_TransformerHandle *  pTransformerHandle(nullptr);
+
+    REQUIRE(CatImputerFeaturizer_float_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(CatImputerFeaturizer_float_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    ArrowSchema                             outputSchema;
+    ArrowArray                              outputArray;
+
+    REQUIRE(CatImputerFeaturizer_float_TransformArrow(pTransformerHandle, &schema, &array, &outputSchema, &outputArray, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CHECK(std::string(outputSchema.format) == "f");
+    CHECK(outputArray.length == 4);
+    CHECK(outputArray.null_count == 0);
+    CHECK(outputArray.offset == 0);
+    REQUIRE(outputArray.n_buffers == 2);
+    CHECK(outputArray.buffers[0] == nullptr);
+
+    float const * const                     pOutput(static_cast<float const *>(outputArray.buffers[1]));
+
+    CHECK(std::vector<float>(pOutput, pOutput + 4) == std::vector<float>{1.0f, 2.0f, 2.0f, 2.0f});
+
+    outputArray.release(&outputArray);
+    CHECK(outputArray.release == nullptr);
+
+    outputSchema.release(&outputSchema);
+    CHECK(outputSchema.release == nullptr);
+
+    REQUIRE(CatImputerFeaturizer_float_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
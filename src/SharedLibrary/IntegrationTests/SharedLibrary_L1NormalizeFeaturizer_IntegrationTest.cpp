@@ -25,3 +25,67 @@ TEST_CASE("int") {
         }
     );
 }
+
+TEST_CASE("Multiple rows") {
+    // ----------------------------------------------------------------------
+    using Ints                              = std::vector<std::int32_t>;
+    // ----------------------------------------------------------------------
+
+    Ints const                              row1{1, 2, 3, 4};
+    Ints const                              row2{2, 2, 2, 2};
+
+    ErrorInfoHandle *                       pErrorInfo(nullptr);
+    L1NormalizeFeaturizer_int32_EstimatorHandle *   pEstimatorHandle(nullptr);
+
+    REQUIRE(L1NormalizeFeaturizer_int32_CreateEstimator(&pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    FitResult                               result(0);
+
+    REQUIRE(L1NormalizeFeaturizer_int32_Fit(pEstimatorHandle, row1.data(), row1.size(), &result, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(L1NormalizeFeaturizer_int32_Fit(pEstimatorHandle, row2.data(), row2.size(), &result, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(L1NormalizeFeaturizer_int32_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    L1NormalizeFeaturizer_int32_TransformerHandle * pTransformerHandle(nullptr);
+
+    REQUIRE(L1NormalizeFeaturizer_int32_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(L1NormalizeFeaturizer_int32_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Each transform consumes the norm of a row. A query-then-fill sequence (as
+    // performed by `TransformIntoBuffer`, which isn't available for this featurizer)
+    // would transform the first row twice, filling the buffer with values
+    // normalized by the norm of the second row.
+    double *                                pResults(nullptr);
+    size_t                                  numResults(0);
+
+    REQUIRE(L1NormalizeFeaturizer_int32_Transform(pTransformerHandle, row1.data(), row1.size(), &pResults, &numResults, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(std::vector<double>(pResults, pResults + numResults) == std::vector<double>{0.1, 0.2, 0.3, 0.4});
+
+    REQUIRE(L1NormalizeFeaturizer_int32_DestroyTransformedData(pResults, numResults, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(L1NormalizeFeaturizer_int32_Transform(pTransformerHandle, row1.data(), row1.size(), &pResults, &numResults, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(std::vector<double>(pResults, pResults + numResults) == std::vector<double>{0.125, 0.25, 0.375, 0.5});
+
+    REQUIRE(L1NormalizeFeaturizer_int32_DestroyTransformedData(pResults, numResults, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // All of the norms have been consumed
+    CHECK(L1NormalizeFeaturizer_int32_Transform(pTransformerHandle, row1.data(), row1.size(), &pResults, &numResults, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    REQUIRE(L1NormalizeFeaturizer_int32_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
@@ -7,6 +7,9 @@
 
 #include "GeneratedCode/SharedLibraryTests_LabelEncoderFeaturizer.h"
 
+#include <cstdio>
+#include <cstring>
+
 
 TEST_CASE("int8") {
     LabelEncoderFeaturizer_int8_Test(
@@ -61,3 +64,235 @@ TEST_CASE("string") {
         bool(true)
     );
 }
+
+TEST_CASE("string - Arrow") {
+    ErrorInfoHandle *                       pErrorInfo(nullptr);
+    LabelEncoderFeaturizer_string_EstimatorHandle * pEstimatorHandle(nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_CreateEstimator(true, &pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // utf8 array with 32-bit offsets
+    char const                              data[] = "orangeapplegrape";
+    std::int32_t const                      offsets[] = {0, 6, 11, 16};
+    void const *                            buffers[] = {nullptr, offsets, data};
+
+    ArrowSchema                             schema;
+
+    std::memset(&schema, 0, sizeof(schema));
+    schema.format = "u";
+    schema.release = [](ArrowSchema *pSchema) { pSchema->release = nullptr; };
+
+    ArrowArray                              array;
+
+    std::memset(&array, 0, sizeof(array));
+    array.length = 3;
+    array.n_buffers = 3;
+    array.buffers = buffers;
+    array.release = [](ArrowArray *pArray) { pArray->release = nullptr; };
+
+    FitResult                               result(0);
+
+    REQUIRE(LabelEncoderFeaturizer_string_FitArrow(pEstimatorHandle, &schema, &array, &result, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(result == Continue);
+
+    REQUIRE(LabelEncoderFeaturizer_string_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    LabelEncoderFeaturizer_string_TransformerHandle *   pTransformerHandle(nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Transform a slice of the array
+    array.offset = 1;
+    array.length = 2;
+
+    ArrowSchema                             outputSchema;
+    ArrowArray                              outputArray;
+
+    REQUIRE(LabelEncoderFeaturizer_string_TransformArrow(pTransformerHandle, &schema, &array, &outputSchema, &outputArray, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CHECK(std::string(outputSchema.format) == "I");
+    CHECK(outputArray.length == 2);
+    CHECK(outputArray.null_count == 0);
+    REQUIRE(outputArray.n_buffers == 2);
+
+    std::uint32_t const * const             pOutput(static_cast<std::uint32_t const *>(outputArray.buffers[1]));
+
+    CHECK(std::vector<std::uint32_t>(pOutput, pOutput + 2) == std::vector<std::uint32_t>{1, 2});
+
+    outputArray.release(&outputArray);
+    outputSchema.release(&outputSchema);
+
+    // Null values are not supported
+    unsigned char const                     validity[] = {0x05};
+
+    buffers[0] = validity;
+    array.offset = 0;
+    array.length = 3;
+    array.null_count = 1;
+
+    CHECK(LabelEncoderFeaturizer_string_TransformArrow(pTransformerHandle, &schema, &array, &outputSchema, &outputArray, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    // Outputs are validated before the input values are read
+    CHECK(LabelEncoderFeaturizer_string_TransformArrow(pTransformerHandle, &schema, &array, nullptr, &outputArray, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+
+    char const *                            pErrorString(nullptr);
+    std::size_t                             cErrorString(0);
+
+    REQUIRE(GetErrorInfoString(pErrorInfo, &pErrorString, &cErrorString));
+    CHECK(std::string(pErrorString, cErrorString) == "'output_schema' is null");
+    REQUIRE(DestroyErrorInfoString(pErrorString, cErrorString));
+
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    // Negative offsets
+    std::int32_t const                      negativeOffsets[] = {-6, 0, 5};
+
+    buffers[0] = nullptr;
+    buffers[1] = negativeOffsets;
+    array.offset = 0;
+    array.length = 2;
+    array.null_count = 0;
+
+    CHECK(LabelEncoderFeaturizer_string_TransformArrow(pTransformerHandle, &schema, &array, &outputSchema, &outputArray, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    REQUIRE(LabelEncoderFeaturizer_string_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
+
+void SaveToFileTest(ArchiveLayout layout) {
+    ErrorInfoHandle *                       pErrorInfo(nullptr);
+    LabelEncoderFeaturizer_string_EstimatorHandle * pEstimatorHandle(nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_CreateEstimator(true, &pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    char const *                            training[] = {"orange", "apple", "grape"};
+    FitResult                               result(0);
+
+    REQUIRE(LabelEncoderFeaturizer_string_FitBuffer(pEstimatorHandle, training, 3, &result, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    LabelEncoderFeaturizer_string_TransformerHandle *   pTransformerHandle(nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    char const * const                      filename("SharedLibrary_LEFeaturizer_IntegrationTest.bin");
+
+    REQUIRE(LabelEncoderFeaturizer_string_CreateTransformerSaveDataFile(pTransformerHandle, filename, layout, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    pTransformerHandle = nullptr;
+
+    REQUIRE(LabelEncoderFeaturizer_string_CreateTransformerFromSavedDataFile(filename, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    std::remove(filename);
+
+    std::uint32_t                           output(0);
+
+    REQUIRE(LabelEncoderFeaturizer_string_Transform(pTransformerHandle, "grape", &output, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(output == 2);
+
+    REQUIRE(LabelEncoderFeaturizer_string_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // The file no longer exists
+    CHECK(LabelEncoderFeaturizer_string_CreateTransformerFromSavedDataFile(filename, &pTransformerHandle, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+}
+
+TEST_CASE("string - save to file") {
+    SaveToFileTest(ArchiveLayoutValue::StandardLayout);
+    SaveToFileTest(ArchiveLayoutValue::FlatLayout);
+    SaveToFileTest(ArchiveLayoutValue::CompactLayout);
+}
+
+TEST_CASE("string - save with layout") {
+    ErrorInfoHandle *                       pErrorInfo(nullptr);
+    LabelEncoderFeaturizer_string_EstimatorHandle * pEstimatorHandle(nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_CreateEstimator(true, &pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    char const *                            training[] = {"orange", "apple", "grape"};
+    FitResult                               result(0);
+
+    REQUIRE(LabelEncoderFeaturizer_string_FitBuffer(pEstimatorHandle, training, 3, &result, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    LabelEncoderFeaturizer_string_TransformerHandle *   pTransformerHandle(nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    for(ArchiveLayout layout : {ArchiveLayoutValue::StandardLayout, ArchiveLayoutValue::FlatLayout, ArchiveLayoutValue::CompactLayout}) {
+        unsigned char const *               pSavedData(nullptr);
+        std::size_t                         cSavedData(0);
+
+        REQUIRE(LabelEncoderFeaturizer_string_CreateTransformerSaveDataWithLayout(pTransformerHandle, layout, &pSavedData, &cSavedData, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        LabelEncoderFeaturizer_string_TransformerHandle *   pOtherTransformerHandle(nullptr);
+
+        REQUIRE(LabelEncoderFeaturizer_string_CreateTransformerFromSavedData(pSavedData, cSavedData, &pOtherTransformerHandle, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        REQUIRE(DestroyTransformerSaveData(pSavedData, cSavedData, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        std::uint32_t                       output(0);
+
+        REQUIRE(LabelEncoderFeaturizer_string_Transform(pOtherTransformerHandle, "grape", &output, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+        CHECK(output == 2);
+
+        REQUIRE(LabelEncoderFeaturizer_string_DestroyTransformer(pOtherTransformerHandle, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+    }
+
+    // Invalid layout
+    unsigned char const *                   pSavedData(nullptr);
+    std::size_t                             cSavedData(0);
+
+    CHECK(LabelEncoderFeaturizer_string_CreateTransformerSaveDataWithLayout(pTransformerHandle, 0, &pSavedData, &cSavedData, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    REQUIRE(LabelEncoderFeaturizer_string_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
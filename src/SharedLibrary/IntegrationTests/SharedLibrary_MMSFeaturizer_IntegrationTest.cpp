@@ -23,3 +23,49 @@ TEST_CASE("double_t") {
         }
     );
 }
+
+TEST_CASE("TransformBatch") {
+    ErrorInfoHandle *                                   pErrorInfo(nullptr);
+    MinMaxScalerFeaturizer_double_EstimatorHandle *     pEstimatorHandle(nullptr);
+
+    REQUIRE(MinMaxScalerFeaturizer_double_CreateEstimator(&pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    std::vector<std::double_t> const                    trainingInputs{-1.0, -0.5, 0.0, 1.0};
+    FitResult                                           fitResult(0);
+
+    REQUIRE(MinMaxScalerFeaturizer_double_FitBuffer(pEstimatorHandle, trainingInputs.data(), trainingInputs.size(), &fitResult, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(MinMaxScalerFeaturizer_double_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    MinMaxScalerFeaturizer_double_TransformerHandle *   pTransformerHandle(nullptr);
+
+    REQUIRE(MinMaxScalerFeaturizer_double_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(MinMaxScalerFeaturizer_double_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    std::vector<std::double_t> const                    inputs{-1.0, 0.0, 1.0, 2.0};
+    std::vector<std::double_t>                          outputs(inputs.size());
+
+    REQUIRE(MinMaxScalerFeaturizer_double_TransformBatch(pTransformerHandle, inputs.data(), inputs.size(), outputs.data(), &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CHECK(outputs == std::vector<std::double_t>{0.0, 0.5, 1.0, 1.5});
+
+    // The results match those produced by Transform
+    for(size_t index = 0; index < inputs.size(); ++index) {
+        std::double_t                                   output(0.0);
+
+        REQUIRE(MinMaxScalerFeaturizer_double_Transform(pTransformerHandle, inputs[index], &output, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        CHECK(output == outputs[index]);
+    }
+
+    REQUIRE(MinMaxScalerFeaturizer_double_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
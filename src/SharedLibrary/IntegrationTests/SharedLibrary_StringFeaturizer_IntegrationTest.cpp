@@ -161,3 +161,108 @@ TEST_CASE("float as empty string") {
         true
     );
 }
+
+TEST_CASE("TransformBatch") {
+    ErrorInfoHandle *                       pErrorInfo(nullptr);
+    StringFeaturizer_int8_EstimatorHandle * pEstimatorHandle(nullptr);
+
+    REQUIRE(StringFeaturizer_int8_CreateEstimator(false, &pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(StringFeaturizer_int8_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    StringFeaturizer_int8_TransformerHandle *   pTransformerHandle(nullptr);
+
+    REQUIRE(StringFeaturizer_int8_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(StringFeaturizer_int8_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    std::vector<std::int8_t> const         inputs{1, 2, -3, 4};
+    std::vector<char const *>               outputPtrs(inputs.size());
+    std::vector<std::size_t>                outputItems(inputs.size());
+
+    REQUIRE(StringFeaturizer_int8_TransformBatch(pTransformerHandle, inputs.data(), inputs.size(), outputPtrs.data(), outputItems.data(), &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    std::vector<std::string>                results;
+
+    for(size_t index = 0; index < inputs.size(); ++index) {
+        results.emplace_back(outputPtrs[index], outputItems[index]);
+
+        REQUIRE(StringFeaturizer_int8_DestroyTransformedData(outputPtrs[index], outputItems[index], &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+    }
+
+    CHECK(results == std::vector<std::string>{"1", "2", "-3", "4"});
+
+    // Invalid arguments
+    CHECK(StringFeaturizer_int8_TransformBatch(pTransformerHandle, inputs.data(), 0, outputPtrs.data(), outputItems.data(), &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    CHECK(StringFeaturizer_int8_TransformBatch(pTransformerHandle, inputs.data(), inputs.size(), nullptr, outputItems.data(), &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    REQUIRE(StringFeaturizer_int8_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
+
+TEST_CASE("TransformIntoBuffer") {
+    ErrorInfoHandle *                       pErrorInfo(nullptr);
+    StringFeaturizer_int8_EstimatorHandle * pEstimatorHandle(nullptr);
+
+    REQUIRE(StringFeaturizer_int8_CreateEstimator(false, &pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(StringFeaturizer_int8_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    StringFeaturizer_int8_TransformerHandle *   pTransformerHandle(nullptr);
+
+    REQUIRE(StringFeaturizer_int8_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(StringFeaturizer_int8_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Query the size
+    std::size_t                             items(0);
+
+    REQUIRE(StringFeaturizer_int8_TransformIntoBuffer(pTransformerHandle, -123, nullptr, 0, &items, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(items == 4);
+
+    // Buffer is too small
+    char                                    buffer[8] = {'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x'};
+
+    REQUIRE(StringFeaturizer_int8_TransformIntoBuffer(pTransformerHandle, -123, buffer, 3, &items, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(items == 4);
+    CHECK(std::string(buffer, sizeof(buffer)) == "xxxxxxxx");
+
+    // Buffer is large enough
+    REQUIRE(StringFeaturizer_int8_TransformIntoBuffer(pTransformerHandle, -123, buffer, sizeof(buffer), &items, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(items == 4);
+    CHECK(std::string(buffer, sizeof(buffer)) == "-123xxxx");
+
+    // Invalid arguments
+    CHECK(StringFeaturizer_int8_TransformIntoBuffer(pTransformerHandle, -123, nullptr, sizeof(buffer), &items, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    CHECK(StringFeaturizer_int8_TransformIntoBuffer(pTransformerHandle, -123, buffer, sizeof(buffer), nullptr, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    REQUIRE(StringFeaturizer_int8_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
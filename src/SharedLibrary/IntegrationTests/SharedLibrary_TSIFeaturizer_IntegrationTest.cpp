@@ -11,6 +11,8 @@
 #include "../../Traits.h"
 
 #include <chrono>
+#include <cstdio>
+#include <cstring>
 
 namespace NS = Microsoft::Featurizer;
 using system_clock                          = std::chrono::system_clock;
@@ -217,6 +219,69 @@ TEST_CASE("End-to-end-Median") {
     REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_DestroyTransformedData(pTransformResults, cNumResults, &pErrorInfo));
     REQUIRE(pErrorInfo == nullptr);
 
+    // Transform into a buffer; the first call doesn't provide any memory, so the results
+    // are retained until they are retrieved.
+    size_t                                  cRequiredBuffer(0);
+    size_t                                  cRequiredData(0);
+
+    REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_TransformIntoBuffer(transformerHandle, bad3, nullptr, 0, nullptr, 0, &cRequiredBuffer, &cRequiredData, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    REQUIRE(cRequiredBuffer != 0);
+    REQUIRE(cRequiredData == 1);
+
+    // Data can't be transformed while results are pending
+    CHECK(TimeSeriesImputerFeaturizer_BinaryArchive_TransformIntoBuffer(transformerHandle, bad3, nullptr, 0, nullptr, 0, &cRequiredBuffer, &cRequiredData, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    std::vector<unsigned char>              buffer(cRequiredBuffer);
+    std::vector<BinaryArchiveData>          bufferData(cRequiredData);
+    BinaryArchiveData                       emptyData;
+
+    emptyData.pBuffer = nullptr;
+    emptyData.cBuffer = 0;
+
+    REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_TransformIntoBuffer(transformerHandle, emptyData, buffer.data(), buffer.size(), bufferData.data(), bufferData.size(), &cRequiredBuffer, &cRequiredData, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    REQUIRE(cRequiredBuffer == buffer.size());
+    REQUIRE(cRequiredData == 1);
+    REQUIRE(bufferData[0].pBuffer == buffer.data());
+    REQUIRE(bufferData[0].cBuffer == buffer.size());
+
+    {
+        NS::Archive                         archive(bufferData[0].pBuffer, bufferData[0].cBuffer);
+
+        bool const                                                          rowAdded(NS::Traits<bool>::deserialize(archive));
+        system_clock::time_point const                                      timePoint(NS::Traits<system_clock::time_point>::deserialize(archive));
+        std::string const                                                   key1(NS::Traits<std::string>::deserialize(archive));
+        std::string const                                                   key2(NS::Traits<std::string>::deserialize(archive));
+        typename NS::Traits<int32_t>::nullable_type const                   data1(NS::Traits<typename NS::Traits<int32_t>::nullable_type>::deserialize(archive));
+        typename NS::Traits<float_t>::nullable_type const                   data2(NS::Traits<typename NS::Traits<float_t>::nullable_type>::deserialize(archive));
+
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wfloat-equal"
+#endif
+
+        REQUIRE(rowAdded == false);
+        REQUIRE(timePoint == originalTimePoint);
+        REQUIRE(key1 == "Hello");
+        REQUIRE(key2 == "World");
+        REQUIRE(NS::Traits<decltype(data1)>::GetNullableValue(data1) == 18);
+        REQUIRE(NS::Traits<decltype(data2)>::GetNullableValue(data2) == 3.0f);
+
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#endif
+    }
+
+    // Nothing is pending
+    REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_TransformIntoBuffer(transformerHandle, emptyData, nullptr, 0, nullptr, 0, &cRequiredBuffer, &cRequiredData, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    REQUIRE(cRequiredBuffer == 0);
+    REQUIRE(cRequiredData == 0);
+
     // Create serialized data
     unsigned char const *                   pSavedData(nullptr);
     size_t                                  cSavedData(0);
@@ -226,6 +291,29 @@ TEST_CASE("End-to-end-Median") {
     REQUIRE(pSavedData != nullptr);
     REQUIRE(cSavedData != 0);
 
+    // Save to and restore from a file
+    char const * const                      filename("SharedLibrary_TSIFeaturizer_IntegrationTest.bin");
+    TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle *           fileTransformerHandle(nullptr);
+
+    REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_CreateTransformerSaveDataFile(transformerHandle, filename, ArchiveLayoutValue::StandardLayout, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_CreateTransformerFromSavedDataFile(filename, &fileTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    REQUIRE(fileTransformerHandle != nullptr);
+
+    REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_DestroyTransformer(fileTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    std::remove(filename);
+
+    // Clone the transformer; the clone doesn't have any of the rows seen by the transformer
+    TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle *           cloneTransformerHandle(nullptr);
+
+    REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_CloneTransformer(transformerHandle, &cloneTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    REQUIRE(cloneTransformerHandle != nullptr);
+
     // Destroy the transformer
     REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_DestroyTransformer(transformerHandle, &pErrorInfo));
     REQUIRE(pErrorInfo == nullptr);
@@ -291,13 +379,29 @@ TEST_CASE("End-to-end-Median") {
 #endif
     }
 
+    // The clone produces the same results as the transformer created from the serialized data
+    BinaryArchiveData *                     pCloneResults(nullptr);
+    size_t                                  cNumCloneResults(0);
+
+    REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_Transform(cloneTransformerHandle, bad1, &pCloneResults, &cNumCloneResults, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    REQUIRE(cNumCloneResults == 1);
+    REQUIRE(pCloneResults->cBuffer == pTransformResults->cBuffer);
+    REQUIRE(std::memcmp(pCloneResults->pBuffer, pTransformResults->pBuffer, pTransformResults->cBuffer) == 0);
+
+    REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_DestroyTransformedData(pCloneResults, cNumCloneResults, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
     // Destroy the data
     REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_DestroyTransformedData(pTransformResults, cNumResults, &pErrorInfo));
     REQUIRE(pErrorInfo == nullptr);
 
-    // Destroy the transformer
+    // Destroy the transformers
     REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_DestroyTransformer(otherTransformerHandle, &pErrorInfo));
     REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(TimeSeriesImputerFeaturizer_BinaryArchive_DestroyTransformer(cloneTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
 }
 
 TEST_CASE("End-to-end-Forward") {
@@ -42,3 +42,93 @@ TEST_CASE("standard") {
     );
 }
 
+
+TEST_CASE("TransformIntoBuffer") {
+    ErrorInfoHandle *                                   pErrorInfo(nullptr);
+    TfidfVectorizerFeaturizer_EstimatorHandle *         pEstimatorHandle(nullptr);
+    std::uint32_t const                                 topKTerms(3);
+
+    REQUIRE(
+        TfidfVectorizerFeaturizer_CreateEstimator(
+            true,
+            static_cast<std::uint8_t>(TfidfVectorizerFeaturizer_AnalyzerMethod_Word),
+            "",
+            static_cast<std::uint8_t>(TfidfVectorizerFeaturizer_NormMethod_L2),
+            static_cast<std::uint32_t>(TfidfVectorizerFeaturizer_TfidfPolicy_UseIdf | TfidfVectorizerFeaturizer_TfidfPolicy_SmoothIdf),
+            0.0f,
+            1.0f,
+            &topKTerms,
+            static_cast<std::uint32_t>(1),
+            static_cast<std::uint32_t>(2),
+            &pEstimatorHandle,
+            &pErrorInfo
+        )
+    );
+    REQUIRE(pErrorInfo == nullptr);
+
+    while(true) {
+        TrainingState                                   trainingState(0);
+
+        REQUIRE(TfidfVectorizerFeaturizer_GetState(pEstimatorHandle, &trainingState, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        if(trainingState != Training)
+            break;
+
+        FitResult                                       result(0);
+
+        REQUIRE(TfidfVectorizerFeaturizer_Fit(pEstimatorHandle, "jumpy fox", &result, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        REQUIRE(TfidfVectorizerFeaturizer_OnDataCompleted(pEstimatorHandle, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+    }
+
+    REQUIRE(TfidfVectorizerFeaturizer_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    TfidfVectorizerFeaturizer_TransformerHandle *       pTransformerHandle(nullptr);
+
+    REQUIRE(TfidfVectorizerFeaturizer_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(TfidfVectorizerFeaturizer_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Query the size
+    std::uint64_t                                       numElements(0);
+    std::uint64_t                                       numValues(0);
+
+    REQUIRE(TfidfVectorizerFeaturizer_TransformIntoBuffer(pTransformerHandle, "jumpy fox", nullptr, nullptr, 0, &numElements, &numValues, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    CHECK(numElements == 3);
+    REQUIRE(numValues == 3);
+
+    // Fill the buffer (which is reused for subsequent calls)
+    std::vector<std::float_t>                           values(static_cast<size_t>(numValues));
+    std::vector<std::uint64_t>                          indexes(static_cast<size_t>(numValues));
+
+    for(int iteration = 0; iteration < 2; ++iteration) {
+        numElements = 0;
+        numValues = 0;
+
+        REQUIRE(TfidfVectorizerFeaturizer_TransformIntoBuffer(pTransformerHandle, "jumpy fox", values.data(), indexes.data(), values.size(), &numElements, &numValues, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+        CHECK(numElements == 3);
+        REQUIRE(numValues == 3);
+
+        for(std::uint64_t index = 0; index < numValues; ++index) {
+            CHECK(Approx(values[static_cast<size_t>(index)]) == 0.57735f);
+            CHECK(indexes[static_cast<size_t>(index)] == index);
+        }
+    }
+
+    // Invalid arguments
+    CHECK(TfidfVectorizerFeaturizer_TransformIntoBuffer(pTransformerHandle, "jumpy fox", nullptr, indexes.data(), values.size(), &numElements, &numValues, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    DestroyErrorInfo(pErrorInfo);
+    pErrorInfo = nullptr;
+
+    REQUIRE(TfidfVectorizerFeaturizer_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
@@ -4,20 +4,44 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <atomic>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <random>
 #include <stdexcept>
-#include <unordered_map>
+#include <vector>
 
 #include <assert.h>
 
 namespace Microsoft{
 namespace Featurizer{
 
+namespace Details {
+
+// Returns the number of bits required to represent the value
+constexpr size_t NumPointerTableBits(size_t value) {
+    return value == 0 ? 0 : 1 + NumPointerTableBits(value >> 1);
+}
+
+} // namespace Details
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         PointerTable
 ///  \brief         Provide an interface to store pointers in exchange of
-///                 an index to avoid exposing pointers to users
+///                 an index to avoid exposing pointers to users.
+///
+///                 Pointers are stored in a slot array; the index encodes
+///                 the slot and a generation that is incremented every time
+///                 the slot is reused, so stale indexes are detected. `Get`
+///                 is lock-free, while `Add` and `Remove` are serialized.
+///
+///                 The slot uses as few bits of the index as possible and the
+///                 generation uses the rest. On 64-bit platforms, this leaves 43
+///                 generation bits. On 32-bit platforms, the table is limited to
+///                 16128 pointers, which leaves 18 generation bits. A stale index
+///                 is then only mistaken for a valid one if its slot has been
+///                 reused exactly a multiple of 2^17 times since it was removed.
 ///
 class PointerTable {
 public:
@@ -28,6 +52,9 @@ public:
     // ----------------------------------------------------------------------
     PointerTable(unsigned int seed=(std::random_device())());
 
+    PointerTable(PointerTable const &) = delete;
+    PointerTable & operator =(PointerTable const &) = delete;
+
     template<typename T>
     size_t Add(const T* const toBeAdded);
 
@@ -44,14 +71,63 @@ private:
     // ----------------------------------------------------------------------
     using LockGuard                         = std::lock_guard<std::mutex>;
 
+    struct Slot {
+        // The generation is odd while the slot is in use and even while it is free;
+        // it is truncated to the number of bits available within an index.
+        std::atomic<size_t>                 Generation;
+        std::atomic<void const *>           Pointer;
+
+        Slot(void) : Generation(0), Pointer(nullptr) {}
+    };
+
+    using SlotBlockPtr                      = std::unique_ptr<Slot []>;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    std::unordered_map<std::size_t, const void *>       m_un;
-    std::mutex                                          m_un_mutex;
-    std::mt19937                                        m_mt;
+
+    static constexpr size_t const           SlotsPerBlock = 256;
+    static constexpr size_t const           MaxNumBlocks = (sizeof(size_t) == 8 ? 4096 : 63);
+
+    // The low bits of an index contain the slot number (+1, so that an index is
+    // never zero) and the high bits contain the generation of the slot.
+    static constexpr size_t const           SlotBits = Details::NumPointerTableBits(MaxNumBlocks * SlotsPerBlock);
+    static constexpr size_t const           SlotMask = (static_cast<size_t>(1) << SlotBits) - 1;
+    static constexpr size_t const           GenerationMask = std::numeric_limits<size_t>::max() >> SlotBits;
+
+    static_assert(sizeof(size_t) * 8 - SlotBits >= 18, "Too few bits remain for the generation to detect stale indexes");
+
+    // Blocks are never freed or moved once allocated, which allows readers to access
+    // them without locking.
+    std::atomic<Slot *>                     _blocks[MaxNumBlocks];
+
+    // Randomizes the generation portion of an index so that indexes aren't predictable
+    size_t const                            _generationSalt;
+
+    // The following members are only accessed while holding the mutex
+    std::mutex                              _mutex;
+    std::vector<SlotBlockPtr>               _ownedBlocks;
+    std::vector<size_t>                     _freeSlots;
+    size_t                                  _numSlots;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    static size_t CreateGenerationSalt(unsigned int seed);
+
+    size_t CreateIndex(size_t slot, size_t generation) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Lookup
+    ///  \brief         Returns the slot associated with the index and the
+    ///                 generation that it must have to be valid, or nullptr
+    ///                 if the index doesn't correspond to an allocated slot.
+    ///
+    Slot * Lookup(size_t index, size_t &generation) const;
 };
 
 
@@ -64,8 +140,12 @@ private:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-inline PointerTable::PointerTable(unsigned int seed) : m_mt(seed) {
+inline PointerTable::PointerTable(unsigned int seed) :
+    _generationSalt(CreateGenerationSalt(seed)),
+    _numSlots(0) {
 
+    for(auto &block : _blocks)
+        block.store(nullptr, std::memory_order_relaxed);
 }
 
 
@@ -77,40 +157,48 @@ size_t PointerTable::Add(const T * const templatePointer) {
 
 
     void const * const                      toBeAdded(reinterpret_cast<const void* const>(templatePointer));
-    size_t                                  empty_index(0);
 
-    {
-        LockGuard const                     lock(m_un_mutex);
+    LockGuard const                         lock(_mutex);
 
-        std::ignore = lock;
+    std::ignore = lock;
 
-        // since we are controlling where and how to use PointerTable and Add function
-        // it wouldn't worth the cost to have two maps with atomic insertions
-        // check for duplicates at run time
-        // comparing to the chance of adding the same pointer twice,
-        // so we would only check for duplicates in debug mode
+    // since we are controlling where and how to use PointerTable and Add function
+    // it wouldn't worth the cost to check for duplicates at run time
+    // comparing to the chance of adding the same pointer twice,
+    // so we would only check for duplicates in debug mode
 #if (defined DEBUG)
-            for (auto pairs : m_un) {
-                assert(pairs.second != toBeAdded);
-            }
+    for(size_t slotIndex = 0; slotIndex < _numSlots; ++slotIndex) {
+        assert(_ownedBlocks[slotIndex / SlotsPerBlock][slotIndex % SlotsPerBlock].Pointer.load(std::memory_order_relaxed) != toBeAdded);
+    }
 #endif
 
-        // size would be changing throughout the process
-        // index zero is reserved
-        std::uniform_int_distribution<size_t>           dist(1,std::numeric_limits<std::size_t>::max());
+    size_t                                  slotIndex;
+
+    if(_freeSlots.empty() == false) {
+        slotIndex = _freeSlots.back();
+        _freeSlots.pop_back();
+    }
+    else {
+        if(_numSlots == _ownedBlocks.size() * SlotsPerBlock) {
+            if(_ownedBlocks.size() == MaxNumBlocks)
+                throw std::runtime_error("The Pointer table is full!");
 
-        while(true) {
-            size_t rand_index = dist(m_mt);
-            if (m_un.find(rand_index) == m_un.end()) {
-                empty_index = rand_index;
-                break;
-            }
+            _ownedBlocks.emplace_back(new Slot[SlotsPerBlock]);
+            _blocks[_ownedBlocks.size() - 1].store(_ownedBlocks.back().get(), std::memory_order_release);
         }
-        assert(empty_index != 0);
-        m_un[empty_index] = toBeAdded;
+
+        slotIndex = _numSlots++;
     }
 
-    return empty_index;
+    Slot &                                  slot(_ownedBlocks[slotIndex / SlotsPerBlock][slotIndex % SlotsPerBlock]);
+    size_t const                            generation((slot.Generation.load(std::memory_order_relaxed) + 1) & GenerationMask);
+
+    assert(generation & 1);
+
+    slot.Pointer.store(toBeAdded, std::memory_order_relaxed);
+    slot.Generation.store(generation, std::memory_order_release);
+
+    return CreateIndex(slotIndex, generation);
 }
 
 template<typename T>
@@ -120,16 +208,20 @@ T* PointerTable::Get(size_t index) {
         throw std::invalid_argument("Invalid query to the Pointer table, index cannot be zero!");
     }
 
-    LockGuard const                         lock(m_un_mutex);
+    size_t                                  generation;
+    Slot *                                  pSlot(Lookup(index, generation));
 
-    std::ignore = lock;
+    if(pSlot != nullptr && pSlot->Generation.load(std::memory_order_acquire) == generation) {
+        void const * const                  ptr(pSlot->Pointer.load(std::memory_order_relaxed));
+
+        // Ensure that the slot wasn't removed while the pointer was being read
+        std::atomic_thread_fence(std::memory_order_acquire);
 
-    std::unordered_map<std::size_t, const void*>::const_iterator found = m_un.find(index);
-    if (found == m_un.end()) {
-        throw std::invalid_argument("Invalid query to the Pointer table, index incorrect!");
+        if(ptr != nullptr && pSlot->Generation.load(std::memory_order_relaxed) == generation)
+            return reinterpret_cast<T*>(const_cast<void*>(ptr));
     }
 
-    return reinterpret_cast<T*>(const_cast<void*>(found->second));
+    throw std::invalid_argument("Invalid query to the Pointer table, index incorrect!");
 }
 
 
@@ -139,16 +231,50 @@ inline void PointerTable::Remove(size_t index) {
         throw std::invalid_argument("Invalid remove from the Pointer table, index cannot be zero!");
     }
 
-    LockGuard const                         lock(m_un_mutex);
+    LockGuard const                         lock(_mutex);
 
     std::ignore = lock;
 
-    std::unordered_map<std::size_t, const void*>::const_iterator found = m_un.find(index);
-    if (found == m_un.end()) {
+    size_t                                  generation;
+    Slot *                                  pSlot(Lookup(index, generation));
+
+    if(pSlot == nullptr || pSlot->Generation.load(std::memory_order_relaxed) != generation) {
         throw std::invalid_argument("Invalid remove from the Pointer table, index pointer not found!");
     }
 
-    m_un.erase(found);
+    // Invalidate the index before clearing the pointer so that concurrent readers
+    // never see a cleared pointer with a valid generation.
+    pSlot->Generation.store((generation + 1) & GenerationMask, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    pSlot->Pointer.store(nullptr, std::memory_order_relaxed);
+
+    _freeSlots.push_back((index & SlotMask) - 1);
+}
+
+/*static*/ inline size_t PointerTable::CreateGenerationSalt(unsigned int seed) {
+    std::mt19937                            mt(seed);
+
+    return std::uniform_int_distribution<size_t>(0, GenerationMask)(mt);
+}
+
+inline size_t PointerTable::CreateIndex(size_t slot, size_t generation) const {
+    return (((generation ^ _generationSalt) << SlotBits) | (slot + 1));
+}
+
+inline PointerTable::Slot * PointerTable::Lookup(size_t index, size_t &generation) const {
+    size_t const                            slotIndex((index & SlotMask) - 1);
+
+    generation = (index >> SlotBits) ^ _generationSalt;
+
+    if(slotIndex >= MaxNumBlocks * SlotsPerBlock || (generation & 1) == 0)
+        return nullptr;
+
+    Slot * const                            pBlock(_blocks[slotIndex / SlotsPerBlock].load(std::memory_order_acquire));
+
+    if(pBlock == nullptr)
+        return nullptr;
+
+    return pBlock + slotIndex % SlotsPerBlock;
 }
 
 } // namespace Featurizer
@@ -0,0 +1,438 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "GeneratedCode/SharedLibrary_Common.h"
+
+#include "Traits.h"
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Microsoft {
+namespace Featurizer {
+
+/////////////////////////////////////////////////////////////////////////
+///  \namespace     Arrow
+///  \brief         Functionality to import and export columns described by
+///                 the Arrow C Data Interface
+///                 (https://arrow.apache.org/docs/format/CDataInterface.html).
+///
+///                 Imported arrays are borrowed: they are never released and
+///                 their buffers are used directly whenever the layout matches
+///                 the type expected by the featurizer. Exported arrays own
+///                 their data and must be released by the consumer.
+///
+///                 Null values are mapped to the nullable type associated with
+///                 the featurizer's type (`nonstd::optional<T>`, or NaN for
+///                 floating point values).
+///
+namespace Arrow {
+
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        ArrayData
+///  \brief         Data owned by an exported `ArrowArray`.
+///
+struct ArrayData {
+    std::vector<unsigned char>              Validity;
+    std::vector<unsigned char>              Values;
+    std::vector<std::int64_t>               Offsets;
+
+    std::size_t                             NumItems;
+    std::size_t                             NumNulls;
+
+    void const *                            Buffers[3];
+
+    ArrayData(std::size_t numItems) :
+        Offsets(1, 0),
+        NumItems(0),
+        NumNulls(0),
+        Buffers{nullptr, nullptr, nullptr} {
+        Validity.reserve((numItems + 7) / 8);
+    }
+};
+
+inline bool IsBitSet(void const *pBuffer, std::size_t bit) {
+    return (static_cast<unsigned char const *>(pBuffer)[bit / 8] & (1 << (bit % 8))) != 0;
+}
+
+inline void AppendBit(std::vector<unsigned char> &buffer, std::size_t bit, bool value) {
+    if(bit % 8 == 0)
+        buffer.push_back(0);
+
+    if(value)
+        buffer.back() = static_cast<unsigned char>(buffer.back() | (1 << (bit % 8)));
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        ValueTraits
+///  \brief         Maps a featurizer type to the corresponding Arrow layout.
+///
+///                 Specializations implement:
+///
+///                     static bool IsFormat(char const *format);
+///                     static char const * GetFormat(void);
+///                     static std::int64_t GetNumBuffers(void);
+///
+///                     // Returns the values when they can be used without conversion,
+///                     // or nullptr if they must be converted one at a time.
+///                     static T const * GetContiguousValues(ArrowArray const &array);
+///                     static T GetValue(ArrowSchema const &schema, ArrowArray const &array, std::size_t index);
+///                     static T CreateNullValue(void);
+///
+///                     static bool IsNull(T const &value);
+///                     static void Append(ArrayData &data, T const &value);
+///                     static void AppendNull(ArrayData &data);
+///                     static void Finalize(ArrayData &data);
+///
+template <typename T, bool IsFloatingPointV=std::is_floating_point<T>::value>
+struct ValueTraits;
+
+template <typename T>
+struct ArithmeticValueTraits {
+    static std::int64_t GetNumBuffers(void) { return 2; }
+
+    static T const * GetContiguousValues(ArrowArray const &array) {
+        return static_cast<T const *>(array.buffers[1]) + array.offset;
+    }
+
+    static T GetValue(ArrowSchema const &, ArrowArray const &array, std::size_t index) {
+        return GetContiguousValues(array)[index];
+    }
+
+    static void Append(ArrayData &data, T const &value) {
+        std::size_t const                   offset(data.Values.size());
+
+        data.Values.resize(offset + sizeof(T));
+        std::memcpy(data.Values.data() + offset, &value, sizeof(T));
+    }
+
+    static void Finalize(ArrayData &data) {
+        data.Buffers[1] = data.Values.data();
+    }
+};
+
+#define FEATURIZER_ARROW_INTEGER_VALUE_TRAITS(Type, Format)                                                                 \
+    template <>                                                                                                             \
+    struct ValueTraits<Type, false> : public ArithmeticValueTraits<Type> {                                                  \
+        static bool IsFormat(char const *format) { return std::strcmp(format, Format) == 0; }                               \
+        static char const * GetFormat(void) { return Format; }                                                              \
+                                                                                                                            \
+        static Type CreateNullValue(void) { throw std::invalid_argument("The array contains null values"); }                \
+        static bool IsNull(Type const &) { return false; }                                                                  \
+        static void AppendNull(ArrayData &) { throw std::invalid_argument("Null values are not supported"); }               \
+    }
+
+FEATURIZER_ARROW_INTEGER_VALUE_TRAITS(std::int8_t, "c");
+FEATURIZER_ARROW_INTEGER_VALUE_TRAITS(std::int16_t, "s");
+FEATURIZER_ARROW_INTEGER_VALUE_TRAITS(std::int32_t, "i");
+FEATURIZER_ARROW_INTEGER_VALUE_TRAITS(std::int64_t, "l");
+FEATURIZER_ARROW_INTEGER_VALUE_TRAITS(std::uint8_t, "C");
+FEATURIZER_ARROW_INTEGER_VALUE_TRAITS(std::uint16_t, "S");
+FEATURIZER_ARROW_INTEGER_VALUE_TRAITS(std::uint32_t, "I");
+FEATURIZER_ARROW_INTEGER_VALUE_TRAITS(std::uint64_t, "L");
+
+#undef FEATURIZER_ARROW_INTEGER_VALUE_TRAITS
+
+template <typename T>
+struct ValueTraits<T, true> : public ArithmeticValueTraits<T> {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unexpected floating point type");
+
+    static bool IsFormat(char const *format) { return std::strcmp(format, GetFormat()) == 0; }
+    static char const * GetFormat(void) { return sizeof(T) == 4 ? "f" : "g"; }
+
+    // NaN is the null value for floating point types
+    static T CreateNullValue(void) { return Traits<T>::CreateNullValue(); }
+    static bool IsNull(T const &value) { return Traits<T>::IsNull(value); }
+    static void AppendNull(ArrayData &data) { ArithmeticValueTraits<T>::Append(data, CreateNullValue()); }
+};
+
+template <>
+struct ValueTraits<bool, false> {
+    static bool IsFormat(char const *format) { return std::strcmp(format, "b") == 0; }
+    static char const * GetFormat(void) { return "b"; }
+    static std::int64_t GetNumBuffers(void) { return 2; }
+
+    // Arrow booleans are stored as bits, so they are always converted
+    static bool const * GetContiguousValues(ArrowArray const &) { return nullptr; }
+
+    static bool GetValue(ArrowSchema const &, ArrowArray const &array, std::size_t index) {
+        return IsBitSet(array.buffers[1], static_cast<std::size_t>(array.offset) + index);
+    }
+
+    static bool CreateNullValue(void) { throw std::invalid_argument("The array contains null values"); }
+
+    static bool IsNull(bool const &) { return false; }
+
+    static void Append(ArrayData &data, bool const &value) {
+        AppendBit(data.Values, data.NumItems, value);
+    }
+
+    static void AppendNull(ArrayData &data) {
+        AppendBit(data.Values, data.NumItems, false);
+    }
+
+    static void Finalize(ArrayData &data) {
+        data.Buffers[1] = data.Values.data();
+    }
+};
+
+template <>
+struct ValueTraits<std::string, false> {
+    // Both utf8 (32-bit offsets) and large utf8 (64-bit offsets) arrays are
+    // supported as input; large utf8 arrays are exported.
+    static bool IsFormat(char const *format) { return std::strcmp(format, "u") == 0 || std::strcmp(format, "U") == 0; }
+    static char const * GetFormat(void) { return "U"; }
+    static std::int64_t GetNumBuffers(void) { return 3; }
+
+    static std::string const * GetContiguousValues(ArrowArray const &) { return nullptr; }
+
+    static std::string GetValue(ArrowSchema const &schema, ArrowArray const &array, std::size_t index) {
+        std::size_t const                   offsetIndex(static_cast<std::size_t>(array.offset) + index);
+        std::int64_t                        begin;
+        std::int64_t                        end;
+
+        if(schema.format[0] == 'u') {
+            std::int32_t const * const      pOffsets(static_cast<std::int32_t const *>(array.buffers[1]));
+
+            begin = pOffsets[offsetIndex];
+            end = pOffsets[offsetIndex + 1];
+        }
+        else {
+            std::int64_t const * const      pOffsets(static_cast<std::int64_t const *>(array.buffers[1]));
+
+            begin = pOffsets[offsetIndex];
+            end = pOffsets[offsetIndex + 1];
+        }
+
+        if(begin < 0)
+            throw std::invalid_argument("The array's offsets are negative");
+
+        if(end < begin)
+            throw std::invalid_argument("The array's offsets are not sorted");
+
+        return std::string(static_cast<char const *>(array.buffers[2]) + begin, static_cast<std::size_t>(end - begin));
+    }
+
+    static std::string CreateNullValue(void) { throw std::invalid_argument("The array contains null values"); }
+
+    static bool IsNull(std::string const &) { return false; }
+
+    static void Append(ArrayData &data, std::string const &value) {
+        data.Values.insert(data.Values.end(), value.begin(), value.end());
+        data.Offsets.push_back(static_cast<std::int64_t>(data.Values.size()));
+    }
+
+    static void AppendNull(ArrayData &data) {
+        data.Offsets.push_back(data.Offsets.back());
+    }
+
+    static void Finalize(ArrayData &data) {
+        // The data buffer must not be null, even when all of the strings are empty
+        if(data.Values.empty())
+            data.Values.reserve(1);
+
+        data.Buffers[1] = data.Offsets.data();
+        data.Buffers[2] = data.Values.data();
+    }
+};
+
+template <typename T>
+struct ValueTraits<nonstd::optional<T>, false> {
+    using Type                              = nonstd::optional<T>;
+    using ValueTraitsType                   = ValueTraits<T>;
+
+    static bool IsFormat(char const *format) { return ValueTraitsType::IsFormat(format); }
+    static char const * GetFormat(void) { return ValueTraitsType::GetFormat(); }
+    static std::int64_t GetNumBuffers(void) { return ValueTraitsType::GetNumBuffers(); }
+
+    static Type const * GetContiguousValues(ArrowArray const &) { return nullptr; }
+
+    static Type GetValue(ArrowSchema const &schema, ArrowArray const &array, std::size_t index) {
+        return ValueTraitsType::GetValue(schema, array, index);
+    }
+
+    static Type CreateNullValue(void) { return Type(); }
+
+    static bool IsNull(Type const &value) { return !value; }
+
+    static void Append(ArrayData &data, Type const &value) {
+        ValueTraitsType::Append(data, *value);
+    }
+
+    static void AppendNull(ArrayData &data) {
+        ValueTraitsType::AppendNull(data);
+    }
+
+    static void Finalize(ArrayData &data) {
+        ValueTraitsType::Finalize(data);
+    }
+};
+
+inline void ReleaseSchema(ArrowSchema *pSchema) {
+    pSchema->release = nullptr;
+}
+
+inline void ReleaseArray(ArrowArray *pArray) {
+    delete static_cast<ArrayData *>(pArray->private_data);
+
+    pArray->private_data = nullptr;
+    pArray->release = nullptr;
+}
+
+} // namespace Details
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            GetValues
+///  \brief         Returns a pointer to the array's values and the number of
+///                 values. The array's buffers are returned directly when
+///                 possible; otherwise, the values are converted into `buffer`.
+///
+template <typename T>
+std::pair<T const *, std::size_t> GetValues(ArrowSchema const &schema, ArrowArray const &array, std::unique_ptr<T []> &buffer) {
+    using ValueTraits                       = Details::ValueTraits<T>;
+
+    if(schema.release == nullptr) throw std::invalid_argument("The schema has been released");
+    if(schema.format == nullptr) throw std::invalid_argument("The schema's format is null");
+    if(ValueTraits::IsFormat(schema.format) == false) throw std::invalid_argument("The schema's format is not supported");
+    if(schema.n_children != 0 || schema.dictionary != nullptr) throw std::invalid_argument("Nested and dictionary-encoded arrays are not supported");
+
+    if(array.release == nullptr) throw std::invalid_argument("The array has been released");
+    if(array.length <= 0) throw std::invalid_argument("The array is empty");
+    if(array.offset < 0) throw std::invalid_argument("The array's offset is invalid");
+    if(array.n_buffers != ValueTraits::GetNumBuffers() || array.buffers == nullptr) throw std::invalid_argument("The array's buffers are invalid");
+
+    for(std::int64_t index = 1; index < array.n_buffers; ++index) {
+        if(array.buffers[index] == nullptr)
+            throw std::invalid_argument("The array's buffers are invalid");
+    }
+
+    std::size_t const                       length(static_cast<std::size_t>(array.length));
+
+    // The validity bitmap may be omitted when there aren't any nulls; a null count
+    // of -1 indicates that the number of nulls hasn't been calculated.
+    bool const                              hasNulls(array.null_count != 0 && array.buffers[0] != nullptr);
+
+    if(hasNulls == false) {
+        T const * const                     pValues(ValueTraits::GetContiguousValues(array));
+
+        if(pValues != nullptr)
+            return std::make_pair(pValues, length);
+    }
+
+    buffer.reset(new T[length]);
+
+    for(std::size_t index = 0; index < length; ++index) {
+        if(hasNulls && Details::IsBitSet(array.buffers[0], static_cast<std::size_t>(array.offset) + index) == false)
+            buffer[index] = ValueTraits::CreateNullValue();
+        else
+            buffer[index] = ValueTraits::GetValue(schema, array, index);
+    }
+
+    return std::make_pair(static_cast<T const *>(buffer.get()), length);
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ArrayBuilder
+///  \brief         Creates an array that is exported via the Arrow C Data
+///                 Interface.
+///
+template <typename T>
+class ArrayBuilder {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    ArrayBuilder(std::size_t numItemsHint) :
+        _pData(new Details::ArrayData(numItemsHint)) {
+    }
+
+    ArrayBuilder(ArrayBuilder const &) = delete;
+    ArrayBuilder & operator =(ArrayBuilder const &) = delete;
+
+    void Append(T const &value) {
+        if(!_pData)
+            throw std::runtime_error("The array has already been released");
+
+        Details::ArrayData &                data(*_pData);
+        bool const                          isNull(ValueTraits::IsNull(value));
+
+        if(isNull) {
+            ValueTraits::AppendNull(data);
+            ++data.NumNulls;
+        }
+        else
+            ValueTraits::Append(data, value);
+
+        Details::AppendBit(data.Validity, data.NumItems, !isNull);
+        ++data.NumItems;
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            Release
+    ///  \brief         Transfers ownership of the data to `array`; the builder
+    ///                 can't be used after this method is called.
+    ///
+    void Release(ArrowSchema &schema, ArrowArray &array) {
+        if(!_pData)
+            throw std::runtime_error("The array has already been released");
+
+        Details::ArrayData &                data(*_pData);
+
+        ValueTraits::Finalize(data);
+
+        if(data.NumNulls != 0)
+            data.Buffers[0] = data.Validity.data();
+
+        schema.format = ValueTraits::GetFormat();
+        schema.name = nullptr;
+        schema.metadata = nullptr;
+        schema.flags = ARROW_FLAG_NULLABLE;
+        schema.n_children = 0;
+        schema.children = nullptr;
+        schema.dictionary = nullptr;
+        schema.release = Details::ReleaseSchema;
+        schema.private_data = nullptr;
+
+        array.length = static_cast<std::int64_t>(data.NumItems);
+        array.null_count = static_cast<std::int64_t>(data.NumNulls);
+        array.offset = 0;
+        array.n_buffers = ValueTraits::GetNumBuffers();
+        array.n_children = 0;
+        array.buffers = data.Buffers;
+        array.children = nullptr;
+        array.dictionary = nullptr;
+        array.release = Details::ReleaseArray;
+        array.private_data = _pData.release();
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using ValueTraits                       = Details::ValueTraits<T>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::unique_ptr<Details::ArrayData>     _pData;
+};
+
+} // namespace Arrow
+} // namespace Featurizer
+} // namespace Microsoft
@@ -13,12 +13,14 @@
 #include "SharedLibrary_PointerTable.h"
 
 #include "Archive.h"
+#include "FileArchive.h"
 #include "TimeSeriesImputerFeaturizer.h"
 
 #include <cstring> // for memcpy
 
 // These method(s) are defined in SharedLibrary_Common.cpp
 ErrorInfoHandle * CreateErrorInfo(std::exception const &ex);
+Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout);
 
 /* ---------------------------------------------------------------------- */
 /* |                                                                      */
@@ -70,6 +72,7 @@ public:
 
     InputTuple Deserialize(unsigned char const *pBuffer, size_t cbBuffer) const;
     std::tuple<BinaryArchiveData *, size_t> Serialize(TransformedTuples const &values) const;
+    void Serialize(TransformedTuples const &values, Bytes &buffer, std::vector<size_t> &sizes) const;
 
     static void DestroySerializedData(BinaryArchiveData const *pData, size_t numDataElements);
 
@@ -93,6 +96,8 @@ private:
 
     void _SaveKeyStrings(Microsoft::Featurizer::Archive &ar, Strings const &strings) const;
     void _SaveDataStrings(Microsoft::Featurizer::Archive &ar, OptionalStrings const &strings) const;
+
+    Microsoft::Featurizer::Archive::ByteArray _SerializeRow(TransformedTuple const &value) const;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -121,12 +126,21 @@ struct TransformerMemory {
     SerializerType                          TransformerSerializer;
     TransformerUniquePtr                    Transformer;
 
+    // Rows produced by `TransformIntoBuffer` that didn't fit within the memory
+    // provided by the caller.
+    SerializerType::Bytes                   PendingBuffer;
+    std::vector<size_t>                     PendingSizes;
+
     TransformerMemory(SerializerType serializer, TransformerUniquePtr pTransformer);
     TransformerMemory(Microsoft::Featurizer::Archive &ar);
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TransformerMemory);
 
     Microsoft::Featurizer::Archive & save(Microsoft::Featurizer::Archive &ar);
+
+    // The clone shares the trained state of the Transformer, but doesn't have any
+    // pending rows.
+    std::unique_ptr<TransformerMemory> clone(void) const;
 };
 
 // ----------------------------------------------------------------------
@@ -436,6 +450,60 @@ FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_CreateTran
     }
 }
 
+FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+        if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+        Microsoft::Featurizer::Archive      archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+        std::unique_ptr<TransformerMemory>  pTransformerMemory(new TransformerMemory(archive));
+        size_t                              index(g_pointerTable.Add(pTransformerMemory.get()));
+
+        *ppTransformerHandle = reinterpret_cast<TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle *>(index);
+
+        // If here, we are ready to commit the results
+        pTransformerMemory.release();
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_CloneTransformer(/*in*/ TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle *pHandle, /*out*/ TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+        TransformerMemory const &           transformerMemory(*g_pointerTable.Get<TransformerMemory>(reinterpret_cast<size_t>(pHandle)));
+        std::unique_ptr<TransformerMemory>  pCloneMemory(transformerMemory.clone());
+        size_t                              index(g_pointerTable.Add(pCloneMemory.get()));
+
+        *ppCloneHandle = reinterpret_cast<TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle *>(index);
+
+        // If here, we are ready to commit the results
+        pCloneMemory.release();
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_DestroyTransformer(/*in*/ TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -460,6 +528,10 @@ FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_DestroyTra
 }
 
 FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_CreateTransformerSaveData(/*in*/ TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    return TimeSeriesImputerFeaturizer_BinaryArchive_CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+}
+
+FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_CreateTransformerSaveDataWithLayout(/*in*/ TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
 
@@ -471,7 +543,7 @@ FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_CreateTran
         if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
         TransformerMemory &                 memory(*g_pointerTable.Get<TransformerMemory>(reinterpret_cast<size_t>(pHandle)));
-        Microsoft::Featurizer::Archive      archive;
+        Microsoft::Featurizer::Archive      archive(0, CreateArchiveLayout(layout));
 
         memory.save(archive);
 
@@ -492,6 +564,34 @@ FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_CreateTran
     }
 }
 
+FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_CreateTransformerSaveDataFile(/*in*/ TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+
+        TransformerMemory &                 memory(*g_pointerTable.Get<TransformerMemory>(reinterpret_cast<size_t>(pHandle)));
+
+        Microsoft::Featurizer::SerializeToFile(
+            filename,
+            [&memory](Microsoft::Featurizer::Archive &archive) {
+                memory.save(archive);
+            },
+            CreateArchiveLayout(layout)
+        );
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 // For ONNX we don't need to serialize the TransformerMemory. This method just serializes the transformer state directly
 FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_CreateONNXSaveData(/*in*/ TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
@@ -579,6 +679,68 @@ FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_Transform(
     }
 }
 
+FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_TransformIntoBuffer(/*in*/ TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle *pHandle, /*in*/ BinaryArchiveData data, /*out*/ unsigned char *pBuffer, /*in*/ std::size_t cBuffer, /*out*/ BinaryArchiveData *pData, /*in*/ std::size_t numDataCapacity, /*out*/ std::size_t *pBufferSize, /*out*/ std::size_t *pNumDataElements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+        if(data.pBuffer == nullptr && data.cBuffer != 0) throw std::invalid_argument("'data' buffer is null");
+        if(data.pBuffer != nullptr && data.cBuffer == 0) throw std::invalid_argument("'data' buffer size is 0");
+        if(pBuffer == nullptr && cBuffer != 0) throw std::invalid_argument("'pBuffer' is null");
+        if(pData == nullptr && numDataCapacity != 0) throw std::invalid_argument("'pData' is null");
+        if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
+        if(pNumDataElements == nullptr) throw std::invalid_argument("'pNumDataElements' is null");
+
+        TransformerMemory &                             memory(*g_pointerTable.Get<TransformerMemory>(reinterpret_cast<size_t>(pHandle)));
+
+        if(data.pBuffer != nullptr) {
+            if(memory.PendingSizes.empty() == false)
+                throw std::runtime_error("Pending transformed data must be retrieved before additional data is transformed");
+
+            TransformedTuples                           results;
+
+            memory.Transformer->execute(
+                memory.TransformerSerializer.Deserialize(data.pBuffer, data.cBuffer),
+                [&results](typename TransformedTuples::value_type value) {
+                    results.emplace_back(std::move(value));
+                }
+            );
+
+            memory.TransformerSerializer.Serialize(results, memory.PendingBuffer, memory.PendingSizes);
+        }
+
+        *pBufferSize = memory.PendingBuffer.size();
+        *pNumDataElements = memory.PendingSizes.size();
+
+        if(memory.PendingBuffer.size() > cBuffer || memory.PendingSizes.size() > numDataCapacity)
+            return true;
+
+        if(memory.PendingBuffer.empty() == false)
+            memcpy(pBuffer, memory.PendingBuffer.data(), memory.PendingBuffer.size());
+
+        for(size_t size : memory.PendingSizes) {
+            pData->pBuffer = pBuffer;
+            pData->cBuffer = size;
+
+            pBuffer += size;
+            ++pData;
+        }
+
+        // Clearing (rather than releasing) the memory allows it to be reused by subsequent calls
+        memory.PendingBuffer.clear();
+        memory.PendingSizes.clear();
+
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool TimeSeriesImputerFeaturizer_BinaryArchive_Flush(/*in*/ TimeSeriesImputerFeaturizer_BinaryArchive_TransformerHandle *pHandle, /*out*/ BinaryArchiveData ** ppData, /*out*/ std::size_t *pNumDataElements, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -738,15 +900,7 @@ std::tuple<BinaryArchiveData *, size_t> Serializer::Serialize(TransformedTuples
     individualBuffers.reserve(values.size());
 
     for(TransformedTuple const & value : values) {
-        Archive                             archive;
-
-        Traits<bool>::serialize(archive, std::get<0>(value));
-        Traits<time_point>::serialize(archive, std::get<1>(value));
-
-        _SaveKeyStrings(archive, std::get<2>(value));
-        _SaveDataStrings(archive, std::get<3>(value));
-
-        Archive::ByteArray                  bytes(archive.commit());
+        Archive::ByteArray                  bytes(_SerializeRow(value));
         ByteArrayUniquePtr                  pBytes(new unsigned char[bytes.size()], Internal::ByteArrayDeleter);
 
         memcpy(pBytes.get(), bytes.data(), bytes.size());
@@ -773,6 +927,20 @@ std::tuple<BinaryArchiveData *, size_t> Serializer::Serialize(TransformedTuples
     return std::make_tuple(pResult, individualBuffers.size());
 }
 
+void Serializer::Serialize(TransformedTuples const &values, Bytes &buffer, std::vector<size_t> &sizes) const {
+    buffer.clear();
+    sizes.clear();
+
+    sizes.reserve(values.size());
+
+    for(TransformedTuple const & value : values) {
+        Microsoft::Featurizer::Archive::ByteArray           bytes(_SerializeRow(value));
+
+        buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+        sizes.push_back(bytes.size());
+    }
+}
+
 // static
 void Serializer::DestroySerializedData(BinaryArchiveData const *pData, size_t numDataElements) {
     if(pData == nullptr && numDataElements != 0) throw std::invalid_argument("Invalid buffer");
@@ -1072,6 +1240,20 @@ void Serializer::_SaveDataStrings(Microsoft::Featurizer::Archive &ar, OptionalSt
     }
 }
 
+Microsoft::Featurizer::Archive::ByteArray Serializer::_SerializeRow(TransformedTuple const &value) const {
+    using namespace Microsoft::Featurizer;
+
+    Archive                                 archive;
+
+    Traits<bool>::serialize(archive, std::get<0>(value));
+    Traits<time_point>::serialize(archive, std::get<1>(value));
+
+    _SaveKeyStrings(archive, std::get<2>(value));
+    _SaveDataStrings(archive, std::get<3>(value));
+
+    return archive.commit();
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  EstimatorMemory
@@ -1110,3 +1292,16 @@ Microsoft::Featurizer::Archive & TransformerMemory::save(Microsoft::Featurizer::
 
     return ar;
 }
+
+std::unique_ptr<TransformerMemory> TransformerMemory::clone(void) const {
+    // ----------------------------------------------------------------------
+    using TransformerType                   = Microsoft::Featurizer::Featurizers::TimeSeriesImputerEstimator::TransformerType;
+    // ----------------------------------------------------------------------
+
+    return std::unique_ptr<TransformerMemory>(
+        new TransformerMemory(
+            SerializerType(TransformerSerializer.KeyTypes, TransformerSerializer.DataTypes),
+            Microsoft::Featurizer::CloneTransformer(static_cast<TransformerType const &>(*Transformer))
+        )
+    );
+}
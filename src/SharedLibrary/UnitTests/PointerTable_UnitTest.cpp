@@ -4,8 +4,12 @@
 // ----------------------------------------------------------------------
 
 #define CATCH_CONFIG_MAIN
-#include <string>
+#include <atomic>
 #include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "catch.hpp"
 
@@ -45,36 +49,87 @@ TEST_CASE("Add_Find_Remove") {
 }
 
 TEST_CASE("Check_Randomness_Given_Seed") {
-    PointerTable TestTable(5);
+    PointerTable TestTable1(5);
+    PointerTable TestTable2(5);
+    PointerTable TestTable3(6);
+
+
+    int p0 = 0;
+    int p1 = 1;
+
+    size_t i0 = TestTable1.Add<int>(&p0);
+    size_t i1 = TestTable1.Add<int>(&p1);
+
+    CHECK(i0 != i1);
+
+    // same seed, same indexes
+    CHECK(TestTable2.Add<int>(&p0) == i0);
+    CHECK(TestTable2.Add<int>(&p1) == i1);
+
+    // different seed, different indexes
+    CHECK(TestTable3.Add<int>(&p0) != i0);
+    CHECK(TestTable3.Add<int>(&p1) != i1);
+}
+
+TEST_CASE("Stale_Index") {
+    PointerTable TestTable;
 
 
     int p0 = 0;
     int p1 = 1;
-    int p2 = 2;
 
     size_t i0 = TestTable.Add<int>(&p0);
+    TestTable.Remove(i0);
+
+    // the slot is reused, but the original index is no longer valid
     size_t i1 = TestTable.Add<int>(&p1);
-    size_t i2 = TestTable.Add<int>(&p2);
-
-#if (defined _MSC_VER)
-#   pragma warning(push)
-#   pragma warning(disable: 4127)           // conditional expression is constant
-#endif
-
-    if(sizeof(size_t) == 8) {
-        // 64 bit
-        CHECK(i0 == 4095051218741643471UL);
-        CHECK(i1 == 16062175962503177918UL);
-        CHECK(i2 == 3813295331020233847UL);
+    CHECK(i1 != i0);
+    CHECK(TestTable.Get<int>(i1) == &p1);
+
+    REQUIRE_THROWS_WITH(TestTable.Get<int>(i0),"Invalid query to the Pointer table, index incorrect!");
+    REQUIRE_THROWS_WITH(TestTable.Remove(i0),"Invalid remove from the Pointer table, index pointer not found!");
+    REQUIRE_THROWS_WITH(TestTable.Get<int>(i1 + 1),"Invalid query to the Pointer table, index incorrect!");
+    REQUIRE_THROWS_WITH(TestTable.Get<int>(std::numeric_limits<size_t>::max()),"Invalid query to the Pointer table, index incorrect!");
+
+    CHECK(TestTable.Get<int>(i1) == &p1);
+}
+
+TEST_CASE("Concurrent_Access") {
+    PointerTable TestTable;
+
+
+    std::vector<int> values(1000);
+    std::vector<size_t> indexes(values.size());
+
+    for(size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(i);
+        indexes[i] = TestTable.Add<int>(&values[i]);
     }
-    else {
-        // 32 bit
-        CHECK(i0 == 953453412);
-        CHECK(i1 == 236996815);
-        CHECK(i2 == 3739766768);
+
+    std::atomic<bool> isValid(true);
+    std::vector<std::thread> threads;
+
+    for(size_t threadIndex = 0; threadIndex < 4; ++threadIndex) {
+        threads.emplace_back(
+            [&TestTable, &values, &indexes, &isValid](void) {
+                for(size_t iteration = 0; iteration < 100; ++iteration) {
+                    for(size_t i = 0; i < values.size(); ++i) {
+                        if(TestTable.Get<int>(indexes[i]) != &values[i])
+                            isValid = false;
+                    }
+                }
+            }
+        );
     }
 
-#if (defined _MSC_VER)
-#   pragma warning(pop)
-#endif
+    // add and remove other pointers while the readers are running
+    std::vector<int> others(2000);
+
+    for(auto &other : others)
+        TestTable.Remove(TestTable.Add<int>(&other));
+
+    for(auto &thread : threads)
+        thread.join();
+
+    CHECK(isValid);
 }
@@ -0,0 +1,362 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "Featurizer.h"
+
+namespace Microsoft {
+namespace Featurizer {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ThreadPool
+///  \brief         Fixed collection of worker threads used to process a range
+///                 of items in parallel.
+///
+///                 A thread waiting for `parallel_for` to complete processes
+///                 queued ranges (including those of other invocations), so
+///                 `parallel_for` may be invoked from within a function that
+///                 is itself executing on a worker thread.
+///
+class ThreadPool {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+
+    // Invoked with the [begin, end) range of items to process
+    using RangeFunction                     = FunctionRef<void (size_t, size_t)>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            ThreadPool
+    ///  \brief         Creates the worker threads. A value of 0 creates one
+    ///                 worker thread for each hardware thread other than the
+    ///                 calling thread, which also participates in `parallel_for`.
+    ///
+    ThreadPool(size_t numWorkers=0);
+    ~ThreadPool(void);
+
+    ThreadPool(ThreadPool const &) = delete;
+    ThreadPool & operator =(ThreadPool const &) = delete;
+    ThreadPool(ThreadPool &&) = delete;
+    ThreadPool & operator =(ThreadPool &&) = delete;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            num_workers
+    ///  \brief         Returns the number of worker threads.
+    ///
+    size_t num_workers(void) const;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            parallel_for
+    ///  \brief         Divides the items into contiguous ranges and invokes `func`
+    ///                 for each range on the worker threads and the calling
+    ///                 thread. This method returns once all ranges have been
+    ///                 processed; if any invocation throws, the first exception
+    ///                 is rethrown.
+    ///
+    void parallel_for(size_t cItems, RangeFunction const &func);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    struct Batch {
+        std::mutex                          Mutex;
+        std::condition_variable             Completed;
+        size_t                              NumRemaining;
+        std::exception_ptr                  pException;
+
+        Batch(size_t numRemaining) :
+            NumRemaining(numRemaining) {
+        }
+    };
+
+    struct Task {
+        RangeFunction                       Func;
+        size_t                              Begin;
+        size_t                              End;
+        Batch *                             pBatch;
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::mutex                              _mutex;
+    std::condition_variable                 _tasksAvailable;
+    std::queue<Task>                        _tasks;
+    bool                                    _isStopping;
+
+    std::vector<std::thread>                _workers;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void worker_thread(void);
+
+    bool try_execute_task(void);
+    static void execute_task(Task const &task);
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            GetSharedThreadPool
+///  \brief         Returns a process-wide `ThreadPool` (with one worker thread
+///                 for each hardware thread other than the calling thread) that
+///                 is created on first use. Use this pool rather than creating
+///                 pools for short-lived or numerous objects.
+///
+ThreadPool & GetSharedThreadPool(void);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            ParallelExecute
+///  \brief         Transforms a batch of inputs by dividing it across the
+///                 threads in the pool, assigning exactly one result for each
+///                 input to the caller-provided output buffer.
+///
+///                 A `Transformer` that isn't stateless can't be invoked
+///                 concurrently, so its batch is executed on the calling thread.
+///
+template <typename InputT, typename TransformedT>
+void ParallelExecute(ThreadPool &pool, Transformer<InputT, TransformedT> &transformer, InputT const *pInputs, size_t cInputs, TransformedT *pOutputs);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  ThreadPool
+// |
+// ----------------------------------------------------------------------
+inline ThreadPool::ThreadPool(size_t numWorkers) :
+    _isStopping(false) {
+    if(numWorkers == 0) {
+        unsigned int const                  numHardwareThreads(std::thread::hardware_concurrency());
+
+        numWorkers = numHardwareThreads > 1 ? numHardwareThreads - 1 : 1;
+    }
+
+    _workers.reserve(numWorkers);
+
+    while(_workers.size() != numWorkers)
+        _workers.emplace_back([this](void) { worker_thread(); });
+}
+
+inline ThreadPool::~ThreadPool(void) {
+    {
+        std::unique_lock<std::mutex>        lock(_mutex);
+
+        _isStopping = true;
+    }
+
+    _tasksAvailable.notify_all();
+
+    for(auto &worker : _workers)
+        worker.join();
+}
+
+inline size_t ThreadPool::num_workers(void) const {
+    return _workers.size();
+}
+
+inline void ThreadPool::parallel_for(size_t cItems, RangeFunction const &func) {
+    if(!func)
+        throw std::invalid_argument("func");
+
+    if(cItems == 0)
+        return;
+
+    size_t const                            numRanges(std::min(cItems, _workers.size() + 1));
+
+    if(numRanges == 1) {
+        func(0, cItems);
+        return;
+    }
+
+    size_t const                            itemsPerRange(cItems / numRanges);
+    size_t const                            numLargerRanges(cItems % numRanges);
+
+    // The first range is processed on this thread
+    size_t const                            firstEnd(itemsPerRange + (numLargerRanges != 0 ? 1 : 0));
+    Batch                                   batch(numRanges - 1);
+
+    {
+        std::unique_lock<std::mutex>        lock(_mutex);
+        size_t                              begin(firstEnd);
+
+        for(size_t rangeIndex = 1; rangeIndex < numRanges; ++rangeIndex) {
+            size_t const                    end(begin + itemsPerRange + (rangeIndex < numLargerRanges ? 1 : 0));
+
+            _tasks.push(Task{func, begin, end, &batch});
+            begin = end;
+        }
+    }
+
+    _tasksAvailable.notify_all();
+
+    std::exception_ptr                      pException;
+
+    try {
+        func(0, firstEnd);
+    }
+    catch(...) {
+        pException = std::current_exception();
+    }
+
+    // Process queued ranges while waiting, so that nested invocations can't exhaust the workers
+    while(true) {
+        {
+            std::unique_lock<std::mutex>    lock(batch.Mutex);
+
+            if(batch.NumRemaining == 0)
+                break;
+        }
+
+        if(try_execute_task())
+            continue;
+
+        // The remaining ranges of this batch are being processed by other threads
+        std::unique_lock<std::mutex>        lock(batch.Mutex);
+
+        batch.Completed.wait(lock, [&batch](void) { return batch.NumRemaining == 0; });
+        break;
+    }
+
+    if(!pException)
+        pException = batch.pException;
+
+    if(pException)
+        std::rethrow_exception(pException);
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+inline void ThreadPool::worker_thread(void) {
+    while(true) {
+        Task                                task;
+
+        {
+            std::unique_lock<std::mutex>    lock(_mutex);
+
+            _tasksAvailable.wait(lock, [this](void) { return _isStopping || _tasks.empty() == false; });
+
+            if(_tasks.empty())
+                return;
+
+            task = _tasks.front();
+            _tasks.pop();
+        }
+
+        execute_task(task);
+    }
+}
+
+inline bool ThreadPool::try_execute_task(void) {
+    Task                                    task;
+
+    {
+        std::unique_lock<std::mutex>        lock(_mutex);
+
+        if(_tasks.empty())
+            return false;
+
+        task = _tasks.front();
+        _tasks.pop();
+    }
+
+    execute_task(task);
+    return true;
+}
+
+inline void ThreadPool::execute_task(Task const &task) {
+    std::exception_ptr                      pException;
+
+    try {
+        task.Func(task.Begin, task.End);
+    }
+    catch(...) {
+        pException = std::current_exception();
+    }
+
+    Batch &                                 batch(*task.pBatch);
+    std::unique_lock<std::mutex>            lock(batch.Mutex);
+
+    if(pException && !batch.pException)
+        batch.pException = pException;
+
+    if(--batch.NumRemaining == 0)
+        batch.Completed.notify_all();
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  GetSharedThreadPool
+// |
+// ----------------------------------------------------------------------
+inline ThreadPool & GetSharedThreadPool(void) {
+    static ThreadPool                       pool;
+
+    return pool;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  ParallelExecute
+// |
+// ----------------------------------------------------------------------
+template <typename InputT, typename TransformedT>
+void ParallelExecute(ThreadPool &pool, Transformer<InputT, TransformedT> &transformer, InputT const *pInputs, size_t cInputs, TransformedT *pOutputs) {
+    if(transformer.is_stateless() == false) {
+        transformer.execute(pInputs, cInputs, pOutputs);
+        return;
+    }
+
+    if(pInputs == nullptr)
+        throw std::invalid_argument("pInputs");
+
+    if(cInputs == 0)
+        throw std::invalid_argument("cInputs");
+
+    if(pOutputs == nullptr)
+        throw std::invalid_argument("pOutputs");
+
+    pool.parallel_for(
+        cInputs,
+        [&transformer, &pInputs, &pOutputs](size_t begin, size_t end) {
+            transformer.execute(pInputs + begin, end - begin, pOutputs + begin);
+        }
+    );
+}
+
+} // namespace Featurizer
+} // namespace Microsoft
@@ -146,6 +146,50 @@ def _CreateInterfaceSubstitutionDict(item, c_data):
     }
 
 
+# ----------------------------------------------------------------------
+def _GetOutputBufferInfo(item, c_data):
+    """\
+    Returns the output info used by `TransformIntoBuffer`, or None if the method
+    should not be generated for the item.
+
+    `TransformIntoBuffer` transforms the input again each time the caller queries
+    the required buffer size, so it is only generated for transformers that do not
+    maintain state across calls.
+    """
+
+    if getattr(item, "transformer_maintains_state", False):
+        return None
+
+    return c_data.OutputTypeInfoFactory.GetOutputBufferInfo("output")
+
+
+# ----------------------------------------------------------------------
+def _GetInputInfos(item, c_data, invocation_template, is_buffer):
+    """\
+    Returns (suffix, input info) tuples for each of the ways in which the
+    input can be provided to the method.
+
+    In addition to the standard representation, variable-length types may provide
+    a view representation where the size of the data is provided by the caller (so
+    the data doesn't need to be null-terminated or copied into individual buffers).
+    """
+
+    is_optional = getattr(item, "is_input_optional", False)
+
+    if is_buffer:
+        results = [
+            ("", c_data.InputTypeInfoFactory.GetInputBufferInfo("input", is_optional, invocation_template)),
+            ("View", c_data.InputTypeInfoFactory.GetInputViewBufferInfo("input", is_optional, invocation_template)),
+        ]
+    else:
+        results = [
+            ("", c_data.InputTypeInfoFactory.GetInputInfo("input", is_optional, invocation_template)),
+            ("View", c_data.InputTypeInfoFactory.GetInputViewInfo("input", is_optional, invocation_template)),
+        ]
+
+    return [(input_suffix, input_info) for input_suffix, input_info in results if input_info is not None]
+
+
 # ----------------------------------------------------------------------
 def _GenerateCommonFiles(open_file_func, output_dir, output_stream):
     with open_file_func(os.path.join(output_dir, "SharedLibrary_Common.h"), "w") as f:
@@ -253,6 +297,15 @@ def _GenerateCommonFiles(open_file_func, output_dir, output_stream):
 
                 typedef unsigned char FitResult;
 
+                // These values should match the values in Archive.h
+                enum ArchiveLayoutValue {
+                    StandardLayout = 1,
+                    FlatLayout,
+                    CompactLayout
+                };
+
+                typedef unsigned char ArchiveLayout;
+
                 // These values should match the values in Traits.h
                 enum TypeIdValue {
                     StringId = 0x00000001,
@@ -287,6 +340,50 @@ def _GenerateCommonFiles(open_file_func, output_dir, output_stream):
 
                 typedef uint32_t TypeId;
 
+                // Arrow C Data Interface (https://arrow.apache.org/docs/format/CDataInterface.html);
+                // these definitions are part of the Arrow ABI and must not be changed.
+                #ifndef ARROW_C_DATA_INTERFACE
+                #define ARROW_C_DATA_INTERFACE
+
+                #define ARROW_FLAG_DICTIONARY_ORDERED 1
+                #define ARROW_FLAG_NULLABLE 2
+                #define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+                struct ArrowSchema {
+                    // Array type description
+                    const char* format;
+                    const char* name;
+                    const char* metadata;
+                    int64_t flags;
+                    int64_t n_children;
+                    struct ArrowSchema** children;
+                    struct ArrowSchema* dictionary;
+
+                    // Release callback
+                    void (*release)(struct ArrowSchema*);
+                    // Opaque producer-specific data
+                    void* private_data;
+                };
+
+                struct ArrowArray {
+                    // Array data description
+                    int64_t length;
+                    int64_t null_count;
+                    int64_t offset;
+                    int64_t n_buffers;
+                    int64_t n_children;
+                    const void** buffers;
+                    struct ArrowArray** children;
+                    struct ArrowArray* dictionary;
+
+                    // Release callback
+                    void (*release)(struct ArrowArray*);
+                    // Opaque producer-specific data
+                    void* private_data;
+                };
+
+                #endif // ARROW_C_DATA_INTERFACE
+
                 } // extern "C"
                 """,
             ),
@@ -307,6 +404,7 @@ def _GenerateCommonFiles(open_file_func, output_dir, output_stream):
 
                 #include "SharedLibrary_Common.h"
                 #include "SharedLibrary_PointerTable.h"
+                #include "Archive.h"
                 #include "Traits.h"
 
                 // Forward declaration for DestroyTransformerSaveData
@@ -394,6 +492,19 @@ def _GenerateCommonFiles(open_file_func, output_dir, output_stream):
 
                     throw std::runtime_error("'type' is invalid");
                 }
+
+                Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout) {
+                    if(layout == ArchiveLayoutValue::StandardLayout)
+                        return Microsoft::Featurizer::Archive::LayoutValue::Standard;
+
+                    if(layout == ArchiveLayoutValue::FlatLayout)
+                        return Microsoft::Featurizer::Archive::LayoutValue::Flat;
+
+                    if(layout == ArchiveLayoutValue::CompactLayout)
+                        return Microsoft::Featurizer::Archive::LayoutValue::Compact;
+
+                    throw std::invalid_argument("'layout' is invalid");
+                }
                 """,
             ),
         )
@@ -539,6 +650,113 @@ def _GenerateHeaderFile(open_file_func, output_dir, items, c_data_items, output_
             else:
                 delete_transformed_method = ""
 
+            additional_fit_methods = ""
+            additional_transform_methods = ""
+
+            input_view_info = c_data.InputTypeInfoFactory.GetInputViewInfo(
+                "input",
+                getattr(item, "is_input_optional", False),
+                "",
+            )
+            if input_view_info is not None:
+                additional_fit_methods += textwrap.dedent(
+                    """\
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}FitView(/*in*/ {name}{suffix}EstimatorHandle *pHandle, {input_param}, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    """,
+                ).format(
+                    input_param=", ".join(input_view_info.ParameterDecl),
+                    **d
+                )
+
+                additional_transform_methods += textwrap.dedent(
+                    """\
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}TransformView(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {transform_output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    """,
+                ).format(
+                    input_param=", ".join(input_view_info.ParameterDecl),
+                    transform_output_param=", ".join(
+                        c_data.OutputTypeInfoFactory.GetOutputInfo("output").ParameterDecl,
+                    ),
+                    **d
+                )
+
+            input_view_buffer_info = c_data.InputTypeInfoFactory.GetInputViewBufferInfo(
+                "input",
+                getattr(item, "is_input_optional", False),
+                "",
+            )
+            if input_view_buffer_info is not None:
+                additional_fit_methods += textwrap.dedent(
+                    """\
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}FitBufferView(/*in*/ {name}{suffix}EstimatorHandle *pHandle, {input_param}, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    """,
+                ).format(
+                    input_param=", ".join(input_view_buffer_info.ParameterDecl),
+                    **d
+                )
+
+                additional_transform_methods += textwrap.dedent(
+                    """\
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}TransformBatchView(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {transform_output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    """,
+                ).format(
+                    input_param=", ".join(input_view_buffer_info.ParameterDecl),
+                    transform_output_param=", ".join(
+                        c_data.OutputTypeInfoFactory.GetOutputInfo("output").ParameterDecl,
+                    ),
+                    **d
+                )
+
+            input_arrow_info = c_data.InputTypeInfoFactory.GetInputArrowInfo(
+                "input",
+                getattr(item, "is_input_optional", False),
+                "",
+            )
+            if input_arrow_info is not None:
+                additional_fit_methods += textwrap.dedent(
+                    """\
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}FitArrow(/*in*/ {name}{suffix}EstimatorHandle *pHandle, {input_param}, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    """,
+                ).format(
+                    input_param=", ".join(input_arrow_info.ParameterDecl),
+                    **d
+                )
+
+                output_arrow_info = c_data.OutputTypeInfoFactory.GetOutputArrowInfo("output")
+                if output_arrow_info is not None:
+                    additional_transform_methods += textwrap.dedent(
+                        """\
+                        FEATURIZER_LIBRARY_API bool {name}{suffix}TransformArrow(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                        """,
+                    ).format(
+                        input_param=", ".join(input_arrow_info.ParameterDecl),
+                        output_param=", ".join(output_arrow_info.ParameterDecl),
+                        **d
+                    )
+
+            transform_into_buffer_info = _GetOutputBufferInfo(item, c_data)
+            if transform_into_buffer_info is not None:
+                transform_into_buffer_method = textwrap.dedent(
+                    """\
+                    // Writes the result to the caller's buffer when it fits within the capacity provided; the required size is always
+                    // returned. Querying the size with an empty buffer runs the full transform (and the transform runs again when the
+                    // data is retrieved), so this method is not available for transformers that maintain state across calls.
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}TransformIntoBuffer(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {parameters}, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    """,
+                ).format(
+                    input_param=", ".join(
+                        c_data.InputTypeInfoFactory.GetInputInfo(
+                            "input",
+                            getattr(item, "is_input_optional", False),
+                            "",
+                        ).ParameterDecl,
+                    ),
+                    parameters=", ".join(transform_into_buffer_info.ParameterDecl),
+                    **d
+                )
+            else:
+                transform_into_buffer_method = ""
+
             # Create the custom structs (if any)
             custom_structs = []
 
@@ -642,18 +860,23 @@ def _GenerateHeaderFile(open_file_func, output_dir, items, c_data_items, output_
                     FEATURIZER_LIBRARY_API bool {name}{suffix}IsTrainingComplete(/*in*/ {name}{suffix}EstimatorHandle *pHandle, /*out*/ bool *pIsTrainingComplete, /*out*/ ErrorInfoHandle **ppErrorInfo);
                     FEATURIZER_LIBRARY_API bool {name}{suffix}Fit(/*in*/ {name}{suffix}EstimatorHandle *pHandle, {input_param}, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo);
                     FEATURIZER_LIBRARY_API bool {name}{suffix}FitBuffer(/*in*/ {name}{suffix}EstimatorHandle *pHandle, {input_buffer_param}, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo);
-                    FEATURIZER_LIBRARY_API bool {name}{suffix}OnDataCompleted(/*in*/ {name}{suffix}EstimatorHandle *pHandle, /*out*/ /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    {additional_fit_methods}FEATURIZER_LIBRARY_API bool {name}{suffix}OnDataCompleted(/*in*/ {name}{suffix}EstimatorHandle *pHandle, /*out*/ /*out*/ ErrorInfoHandle **ppErrorInfo);
                     FEATURIZER_LIBRARY_API bool {name}{suffix}CompleteTraining(/*in*/ {name}{suffix}EstimatorHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
                     /* Inference Methods */
                     FEATURIZER_LIBRARY_API bool {name}{suffix}CreateTransformerFromEstimator(/*in*/ {name}{suffix}EstimatorHandle *pEstimatorHandle, /*out*/ {name}{suffix}TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
                     FEATURIZER_LIBRARY_API bool {name}{suffix}CreateTransformerFromSavedData(/*in*/ unsigned char const *pBuffer, /*in*/ std::size_t cBufferSize, /*out*/ {name}{suffix}TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ {name}{suffix}TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}CloneTransformer(/*in*/ {name}{suffix}TransformerHandle *pHandle, /*out*/ {name}{suffix}TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
                     FEATURIZER_LIBRARY_API bool {name}{suffix}DestroyTransformer(/*in*/ {name}{suffix}TransformerHandle *pHandle, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
                     FEATURIZER_LIBRARY_API bool {name}{suffix}CreateTransformerSaveData(/*in*/ {name}{suffix}TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}CreateTransformerSaveDataWithLayout(/*in*/ {name}{suffix}TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}CreateTransformerSaveDataFile(/*in*/ {name}{suffix}TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
                     FEATURIZER_LIBRARY_API bool {name}{suffix}Transform(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {transform_output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo);
-                    {delete_transformed_method}
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}TransformBatch(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_buffer_param}, {transform_output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    {additional_transform_methods}{transform_into_buffer_method}{delete_transformed_method}
                     """,
                 ).format(
                     construct_params="{},".format(
@@ -676,6 +899,9 @@ def _GenerateHeaderFile(open_file_func, output_dir, items, c_data_items, output_
                     transform_output_param=", ".join(
                         c_data.OutputTypeInfoFactory.GetOutputInfo("output").ParameterDecl,
                     ),
+                    additional_fit_methods=additional_fit_methods,
+                    additional_transform_methods=additional_transform_methods,
+                    transform_into_buffer_method=transform_into_buffer_method,
                     delete_transformed_method=delete_transformed_method,
                     **d
                 )
@@ -707,13 +933,68 @@ def _GenerateCppFile(open_file_func, output_dir, items, c_data_items, output_str
 
                 #include "SharedLibrary_{name}.h"
                 #include "SharedLibrary_PointerTable.h"
+                #include "../SharedLibrary_Arrow.h"
 
                 #include "Archive.h"
+                #include "FileArchive.h"
                 #include "{name}.h"
 
                 // These method(s) are defined in SharedLibrary_Common.cpp
                 ErrorInfoHandle * CreateErrorInfo(std::exception const &ex);
                 std::chrono::system_clock::time_point CreateDateTime(DateTimeParameter const &param);
+                Microsoft::Featurizer::Archive::LayoutValue CreateArchiveLayout(ArchiveLayout layout);
+
+                namespace {{
+
+                // Transforms the inputs with a single call to the transformer's batch
+                // `execute` method and invokes `outputFunc` for each result.
+                template <typename TransformerT, typename OutputFuncT>
+                void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::true_type /*is_default_constructible*/) {{
+                    std::unique_ptr<typename TransformerT::TransformedType []> pResults(new typename TransformerT::TransformedType[cInputs]);
+
+                    transformer.execute(pInputs, cInputs, pResults.get());
+
+                    for(std::size_t index = 0; index < cInputs; ++index)
+                        outputFunc(pResults[index]);
+                }}
+
+                // The batch `execute` method writes to constructed items; results that can't be
+                // default constructed are transformed one at a time.
+                template <typename TransformerT, typename OutputFuncT>
+                void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc, std::false_type /*is_default_constructible*/) {{
+                    typename TransformerT::InputType const * const  pEndInputs(pInputs + cInputs);
+
+                    while(pInputs != pEndInputs) {{
+                        typename TransformerT::TransformedType      result(transformer.execute(*pInputs));
+
+                        outputFunc(result);
+                        ++pInputs;
+                    }}
+                }}
+
+                template <typename TransformerT, typename OutputFuncT>
+                void TransformBatch(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputFuncT const &outputFunc) {{
+                    TransformBatch(transformer, pInputs, cInputs, outputFunc, std::is_default_constructible<typename TransformerT::TransformedType>());
+                }}
+
+                // Results are written directly to the caller's buffer when its type is the
+                // transformed type; otherwise, each result is converted by `outputFunc`.
+                template <typename TransformerT, typename OutputT, typename OutputFuncT>
+                void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &/*outputFunc*/, std::true_type /*is_transformed_type*/) {{
+                    transformer.execute(pInputs, cInputs, pOutputs);
+                }}
+
+                template <typename TransformerT, typename OutputT, typename OutputFuncT>
+                void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT * /*pOutputs*/, OutputFuncT const &outputFunc, std::false_type /*is_transformed_type*/) {{
+                    TransformBatch(transformer, pInputs, cInputs, outputFunc);
+                }}
+
+                template <typename TransformerT, typename OutputT, typename OutputFuncT>
+                void TransformBatchToOutput(TransformerT &transformer, typename TransformerT::InputType const *pInputs, std::size_t cInputs, OutputT *pOutputs, OutputFuncT const &outputFunc) {{
+                    TransformBatchToOutput(transformer, pInputs, cInputs, pOutputs, outputFunc, std::is_same<OutputT, typename TransformerT::TransformedType>());
+                }}
+
+                }} // anonymous namespace
 
                 extern "C" {{
 
@@ -899,84 +1180,124 @@ def _GenerateCppFile(open_file_func, output_dir, items, c_data_items, output_str
             )
 
             # Fit
-            input_info = c_data.InputTypeInfoFactory.GetInputInfo(
-                "input",
-                getattr(item, "is_input_optional", False),
+            for input_suffix, input_info in _GetInputInfos(
+                item,
+                c_data,
                 "*pFitResult = static_cast<unsigned char>(estimator.fit({}));",
-            )
-
-            f.write(
-                textwrap.dedent(
-                    """\
-                    FEATURIZER_LIBRARY_API bool {name}{suffix}Fit(/*in*/ {name}{suffix}EstimatorHandle *pHandle, {param}, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
-                        {method_prefix}
-                            if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-                            if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+                is_buffer=False,
+            ):
+                f.write(
+                    textwrap.dedent(
+                        """\
+                        FEATURIZER_LIBRARY_API bool {name}{suffix}Fit{input_suffix}(/*in*/ {name}{suffix}EstimatorHandle *pHandle, {param}, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                            {method_prefix}
+                                if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+                                if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
-                            {validation}
+                                {validation}
 
-                            Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix} & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}>(reinterpret_cast<size_t>(pHandle)));
+                                Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix} & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}>(reinterpret_cast<size_t>(pHandle)));
 
 
-                            {statement}
-                        {method_suffix}
-                    }}
+                                {statement}
+                            {method_suffix}
+                        }}
 
-                    """,
-                ).format(
-                    param=", ".join(input_info.ParameterDecl),
-                    validation="// No validation" if not input_info.ValidationStatements else StringHelpers.LeftJustify(
-                        input_info.ValidationStatements.strip(),
-                        8,
-                    ),
-                    statement=StringHelpers.LeftJustify(
-                        input_info.InvocationStatements.strip(),
-                        8,
-                    ),
-                    **d
+                        """,
+                    ).format(
+                        param=", ".join(input_info.ParameterDecl),
+                        validation="// No validation" if not input_info.ValidationStatements else StringHelpers.LeftJustify(
+                            input_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        statement=StringHelpers.LeftJustify(
+                            input_info.InvocationStatements.strip(),
+                            8,
+                        ),
+                        input_suffix=input_suffix,
+                        **d
+                    )
                 )
-            )
 
             # FitBuffer
-            input_info = c_data.InputTypeInfoFactory.GetInputBufferInfo(
-                "input",
-                getattr(item, "is_input_optional", False),
+            for input_suffix, input_info in _GetInputInfos(
+                item,
+                c_data,
                 "*pFitResult = static_cast<unsigned char>(estimator.fit({}));",
-            )
-
-            f.write(
-                textwrap.dedent(
-                    """\
-                    FEATURIZER_LIBRARY_API bool {name}{suffix}FitBuffer(/*in*/ {name}{suffix}EstimatorHandle *pHandle, {param}, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
-                        {method_prefix}
-                            if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-                            if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+                is_buffer=True,
+            ):
+                f.write(
+                    textwrap.dedent(
+                        """\
+                        FEATURIZER_LIBRARY_API bool {name}{suffix}FitBuffer{input_suffix}(/*in*/ {name}{suffix}EstimatorHandle *pHandle, {param}, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                            {method_prefix}
+                                if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+                                if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
 
 
 
-                            {validation}
+                                {validation}
 
-                            Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix} & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}>(reinterpret_cast<size_t>(pHandle)));
+                                Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix} & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}>(reinterpret_cast<size_t>(pHandle)));
 
-                            {statement}
-                        {method_suffix}
-                    }}
+                                {statement}
+                            {method_suffix}
+                        }}
 
-                    """,
-                ).format(
-                    param=", ".join(input_info.ParameterDecl),
-                    validation="// No validation" if not input_info.ValidationStatements else StringHelpers.LeftJustify(
-                        input_info.ValidationStatements.strip(),
-                        8,
-                    ),
-                    statement=StringHelpers.LeftJustify(
-                        input_info.InvocationStatements.strip(),
-                        8,
-                    ),
-                    **d
+                        """,
+                    ).format(
+                        param=", ".join(input_info.ParameterDecl),
+                        validation="// No validation" if not input_info.ValidationStatements else StringHelpers.LeftJustify(
+                            input_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        statement=StringHelpers.LeftJustify(
+                            input_info.InvocationStatements.strip(),
+                            8,
+                        ),
+                        input_suffix=input_suffix,
+                        **d
+                    )
                 )
+
+            # FitArrow (optional)
+            input_info = c_data.InputTypeInfoFactory.GetInputArrowInfo(
+                "input",
+                getattr(item, "is_input_optional", False),
+                "*pFitResult = static_cast<unsigned char>(estimator.fit({}));",
             )
+            if input_info is not None:
+                f.write(
+                    textwrap.dedent(
+                        """\
+                        FEATURIZER_LIBRARY_API bool {name}{suffix}FitArrow(/*in*/ {name}{suffix}EstimatorHandle *pHandle, {param}, /*out*/ FitResult *pFitResult, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                            {method_prefix}
+                                if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+                                if(pFitResult == nullptr) throw std::invalid_argument("'pFitResult' is null");
+
+                                {validation}
+
+                                Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix} & estimator(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}>(reinterpret_cast<size_t>(pHandle)));
+
+                                {statement}
+                            {method_suffix}
+                        }}
+
+                        """,
+                    ).format(
+                        param=", ".join(input_info.ParameterDecl),
+                        validation=StringHelpers.LeftJustify(
+                            input_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        statement=StringHelpers.LeftJustify(
+                            input_info.InvocationStatements.strip(),
+                            8,
+                        ),
+                        **d
+                    )
+                )
 
             # OnDataCompleted
             f.write(
@@ -1062,6 +1383,49 @@ def _GenerateCppFile(open_file_func, output_dir, items, c_data_items, output_str
                 ).format(**d)
             )
 
+            # CreateTransformerFromSavedDataFile
+            f.write(
+                textwrap.dedent(
+                    """\
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}CreateTransformerFromSavedDataFile(/*in*/ char const *filename, /*out*/ {name}{suffix}TransformerHandle **ppTransformerHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                        {method_prefix}
+                            if(filename == nullptr) throw std::invalid_argument("'filename' is null");
+                            if(ppTransformerHandle == nullptr) throw std::invalid_argument("'ppTransformerHandle' is null");
+
+                            Microsoft::Featurizer::Archive archive(Microsoft::Featurizer::CreateFileDeserializingArchive(filename));
+
+                            Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType* pTransformer(new Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType(archive));
+
+                            size_t index = g_pointerTable.Add(pTransformer);
+                            *ppTransformerHandle = reinterpret_cast<{name}{suffix}TransformerHandle*>(index);
+                        {method_suffix}
+                    }}
+
+                    """,
+                ).format(**d)
+            )
+
+            # CloneTransformer
+            f.write(
+                textwrap.dedent(
+                    """\
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}CloneTransformer(/*in*/ {name}{suffix}TransformerHandle *pHandle, /*out*/ {name}{suffix}TransformerHandle **ppCloneHandle, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                        {method_prefix}
+                            if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+                            if(ppCloneHandle == nullptr) throw std::invalid_argument("'ppCloneHandle' is null");
+
+                            Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+                            Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType* pClone(Microsoft::Featurizer::CloneTransformer(transformer).release());
+
+                            size_t index = g_pointerTable.Add(pClone);
+                            *ppCloneHandle = reinterpret_cast<{name}{suffix}TransformerHandle*>(index);
+                        {method_suffix}
+                    }}
+
+                    """,
+                ).format(**d)
+            )
+
             # DestroyTransformer
             f.write(
                 textwrap.dedent(
@@ -1088,17 +1452,22 @@ def _GenerateCppFile(open_file_func, output_dir, items, c_data_items, output_str
                 textwrap.dedent(
                     """\
                     FEATURIZER_LIBRARY_API bool {name}{suffix}CreateTransformerSaveData(/*in*/ {name}{suffix}TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                        return {name}{suffix}CreateTransformerSaveDataWithLayout(pHandle, ArchiveLayoutValue::StandardLayout, ppBuffer, pBufferSize, ppErrorInfo);
+                    }}
+
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}CreateTransformerSaveDataWithLayout(/*in*/ {name}{suffix}TransformerHandle *pHandle, /*in*/ ArchiveLayout layout, /*out*/ unsigned char const **ppBuffer, /*out*/ std::size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
                         {method_prefix}
                             if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
                             if(ppBuffer == nullptr) throw std::invalid_argument("'ppBuffer' is null");
                             if(pBufferSize == nullptr) throw std::invalid_argument("'pBufferSize' is null");
 
                             Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType>(reinterpret_cast<size_t>(pHandle)));
-                            Microsoft::Featurizer::Archive archive;
-
-                            transformer.save(archive);
-
-                            Microsoft::Featurizer::Archive::ByteArray const buffer(archive.commit());
+                            Microsoft::Featurizer::Archive::ByteArray const buffer(
+                                Microsoft::Featurizer::Archive::Serialize(
+                                    [&transformer](Microsoft::Featurizer::Archive &archive) {{ transformer.save(archive); }},
+                                    CreateArchiveLayout(layout)
+                                )
+                            );
 
                             unsigned char * new_buffer(new unsigned char[buffer.size()]);
 
@@ -1113,60 +1482,319 @@ def _GenerateCppFile(open_file_func, output_dir, items, c_data_items, output_str
                 ).format(**d)
             )
 
-            # Transform
-            input_info = c_data.InputTypeInfoFactory.GetInputInfo(
-                "input",
-                getattr(item, "is_input_optional", False),
-                "auto result(transformer.execute({}));",
-            )
-
-            output_info = c_data.OutputTypeInfoFactory.GetOutputInfo("output")
-
+            # CreateTransformerSaveDataFile
             f.write(
                 textwrap.dedent(
                     """\
-                    FEATURIZER_LIBRARY_API bool {name}{suffix}Transform(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}CreateTransformerSaveDataFile(/*in*/ {name}{suffix}TransformerHandle *pHandle, /*in*/ char const *filename, /*in*/ ArchiveLayout layout, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
                         {method_prefix}
                             if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
-
-
-                            {input_validation}
-                            {output_validation}
+                            if(filename == nullptr) throw std::invalid_argument("'filename' is null");
 
                             Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType>(reinterpret_cast<size_t>(pHandle)));
 
-                            // Input
-                            {input_statement}
-
-                            // Output
-                            {output_statement}
+                            Microsoft::Featurizer::SerializeToFile(
+                                filename,
+                                [&transformer](Microsoft::Featurizer::Archive &archive) {{
+                                    transformer.save(archive);
+                                }},
+                                CreateArchiveLayout(layout)
+                            );
                         {method_suffix}
                     }}
 
+                    """,
+                ).format(**d)
+            )
+
+            # Transform
+            for input_suffix, input_info in _GetInputInfos(
+                item,
+                c_data,
+                "auto result(transformer.execute({}));",
+                is_buffer=False,
+            ):
+                output_info = c_data.OutputTypeInfoFactory.GetOutputInfo("output")
+
+                f.write(
+                    textwrap.dedent(
+                        """\
+                        FEATURIZER_LIBRARY_API bool {name}{suffix}Transform{input_suffix}(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                            {method_prefix}
+                                if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+                                {input_validation}
+                                {output_validation}
+
+                                Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+                                // Input
+                                {input_statement}
+
+                                // Output
+                                {output_statement}
+                            {method_suffix}
+                        }}
+
+                        """,
+                    ).format(
+                        input_param=", ".join(input_info.ParameterDecl),
+                        output_param=", ".join(output_info.ParameterDecl),
+                        input_validation="// No input validation" if not input_info.ValidationStatements else StringHelpers.LeftJustify(
+                            input_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        output_validation="// No output validation" if not output_info.ValidationStatements else StringHelpers.LeftJustify(
+                            output_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        input_statement=StringHelpers.LeftJustify(
+                            input_info.InvocationStatements.strip(),
+                            8,
+                        ),
+                        output_statement=StringHelpers.LeftJustify(
+                            output_info.InvocationStatements.strip(),
+                            8,
+                        ),
+                        input_suffix=input_suffix,
+                        **d
+                    )
+                )
+
+            # TransformBatch
+            output_info = c_data.OutputTypeInfoFactory.GetOutputInfo("output")
+
+            # Each output argument points to storage for one result per input; the
+            # arguments are advanced after each result is written.
+            output_names = [decl.split()[-1].lstrip("*") for decl in output_info.ParameterDecl]
+
+            # Results are written directly to a single output buffer when its C type is the
+            # transformed type (this is determined at compile time).
+            if len(output_names) == 1 and not output_info.ParameterDecl[0].startswith("/*out via struct*/"):
+                batch_invocation_template = "TransformBatchToOutput(transformer, {{}}, {}, output_func);".format(output_names[0])
+            else:
+                batch_invocation_template = "TransformBatch(transformer, {}, output_func);"
+
+            # Results that own memory are destroyed if a later result can't be produced, as
+            # the caller won't receive them.
+            if c_data.OutputTypeInfoFactory.GetDestroyOutputInfo() is not None:
+                output_begin_statements = "".join(["\n        auto * const {name}_begin({name});".format(name=output_name) for output_name in output_names])
+
+                batch_invocation_template = textwrap.dedent(
+                    """\
+                    try {{{{
+                        {invocation}
+                    }}}}
+                    catch(...) {{{{
+                        // Destroy the results that were written before the error
+                        for(std::size_t result_index = 0; {first}_begin + result_index != {first}; ++result_index) {{{{
+                            ErrorInfoHandle * pDestroyErrorInfo(nullptr);
+
+                            if({name}{suffix}DestroyTransformedData({args}, &pDestroyErrorInfo) == false)
+                                DestroyErrorInfo(pDestroyErrorInfo);
+                        }}}}
+
+                        throw;
+                    }}}}
                     """,
                 ).format(
-                    input_param=", ".join(input_info.ParameterDecl),
-                    output_param=", ".join(output_info.ParameterDecl),
-                    input_validation="// No input validation" if not input_info.ValidationStatements else StringHelpers.LeftJustify(
-                        input_info.ValidationStatements.strip(),
-                        8,
-                    ),
-                    output_validation="// No output validation" if not output_info.ValidationStatements else StringHelpers.LeftJustify(
-                        output_info.ValidationStatements.strip(),
-                        8,
-                    ),
-                    input_statement=StringHelpers.LeftJustify(
-                        input_info.InvocationStatements.strip(),
-                        8,
-                    ),
-                    output_statement=StringHelpers.LeftJustify(
-                        output_info.InvocationStatements.strip(),
-                        8,
+                    invocation=batch_invocation_template,
+                    first=output_names[0],
+                    name=d["name"],
+                    suffix=d["suffix"],
+                    args=", ".join(
+                        [
+                            "{}_begin + result_index".format(output_name) if decl.startswith("/*out via struct*/") else "{}_begin[result_index]".format(output_name)
+                            for output_name, decl in zip(output_names, output_info.ParameterDecl)
+                        ]
                     ),
-                    **d
                 )
+            else:
+                output_begin_statements = ""
+
+            for input_suffix, input_info in _GetInputInfos(
+                item,
+                c_data,
+                batch_invocation_template,
+                is_buffer=True,
+            ):
+                f.write(
+                    textwrap.dedent(
+                        """\
+                        FEATURIZER_LIBRARY_API bool {name}{suffix}TransformBatch{input_suffix}(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                            {method_prefix}
+                                if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+                                {input_validation}
+                                {output_validation}
+
+                                Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+                                // Output{output_begin_statements}
+                                auto const output_func(
+                                    [{output_captures}](Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType::TransformedType &result) {{
+                                        {output_statement}
+
+                                        {output_increment}
+                                    }}
+                                );
+
+                                // Input
+                                {input_statement}
+                            {method_suffix}
+                        }}
+
+                        """,
+                    ).format(
+                        input_param=", ".join(input_info.ParameterDecl),
+                        output_param=", ".join(output_info.ParameterDecl),
+                        input_validation="// No input validation" if not input_info.ValidationStatements else StringHelpers.LeftJustify(
+                            input_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        output_validation="// No output validation" if not output_info.ValidationStatements else StringHelpers.LeftJustify(
+                            output_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        output_captures=", ".join(["&{}".format(output_name) for output_name in output_names]),
+                        output_begin_statements=output_begin_statements,
+                        output_statement=StringHelpers.LeftJustify(
+                            output_info.InvocationStatements.strip(),
+                            16,
+                        ),
+                        output_increment=StringHelpers.LeftJustify(
+                            "\n".join(["++{};".format(output_name) for output_name in output_names]),
+                            16,
+                        ),
+                        input_statement=StringHelpers.LeftJustify(
+                            input_info.InvocationStatements.strip(),
+                            8,
+                        ),
+                        input_suffix=input_suffix,
+                        **d
+                    )
+                )
+
+            # TransformArrow (optional)
+            input_info = c_data.InputTypeInfoFactory.GetInputArrowInfo(
+                "input",
+                getattr(item, "is_input_optional", False),
+                "TransformBatch(transformer, {}, output_func);",
             )
 
+            output_info = c_data.OutputTypeInfoFactory.GetOutputArrowInfo("output")
+
+            if input_info is not None and output_info is not None:
+                f.write(
+                    textwrap.dedent(
+                        """\
+                        FEATURIZER_LIBRARY_API bool {name}{suffix}TransformArrow(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                            {method_prefix}
+                                if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+                                // The input validation reads the input values, so the outputs are
+                                // validated first.
+                                {output_validation}
+                                {input_validation}
+
+                                Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+                                // Output
+                                Microsoft::Featurizer::Arrow::ArrayBuilder<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType::TransformedType> output_builder(input_values.second);
+
+                                auto const output_func(
+                                    [&output_builder](Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType::TransformedType &result) {{
+                                        {output_statement}
+                                    }}
+                                );
+
+                                // Input
+                                {input_statement}
+
+                                output_builder.Release(*output_schema, *output_array);
+                            {method_suffix}
+                        }}
+
+                        """,
+                    ).format(
+                        input_param=", ".join(input_info.ParameterDecl),
+                        output_param=", ".join(output_info.ParameterDecl),
+                        input_validation=StringHelpers.LeftJustify(
+                            input_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        output_validation=StringHelpers.LeftJustify(
+                            output_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        output_statement=StringHelpers.LeftJustify(
+                            output_info.InvocationStatements.strip(),
+                            16,
+                        ),
+                        input_statement=StringHelpers.LeftJustify(
+                            input_info.InvocationStatements.strip(),
+                            8,
+                        ),
+                        **d
+                    )
+                )
+
+            # TransformIntoBuffer (optional)
+            output_info = _GetOutputBufferInfo(item, c_data)
+            if output_info is not None:
+                input_info = c_data.InputTypeInfoFactory.GetInputInfo(
+                    "input",
+                    getattr(item, "is_input_optional", False),
+                    "auto result(transformer.execute({}));",
+                )
+
+                f.write(
+                    textwrap.dedent(
+                        """\
+                        FEATURIZER_LIBRARY_API bool {name}{suffix}TransformIntoBuffer(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                            {method_prefix}
+                                if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+
+                                {input_validation}
+                                {output_validation}
+
+                                Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+                                // Input
+                                {input_statement}
+
+                                // Output
+                                {output_statement}
+                            {method_suffix}
+                        }}
+
+                        """,
+                    ).format(
+                        input_param=", ".join(input_info.ParameterDecl),
+                        output_param=", ".join(output_info.ParameterDecl),
+                        input_validation="// No input validation" if not input_info.ValidationStatements else StringHelpers.LeftJustify(
+                            input_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        output_validation="// No output validation" if not output_info.ValidationStatements else StringHelpers.LeftJustify(
+                            output_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        input_statement=StringHelpers.LeftJustify(
+                            input_info.InvocationStatements.strip(),
+                            8,
+                        ),
+                        output_statement=StringHelpers.LeftJustify(
+                            output_info.InvocationStatements.strip(),
+                            8,
+                        ),
+                        **d
+                    )
+                )
+
             # DestroyTransformedData (optional)
             output_info = c_data.OutputTypeInfoFactory.GetDestroyOutputInfo()
             if output_info is not None:
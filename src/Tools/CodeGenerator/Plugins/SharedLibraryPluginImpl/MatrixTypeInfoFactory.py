@@ -195,6 +195,49 @@ class MatrixTypeInfoFactory(TypeInfoFactory):
             ),
         )
 
+    # ----------------------------------------------------------------------
+    @Interface.override
+    def GetOutputBufferInfo(
+        self,
+        arg_name,
+        result_name="result",
+    ):
+        # The capacity is the number of elements (not rows or columns) that can be
+        # written to the buffer; data is written in column-major order.
+        return self.Result(
+            [
+                "/*out*/ {type} *{name}_ptr".format(
+                    type=self._type_info.CType,
+                    name=arg_name,
+                ),
+                "/*in*/ size_t {}_capacity".format(arg_name),
+                "/*out*/ size_t *{}_cols".format(arg_name),
+                "/*out*/ size_t *{}_rows".format(arg_name),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_ptr == nullptr && {name}_capacity != 0) throw std::invalid_argument("'{name}_ptr' is null");
+                if({name}_cols == nullptr) throw std::invalid_argument("'{name}_cols' is null");
+                if({name}_rows == nullptr) throw std::invalid_argument("'{name}_rows' is null");
+                """,
+            ).format(
+                name=arg_name,
+            ),
+            textwrap.dedent(
+                """\
+                *{name}_cols = static_cast<size_t>({result_name}.cols());
+                *{name}_rows = static_cast<size_t>({result_name}.rows());
+
+                if(static_cast<size_t>({result_name}.size()) <= {name}_capacity)
+                    memcpy({name}_ptr, {result_name}.data(), static_cast<size_t>({result_name}.size()) * sizeof({type}));
+                """,
+            ).format(
+                name=arg_name,
+                type=self._type_info.CType,
+                result_name=result_name,
+            ),
+        )
+
     # ----------------------------------------------------------------------
     @Interface.override
     def GetDestroyOutputInfo(
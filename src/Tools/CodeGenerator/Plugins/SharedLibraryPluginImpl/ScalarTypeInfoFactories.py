@@ -127,6 +127,43 @@ class _ScalarTypeInfoFactory(TypeInfoFactory):
             invocation_statement,
         )
 
+    # ----------------------------------------------------------------------
+    @classmethod
+    @Interface.override
+    def GetInputArrowInfo(cls, arg_name, is_optional, invocation_template):
+        if is_optional:
+            value_type = "Microsoft::Featurizer::Traits<{}>::nullable_type".format(cls.CppType)
+        else:
+            value_type = cls.CppType
+
+        return cls.Result(
+            [
+                "/*in*/ ArrowSchema const *{name}_schema".format(
+                    name=arg_name,
+                ),
+                "/*in*/ ArrowArray const *{name}_array".format(
+                    name=arg_name,
+                ),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_schema == nullptr) throw std::invalid_argument("'{name}_schema' is null");
+                if({name}_array == nullptr) throw std::invalid_argument("'{name}_array' is null");
+
+                std::unique_ptr<{value_type} []> {name}_buffer;
+                auto const {name}_values(Microsoft::Featurizer::Arrow::GetValues(*{name}_schema, *{name}_array, {name}_buffer));
+                """,
+            ).format(
+                name=arg_name,
+                value_type=value_type,
+            ),
+            invocation_template.format(
+                "{name}_values.first, {name}_values.second".format(
+                    name=arg_name,
+                ),
+            ),
+        )
+
     # ----------------------------------------------------------------------
     @classmethod
     @Interface.override
@@ -150,6 +187,37 @@ class _ScalarTypeInfoFactory(TypeInfoFactory):
             "{}{} = {};".format("" if is_struct_member else "*", arg_name, result_name),
         )
 
+    # ----------------------------------------------------------------------
+    @classmethod
+    @Interface.override
+    def GetOutputArrowInfo(
+        cls,
+        arg_name,
+        result_name="result",
+    ):
+        return cls.Result(
+            [
+                "/*out*/ ArrowSchema *{name}_schema".format(
+                    name=arg_name,
+                ),
+                "/*out*/ ArrowArray *{name}_array".format(
+                    name=arg_name,
+                ),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_schema == nullptr) throw std::invalid_argument("'{name}_schema' is null");
+                if({name}_array == nullptr) throw std::invalid_argument("'{name}_array' is null");
+                """,
+            ).format(
+                name=arg_name,
+            ),
+            "{name}_builder.Append({result});".format(
+                name=arg_name,
+                result=result_name,
+            ),
+        )
+
     # ----------------------------------------------------------------------
     @staticmethod
     @Interface.override
@@ -117,6 +117,49 @@ class SparseVectorTypeInfoFactory(TypeInfoFactory):
             ),
         )
 
+    # ----------------------------------------------------------------------
+    @Interface.override
+    def GetOutputBufferInfo(
+        self,
+        arg_name,
+        result_name="result",
+    ):
+        return self.Result(
+            [
+                "/*out*/ {} *{}_values".format(self._type_info.CType, arg_name),
+                "/*out*/ uint64_t *{}_indexes".format(arg_name),
+                "/*in*/ uint64_t {}_capacity".format(arg_name),
+                "/*out*/ uint64_t * {}_numElements".format(arg_name),
+                "/*out*/ uint64_t * {}_numValues".format(arg_name),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_values == nullptr && {name}_capacity != 0) throw std::invalid_argument("'{name}_values' is null");
+                if({name}_indexes == nullptr && {name}_capacity != 0) throw std::invalid_argument("'{name}_indexes' is null");
+                if({name}_numElements == nullptr) throw std::invalid_argument("'{name}_numElements' is null");
+                if({name}_numValues == nullptr) throw std::invalid_argument("'{name}_numValues' is null");
+                """,
+            ).format(
+                name=arg_name,
+            ),
+            textwrap.dedent(
+                """\
+                *{name}_numElements = {result}.NumElements;
+                *{name}_numValues = {result}.Values.size();
+
+                if({result}.Values.size() <= {name}_capacity) {{
+                    for(auto const & encoding : {result}.Values) {{
+                        *{name}_values++ = encoding.Value;
+                        *{name}_indexes++ = encoding.Index;
+                    }}
+                }}
+                """,
+            ).format(
+                name=arg_name,
+                result=result_name,
+            ),
+        )
+
     # ----------------------------------------------------------------------
     @Interface.override
     def GetDestroyOutputInfo(
@@ -132,6 +132,172 @@ class StringTypeInfoFactory(TypeInfoFactory):
             ),
         )
 
+    # ----------------------------------------------------------------------
+    @classmethod
+    @Interface.override
+    def GetInputViewInfo(cls, arg_name, is_optional, invocation_template):
+        if is_optional:
+            validation = ""
+            invocation = invocation_template.format(
+                "{name}_ptr ? std::string({name}_ptr, {name}_length) : nonstd::optional<std::string>()".format(
+                    name=arg_name,
+                ),
+            )
+
+        else:
+            validation = """if({name}_ptr == nullptr && {name}_length != 0) throw std::invalid_argument("'{name}_ptr' is null");""".format(
+                name=arg_name,
+            )
+            invocation = invocation_template.format(
+                "{name}_ptr ? std::string({name}_ptr, {name}_length) : std::string()".format(
+                    name=arg_name,
+                ),
+            )
+
+        return cls.Result(
+            [
+                "/*in*/ char const *{name}_ptr".format(
+                    name=arg_name,
+                ),
+                "/*in*/ std::size_t {name}_length".format(
+                    name=arg_name,
+                ),
+            ],
+            validation,
+            invocation,
+        )
+
+    # ----------------------------------------------------------------------
+    @classmethod
+    @Interface.override
+    def GetInputViewBufferInfo(cls, arg_name, is_optional, invocation_template):
+        # The offsets array contains `items + 1` elements; the string at index `i` is
+        # stored in the range `[data + offsets[i], data + offsets[i + 1])`. Null values
+        # are described by a validity bitmap, where the least significant bit of the
+        # first byte corresponds to the first item and a value of 0 indicates null; a
+        # null bitmap indicates that all values are valid.
+        if is_optional:
+            parameters = [
+                "/*in*/ char const *{name}_data",
+                "/*in*/ std::size_t const *{name}_offsets",
+                "/*in*/ unsigned char const *{name}_validity",
+                "/*in*/ std::size_t {name}_items",
+            ]
+
+            buffer_statements = textwrap.dedent(
+                """\
+                std::vector<nonstd::optional<std::string>> {name}_buffer;
+
+                {name}_buffer.reserve({name}_items);
+
+                for(std::size_t {name}_index = 0; {name}_index < {name}_items; ++{name}_index) {{
+                    if({name}_validity != nullptr && ({name}_validity[{name}_index / 8] & (1 << ({name}_index % 8))) == 0) {{
+                        {name}_buffer.push_back(nonstd::optional<std::string>());
+                        continue;
+                    }}
+
+                    std::size_t const {name}_begin({name}_offsets[{name}_index]);
+                    std::size_t const {name}_end({name}_offsets[{name}_index + 1]);
+
+                    if({name}_end < {name}_begin) throw std::invalid_argument("'{name}_offsets' is not sorted");
+
+                    {name}_buffer.push_back(std::string({name}_data + {name}_begin, {name}_end - {name}_begin));
+                }}
+                """,
+            ).format(
+                name=arg_name,
+            )
+
+        else:
+            parameters = [
+                "/*in*/ char const *{name}_data",
+                "/*in*/ std::size_t const *{name}_offsets",
+                "/*in*/ std::size_t {name}_items",
+            ]
+
+            buffer_statements = textwrap.dedent(
+                """\
+                std::vector<std::string> {name}_buffer;
+
+                {name}_buffer.reserve({name}_items);
+
+                for(std::size_t {name}_index = 0; {name}_index < {name}_items; ++{name}_index) {{
+                    std::size_t const {name}_begin({name}_offsets[{name}_index]);
+                    std::size_t const {name}_end({name}_offsets[{name}_index + 1]);
+
+                    if({name}_end < {name}_begin) throw std::invalid_argument("'{name}_offsets' is not sorted");
+
+                #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
+                    {name}_buffer.push_back(std::string({name}_data + {name}_begin, {name}_end - {name}_begin));
+                #else
+                    {name}_buffer.emplace_back({name}_data + {name}_begin, {name}_end - {name}_begin);
+                #endif
+                }}
+                """,
+            ).format(
+                name=arg_name,
+            )
+
+        return cls.Result(
+            [parameter.format(name=arg_name) for parameter in parameters],
+            textwrap.dedent(
+                """\
+                if({name}_data == nullptr) throw std::invalid_argument("'{name}_data' is null");
+                if({name}_offsets == nullptr) throw std::invalid_argument("'{name}_offsets' is null");
+                if({name}_items == 0) throw std::invalid_argument("'{name}_items' is 0");
+                """,
+            ).format(
+                name=arg_name,
+            ),
+            # The strings are copied once all arguments (including outputs) have
+            # been validated.
+            "{}\n{}".format(
+                buffer_statements,
+                invocation_template.format(
+                    "{name}_buffer.data(), {name}_buffer.size()".format(
+                        name=arg_name,
+                    ),
+                ),
+            ),
+        )
+
+    # ----------------------------------------------------------------------
+    @classmethod
+    @Interface.override
+    def GetInputArrowInfo(cls, arg_name, is_optional, invocation_template):
+        if is_optional:
+            value_type = "nonstd::optional<std::string>"
+        else:
+            value_type = "std::string"
+
+        return cls.Result(
+            [
+                "/*in*/ ArrowSchema const *{name}_schema".format(
+                    name=arg_name,
+                ),
+                "/*in*/ ArrowArray const *{name}_array".format(
+                    name=arg_name,
+                ),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_schema == nullptr) throw std::invalid_argument("'{name}_schema' is null");
+                if({name}_array == nullptr) throw std::invalid_argument("'{name}_array' is null");
+
+                std::unique_ptr<{value_type} []> {name}_buffer;
+                auto const {name}_values(Microsoft::Featurizer::Arrow::GetValues(*{name}_schema, *{name}_array, {name}_buffer));
+                """,
+            ).format(
+                name=arg_name,
+                value_type=value_type,
+            ),
+            invocation_template.format(
+                "{name}_values.first, {name}_values.second".format(
+                    name=arg_name,
+                ),
+            ),
+        )
+
     # ----------------------------------------------------------------------
     @classmethod
     @Interface.override
@@ -183,6 +349,79 @@ class StringTypeInfoFactory(TypeInfoFactory):
             ),
         )
 
+    # ----------------------------------------------------------------------
+    @classmethod
+    @Interface.override
+    def GetOutputBufferInfo(
+        cls,
+        arg_name,
+        result_name="result",
+    ):
+        # Note that the string written to the buffer is not null-terminated
+        return cls.Result(
+            [
+                "/*out*/ char *{name}_ptr".format(
+                    name=arg_name,
+                ),
+                "/*in*/ std::size_t {name}_capacity".format(
+                    name=arg_name,
+                ),
+                "/*out*/ std::size_t *{name}_items".format(
+                    name=arg_name,
+                ),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_ptr == nullptr && {name}_capacity != 0) throw std::invalid_argument("'{name}_ptr' is null");
+                if({name}_items == nullptr) throw std::invalid_argument("'{name}_items' is null");
+                """,
+            ).format(
+                name=arg_name,
+            ),
+            textwrap.dedent(
+                """\
+                *{name}_items = {result_name}.size();
+
+                if({result_name}.size() <= {name}_capacity)
+                    std::copy({result_name}.begin(), {result_name}.end(), {name}_ptr);
+                """,
+            ).format(
+                name=arg_name,
+                result_name=result_name,
+            ),
+        )
+
+    # ----------------------------------------------------------------------
+    @classmethod
+    @Interface.override
+    def GetOutputArrowInfo(
+        cls,
+        arg_name,
+        result_name="result",
+    ):
+        return cls.Result(
+            [
+                "/*out*/ ArrowSchema *{name}_schema".format(
+                    name=arg_name,
+                ),
+                "/*out*/ ArrowArray *{name}_array".format(
+                    name=arg_name,
+                ),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_schema == nullptr) throw std::invalid_argument("'{name}_schema' is null");
+                if({name}_array == nullptr) throw std::invalid_argument("'{name}_array' is null");
+                """,
+            ).format(
+                name=arg_name,
+            ),
+            "{name}_builder.Append({result});".format(
+                name=arg_name,
+                result=result_name,
+            ),
+        )
+
     # ----------------------------------------------------------------------
     @classmethod
     @Interface.override
@@ -95,6 +95,42 @@ class TypeInfoFactory(Interface.Interface):
         """
         raise Exception("Abstract method")
 
+    # ----------------------------------------------------------------------
+    @staticmethod
+    def GetInputViewInfo(arg_name, is_optional, invocation_template):
+        """\
+        Returns information about the type when used as an input argument whose
+        length is provided explicitly (rather than being calculated by the shared
+        library).
+
+        Return `None` if the type doesn't have a variable length.
+        """
+        return None
+
+    # ----------------------------------------------------------------------
+    @staticmethod
+    def GetInputViewBufferInfo(arg_name, is_optional, invocation_template):
+        """\
+        Returns information about the type when used as a buffer input argument
+        where all of the elements are stored in a single contiguous block of
+        memory, delimited by an array of offsets (this is the layout used by
+        Apache Arrow for variable-length data).
+
+        Return `None` if the type doesn't have a variable length.
+        """
+        return None
+
+    # ----------------------------------------------------------------------
+    @staticmethod
+    def GetInputArrowInfo(arg_name, is_optional, invocation_template):
+        """\
+        Returns information about the type when used as a buffer input argument
+        described by the Arrow C Data Interface (`ArrowSchema` and `ArrowArray`).
+
+        Return `None` if the type can't be represented by an Arrow array.
+        """
+        return None
+
     # ----------------------------------------------------------------------
     @staticmethod
     @Interface.abstractmethod
@@ -110,6 +146,47 @@ class TypeInfoFactory(Interface.Interface):
         """
         raise Exception("Abstract method")
 
+    # ----------------------------------------------------------------------
+    @staticmethod
+    def GetOutputBufferInfo(
+        arg_name,
+        result_name="result",
+    ):
+        """\
+        Returns information about the type when used as an output argument whose
+        data is written to memory provided by the caller.
+
+        The caller provides a buffer and its capacity; the required size is always
+        written, but the data is only written when it fits within the buffer (so the
+        caller can query the required size by providing an empty buffer). Note that
+        querying the size performs the full transformation; the result is discarded
+        and produced again when the caller invokes the method with a buffer that is
+        large enough.
+
+        Return `None` if the type doesn't support caller-allocated output (which
+        is the case for types whose output doesn't require explicit destruction).
+        """
+        return None
+
+    # ----------------------------------------------------------------------
+    @staticmethod
+    def GetOutputArrowInfo(
+        arg_name,
+        result_name="result",
+    ):
+        """\
+        Returns information about the type when used as an output argument where
+        all of the results are exported as a single array via the Arrow C Data
+        Interface.
+
+        The invocation statements append `result_name` to `{arg_name}_builder`,
+        which is a `Microsoft::Featurizer::Arrow::ArrayBuilder` created by the
+        caller.
+
+        Return `None` if the type can't be represented by an Arrow array.
+        """
+        return None
+
     # ----------------------------------------------------------------------
     @staticmethod
     @Interface.abstractmethod
@@ -217,6 +217,45 @@ class VectorTypeInfoFactory(TypeInfoFactory):
             ),
         )
 
+    # ----------------------------------------------------------------------
+    @Interface.override
+    def GetOutputBufferInfo(
+        self,
+        arg_name,
+        result_name="result",
+    ):
+        return self.Result(
+            [
+                "/*out*/ {type} *{name}_ptr".format(
+                    type=self._type_info.CType,
+                    name=arg_name,
+                ),
+                "/*in*/ size_t {}_capacity".format(arg_name),
+                "/*out*/ size_t *{}_elements".format(arg_name),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_ptr == nullptr && {name}_capacity != 0) throw std::invalid_argument("'{name}_ptr' is null");
+                if({name}_elements == nullptr) throw std::invalid_argument("'{name}_elements' is null");
+                """,
+            ).format(
+                name=arg_name,
+            ),
+            # TODO: This code is assuming a result type of std::vector (see
+            #       `GetOutputInfo`).
+            textwrap.dedent(
+                """\
+                *{name}_elements = {result_name}.size();
+
+                if({result_name}.size() <= {name}_capacity)
+                    std::move({result_name}.begin(), {result_name}.end(), {name}_ptr);
+                """,
+            ).format(
+                name=arg_name,
+                result_name=result_name,
+            ),
+        )
+
     # ----------------------------------------------------------------------
     @Interface.override
     def GetDestroyOutputInfo(
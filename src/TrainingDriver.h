@@ -0,0 +1,335 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "Featurizer.h"
+#include "MemoryMappedFile.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Microsoft {
+namespace Featurizer {
+
+static constexpr size_t const               DefaultTrainingBatchSize = 64 * 1024;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         TrainingDataSource
+///  \brief         Sequential, replayable source of training data. Sources
+///                 don't need to hold all of the data in memory, which allows
+///                 `Estimators` to be trained on datasets that are larger
+///                 than the available RAM.
+///
+template <typename T>
+class TrainingDataSource {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using InputType                         = T;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    TrainingDataSource(void) = default;
+    virtual ~TrainingDataSource(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TrainingDataSource);
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            rewind
+    ///  \brief         Positions the source at the start of the data.
+    ///
+    virtual void rewind(void) = 0;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            read
+    ///  \brief         Sets `pItems` to the next (at most) `maxNumItems` items and
+    ///                 returns the number of items, or 0 once all of the data has
+    ///                 been read. The items are valid until the next call to `read`
+    ///                 or `rewind`.
+    ///
+    virtual size_t read(T const *&pItems, size_t maxNumItems) = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         MemoryMappedColumnSource
+///  \brief         Reads a binary file that contains a contiguous array of
+///                 values. Items are provided directly from the mapped pages,
+///                 so they aren't copied and the OS is free to evict pages
+///                 that have already been read. For the same reason, the
+///                 values must be stored in the host's byte order (they
+///                 aren't converted); files written by a host with a
+///                 different byte order must be converted before they are
+///                 used.
+///
+template <typename T>
+class MemoryMappedColumnSource : public TrainingDataSource<T> {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    static_assert(std::is_arithmetic<T>::value, "Binary column files can only contain arithmetic values");
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    MemoryMappedColumnSource(std::string const &filename);
+    ~MemoryMappedColumnSource(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MemoryMappedColumnSource);
+
+    size_t get_num_items(void) const;
+
+    void rewind(void) override;
+    size_t read(T const *&pItems, size_t maxNumItems) override;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::unique_ptr<MemoryMappedFile>       _pFile;
+    size_t                                  _offset;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ChunkedReaderSource
+///  \brief         Reads data through caller-provided callbacks into a buffer
+///                 of bounded size; the callbacks can read from a file, a
+///                 database cursor, a network stream, etc.
+///
+template <typename T>
+class ChunkedReaderSource : public TrainingDataSource<T> {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+
+    // Writes up to `maxNumItems` items to `pItems` and returns the number of
+    // items written; returns 0 once all of the data has been read.
+    using ReadFunction                      = std::function<size_t (T *pItems, size_t maxNumItems)>;
+
+    // Positions the reader at the start of the data.
+    using RewindFunction                    = std::function<void (void)>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    ChunkedReaderSource(ReadFunction readFunc, RewindFunction rewindFunc, size_t maxBufferSize=DefaultTrainingBatchSize);
+    ~ChunkedReaderSource(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(ChunkedReaderSource);
+
+    void rewind(void) override;
+    size_t read(T const *&pItems, size_t maxNumItems) override;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    ReadFunction const                      _readFunc;
+    RewindFunction const                    _rewindFunc;
+    size_t const                            _maxBufferSize;
+
+    std::vector<T>                          _buffer;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            TrainEstimator
+///  \brief         Trains the `Estimator` with data read from the source in
+///                 batches of (at most) `batchSize` items. The source is
+///                 rewound and replayed when the `Estimator` returns
+///                 `FitResult::Reset` or requires additional passes over the
+///                 data (for example, a pipeline where an `Estimator` depends
+///                 upon the output of the one before it), so the caller
+///                 doesn't need to buffer the data. An exception is thrown if
+///                 the source doesn't provide any items during a pass and the
+///                 `Estimator` requires another pass (which would never end).
+///
+template <typename EstimatorT>
+void TrainEstimator(EstimatorT &estimator, TrainingDataSource<typename EstimatorT::InputType> &source, size_t batchSize=DefaultTrainingBatchSize);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  MemoryMappedColumnSource
+// |
+// ----------------------------------------------------------------------
+template <typename T>
+MemoryMappedColumnSource<T>::MemoryMappedColumnSource(std::string const &filename) :
+    _pFile(
+        [&filename](void) {
+            std::unique_ptr<MemoryMappedFile>   pFile(new MemoryMappedFile(filename));
+
+            if(pFile->size() % sizeof(T) != 0)
+                throw std::runtime_error("The size of the file '" + filename + "' is not a multiple of the item size");
+
+            return pFile;
+        }()
+    ),
+    _offset(0) {
+}
+
+template <typename T>
+size_t MemoryMappedColumnSource<T>::get_num_items(void) const {
+    return _pFile->size() / sizeof(T);
+}
+
+template <typename T>
+void MemoryMappedColumnSource<T>::rewind(void) /*override*/ {
+    _offset = 0;
+}
+
+template <typename T>
+size_t MemoryMappedColumnSource<T>::read(T const *&pItems, size_t maxNumItems) /*override*/ {
+    size_t const                            cItems(std::min(maxNumItems, get_num_items() - _offset));
+
+    if(cItems == 0) {
+        pItems = nullptr;
+        return 0;
+    }
+
+    // The mapping starts on a page boundary, so the items are properly aligned
+    pItems = reinterpret_cast<T const *>(_pFile->data()) + _offset;
+    _offset += cItems;
+
+    return cItems;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  ChunkedReaderSource
+// |
+// ----------------------------------------------------------------------
+template <typename T>
+ChunkedReaderSource<T>::ChunkedReaderSource(ReadFunction readFunc, RewindFunction rewindFunc, size_t maxBufferSize) :
+    _readFunc(
+        [&readFunc](void) -> ReadFunction & {
+            if(!readFunc)
+                throw std::invalid_argument("readFunc");
+
+            return readFunc;
+        }()
+    ),
+    _rewindFunc(
+        [&rewindFunc](void) -> RewindFunction & {
+            if(!rewindFunc)
+                throw std::invalid_argument("rewindFunc");
+
+            return rewindFunc;
+        }()
+    ),
+    _maxBufferSize(
+        [&maxBufferSize](void) -> size_t {
+            if(maxBufferSize == 0)
+                throw std::invalid_argument("maxBufferSize");
+
+            return maxBufferSize;
+        }()
+    ) {
+}
+
+template <typename T>
+void ChunkedReaderSource<T>::rewind(void) /*override*/ {
+    _rewindFunc();
+}
+
+template <typename T>
+size_t ChunkedReaderSource<T>::read(T const *&pItems, size_t maxNumItems) /*override*/ {
+    size_t const                            cMaxItems(std::min(maxNumItems, _maxBufferSize));
+
+    if(_buffer.size() < cMaxItems)
+        _buffer.resize(cMaxItems);
+
+    size_t const                            cItems(_readFunc(_buffer.data(), cMaxItems));
+
+    if(cItems > cMaxItems)
+        throw std::runtime_error("The reader returned more items than requested");
+
+    pItems = cItems ? _buffer.data() : nullptr;
+    return cItems;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  TrainEstimator
+// |
+// ----------------------------------------------------------------------
+template <typename EstimatorT>
+void TrainEstimator(EstimatorT &estimator, TrainingDataSource<typename EstimatorT::InputType> &source, size_t batchSize) {
+    // ----------------------------------------------------------------------
+    using InputType                         = typename EstimatorT::InputType;
+    // ----------------------------------------------------------------------
+
+    if(batchSize == 0)
+        throw std::invalid_argument("batchSize");
+
+    estimator.begin_training();
+
+    if(estimator.get_state() == TrainingState::Training)
+        source.rewind();
+
+    bool                                    hasItems(false);
+
+    while(estimator.get_state() == TrainingState::Training) {
+        InputType const *                   pItems(nullptr);
+        size_t const                        cItems(source.read(pItems, batchSize));
+
+        if(cItems == 0) {
+            // The `Estimator` remains in the Training state when it requires
+            // another pass over the data.
+            estimator.on_data_completed();
+
+            if(estimator.get_state() == TrainingState::Training) {
+                if(hasItems == false)
+                    throw std::runtime_error("The source didn't provide any items, but the estimator requires another pass over the data");
+
+                source.rewind();
+                hasItems = false;
+            }
+
+            continue;
+        }
+
+        hasItems = true;
+
+        if(estimator.fit(pItems, cItems) == FitResult::Reset)
+            source.rewind();
+    }
+
+    estimator.complete_training();
+}
+
+} // namespace Featurizer
+} // namespace Microsoft
@@ -847,7 +847,7 @@ struct Traits<std::string> : public TraitsImpl<std::string> {
         std::uint32_t const                 size(ar.template deserialize<std::uint32_t>());
 
         if(size != 0) {
-            char const * const     pBuffer(reinterpret_cast<char const *>(ar.get_buffer_ptr()));
+            char const * const     pBuffer(reinterpret_cast<char const *>(ar.get_buffer_ptr(size)));
 
             ar.update_buffer_ptr(size);
 
@@ -860,6 +860,41 @@ struct Traits<std::string> : public TraitsImpl<std::string> {
 
 namespace {
 
+/////////////////////////////////////////////////////////////////////////
+///  \struct        IsBulkSerializable
+///  \brief         Types whose serialized representation is the same as their
+///                 in-memory representation on little-endian hosts; contiguous
+///                 ranges of these types are serialized with a single copy.
+///
+template <typename T>
+struct IsBulkSerializable : public std::integral_constant<bool, std::is_arithmetic<T>::value && std::is_same<T, bool>::value == false> {};
+
+template <typename ArchiveT, typename T>
+void SerializeItems(ArchiveT &ar, T const *pItems, size_t cItems, std::true_type) {
+    ar.serialize_items(pItems, cItems);
+}
+
+template <typename ArchiveT, typename T>
+void SerializeItems(ArchiveT &ar, T const *pItems, size_t cItems, std::false_type) {
+    T const * const                         pEndItems(pItems + cItems);
+
+    while(pItems != pEndItems)
+        Traits<T>::serialize(ar, *pItems++);
+}
+
+template <typename ArchiveT, typename T>
+void DeserializeItems(ArchiveT &ar, T *pItems, size_t cItems, std::true_type) {
+    ar.deserialize_items(pItems, cItems);
+}
+
+template <typename ArchiveT, typename T>
+void DeserializeItems(ArchiveT &ar, T *pItems, size_t cItems, std::false_type) {
+    T * const                               pEndItems(pItems + cItems);
+
+    while(pItems != pEndItems)
+        *pItems++ = Traits<T>::deserialize(ar);
+}
+
 template <typename T>
 std::string ToStringImpl(T const *pBuffer, size_t cBuffer) {
     std::ostringstream streamObj;
@@ -895,10 +930,7 @@ struct Traits<std::array<T, ArrayV>> : public TraitsImpl<std::array<T, ArrayV>>
 
     template <typename ArchiveT>
     static ArchiveT & serialize(ArchiveT &ar, std::array<T, ArrayV> const &value) {
-        for(auto const &item : value) {
-            Traits<T>::serialize(ar, item);
-        }
-
+        SerializeItems(ar, value.data(), value.size(), IsBulkSerializable<T>());
         return ar;
     }
 
@@ -906,10 +938,7 @@ struct Traits<std::array<T, ArrayV>> : public TraitsImpl<std::array<T, ArrayV>>
     static std::array<T, ArrayV> deserialize(ArchiveT &ar) {
         std::array<T, ArrayV>               result;
 
-        for(auto &item : result) {
-            item = Traits<T>::deserialize(ar);
-        }
-
+        DeserializeItems(ar, result.data(), result.size(), IsBulkSerializable<T>());
         return result;
     }
 };
@@ -929,17 +958,41 @@ struct Traits<std::vector<T, AllocatorT>> : public TraitsImpl<std::vector<T, All
     static ArchiveT & serialize(ArchiveT &ar, std::vector<T, AllocatorT> const &value) {
         ar.serialize(static_cast<std::uint32_t>(value.size()));
 
+        serialize_impl(ar, value, IsBulkSerializable<T>());
+        return ar;
+    }
+
+    template <typename ArchiveT>
+    static std::vector<T, AllocatorT> deserialize(ArchiveT &ar) {
+        std::uint32_t const                 size(ar.template deserialize<std::uint32_t>());
+
+        return deserialize_impl(ar, size, IsBulkSerializable<T>());
+    }
+
+private:
+    template <typename ArchiveT>
+    static void serialize_impl(ArchiveT &ar, std::vector<T, AllocatorT> const &value, std::true_type) {
+        SerializeItems(ar, value.data(), value.size(), std::true_type());
+    }
+
+    template <typename ArchiveT>
+    static void serialize_impl(ArchiveT &ar, std::vector<T, AllocatorT> const &value, std::false_type) {
         for(auto const &item: value) {
             Traits<T>::serialize(ar, item);
         }
+    }
 
-        return ar;
+    template <typename ArchiveT>
+    static std::vector<T, AllocatorT> deserialize_impl(ArchiveT &ar, std::uint32_t size, std::true_type) {
+        std::vector<T, AllocatorT>          result(size);
+
+        DeserializeItems(ar, result.data(), result.size(), std::true_type());
+        return result;
     }
 
     template <typename ArchiveT>
-    static std::vector<T, AllocatorT> deserialize(ArchiveT &ar) {
+    static std::vector<T, AllocatorT> deserialize_impl(ArchiveT &ar, std::uint32_t size, std::false_type) {
         std::vector<T, AllocatorT>          result;
-        std::uint32_t                       size(ar.template deserialize<std::uint32_t>());
 
         if(size != 0) {
             result.reserve(size);
@@ -1141,12 +1194,8 @@ struct Traits<ColMajMatrix<T>> : public TraitsImpl<ColMajMatrix<T>> {
         ar.serialize(static_cast<typename MatrixT::Index>(value.rows()));
         ar.serialize(static_cast<typename MatrixT::Index>(value.cols()));
 
-        for(typename MatrixT::Index colId = 0; colId < value.cols(); ++colId) {
-            for(typename MatrixT::Index rowId = 0; rowId < value.rows(); ++rowId) {
-                Traits<typename MatrixT::Scalar>::serialize(ar, value(rowId, colId));
-            }
-        }
-
+        // Values are written in column-major order, which is the storage order
+        SerializeItems(ar, value.data(), static_cast<size_t>(value.size()), IsBulkSerializable<T>());
         return ar;
     }
 
@@ -1159,12 +1208,7 @@ struct Traits<ColMajMatrix<T>> : public TraitsImpl<ColMajMatrix<T>> {
 
         MatrixT                                 result(numRows, numCols);
 
-        for(typename MatrixT::Index colId = 0; colId < numCols; ++colId) {
-            for(typename MatrixT::Index rowId = 0; rowId < numRows; ++rowId) {
-                result(rowId, colId) = Traits<typename MatrixT::Scalar>::deserialize(ar);
-            }
-        }
-
+        DeserializeItems(ar, result.data(), static_cast<size_t>(result.size()), IsBulkSerializable<T>());
         return result;
     }
 };
@@ -1187,12 +1231,8 @@ struct Traits<RowMajMatrix<T>> : public TraitsImpl<RowMajMatrix<T>> {
         ar.serialize(static_cast<typename MatrixT::Index>(value.rows()));
         ar.serialize(static_cast<typename MatrixT::Index>(value.cols()));
 
-        for(typename MatrixT::Index rowId = 0; rowId < value.rows(); ++rowId) {
-            for(typename MatrixT::Index colId = 0; colId < value.cols(); ++colId) {
-                Traits<typename MatrixT::Scalar>::serialize(ar, value(rowId, colId));
-                }
-            }
-
+        // Values are written in row-major order, which is the storage order
+        SerializeItems(ar, value.data(), static_cast<size_t>(value.size()), IsBulkSerializable<T>());
         return ar;
     }
 
@@ -1205,12 +1245,7 @@ struct Traits<RowMajMatrix<T>> : public TraitsImpl<RowMajMatrix<T>> {
 
         MatrixT                                 result(numRows, numCols);
 
-        for(typename MatrixT::Index rowId = 0; rowId < numRows; ++rowId) {
-            for(typename MatrixT::Index colId = 0; colId < numCols; ++colId) {
-                result(rowId, colId) = Traits<typename MatrixT::Scalar>::deserialize(ar);
-                }
-            }
-
+        DeserializeItems(ar, result.data(), static_cast<size_t>(result.size()), IsBulkSerializable<T>());
         return result;
      }
 };
@@ -6,6 +6,9 @@
 #include "catch.hpp"
 
 #include "../Archive.h"
+#include "../FileArchive.h"
+
+#include <cstdio>
 
 namespace NS                                = Microsoft::Featurizer;
 
@@ -130,3 +133,174 @@ TEST_CASE("Serialization_Based_On_Endianess") {
     CHECK(SerializeOnly(static_cast<std::double_t>(-23)) == expected_result);
     CHECK(SerializeOnly(static_cast<std::float_t>(-23)) == expected_result);
 }
+
+TEST_CASE("Items") {
+    std::vector<std::uint32_t> const        values{1, 2, 0xFFFFFFFF, 3};
+
+    NS::Archive                             bulk;
+    NS::Archive                             individual;
+
+    bulk.serialize_items(values.data(), values.size());
+
+    for(auto const &value : values)
+        individual.serialize(value);
+
+    NS::Archive::ByteArray const            buffer(bulk.commit());
+
+    CHECK(buffer == individual.commit());
+
+    NS::Archive                             in(buffer);
+    std::vector<std::uint32_t>              other(values.size());
+
+    in.deserialize_items(other.data(), other.size());
+    CHECK(other == values);
+    CHECK(in.AtEnd());
+
+    NS::Archive                             in2(buffer);
+    std::vector<std::uint32_t>              tooLarge(values.size() + 1);
+
+    CHECK_THROWS_WITH(in2.deserialize_items(tooLarge.data(), tooLarge.size()), "Invalid buffer");
+}
+
+TEST_CASE("Serialize") {
+    NS::Archive::ByteArray const            buffer(
+        NS::Archive::Serialize(
+            [](NS::Archive &ar) {
+                ar.serialize(static_cast<std::uint16_t>(10));
+                NS::Traits<std::string>::serialize(ar, std::string("Hello"));
+                ar.serialize(true);
+            }
+        )
+    );
+
+    CHECK(buffer.size() == sizeof(std::uint16_t) + sizeof(std::uint32_t) + 5 + sizeof(bool));
+
+    NS::Archive                             in(buffer);
+
+    CHECK(in.deserialize<std::uint16_t>() == 10);
+    CHECK(NS::Traits<std::string>::deserialize(in) == "Hello");
+    CHECK(in.deserialize<bool>() == true);
+    CHECK(in.AtEnd());
+}
+
+void SerializeStreamingData(NS::Archive &ar) {
+    ar.serialize(static_cast<std::uint16_t>(10));
+    NS::Traits<std::string>::serialize(ar, std::string("This string is longer than the chunk size"));
+    NS::Traits<std::vector<std::uint32_t>>::serialize(ar, std::vector<std::uint32_t>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+    ar.serialize(true);
+}
+
+void DeserializeStreamingData(NS::Archive &ar) {
+    CHECK(ar.deserialize<std::uint16_t>() == 10);
+    CHECK(NS::Traits<std::string>::deserialize(ar) == "This string is longer than the chunk size");
+    CHECK(NS::Traits<std::vector<std::uint32_t>>::deserialize(ar) == std::vector<std::uint32_t>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+    CHECK(ar.deserialize<bool>() == true);
+    CHECK(ar.AtEnd());
+}
+
+TEST_CASE("Streaming") {
+    NS::Archive                             expectedArchive;
+
+    SerializeStreamingData(expectedArchive);
+
+    NS::Archive::ByteArray const            expected(expectedArchive.commit());
+
+    NS::Archive::ByteArray                  streamed;
+    size_t                                  cChunks(0);
+    NS::Archive                             out(
+        NS::Archive::SinkFunc(
+            [&streamed, &cChunks](unsigned char const *pBuffer, size_t cbBuffer) {
+                streamed.insert(streamed.end(), pBuffer, pBuffer + cbBuffer);
+                ++cChunks;
+            }
+        ),
+        8
+    );
+
+    SerializeStreamingData(out);
+
+    // The final chunk isn't written until the archive is committed
+    CHECK(streamed.size() < expected.size());
+    CHECK(out.commit().empty());
+    CHECK(streamed == expected);
+    CHECK(cChunks > 1);
+
+    // Read the data a few bytes at a time
+    size_t                                  offset(0);
+    NS::Archive                             in(
+        NS::Archive::SourceFunc(
+            [&expected, &offset](unsigned char *pBuffer, size_t cbBuffer) {
+                size_t const                cbRead(std::min(std::min(cbBuffer, static_cast<size_t>(3)), expected.size() - offset));
+
+                std::copy(expected.begin() + static_cast<std::ptrdiff_t>(offset), expected.begin() + static_cast<std::ptrdiff_t>(offset + cbRead), pBuffer);
+                offset += cbRead;
+
+                return cbRead;
+            }
+        ),
+        8
+    );
+
+    DeserializeStreamingData(in);
+    CHECK_THROWS_WITH(in.deserialize<std::uint8_t>(), "Invalid buffer");
+
+    CHECK_THROWS_WITH(NS::Archive(NS::Archive::SinkFunc()), "Invalid sink");
+    CHECK_THROWS_WITH(NS::Archive(NS::Archive::SourceFunc()), "Invalid source");
+    CHECK_THROWS_WITH(NS::Archive(NS::Archive::SinkFunc([](unsigned char const *, size_t) {}), 0), "Invalid chunk size");
+}
+
+TEST_CASE("Streaming - file") {
+    char const * const                      filename("Archive_UnitTest_Streaming.bin");
+
+    {
+        NS::Archive                         out(NS::CreateFileSerializingArchive(filename, NS::Archive::LayoutValue::Standard, 8));
+
+        SerializeStreamingData(out);
+        out.commit();
+    }
+
+    {
+        NS::Archive                         in(NS::CreateFileDeserializingArchive(filename, 8));
+
+        DeserializeStreamingData(in);
+    }
+
+    std::remove(filename);
+
+    CHECK_THROWS_WITH(NS::CreateFileDeserializingArchive(filename), "The file 'Archive_UnitTest_Streaming.bin' could not be opened");
+}
+
+TEST_CASE("SerializeToFile") {
+    char const * const                      filename("Archive_UnitTest_SerializeToFile.bin");
+
+    NS::SerializeToFile(
+        filename,
+        [](NS::Archive &ar) {
+            SerializeStreamingData(ar);
+        },
+        NS::Archive::LayoutValue::Standard,
+        8
+    );
+
+    // An error while serializing leaves the existing file untouched
+    CHECK_THROWS_WITH(
+        NS::SerializeToFile(
+            filename,
+            [](NS::Archive &ar) {
+                ar.serialize(std::uint32_t(1));
+                throw std::runtime_error("Failure");
+            }
+        ),
+        "Failure"
+    );
+
+    {
+        NS::Archive                         in(NS::CreateFileDeserializingArchive(filename, 8));
+
+        DeserializeStreamingData(in);
+    }
+
+    CHECK_THROWS(NS::CreateFileDeserializingArchive(std::string(filename) + ".tmp"));
+
+    std::remove(filename);
+}
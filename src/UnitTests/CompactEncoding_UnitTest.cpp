@@ -0,0 +1,123 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../CompactEncoding.h"
+
+#include <unordered_map>
+
+namespace NS = Microsoft::Featurizer;
+
+size_t VarintSize(std::uint64_t value) {
+    NS::Archive                             out;
+
+    NS::SerializeVarint(out, value);
+
+    NS::Archive::ByteArray const            buffer(out.commit());
+    NS::Archive                             in(buffer);
+
+    CHECK(NS::DeserializeVarint(in) == value);
+    CHECK(in.AtEnd());
+
+    return buffer.size();
+}
+
+template <typename KeyT>
+NS::Archive::ByteArray TestRoundtrip(std::unordered_map<KeyT, std::uint32_t> const &map) {
+    NS::Archive                             out;
+
+    NS::SerializeCompactIndexMap(out, map);
+
+    NS::Archive::ByteArray                  buffer(out.commit());
+    NS::Archive                             in(buffer);
+
+    CHECK(NS::DeserializeCompactIndexMap<std::unordered_map<KeyT, std::uint32_t>>(in) == map);
+    CHECK(in.AtEnd());
+
+    return buffer;
+}
+
+TEST_CASE("Varint") {
+    CHECK(VarintSize(0) == 1);
+    CHECK(VarintSize(127) == 1);
+    CHECK(VarintSize(128) == 2);
+    CHECK(VarintSize(16383) == 2);
+    CHECK(VarintSize(16384) == 3);
+    CHECK(VarintSize(std::numeric_limits<std::uint32_t>::max()) == 5);
+    CHECK(VarintSize(std::numeric_limits<std::uint64_t>::max()) == 10);
+
+    // Too many bytes
+    NS::Archive::ByteArray const            invalid{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F};
+    NS::Archive                             in(invalid);
+
+    CHECK_THROWS_WITH(NS::DeserializeVarint(in), "Invalid varint");
+}
+
+TEST_CASE("String keys") {
+    TestRoundtrip(std::unordered_map<std::string, std::uint32_t>());
+    TestRoundtrip(std::unordered_map<std::string, std::uint32_t>{{"", 0}});
+
+    std::unordered_map<std::string, std::uint32_t>  map;
+    NS::Archive                                     standardOut;
+
+    for(std::uint32_t index = 0; index < 1000; ++index)
+        map.emplace("prefix_" + std::to_string(index), index);
+
+    NS::Traits<decltype(map)>::serialize(standardOut, map);
+
+    // Front coding removes the common prefixes and the values are deltas
+    CHECK(TestRoundtrip(map).size() * 3 < standardOut.commit().size());
+
+    // Values that aren't dense
+    TestRoundtrip(std::unordered_map<std::string, std::uint32_t>{{"a", 100}, {"b", 3}, {"c", std::numeric_limits<std::uint32_t>::max()}});
+}
+
+TEST_CASE("Integer keys") {
+    TestRoundtrip(std::unordered_map<std::int8_t, std::uint32_t>{{-128, 0}, {0, 1}, {127, 2}});
+    TestRoundtrip(std::unordered_map<std::uint8_t, std::uint32_t>{{0, 0}, {255, 1}});
+    TestRoundtrip(
+        std::unordered_map<std::int64_t, std::uint32_t>{
+            {std::numeric_limits<std::int64_t>::min(), 0},
+            {-1, 1},
+            {std::numeric_limits<std::int64_t>::max(), 2}
+        }
+    );
+    TestRoundtrip(std::unordered_map<std::uint64_t, std::uint32_t>{{0, 0}, {std::numeric_limits<std::uint64_t>::max(), 1}});
+
+    // Sorted keys are written as deltas
+    CHECK(TestRoundtrip(std::unordered_map<std::int32_t, std::uint32_t>{{1000, 0}, {1001, 1}, {1002, 2}}).size() < 12);
+}
+
+TEST_CASE("Other keys") {
+    TestRoundtrip(std::unordered_map<double, std::uint32_t>{{1.5, 0}, {-2.5, 1}});
+    TestRoundtrip(std::unordered_map<bool, std::uint32_t>{{true, 0}, {false, 1}});
+}
+
+TEST_CASE("Invalid data") {
+    // Prefix is longer than the previous key
+    NS::Archive::ByteArray const            invalidPrefix{1, 1, 1, 'a', 0};
+    NS::Archive                             prefixIn(invalidPrefix);
+
+    CHECK_THROWS_WITH((NS::DeserializeCompactIndexMap<std::unordered_map<std::string, std::uint32_t>>(prefixIn)), "Invalid prefix");
+
+    // Duplicate key
+    NS::Archive::ByteArray const            duplicateKey{2, 0, 1, 'a', 0, 1, 0, 0};
+    NS::Archive                             duplicateIn(duplicateKey);
+
+    CHECK_THROWS_WITH((NS::DeserializeCompactIndexMap<std::unordered_map<std::string, std::uint32_t>>(duplicateIn)), "Invalid key");
+
+    // Negative value
+    NS::Archive::ByteArray const            negativeValue{1, 0, 1, 'a', 1};
+    NS::Archive                             negativeIn(negativeValue);
+
+    CHECK_THROWS_WITH((NS::DeserializeCompactIndexMap<std::unordered_map<std::string, std::uint32_t>>(negativeIn)), "Invalid value");
+
+    // Item count that is far larger than the data (which must not be used to reserve memory)
+    NS::Archive::ByteArray const            hugeCount{0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0, 1, 'a', 0};
+    NS::Archive                             hugeCountIn(hugeCount);
+
+    CHECK_THROWS_WITH((NS::DeserializeCompactIndexMap<std::unordered_map<std::string, std::uint32_t>>(hugeCountIn)), "Invalid buffer");
+}
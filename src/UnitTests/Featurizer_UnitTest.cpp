@@ -6,8 +6,12 @@
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
 
+#include "../Archive.h"
 #include "../Featurizer.h"
 
+#include <atomic>
+#include <thread>
+
 // ----------------------------------------------------------------------
 using Microsoft::Featurizer::AnnotationPtr;
 using Microsoft::Featurizer::AnnotationMaps;
@@ -91,6 +95,163 @@ TEST_CASE("Estimator") {
     CHECK_THROWS_WITH(estimator.get_annotation(99999), "colIndex");
 }
 
+class MyDerivedAnnotation : public MyAnnotation {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    MyDerivedAnnotation(int state) :
+        MyAnnotation(state) {
+    }
+
+    ~MyDerivedAnnotation(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MyDerivedAnnotation);
+};
+
+TEST_CASE("AnnotationMap - typed lookup") {
+    NS::AnnotationMap                       annotations;
+
+    CHECK(annotations.get_typed<MyAnnotation>("Estimator1") == nullptr);
+
+    annotations.publish("Estimator1", std::make_shared<MyAnnotation>(1));
+    annotations.publish("Estimator2", std::make_shared<MyAnnotation>(2));
+    annotations.publish("Estimator2", std::make_shared<MyAnnotation>(3));
+    annotations.publish("Estimator3", std::make_shared<MyDerivedAnnotation>(4));
+    annotations.publish("Estimator4", AnnotationPtr(std::make_shared<MyAnnotation>(5)));
+
+    CHECK(annotations.size() == 4);
+
+    // Names are compared by value rather than by pointer
+    std::string const                       name("Estimator2");
+
+    REQUIRE(annotations.get_typed<MyAnnotation>(name.c_str()));
+    CHECK(annotations.get_typed<MyAnnotation>(name.c_str())->State == 2);
+    CHECK(annotations.get_typed<MyAnnotation>("Estimator1")->State == 1);
+
+    // Typed lookup only matches the exact type that was published
+    CHECK(annotations.get_typed<MyDerivedAnnotation>("Estimator1") == nullptr);
+    CHECK(annotations.get_typed<MyAnnotation>("Estimator3") == nullptr);
+    CHECK(annotations.get_typed<MyDerivedAnnotation>("Estimator3")->State == 4);
+    CHECK(annotations.get_typed<MyAnnotation>("Estimator4") == nullptr);
+    CHECK(annotations.get_typed<MyAnnotation>("Estimator5") == nullptr);
+
+    // `Estimator::get_annotation_impl` falls back to RTTI for these cases
+    AnnotationMapsPtr const                 pAllAnnotations(CreateTestAnnotationMapsPtr(1));
+
+    MyEstimator("Estimator4", pAllAnnotations).add_annotation(0, 5);
+
+    (*pAllAnnotations)[0].publish("Estimator5", std::make_shared<MyDerivedAnnotation>(6));
+
+    CHECK(MyEstimator("Estimator4", pAllAnnotations).get_annotation(0)->State == 5);
+    CHECK(MyEstimator("Estimator5", pAllAnnotations).get_annotation(0)->State == 6);
+
+    CHECK_THROWS_WITH(annotations.publish("", std::make_shared<MyAnnotation>(1)), "name");
+    CHECK_THROWS_WITH(annotations.publish("Estimator1", std::shared_ptr<MyAnnotation>()), "pAnnotation");
+}
+
+TEST_CASE("AnnotationMap - released snapshots") {
+    NS::AnnotationMap                       annotations;
+
+    annotations.publish("Estimator1", std::make_shared<MyAnnotation>(1));
+
+    NS::AnnotationMap::SnapshotPtr          pHeld(annotations.snapshot());
+
+    annotations.publish("Estimator2", std::make_shared<MyAnnotation>(2));
+
+    // Replaced snapshots are released unless a reader holds them
+    std::weak_ptr<NS::AnnotationMap::Snapshot const>    pReleased(annotations.snapshot());
+
+    CHECK(pReleased.expired() == false);
+
+    annotations.publish("Estimator3", std::make_shared<MyAnnotation>(3));
+
+    CHECK(pReleased.expired());
+
+    // Held snapshots don't change
+    CHECK(pHeld->size() == 1);
+    CHECK(annotations.size() == 3);
+
+    pReleased = pHeld;
+    pHeld.reset();
+
+    CHECK(pReleased.expired());
+
+    // `Annotations` retrieved from replaced versions remain valid
+    CHECK(annotations.get_typed<MyAnnotation>("Estimator1")->State == 1);
+}
+
+TEST_CASE("AnnotationMap - released snapshots with active readers") {
+    NS::AnnotationMap                       annotations;
+    std::atomic<bool>                       isDone(false);
+
+    annotations.publish("Estimator1", std::make_shared<MyAnnotation>(1));
+
+    // Versions replaced while readers are active can't be released by `publish`...
+    std::thread                             reader(
+        [&annotations, &isDone](void) {
+            while(isDone == false)
+                annotations.get_typed<MyAnnotation>("Estimator1");
+        }
+    );
+
+    std::vector<std::weak_ptr<NS::AnnotationMap::Snapshot const>>      replaced;
+
+    for(int i = 0; i < 1000; ++i) {
+        replaced.emplace_back(annotations.snapshot());
+        annotations.publish("Estimator2", std::make_shared<MyAnnotation>(i));
+    }
+
+    isDone = true;
+    reader.join();
+
+    // ...but are released once there aren't any active readers
+    CHECK(annotations.get_typed<MyAnnotation>("Estimator1")->State == 1);
+
+    for(auto const &pReplaced : replaced)
+        CHECK(pReplaced.expired());
+}
+
+TEST_CASE("Estimator - concurrent annotations") {
+    AnnotationMapsPtr const                 pAllAnnotations(CreateTestAnnotationMapsPtr(2));
+    char const * const                      names[] = { "Estimator0", "Estimator1", "Estimator2", "Estimator3" };
+    std::vector<std::thread>                threads;
+    std::atomic<bool>                       isValid(true);
+
+    // A snapshot is not modified when Annotations are published
+    NS::AnnotationMap::SnapshotPtr const    pInitialSnapshot((*pAllAnnotations)[0].snapshot());
+
+    for(int threadIndex = 0; threadIndex < 4; ++threadIndex) {
+        threads.emplace_back(
+            [&pAllAnnotations, &names, &isValid, threadIndex](void) {
+                MyEstimator const           estimator(names[threadIndex], pAllAnnotations);
+
+                for(int i = 0; i < 100; ++i) {
+                    estimator.add_annotation(static_cast<size_t>(i % 2), threadIndex * 1000 + i);
+
+                    // The first Annotation for this Estimator is always returned
+                    MyAnnotation const * const      pAnnotation(estimator.get_annotation(0));
+
+                    if(pAnnotation == nullptr || pAnnotation->State != threadIndex * 1000)
+                        isValid = false;
+                }
+            }
+        );
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    CHECK(isValid);
+    CHECK(pInitialSnapshot->empty());
+
+    for(auto const &columnAnnotations : *pAllAnnotations) {
+        CHECK(columnAnnotations.size() == 4);
+
+        for(auto const &kvp : *columnAnnotations.snapshot())
+            CHECK(kvp.second.size() == 50);
+    }
+}
+
 class MyFitEstimator : public Microsoft::Featurizer::FitEstimator<int> {
 public:
     // ----------------------------------------------------------------------
@@ -290,3 +451,165 @@ TEST_CASE("TransformerEstimator") {
 
     CHECK_THROWS_WITH(MyTransformerEstimator(true, true).create_transformer(), "Invalid result");
 }
+
+TEST_CASE("Transformer - batch execute") {
+    MyTransformerEstimator::MyTransformer   transformer;
+    int const                               inputs[] = { 1, 2, 3, 4, 5 };
+    bool                                    outputs[5];
+
+    transformer.execute(inputs, 5, outputs);
+
+    CHECK(outputs[0] == true);
+    CHECK(outputs[1] == false);
+    CHECK(outputs[2] == true);
+    CHECK(outputs[3] == false);
+    CHECK(outputs[4] == true);
+
+    CHECK_THROWS_WITH(transformer.execute(static_cast<int const *>(nullptr), 5, outputs), "pInputs");
+    CHECK_THROWS_WITH(transformer.execute(inputs, 0, outputs), "cInputs");
+    CHECK_THROWS_WITH(transformer.execute(inputs, 5, static_cast<bool *>(nullptr)), "pOutputs");
+}
+
+class MyDuplicatingTransformer : public Microsoft::Featurizer::Transformer<int, int> {
+public:
+    MyDuplicatingTransformer(void) = default;
+    ~MyDuplicatingTransformer(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MyDuplicatingTransformer);
+
+    void save(Microsoft::Featurizer::Archive &) const override {
+        // Nothing to do here
+    }
+
+private:
+    void execute_impl(int const &value, CallbackFunction const &callback) override {
+        callback(value);
+        callback(value);
+    }
+
+    void flush_impl(CallbackFunction const &) override {
+    }
+};
+
+TEST_CASE("Transformer - batch execute with multiple outputs") {
+    MyDuplicatingTransformer                transformer;
+    int const                               inputs[] = { 1, 2 };
+    int                                     outputs[2];
+
+    CHECK_THROWS_WITH(transformer.execute(inputs, 2, outputs), "This method should only be used with Transformers that generate 1 output value for each input value");
+}
+
+TEST_CASE("Transformer - invalid callback") {
+    MyTransformerEstimator::MyTransformer   transformer;
+
+    CHECK_THROWS_WITH(transformer.execute(1, MyTransformerEstimator::MyTransformer::CallbackFunction()), "callback");
+    CHECK_THROWS_WITH(transformer.flush(MyTransformerEstimator::MyTransformer::CallbackFunction()), "callback");
+}
+
+class MyOffsetTransformer : public Microsoft::Featurizer::StandardTransformer<int, int> {
+public:
+    int const                               Offset;
+
+    MyOffsetTransformer(int offset) : Offset(offset) {}
+    MyOffsetTransformer(Microsoft::Featurizer::Archive &ar) : Offset(NS::Traits<int>::deserialize(ar)) {}
+    ~MyOffsetTransformer(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MyOffsetTransformer);
+
+    void save(Microsoft::Featurizer::Archive &ar) const override {
+        NS::Traits<int>::serialize(ar, Offset);
+    }
+
+private:
+    void execute_impl(int const &value, CallbackFunction const &callback) override {
+        callback(value + Offset);
+    }
+};
+
+TEST_CASE("Transformer - is_stateless") {
+    // StandardTransformers must opt in to concurrent execution
+    CHECK(MyTransformerEstimator::MyTransformer().is_stateless() == false);
+    CHECK(MyOffsetTransformer(10).is_stateless() == false);
+}
+
+TEST_CASE("Transformer - clone") {
+    // Cloning isn't supported by default...
+    CHECK(!MyTransformerEstimator::MyTransformer().clone());
+
+    // ...so the Transformer is saved and restored instead
+    MyOffsetTransformer                     transformer(10);
+    std::unique_ptr<MyOffsetTransformer>    pClone(NS::CloneTransformer(transformer));
+
+    CHECK(pClone->Offset == 10);
+    CHECK(pClone->execute(1) == 11);
+}
+
+struct CopyCountingType {
+    static int                              NumCopies;
+
+    int                                     Value;
+
+    CopyCountingType(int value) : Value(value) {}
+    CopyCountingType(CopyCountingType const &other) : Value(other.Value) { ++NumCopies; }
+    CopyCountingType(CopyCountingType &&) = default;
+};
+
+int CopyCountingType::NumCopies = 0;
+
+class MyCallbackTransformer : public Microsoft::Featurizer::StandardTransformer<CopyCountingType, CopyCountingType> {
+public:
+    MyCallbackTransformer(void) = default;
+    ~MyCallbackTransformer(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MyCallbackTransformer);
+
+    void save(Microsoft::Featurizer::Archive &) const override {
+        // Nothing to do here
+    }
+
+private:
+    void execute_impl(CopyCountingType const &value, CallbackFunction const &callback) override {
+        if(value.Value >= 0)
+            callback(CopyCountingType(value.Value * 2));
+    }
+};
+
+class MyDirectTransformer : public MyCallbackTransformer {
+public:
+    MyDirectTransformer(void) = default;
+    ~MyDirectTransformer(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MyDirectTransformer);
+
+private:
+    CopyCountingType transform_impl(CopyCountingType const &value) override {
+        return CopyCountingType(value.Value * 3);
+    }
+};
+
+TEST_CASE("StandardTransformer - execute without copies") {
+    CopyCountingType const                  constInput(2);
+    CopyCountingType                        input(3);
+
+    CopyCountingType::NumCopies = 0;
+
+    SECTION("Callback") {
+        MyCallbackTransformer               transformer;
+
+        CHECK(transformer.execute(constInput).Value == 4);
+        CHECK(transformer.execute(input).Value == 6);
+        CHECK(input.Value == 3);
+
+        CHECK_THROWS_WITH(transformer.execute(CopyCountingType(-1)), "This method should only be used with Transformers that generate 1 output value for each input value");
+    }
+
+    SECTION("Direct") {
+        MyDirectTransformer                 transformer;
+
+        CHECK(transformer.execute(constInput).Value == 6);
+        CHECK(transformer.execute(input).Value == 9);
+        CHECK(input.Value == 3);
+    }
+
+    CHECK(CopyCountingType::NumCopies == 0);
+}
@@ -0,0 +1,195 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../FlatIndexMap.h"
+#include "../MemoryMappedFile.h"
+
+#include <cstdio>
+#include <fstream>
+
+namespace NS = Microsoft::Featurizer;
+
+template <typename T>
+void TestRoundtrip(std::unordered_map<T, std::uint32_t> const &map, std::vector<T> const &missing) {
+    NS::FlatIndexMap<T> const               flat(NS::FlatIndexMap<T>::Create(map));
+
+    CHECK(flat.size() == map.size());
+    CHECK(flat.empty() == map.empty());
+    CHECK(flat.Equals(map));
+    CHECK(flat.template ToMap<std::unordered_map<T, std::uint32_t>>() == map);
+
+    for(auto const &kvp : map) {
+        std::uint32_t                       value(0);
+
+        CHECK(flat.find(kvp.first, value));
+        CHECK(value == kvp.second);
+    }
+
+    for(auto const &key : missing) {
+        std::uint32_t                       value(0);
+
+        CHECK(flat.find(key, value) == false);
+    }
+}
+
+TEST_CASE("Empty") {
+    NS::FlatIndexMap<std::string> const     flat;
+    std::uint32_t                           value;
+
+    CHECK(flat.empty());
+    CHECK(flat.size() == 0);
+    CHECK(flat.find("one", value) == false);
+
+    TestRoundtrip<std::string>({}, {"one", ""});
+}
+
+TEST_CASE("string") {
+    std::unordered_map<std::string, std::uint32_t>              map;
+
+    for(std::uint32_t i = 0; i < 1000; ++i)
+        map.emplace(std::to_string(i), i * 2);
+
+    map.emplace("", 12345);
+
+    TestRoundtrip<std::string>(map, {"1000", "-1", "a"});
+
+    NS::FlatIndexMap<std::string> const     flat(NS::FlatIndexMap<std::string>::Create(map));
+    std::string const                       text("abc123def");
+    std::uint32_t                           value(0);
+
+    CHECK(flat.find(reinterpret_cast<unsigned char const *>(text.data()) + 3, 3, value));
+    CHECK(value == 246);
+}
+
+TEST_CASE("int") {
+    TestRoundtrip<std::int64_t>({{-1, 0}, {10, 1}, {20, 2}, {std::numeric_limits<std::int64_t>::min(), 3}}, {0, 1, 30});
+    TestRoundtrip<std::uint8_t>({{1, 10}, {2, 20}, {255, 30}}, {0, 3});
+    TestRoundtrip<bool>({{true, 1}}, {false});
+}
+
+TEST_CASE("float") {
+    std::unordered_map<double, std::uint32_t, std::hash<double>, NS::Traits<double>::key_equal>    map;
+
+    map.emplace(1.5, 0);
+    map.emplace(0.0, 1);
+    map.emplace(std::numeric_limits<double>::quiet_NaN(), 2);
+
+    NS::FlatIndexMap<double> const          flat(NS::FlatIndexMap<double>::Create(map));
+    std::uint32_t                           value(0);
+
+    CHECK(flat.Equals(map));
+
+    CHECK(flat.find(-0.0, value));
+    CHECK(value == 1);
+
+    CHECK(flat.find(-std::numeric_limits<double>::quiet_NaN(), value));
+    CHECK(value == 2);
+
+    CHECK(flat.find(2.5, value) == false);
+}
+
+TEST_CASE("Equality") {
+    NS::FlatIndexMap<std::string> const     flat1(NS::FlatIndexMap<std::string>::Create(std::unordered_map<std::string, std::uint32_t>{{"one", 1}, {"two", 2}}));
+    NS::FlatIndexMap<std::string> const     flat2(NS::FlatIndexMap<std::string>::Create(std::unordered_map<std::string, std::uint32_t>{{"two", 2}, {"one", 1}}));
+    NS::FlatIndexMap<std::string> const     flat3(NS::FlatIndexMap<std::string>::Create(std::unordered_map<std::string, std::uint32_t>{{"one", 1}, {"two", 3}}));
+
+    CHECK(flat1 == flat2);
+    CHECK((flat1 == flat3) == false);
+    CHECK((flat1 == NS::FlatIndexMap<std::string>()) == false);
+
+    CHECK(flat1.Equals(std::unordered_map<std::string, std::uint32_t>{{"one", 1}, {"two", 2}}));
+    CHECK(flat1.Equals(std::unordered_map<std::string, std::uint32_t>{{"one", 1}}) == false);
+}
+
+TEST_CASE("Little endian layout") {
+    NS::FlatIndexMap<std::int32_t>::ByteArray const             data(NS::FlatIndexMap<std::int32_t>::Create(std::unordered_map<std::int32_t, std::uint32_t>{{0x01020304, 7}}));
+
+    // Signature, Version, and NumItems
+    CHECK(NS::FlatIndexMap<std::int32_t>::ByteArray(data.begin(), data.begin() + 16) == NS::FlatIndexMap<std::int32_t>::ByteArray{'F', 'M', 'A', 'P', 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0});
+
+    // The only key (Size and Bytes) is at the end of the buffer
+    CHECK(NS::FlatIndexMap<std::int32_t>::ByteArray(data.end() - 8, data.end()) == NS::FlatIndexMap<std::int32_t>::ByteArray{4, 0, 0, 0, 4, 3, 2, 1});
+}
+
+TEST_CASE("Invalid data") {
+    NS::FlatIndexMap<std::string>::ByteArray                    data(NS::FlatIndexMap<std::string>::Create(std::unordered_map<std::string, std::uint32_t>{{"one", 1}}));
+
+    CHECK_THROWS_WITH(NS::FlatIndexMap<std::string>(nullptr, 10, nullptr), "pBuffer");
+    CHECK_THROWS_WITH(NS::FlatIndexMap<std::string>(data.data(), 10, nullptr), "Invalid flat index map");
+    CHECK_THROWS_WITH(NS::FlatIndexMap<std::string>(data.data(), data.size() - 1, nullptr), "Invalid flat index map");
+
+    data[0] = 0;
+    CHECK_THROWS_WITH(NS::FlatIndexMap<std::string>(std::move(data)), "Unsupported flat index map");
+}
+
+TEST_CASE("Archive") {
+    std::unordered_map<std::string, std::uint32_t> const        map{{"one", 1}, {"two", 2}, {"three", 3}};
+    NS::Archive                             out;
+
+    NS::FlatIndexMap<std::string>(NS::FlatIndexMap<std::string>::Create(map)).save(out);
+    out.serialize(static_cast<std::uint32_t>(10));
+
+    NS::Archive::ByteArray const            data(out.commit());
+
+    // Borrowed buffer (copied)
+    {
+        NS::Archive                         in(data.data(), data.size());
+        NS::FlatIndexMap<std::string> const flat(in);
+
+        CHECK(flat.Equals(map));
+        CHECK(in.deserialize<std::uint32_t>() == 10);
+        CHECK(in.AtEnd());
+    }
+
+    // Owned buffer (referenced in place)
+    {
+        NS::FlatIndexMap<std::string>       flat;
+
+        {
+            NS::Archive                     in(data);
+
+            flat = NS::FlatIndexMap<std::string>(in);
+            CHECK(in.deserialize<std::uint32_t>() == 10);
+        }
+
+        CHECK(flat.Equals(map));
+    }
+}
+
+TEST_CASE("MemoryMappedFile") {
+    std::string const                       filename("FlatIndexMap_UnitTest.bin");
+    std::unordered_map<std::string, std::uint32_t> const        map{{"one", 1}, {"two", 2}, {"three", 3}};
+
+    {
+        NS::Archive                         out;
+
+        NS::FlatIndexMap<std::string>(NS::FlatIndexMap<std::string>::Create(map)).save(out);
+
+        NS::Archive::ByteArray const        data(out.commit());
+        std::ofstream                       stream(filename, std::ios::binary);
+
+        stream.write(reinterpret_cast<char const *>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+    {
+        NS::FlatIndexMap<std::string>       flat;
+
+        {
+            NS::Archive                     in(NS::CreateMemoryMappedArchive(filename));
+
+            flat = NS::FlatIndexMap<std::string>(in);
+            CHECK(in.AtEnd());
+        }
+
+        // The mapping is kept alive by the map
+        CHECK(flat.Equals(map));
+    }
+
+    std::remove(filename.c_str());
+
+    CHECK_THROWS_WITH(NS::MemoryMappedFile("FlatIndexMap_UnitTest.does_not_exist"), "The file 'FlatIndexMap_UnitTest.does_not_exist' could not be opened");
+}
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../FunctionRef.h"
+#include "../Featurizer.h"
+
+#include <string>
+
+namespace NS = Microsoft::Featurizer;
+
+namespace {
+
+int Increment(int value) {
+    return value + 1;
+}
+
+struct MoveOnly {
+    std::string                             Value;
+
+    MoveOnly(std::string value) : Value(std::move(value)) {}
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MoveOnly);
+};
+
+} // anonymous namespace
+
+TEST_CASE("Default") {
+    NS::FunctionRef<void (int)>             func;
+
+    CHECK(static_cast<bool>(func) == false);
+    CHECK(static_cast<bool>(NS::FunctionRef<void (int)>(nullptr)) == false);
+}
+
+TEST_CASE("Lambda") {
+    int                                     total(0);
+    auto const                              lambda(
+        [&total](int value) {
+            total += value;
+        }
+    );
+
+    NS::FunctionRef<void (int)>             func(lambda);
+
+    CHECK(static_cast<bool>(func));
+
+    func(1);
+    func(2);
+    func(3);
+
+    CHECK(total == 6);
+}
+
+TEST_CASE("Function pointer") {
+    NS::FunctionRef<int (int)>              func(Increment);
+
+    CHECK(func(1) == 2);
+    CHECK(func(10) == 11);
+}
+
+TEST_CASE("Mutable state") {
+    struct Counter {
+        int                                 Count = 0;
+
+        void operator()(void) {
+            ++Count;
+        }
+    };
+
+    Counter                                 counter;
+    NS::FunctionRef<void (void)>            func(counter);
+
+    func();
+    func();
+
+    // The `FunctionRef` refers to the object rather than a copy
+    CHECK(counter.Count == 2);
+}
+
+TEST_CASE("Copy") {
+    int                                     total(0);
+    auto const                              lambda(
+        [&total](int value) {
+            total += value;
+        }
+    );
+
+    NS::FunctionRef<void (int)>             func1(lambda);
+    NS::FunctionRef<void (int)>             func2(func1);
+
+    func1(1);
+    func2(2);
+
+    CHECK(total == 3);
+}
+
+TEST_CASE("Move-only arguments") {
+    std::string                             result;
+    auto const                              lambda(
+        [&result](MoveOnly &&value) {
+            result = std::move(value.Value);
+        }
+    );
+
+    NS::FunctionRef<void (MoveOnly)>        func(lambda);
+
+    func(MoveOnly("Hello"));
+    CHECK(result == "Hello");
+
+    MoveOnly                                value("World");
+
+    func(std::move(value));
+    CHECK(result == "World");
+}
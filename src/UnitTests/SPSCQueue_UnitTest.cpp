@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../SPSCQueue.h"
+
+#include <chrono>
+#include <string>
+
+namespace NS = Microsoft::Featurizer;
+
+TEST_CASE("Construction") {
+    CHECK(NS::SPSCQueue<int>(3).capacity() == 3);
+    CHECK_THROWS_WITH(NS::SPSCQueue<int>(0), "capacity");
+}
+
+TEST_CASE("try_push/try_pop") {
+    NS::SPSCQueue<std::string>              queue(2);
+    std::string                             value;
+
+    CHECK(queue.try_pop(value) == false);
+
+    value = "one";
+    CHECK(queue.try_push(value));
+
+    value = "two";
+    CHECK(queue.try_push(value));
+
+    // The queue is full, so the value is not moved
+    value = "three";
+    CHECK(queue.try_push(value) == false);
+    CHECK(value == "three");
+
+    CHECK(queue.try_pop(value));
+    CHECK(value == "one");
+
+    value = "three";
+    CHECK(queue.try_push(value));
+
+    CHECK(queue.pop() == "two");
+    CHECK(queue.pop() == "three");
+    CHECK(queue.try_pop(value) == false);
+}
+
+TEST_CASE("Producer and consumer threads") {
+    NS::SPSCQueue<int>                      queue(4);
+    int const                               numItems(100000);
+    long long                               total(0);
+
+    std::thread                             consumer(
+        [&queue, &total](void) {
+            int                             expected(1);
+
+            while(true) {
+                int const                   value(queue.pop());
+
+                if(value == 0)
+                    break;
+
+                // Items are received in the order in which they were pushed
+                if(value != expected)
+                    return;
+
+                total += value;
+                ++expected;
+            }
+        }
+    );
+
+    for(int i = 1; i <= numItems; ++i)
+        queue.push(i);
+
+    queue.push(0);
+    consumer.join();
+
+    CHECK(total == static_cast<long long>(numItems) * (numItems + 1) / 2);
+}
+
+TEST_CASE("Blocking push and pop") {
+    NS::SPSCQueue<int>                      queue(1);
+    std::atomic<int>                        numPopped(0);
+
+    // The consumer is slower than the producer (so `push` blocks on a full queue), and then
+    // the producer is slower than the consumer (so `pop` blocks on an empty queue).
+    std::thread                             consumer(
+        [&queue, &numPopped](void) {
+            for(int i = 0; i < 3; ++i) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+                if(queue.pop() == i)
+                    ++numPopped;
+            }
+
+            for(int i = 3; i < 6; ++i) {
+                if(queue.pop() == i)
+                    ++numPopped;
+            }
+        }
+    );
+
+    for(int i = 0; i < 3; ++i)
+        queue.push(i);
+
+    for(int i = 3; i < 6; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.push(i);
+    }
+
+    consumer.join();
+
+    CHECK(numPopped == 6);
+}
@@ -0,0 +1,197 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../ThreadPool.h"
+
+#include <atomic>
+
+namespace NS = Microsoft::Featurizer;
+
+class MyStatelessTransformer : public NS::StandardTransformer<int, int> {
+public:
+    MyStatelessTransformer(void) = default;
+    ~MyStatelessTransformer(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MyStatelessTransformer);
+
+    void save(NS::Archive &) const override {
+        // Nothing to do here
+    }
+
+    bool is_stateless(void) const override {
+        return true;
+    }
+
+private:
+    void execute_impl(int const &input, CallbackFunction const &callback) override {
+        callback(input * 2);
+    }
+};
+
+class MyStatefulTransformer : public NS::StandardTransformer<int, int> {
+public:
+    MyStatefulTransformer(void) = default;
+    ~MyStatefulTransformer(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MyStatefulTransformer);
+
+    void save(NS::Archive &) const override {
+        // Nothing to do here
+    }
+
+    bool is_stateless(void) const override {
+        return false;
+    }
+
+private:
+    int                                     _total = 0;
+
+    void execute_impl(int const &input, CallbackFunction const &callback) override {
+        _total += input;
+        callback(_total);
+    }
+};
+
+TEST_CASE("Construction") {
+    CHECK(NS::ThreadPool(3).num_workers() == 3);
+    CHECK(NS::ThreadPool().num_workers() >= 1);
+}
+
+TEST_CASE("parallel_for") {
+    NS::ThreadPool                          pool(3);
+
+    for(size_t cItems : { 1, 2, 3, 4, 5, 17, 1000 }) {
+        std::vector<std::atomic<int>>       visited(cItems);
+        std::atomic<size_t>                 numRanges(0);
+
+        for(auto &value : visited)
+            value = 0;
+
+        pool.parallel_for(
+            cItems,
+            [&visited, &numRanges](size_t begin, size_t end) {
+                REQUIRE(begin < end);
+                ++numRanges;
+
+                while(begin != end)
+                    ++visited[begin++];
+            }
+        );
+
+        CHECK(numRanges == std::min<size_t>(cItems, 4));
+
+        for(auto const &value : visited)
+            CHECK(value == 1);
+    }
+}
+
+TEST_CASE("parallel_for - nested") {
+    NS::ThreadPool                          pool(2);
+    std::atomic<size_t>                     total(0);
+
+    // Every thread is waiting on a nested invocation at the same time; this would deadlock if
+    // waiting threads didn't process queued ranges.
+    pool.parallel_for(
+        3,
+        [&pool, &total](size_t begin, size_t end) {
+            while(begin++ != end) {
+                pool.parallel_for(
+                    100,
+                    [&total](size_t nestedBegin, size_t nestedEnd) {
+                        total += nestedEnd - nestedBegin;
+                    }
+                );
+            }
+        }
+    );
+
+    CHECK(total == 300);
+}
+
+TEST_CASE("GetSharedThreadPool") {
+    CHECK(&NS::GetSharedThreadPool() == &NS::GetSharedThreadPool());
+    CHECK(NS::GetSharedThreadPool().num_workers() >= 1);
+}
+
+TEST_CASE("parallel_for - no items") {
+    NS::ThreadPool                          pool(2);
+    bool                                    invoked(false);
+
+    pool.parallel_for(0, [&invoked](size_t, size_t) { invoked = true; });
+    CHECK(invoked == false);
+}
+
+TEST_CASE("parallel_for - errors") {
+    NS::ThreadPool                          pool(2);
+
+    CHECK_THROWS_WITH(pool.parallel_for(10, NS::ThreadPool::RangeFunction()), "func");
+
+    std::atomic<int>                        numInvocations(0);
+
+    CHECK_THROWS_WITH(
+        pool.parallel_for(
+            10,
+            [&numInvocations](size_t begin, size_t) {
+                ++numInvocations;
+
+                if(begin != 0)
+                    throw std::runtime_error("Worker error");
+            }
+        ),
+        "Worker error"
+    );
+
+    // All of the ranges are processed, even when one throws
+    CHECK(numInvocations == 3);
+
+    // The pool is still usable
+    std::atomic<int>                        total(0);
+
+    pool.parallel_for(10, [&total](size_t begin, size_t end) { total += static_cast<int>(end - begin); });
+    CHECK(total == 10);
+}
+
+TEST_CASE("ParallelExecute") {
+    NS::ThreadPool                          pool(3);
+    std::vector<int>                        inputs;
+
+    for(int i = 0; i < 100; ++i)
+        inputs.emplace_back(i);
+
+    std::vector<int>                        outputs(inputs.size(), 0);
+
+    SECTION("Stateless") {
+        MyStatelessTransformer              transformer;
+
+        CHECK(transformer.is_stateless());
+
+        NS::ParallelExecute(pool, transformer, inputs.data(), inputs.size(), outputs.data());
+
+        for(size_t i = 0; i < inputs.size(); ++i)
+            CHECK(outputs[i] == inputs[i] * 2);
+
+        CHECK_THROWS_WITH(NS::ParallelExecute(pool, transformer, static_cast<int const *>(nullptr), inputs.size(), outputs.data()), "pInputs");
+        CHECK_THROWS_WITH(NS::ParallelExecute(pool, transformer, inputs.data(), 0, outputs.data()), "cInputs");
+        CHECK_THROWS_WITH(NS::ParallelExecute(pool, transformer, inputs.data(), inputs.size(), static_cast<int *>(nullptr)), "pOutputs");
+    }
+
+    SECTION("Stateful") {
+        MyStatefulTransformer               transformer;
+
+        CHECK(transformer.is_stateless() == false);
+
+        NS::ParallelExecute(pool, transformer, inputs.data(), inputs.size(), outputs.data());
+
+        // The running total is only correct when the batch is executed in order on a single thread
+        int                                 total(0);
+
+        for(size_t i = 0; i < inputs.size(); ++i) {
+            total += inputs[i];
+            CHECK(outputs[i] == total);
+        }
+    }
+}
@@ -0,0 +1,290 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../TrainingDriver.h"
+#include "../Featurizers/MinMaxScalerFeaturizer.h"
+#include "../Featurizers/StandardScaleWrapperFeaturizer.h"
+#include "../Featurizers/TestHelpers.h"
+
+#include <cstdio>
+#include <fstream>
+
+namespace NS = Microsoft::Featurizer;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         MyEstimator
+///  \brief         Sums the items in each pass over the data. The first fit
+///                 of the first pass returns `FitResult::Reset` when requested.
+///
+class MyEstimator : public NS::FitEstimator<int> {
+public:
+    // ----------------------------------------------------------------------
+    // |  Public Data
+    std::vector<std::int64_t>               Sums;
+    std::vector<size_t>                     BatchSizes;
+
+    // ----------------------------------------------------------------------
+    // |  Public Methods
+    MyEstimator(size_t numPasses, bool reset=false, size_t maxNumItems=std::numeric_limits<size_t>::max()) :
+        NS::FitEstimator<int>("MyEstimator", NS::CreateTestAnnotationMapsPtr(1)),
+        _numPasses(numPasses),
+        _reset(reset),
+        _cRemainingItems(maxNumItems) {
+    }
+
+    ~MyEstimator(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MyEstimator);
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Data
+    size_t const                            _numPasses;
+    bool                                    _reset;
+    size_t                                  _cRemainingItems;
+
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    bool begin_training_impl(void) override {
+        Sums.emplace_back(0);
+        return true;
+    }
+
+    NS::FitResult fit_impl(int const *pItems, size_t cItems) override {
+        if(_reset) {
+            _reset = false;
+            return NS::FitResult::Reset;
+        }
+
+        BatchSizes.emplace_back(cItems);
+
+        cItems = std::min(cItems, _cRemainingItems);
+        _cRemainingItems -= cItems;
+
+        while(cItems--)
+            Sums.back() += *pItems++;
+
+        return _cRemainingItems ? NS::FitResult::Continue : NS::FitResult::Complete;
+    }
+
+    bool on_data_completed_impl(void) override {
+        if(Sums.size() == _numPasses)
+            return true;
+
+        Sums.emplace_back(0);
+        return false;
+    }
+
+    void complete_training_impl(void) override {
+    }
+};
+
+std::vector<int> CreateInputs(int numItems) {
+    std::vector<int>                        result;
+
+    result.reserve(static_cast<size_t>(numItems));
+
+    for(int i = 1; i <= numItems; ++i)
+        result.push_back(i);
+
+    return result;
+}
+
+NS::ChunkedReaderSource<int> CreateReaderSource(std::vector<int> const &inputs, size_t maxBufferSize, size_t &numRewinds) {
+    std::shared_ptr<size_t>                 pOffset(std::make_shared<size_t>(0));
+
+    return NS::ChunkedReaderSource<int>(
+        [&inputs, pOffset](int *pItems, size_t maxNumItems) {
+            size_t const                    cItems(std::min(maxNumItems, inputs.size() - *pOffset));
+
+            std::copy(inputs.begin() + static_cast<std::ptrdiff_t>(*pOffset), inputs.begin() + static_cast<std::ptrdiff_t>(*pOffset + cItems), pItems);
+            *pOffset += cItems;
+
+            return cItems;
+        },
+        [pOffset, &numRewinds](void) {
+            *pOffset = 0;
+            ++numRewinds;
+        },
+        maxBufferSize
+    );
+}
+
+TEST_CASE("ChunkedReaderSource") {
+    std::vector<int> const                  inputs(CreateInputs(1000));
+
+    SECTION("Single pass") {
+        size_t                              numRewinds(0);
+        NS::ChunkedReaderSource<int>        source(CreateReaderSource(inputs, 64, numRewinds));
+        MyEstimator                         estimator(1);
+
+        NS::TrainEstimator(estimator, source, 100);
+
+        CHECK(estimator.get_state() == NS::TrainingState::Completed);
+        CHECK(estimator.Sums == std::vector<std::int64_t>{500500});
+        CHECK(numRewinds == 1);
+
+        // Batches are limited by the buffer size
+        CHECK(*std::max_element(estimator.BatchSizes.begin(), estimator.BatchSizes.end()) == 64);
+    }
+
+    SECTION("Multiple passes") {
+        size_t                              numRewinds(0);
+        NS::ChunkedReaderSource<int>        source(CreateReaderSource(inputs, 1024, numRewinds));
+        MyEstimator                         estimator(3);
+
+        NS::TrainEstimator(estimator, source, 100);
+
+        CHECK(estimator.Sums == std::vector<std::int64_t>{500500, 500500, 500500});
+        CHECK(numRewinds == 3);
+        CHECK(*std::max_element(estimator.BatchSizes.begin(), estimator.BatchSizes.end()) == 100);
+    }
+
+    SECTION("Reset") {
+        size_t                              numRewinds(0);
+        NS::ChunkedReaderSource<int>        source(CreateReaderSource(inputs, 1024, numRewinds));
+        MyEstimator                         estimator(1, true);
+
+        NS::TrainEstimator(estimator, source, 100);
+
+        CHECK(estimator.Sums == std::vector<std::int64_t>{500500});
+        CHECK(numRewinds == 2);
+    }
+
+    SECTION("Complete") {
+        size_t                              numRewinds(0);
+        NS::ChunkedReaderSource<int>        source(CreateReaderSource(inputs, 1024, numRewinds));
+        MyEstimator                         estimator(3, false, 10);
+
+        NS::TrainEstimator(estimator, source, 100);
+
+        CHECK(estimator.Sums == std::vector<std::int64_t>{55});
+        CHECK(estimator.BatchSizes == std::vector<size_t>{100});
+    }
+
+    SECTION("Errors") {
+        size_t                              numRewinds(0);
+
+        CHECK_THROWS_WITH(NS::ChunkedReaderSource<int>(NS::ChunkedReaderSource<int>::ReadFunction(), [](void) {}), "readFunc");
+        CHECK_THROWS_WITH(NS::ChunkedReaderSource<int>([](int *, size_t) { return static_cast<size_t>(0); }, NS::ChunkedReaderSource<int>::RewindFunction()), "rewindFunc");
+        CHECK_THROWS_WITH(CreateReaderSource(inputs, 0, numRewinds), "maxBufferSize");
+
+        NS::ChunkedReaderSource<int>        source([](int *, size_t maxNumItems) { return maxNumItems + 1; }, [](void) {});
+        MyEstimator                         estimator(1);
+
+        CHECK_THROWS_WITH(NS::TrainEstimator(estimator, source, 0), "batchSize");
+        CHECK_THROWS_WITH(NS::TrainEstimator(estimator, source), "The reader returned more items than requested");
+    }
+
+    SECTION("No items") {
+        std::vector<int> const              emptyInputs;
+        size_t                              numRewinds(0);
+        NS::ChunkedReaderSource<int>        source(CreateReaderSource(emptyInputs, 1024, numRewinds));
+
+        // A single pass completes without any items...
+        MyEstimator                         singlePassEstimator(1);
+
+        NS::TrainEstimator(singlePassEstimator, source, 100);
+        CHECK(singlePassEstimator.get_state() == NS::TrainingState::Completed);
+
+        // ...but additional passes would never end
+        MyEstimator                         multiPassEstimator(3);
+
+        CHECK_THROWS_WITH(NS::TrainEstimator(multiPassEstimator, source, 100), "The source didn't provide any items, but the estimator requires another pass over the data");
+    }
+}
+
+TEST_CASE("Pipeline") {
+    // ----------------------------------------------------------------------
+    using StandardScaleWrapperEstimator     = NS::Featurizers::StandardScaleWrapperEstimator<int>;
+    using MinMaxScalerEstimator             = NS::Featurizers::MinMaxScalerEstimator<std::double_t, std::double_t>;
+    using Pipeline                          = NS::Featurizers::Components::PipelineExecutionEstimatorImpl<StandardScaleWrapperEstimator, MinMaxScalerEstimator>;
+    // ----------------------------------------------------------------------
+
+    // The MinMaxScalerEstimator is trained on the output of the trained
+    // StandardScaleWrapperEstimator, so the pipeline requires a pass over the
+    // data for each of them.
+    std::vector<int> const                  inputs{1, 3, 5, 7, 9};
+    size_t                                  numRewinds(0);
+    NS::ChunkedReaderSource<int>            source(CreateReaderSource(inputs, 2, numRewinds));
+    NS::AnnotationMapsPtr                   pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(2));
+    Pipeline                                estimator(
+        "Pipeline",
+        pAllColumnAnnotations,
+        [pAllColumnAnnotations](void) { return StandardScaleWrapperEstimator(pAllColumnAnnotations, 0, true, true); },
+        [pAllColumnAnnotations](void) { return MinMaxScalerEstimator(pAllColumnAnnotations, 1); }
+    );
+
+    NS::TrainEstimator(estimator, source, 2);
+
+    CHECK(estimator.get_state() == NS::TrainingState::Completed);
+    CHECK(numRewinds == 2);
+
+    auto                                    pTransformer(estimator.create_transformer());
+    std::vector<int> const                  transformInputs{1, 2, 5, 9};
+    std::vector<std::double_t>              outputs(transformInputs.size());
+
+    pTransformer->execute(transformInputs.data(), transformInputs.size(), outputs.data());
+
+    CHECK(
+        NS::TestHelpers::FuzzyCheck(
+            outputs,
+            std::vector<std::double_t>{0.0, 0.125, 0.5, 1.0}
+        )
+    );
+}
+
+TEST_CASE("MemoryMappedColumnSource") {
+    std::string const                       filename("TrainingDriver_UnitTest.bin");
+    std::vector<int> const                  inputs(CreateInputs(1000));
+
+    {
+        std::ofstream                       stream(filename, std::ios::binary);
+
+        stream.write(reinterpret_cast<char const *>(inputs.data()), static_cast<std::streamsize>(inputs.size() * sizeof(int)));
+    }
+
+    {
+        NS::MemoryMappedColumnSource<int>   source(filename);
+
+        CHECK(source.get_num_items() == 1000);
+
+        SECTION("Multiple passes") {
+            MyEstimator                     estimator(2, true);
+
+            NS::TrainEstimator(estimator, source, 300);
+
+            CHECK(estimator.Sums == std::vector<std::int64_t>{500500, 500500});
+            CHECK(estimator.BatchSizes == std::vector<size_t>{300, 300, 300, 100, 300, 300, 300, 100});
+        }
+
+        SECTION("Read") {
+            int const *                     pItems(nullptr);
+
+            CHECK(source.read(pItems, 600) == 600);
+            CHECK(pItems[0] == 1);
+            CHECK(source.read(pItems, 600) == 400);
+            CHECK(pItems[0] == 601);
+            CHECK(source.read(pItems, 600) == 0);
+            CHECK(pItems == nullptr);
+
+            source.rewind();
+            CHECK(source.read(pItems, 600) == 600);
+            CHECK(pItems[0] == 1);
+        }
+    }
+
+    {
+        std::ofstream                       stream(filename, std::ios::binary);
+
+        stream.write("abcde", 5);
+    }
+
+    CHECK_THROWS_WITH(NS::MemoryMappedColumnSource<int>(filename), "The size of the file 'TrainingDriver_UnitTest.bin' is not a multiple of the item size");
+
+    std::remove(filename.c_str());
+}
@@ -450,6 +450,9 @@ TEST_CASE("Serialization") {
     CHECK(SerializationTestImpl(std::vector<int>()));
     CHECK(SerializationTestImpl(std::vector<int>{1, 2, 3}));
     CHECK(SerializationTestImpl(std::vector<std::string>{"one", "two", "three"}));
+    CHECK(SerializationTestImpl(std::vector<bool>{true, false, true}));
+    CHECK(SerializationTestImpl(std::vector<double>{1.5, -2.25, 3.0}));
+    CHECK(SerializationTestImpl(std::vector<std::int8_t>{-1, 0, 1}));
 
     CHECK(SerializationTestImpl(std::map<int, std::string>()));
     CHECK(SerializationTestImpl(std::map<int, std::string>{ {10, "ten"}, {20, "twenty"} }));
@@ -468,6 +471,11 @@ TEST_CASE("Serialization") {
     matrix(0, 1) = 0.0f;
     CHECK(SerializationTestImpl(matrix));
 
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> rowMajorMatrix(2, 3);
+    rowMajorMatrix << 1.0, 2.0, 3.0,
+                      4.0, 5.0, 6.0;
+    CHECK(SerializationTestImpl(rowMajorMatrix));
+
     CHECK(SerializationTestImpl(nonstd::optional<int>()));
     CHECK(SerializationTestImpl(nonstd::optional<int>(23)));
     CHECK(SerializationTestImpl(nonstd::optional<std::string>("foo")));